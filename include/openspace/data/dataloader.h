@@ -26,6 +26,7 @@
 #define __OPENSPACE_CORE___DATALOADER___H__
 
 #include <openspace/data/datamapping.h>
+#include <openspace/util/boundingvolume.h>
 #include <ghoul/glm.h>
 #include <ghoul/misc/boolean.h>
 #include <ghoul/misc/csvreader.h>
@@ -71,6 +72,10 @@ struct Dataset {
     /// the dataset
     float maxPositionComponent = 0.f;
 
+    /// The bounding volume of all entry positions, in the units of the dataset. It is
+    /// computed once when the dataset is loaded and stored in the cache alongside it
+    BoundingVolume bounds;
+
     bool isEmpty() const;
 
     int index(std::string_view variableName) const;
@@ -0,0 +1,140 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___COMPILEDSPECIFICATION___H__
+#define __OPENSPACE_CORE___COMPILEDSPECIFICATION___H__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ghoul { class Dictionary; }
+
+namespace openspace::documentation {
+
+struct Documentation;
+struct DocumentationEntry;
+class Verifier;
+
+/**
+ * A Documentation that has been flattened into a linear list of checks. Nested
+ * TableVerifier%s are inlined into the same list, and the checks for the basic types
+ * (BoolVerifier, IntVerifier, DoubleVerifier, StringVerifier, and TableVerifier) are
+ * executed directly without going through the virtual Verifier interface. All other
+ * Verifier%s are called as usual.
+ *
+ * Running the compiled specification only answers the question whether a dictionary
+ * adheres to the Documentation, but does not collect any offenses. This means that it
+ * does not allocate any memory for dictionaries that pass, which is the common case. If
+ * the test fails, the full #testSpecification has to be run to get the reasons.
+ */
+class CompiledSpecification {
+public:
+    explicit CompiledSpecification(const Documentation& documentation);
+
+    /**
+     * Returns `true` if the \p dictionary adheres to the Documentation that this
+     * CompiledSpecification was created from.
+     */
+    bool test(const ghoul::Dictionary& dictionary) const;
+
+    /**
+     * Returns whether this CompiledSpecification was compiled from a Documentation with
+     * the same identifier and the same entries as the \p documentation, including the
+     * entries of nested tables and the parameters of the Verifier%s. The entries are
+     * compared by their hash.
+     */
+    bool matches(const Documentation& documentation) const;
+
+    /// Records the duration and result of one test of a dictionary
+    void recordTest(std::chrono::nanoseconds duration, bool success) const;
+
+    const std::string& identifier() const;
+    uint64_t nTests() const;
+    uint64_t nFailures() const;
+    std::chrono::nanoseconds totalTime() const;
+
+private:
+    struct Check {
+        enum class Kind : uint8_t {
+            Bool = 0,
+            Int,
+            Double,
+            String,
+            Table,
+            Verifier
+        };
+
+        std::string key;
+        /// The Verifier that is called for Kind::Verifier checks
+        std::shared_ptr<Verifier> verifier;
+        /// The number of checks following this one that belong to its nested table
+        uint32_t nNested = 0;
+        /// The number of entries that are required in a nested table
+        std::optional<int> count;
+        Kind kind = Kind::Verifier;
+        bool isOptional = false;
+        bool isWildcard = false;
+        bool mustBeNotEmpty = false;
+    };
+
+    void compile(const std::vector<DocumentationEntry>& entries);
+
+    bool test(const ghoul::Dictionary& dictionary, size_t begin, size_t end) const;
+    bool test(const ghoul::Dictionary& dictionary, size_t index,
+        std::string_view key) const;
+
+    std::string _identifier;
+    std::vector<Check> _checks;
+    // The hash of the Documentation that this CompiledSpecification was compiled from
+    size_t _hash = 0;
+
+    mutable std::atomic<uint64_t> _nTests = 0;
+    mutable std::atomic<uint64_t> _nFailures = 0;
+    mutable std::atomic<int64_t> _totalTime = 0;
+};
+
+/**
+ * Returns the CompiledSpecification for the \p documentation. The specifications are
+ * compiled the first time they are requested and are then cached based on the
+ * Documentation's identifier. This function returns `nullptr` if the \p documentation
+ * does not have an identifier, or if a different Documentation with the same identifier
+ * has been compiled before. This function is thread-safe.
+ */
+const CompiledSpecification* compiledSpecification(const Documentation& documentation);
+
+/**
+ * Logs how many dictionaries have been tested against each of the compiled
+ * specifications, how many of those failed, and how much time was spent testing them.
+ */
+void logSpecificationTimings();
+
+} // namespace openspace::documentation
+
+#endif // __OPENSPACE_CORE___COMPILEDSPECIFICATION___H__
@@ -76,6 +76,15 @@ public:
      */
     std::vector<Documentation> documentations() const;
 
+    /**
+     * Returns the registered Documentation with the provided \p identifier.
+     *
+     * \param identifier The identifier of the Documentation that should be returned
+     * \return The Documentation with the \p identifier or `nullptr` if no such
+     *         Documentation has been registered
+     */
+    const Documentation* documentation(std::string_view identifier) const;
+
     static void initialize();
     static void deinitialize();
     static bool isInitialized();
@@ -26,18 +26,29 @@
 #define __OPENSPACE_CORE___DOWNLOADMANAGER___H__
 
 #include <ghoul/misc/boolean.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <filesystem>
 #include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace ghoul::filesystem { class File; }
 
 namespace openspace {
 
-// Multithreaded
+// Multithreaded. All transfers are multiplexed on a single transfer thread that reuses
+// connections to the same host and limits the number of concurrent transfers. Requests
+// that exceed the limits are queued and started in the order of their priority.
+//
+// All callbacks are called one after another on the transfer thread, which runs with
+// the Idle priority. A slow callback therefore delays every other transfer, so they
+// should hand off expensive work to another thread
 class DownloadManager {
 public:
     struct FileFuture {
@@ -70,6 +81,21 @@ public:
     BooleanType(UseMultipleThreads);
     BooleanType(OverrideFile);
     BooleanType(FailOnError);
+    BooleanType(Resume);
+
+    /// Queued requests with a higher priority are started before those with a lower one
+    enum class Priority {
+        Low = 0,
+        Normal,
+        High
+    };
+
+    struct Limits {
+        /// The maximum number of transfers that are active at the same time
+        int maxTransfers = 16;
+        /// The maximum number of transfers to the same host that are active at a time
+        int maxTransfersPerHost = 4;
+    };
 
 
     using DownloadProgressCallback = std::function<void(const FileFuture&)>;
@@ -89,8 +115,14 @@ public:
         return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
     }
 
+    // If useMultipleThreads is false, every request is performed on the calling thread
+    // before the function returns
     explicit DownloadManager(
         UseMultipleThreads useMultipleThreads = UseMultipleThreads::Yes);
+    DownloadManager(UseMultipleThreads useMultipleThreads, Limits limits);
+
+    // Cancels all queued and active transfers and waits for the transfer thread
+    ~DownloadManager();
 
     //downloadFile
     // url - specifies the target of the download
@@ -100,22 +132,59 @@ public:
     // timeout_secs - timeout in seconds before giving up on download (0 = no timeout)
     // finishedCallback - callback when download finished (happens on different thread)
     // progressCallback - callback for status during (happens on different thread)
+    // priority - the priority of the request while it is waiting to be started
+    // resume - if true and the file exists, only the remainder of the file is requested
+    //          and appended to it. If the server does not support range requests, the
+    //          file is downloaded from the beginning instead
+    //
+    // The download can be cancelled at any time by setting abortDownload on the future
     std::shared_ptr<FileFuture> downloadFile(const std::string& url,
         const std::filesystem::path& file,
         OverrideFile overrideFile = OverrideFile::Yes,
         FailOnError failOnError = FailOnError::No, unsigned int timeout_secs = 0,
         DownloadFinishedCallback finishedCallback = DownloadFinishedCallback(),
-        DownloadProgressCallback progressCallback = DownloadProgressCallback()) const;
+        DownloadProgressCallback progressCallback = DownloadProgressCallback(),
+        Priority priority = Priority::Normal, Resume resume = Resume::No);
 
+    //fetchFile
+    // url - specifies the target of the download
+    // successCallback - callback when the file was downloaded (happens on the transfer
+    //                   thread)
+    // errorCallback - callback when the download failed (happens on the transfer thread)
+    // priority - the priority of the request while it is waiting to be started
+    //
+    // Unlike a future returned by std::async, the returned future does not wait for the
+    // download when it is destroyed. The callbacks may thus be called after the caller
+    // has returned and must not refer to any of its local variables
     std::future<MemoryFile> fetchFile(const std::string& url,
         SuccessCallback successCallback = SuccessCallback(),
-        ErrorCallback errorCallback = ErrorCallback());
+        ErrorCallback errorCallback = ErrorCallback(),
+        Priority priority = Priority::Normal);
 
     void fileExtension(const std::string& url,
-        RequestFinishedCallback finishedCallback = RequestFinishedCallback()) const;
+        RequestFinishedCallback finishedCallback = RequestFinishedCallback());
 
 private:
-    bool _useMultithreadedDownload;
+    struct Transfer;
+
+    // Queues the transfer for the transfer thread or performs it immediately if the
+    // DownloadManager does not use multiple threads
+    void enqueue(std::unique_ptr<Transfer> transfer);
+
+    // The main loop of the transfer thread
+    void transferLoop();
+
+    const bool _useMultithreadedDownload;
+    const Limits _limits;
+
+    std::mutex _queueMutex;
+    // Wakes up the transfer thread while it is waiting for new transfers
+    std::condition_variable _queueCondition;
+    std::vector<std::unique_ptr<Transfer>> _queue;
+    uint64_t _nextSequence = 0;
+
+    std::atomic_bool _isRunning = true;
+    std::thread _transferThread;
 };
 
 } // namespace openspace
@@ -28,6 +28,8 @@
 #include <openspace/util/tstring.h>
 #include <ghoul/misc/assert.h>
 #include <ghoul/misc/dictionary.h>
+#include <string_view>
+#include <variant>
 
 namespace openspace {
     namespace properties { class Property; }
@@ -53,9 +55,10 @@ struct Event {
     //     to see all events.
     //  4. Add a new case into the logAllEvents function that handles the new enum entry
     //  5. If the new event type has any parameters it takes in its constructor, go into
-    //     the `toParameter` function and add a case label for the new enum type and
-    //     return a dictionary with these parameters. This dictionary is passed to actions
-    //     if they are triggered by events
+    //     the `parameters` function and add a case label for the new enum type that
+    //     returns the names of these parameters and how to access them. The parameters
+    //     are passed to actions if they are triggered by events and can be used to
+    //     filter events
     //  6. Add the new enum entry into the `toString` and `fromString` methods
     enum class Type : uint8_t {
         ParallelConnection,
@@ -106,6 +109,29 @@ Event::Type fromString(std::string_view str);
 
 ghoul::Dictionary toParameter(const Event& e);
 
+/**
+ * The value of a single parameter of an event. Strings refer to memory owned by the event
+ * and are only valid for as long as the event itself is.
+ */
+using ParameterValue = std::variant<double, std::string_view>;
+
+/**
+ * A function that extracts a single parameter from an event without creating the full
+ * Dictionary returned by #toParameter.
+ */
+using ParameterAccessor = ParameterValue(*)(const Event& e);
+
+/**
+ * Returns the accessor for the parameter \p key of events of type \p type. The keys are
+ * the same as the ones in the Dictionary returned by #toParameter.
+ *
+ * \param type The type of event for which the accessor is requested
+ * \param key The name of the parameter
+ * \return The accessor for the parameter or `nullptr` if events of the provided \p type
+ *         do not have a parameter called \p key
+ */
+ParameterAccessor parameterAccessor(Event::Type type, std::string_view key);
+
 void logAllEvents(const Event* e);
 
 //
@@ -29,6 +29,7 @@
 #include <openspace/scripting/lualibrary.h>
 #include <ghoul/misc/memorypool.h>
 #include <unordered_map>
+#include <variant>
 
 namespace openspace {
 
@@ -36,7 +37,36 @@ namespace events { struct Event; }
 
 class EventEngine {
 public:
-    using ScriptCallback = std::function<void(ghoul::Dictionary)>;
+    /// The callback of a topic, which receives the parameters of all events that
+    /// occurred during a frame at once. Each parameter dictionary additionally contains
+    /// the name of the event type in the `Event` key
+    using TopicCallback = std::function<void(const std::vector<ghoul::Dictionary>&)>;
+
+    /**
+     * An event filter that has been compiled from the Dictionary passed to
+     * #registerEventAction into typed comparisons against the parameters of a single
+     * event type. This makes it possible to test events without converting them into a
+     * Dictionary first.
+     */
+    struct CompiledFilter {
+        struct Condition {
+            events::ParameterAccessor accessor = nullptr;
+            std::variant<double, std::string> value;
+        };
+
+        /**
+         * Returns whether the event \p e passes this filter, which is the case if all
+         * conditions are fulfilled.
+         */
+        bool matches(const events::Event& e) const;
+
+        std::vector<Condition> conditions;
+
+        /// This is `false` if the filter refers to a parameter that does not exist for
+        /// the event type or uses a value type that cannot be compared. In that case, no
+        /// event will ever pass the filter
+        bool isSatisfiable = true;
+    };
 
     struct ActionInfo {
         events::Event::Type type;
@@ -44,11 +74,12 @@ public:
         bool isEnabled = true;
         std::string action;
         std::optional<ghoul::Dictionary> filter;
+        CompiledFilter compiledFilter;
     };
 
     struct TopicInfo {
         uint32_t id = std::numeric_limits<uint32_t>::max();
-        ScriptCallback callback;
+        TopicCallback callback;
     };
 
     /**
@@ -99,10 +130,12 @@ public:
      *
      * \param topicId The id of the topic that will be triggered
      * \param type The type for which a new topic is registered
-     * \param callback The callback function that will be called on triggered event
+     * \param callback The callback function that will be called once per frame with all
+     *        events the topic is registered for. If a topic is registered for multiple
+     *        types, the same callback should be passed for each of them
     */
     void registerEventTopic(size_t topicId, events::Event::Type type,
-        ScriptCallback callback);
+        TopicCallback callback);
 
     /**
      * Removing registration for a type/action combination.
@@ -170,7 +203,7 @@ public:
 
     /**
      * Triggers all topics that are registered for events that are in the current event
-     * queue.
+     * queue. Each topic is called at most once with all of its events.
     */
     void triggerTopics() const;
 
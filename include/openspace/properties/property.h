@@ -337,7 +337,8 @@ public:
     /**
      * Sets a hint about the visibility of the Property. Each application accessing the
      * properties is free to ignore this hint. It is stored in the metaData Dictionary
-     * with the key: `Visibility`.
+     * with the key: `Visibility`. If the visibility of a Property that is part of the
+     * property tree changes, an EventPropertyTreeUpdated is published.
      *
      * \param visibility The new visibility of the Property
      */
@@ -441,6 +442,17 @@ public:
      */
     std::string generateJsonDescription() const;
 
+    /**
+     * Returns the part of the JSON description that does not change during the lifetime
+     * of this Property, which are the `Type` and `Name` keys and the user-facing
+     * `description`. The key-value pairs are separated by commas but not enclosed in
+     * braces, so that they can be spliced into a larger JSON object. The text is
+     * generated the first time this function is called and cached afterwards.
+     *
+     * \return The static key-value pairs of the JSON description of this Property
+     */
+    const std::string& staticJsonDescription() const;
+
     /**
      * Creates the information for the `MetaData` key-part of the JSON description for
      * the Property. The result can be included as one key-value pair in the description
@@ -519,6 +531,9 @@ private:
 
     OnChangeHandle _currentHandleValue = 0;
 
+    /// The cached result of #staticJsonDescription, empty until it is first requested
+    mutable std::string _staticJsonDescription;
+
 #ifdef _DEBUG
     // These identifiers can be used for debugging. Each Property is assigned one unique
     // identifier.
@@ -31,6 +31,7 @@
 #include <openspace/properties/scalar/boolproperty.h>
 #include <openspace/properties/scalar/intproperty.h>
 #include <openspace/properties/vector/vec4property.h>
+#include <openspace/util/completionindex.h>
 #include <openspace/util/keys.h>
 #include <ghoul/opengl/ghoul_gl.h>
 #include <ghoul/opengl/uniformcache.h>
@@ -64,6 +65,12 @@ private:
     void parallelConnectionChanged(const ParallelConnection::Status& status);
     void addToCommand(const std::string& c);
 
+    /**
+     * Returns the index of the URIs of all properties, rebuilding it first if the
+     * property tree has changed since the index was last built.
+     */
+    const CompletionIndex& propertyIndex();
+
     properties::BoolProperty _isVisible;
     properties::BoolProperty _shouldBeSynchronized;
     properties::BoolProperty _shouldSendToRemote;
@@ -84,8 +91,22 @@ private:
         int lastIndex;
         bool hasInitialValue;
         std::string initialValue;
+
+        // The parts of the command before and after the completed value. These are only
+        // used when completing a property URI inside of a string
+        bool isPropertyUri = false;
+        std::string prefix;
+        std::string suffix;
+
+        // If no entry starts with the initial value, the indices of the entries that
+        // match it fuzzily
+        bool isFuzzy = false;
+        std::vector<size_t> fuzzyMatches;
     } _autoCompleteInfo;
 
+    CompletionIndex _propertyIndex;
+    bool _isPropertyIndexDirty = true;
+
     float _currentHeight = 0.f;
     float _targetHeight = 0.f;
     float _fullHeight = 0.f;
@@ -61,6 +61,7 @@ class Scene;
 class SceneManager;
 class ScreenLog;
 class ScreenSpaceRenderable;
+class TextureCache;
 struct ShutdownInformation;
 
 class RenderEngine : public properties::PropertyOwner {
@@ -80,6 +81,8 @@ public:
 
     ghoul::opengl::OpenGLStateCache& openglStateCache();
 
+    TextureCache& textureCache();
+
     void updateShaderPrograms();
     void updateRenderer();
     void updateScreenSpaceRenderables();
@@ -177,6 +180,7 @@ private:
     ScreenLog* _log = nullptr;
 
     ghoul::opengl::OpenGLStateCache* _openglStateCache = nullptr;
+    std::unique_ptr<TextureCache> _textureCache;
 
     properties::BoolProperty _showOverlayOnClients;
     properties::BoolProperty _showLog;
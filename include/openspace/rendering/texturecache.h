@@ -0,0 +1,149 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___TEXTURECACHE___H__
+#define __OPENSPACE_CORE___TEXTURECACHE___H__
+
+#include <openspace/util/threadpool.h>
+#include <ghoul/glm.h>
+#include <ghoul/opengl/texture.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace openspace {
+
+/**
+ * Keeps track of the textures that are loaded from files on disk, so that files with the
+ * same content that are loaded with the same settings are only decoded and uploaded once,
+ * no matter how many components use them. Two-dimensional images are decoded on worker
+ * threads and the decoded pixels are stored in the cache folder, keyed by the hash of the
+ * file content, so that subsequent loads of the same file skip the decoding. The textures
+ * themselves require an OpenGL context and are created on the rendering thread.
+ */
+class TextureCache {
+public:
+    struct Settings {
+        int nDimensions = 2;
+        ghoul::opengl::Texture::FilterMode filterMode =
+            ghoul::opengl::Texture::FilterMode::LinearMipMap;
+        ghoul::opengl::Texture::WrappingMode wrappingMode =
+            ghoul::opengl::Texture::WrappingMode::Repeat;
+        bool shouldPurgeFromRAM = true;
+    };
+
+    /// An image that has been decoded on a worker thread, with the bottom row first
+    struct Image {
+        std::unique_ptr<std::byte[]> pixels;
+        glm::uvec2 resolution = glm::uvec2(0);
+        int nChannels = 0;
+    };
+
+    /// A texture that is shared between all components that load the same content
+    struct SharedTexture {
+        std::filesystem::path path;
+        int nDimensions = 2;
+
+        // The decoded image, which is `nullptr` if the file has to be decoded by the
+        // texture reader on the rendering thread instead
+        std::shared_future<std::shared_ptr<Image>> image;
+
+        std::unique_ptr<ghoul::opengl::Texture> texture;
+        bool isCreated = false;
+        bool isUploaded = false;
+    };
+
+    explicit TextureCache(size_t nThreads = 2);
+
+    /**
+     * Returns the texture for the file at \p path, which has to exist. If a texture with
+     * the same content and \p settings is already in use, that texture is returned.
+     * Otherwise the file is decoded in the background and #createTexture has to be called
+     * before the texture can be used.
+     */
+    std::shared_ptr<SharedTexture> load(const std::filesystem::path& path,
+        const Settings& settings);
+
+    /**
+     * Returns whether the image of \p texture has been decoded, which means that
+     * #createTexture does not block.
+     */
+    static bool isDecoded(const SharedTexture& texture);
+
+    /**
+     * Creates the texture of \p texture from the decoded image, waiting for the image if
+     * it has not been decoded yet. Afterwards, the `texture` is `nullptr` if the file
+     * could not be loaded. This function must be called from the rendering thread.
+     */
+    static void createTexture(SharedTexture& texture);
+
+private:
+    struct FileVersion {
+        std::filesystem::file_time_type lastWriteTime;
+        std::uintmax_t size = 0;
+        unsigned int hash = 0;
+    };
+
+    struct CachedTexture {
+        std::weak_ptr<SharedTexture> texture;
+
+        // The file from which the texture was loaded and its version at that time. Used
+        // to verify that a file with the same hash really has the same content
+        std::filesystem::path path;
+        std::filesystem::file_time_type lastWriteTime;
+        std::uintmax_t size = 0;
+    };
+
+    unsigned int contentHash(const std::filesystem::path& path);
+
+    // Returns whether the file at the provided path has the same content as the file
+    // from which the cached texture was loaded. The content is only compared if the
+    // hashes match, so a mismatch means that the hashes collided
+    static bool isSameContent(const CachedTexture& cached,
+        const std::filesystem::path& path);
+
+    // Protects the maps, as components might load their textures from multiple threads
+    std::mutex _mutex;
+
+    // The content hashes of the files that have been loaded, which are only recomputed
+    // if the size or the modification time of the file changes
+    std::unordered_map<std::string, FileVersion> _fileHashes;
+
+    // The textures that are currently in use, keyed by the content hash of their file
+    // and the settings with which they were loaded
+    std::unordered_map<std::string, CachedTexture> _textures;
+
+    // Images that have not been decoded when the cache is destroyed are loaded by the
+    // texture reader instead
+    ThreadPool _threadPool;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___TEXTURECACHE___H__
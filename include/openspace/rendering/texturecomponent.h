@@ -25,16 +25,28 @@
 #ifndef __OPENSPACE_CORE___TEXTURECOMPONENT___H__
 #define __OPENSPACE_CORE___TEXTURECOMPONENT___H__
 
+#include <openspace/rendering/texturecache.h>
+#include <ghoul/misc/boolean.h>
 #include <ghoul/opengl/texture.h>
 #include <filesystem>
+#include <memory>
 
 namespace ghoul::filesystem { class File; }
 namespace ghoul::opengl {class Texture; }
 
 namespace openspace {
 
+/**
+ * A texture that is loaded from a file on disk. Textures are shared through the
+ * TextureCache between all TextureComponents that load a file with the same content
+ * using the same settings, so that each file is only decoded and uploaded once, no matter
+ * how many renderables use it. The shared texture is released when the last component
+ * that uses it is destroyed or loads a different file.
+ */
 class TextureComponent {
 public:
+    BooleanType(WaitForTexture);
+
     // nDimensions must be 1, 2, 3
     explicit TextureComponent(int nDimensions);
 
@@ -49,16 +61,24 @@ public:
     void bind();
     void uploadToGpu();
 
-    // Loads a texture from a file on disk
-    void loadFromFile(const std::filesystem::path& path);
+    // Loads a texture from a file on disk or reuses a texture that was already loaded
+    // from a file with the same content. The file is decoded on a worker thread. If
+    // waitForTexture is `No`, the previous texture is kept until the new texture is
+    // available in the update function
+    void loadFromFile(const std::filesystem::path& path,
+        WaitForTexture waitForTexture = WaitForTexture::Yes);
 
     // Function to call in a renderable's update function to make sure
     // the texture is kept up to date
     void update();
 
 private:
+    void finishLoading(WaitForTexture waitForTexture);
+
     std::unique_ptr<ghoul::filesystem::File> _textureFile;
-    std::unique_ptr<ghoul::opengl::Texture> _texture;
+    std::shared_ptr<TextureCache::SharedTexture> _texture;
+    // The texture that is being decoded and replaces the current texture once available
+    std::shared_ptr<TextureCache::SharedTexture> _pendingTexture;
 
     ghoul::opengl::Texture::FilterMode _filterMode =
         ghoul::opengl::Texture::FilterMode::LinearMipMap;
@@ -28,8 +28,10 @@
 #include <ghoul/glm.h>
 #include <filesystem>
 #include <functional>
+#include <istream>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ghoul::filesystem { class File; }
 namespace ghoul::opengl { class Texture; }
@@ -75,6 +77,45 @@ struct MappingKey {
     glm::vec4 color = glm::vec4(0.f);
 };
 
+/**
+ * The parsed representation of a transfer function in the text format. The mapping keys
+ * are sorted by their position and cover the entire range between the lower and upper
+ * bounds, and the function is linearly interpolated between the keys.
+ */
+struct PiecewiseTransferFunction {
+    std::vector<MappingKey> keys;
+    float lower = 0.f;
+    float upper = 1.f;
+
+    /// The number of texels that was requested or 0 if it should be chosen adaptively
+    int width = 0;
+};
+
+/**
+ * Parses the text format of a transfer function from the \p stream. Each line consists
+ * of a key followed by its values, where the keys are `width`, `lower`, `upper`, and
+ * `mappingkey`, the latter being followed by a position and four color components in the
+ * range [0, 255].
+ */
+PiecewiseTransferFunction parseTransferFunction(std::istream& stream);
+
+/**
+ * Returns the smallest number of texels for which the linear interpolation between the
+ * texels of the baked transfer function \p tf differs by at most \p maxError from the
+ * exact value anywhere in the function. The result is a power of two that is clamped to
+ * the range [\p minWidth, \p maxWidth].
+ */
+int adaptiveTransferFunctionWidth(const PiecewiseTransferFunction& tf, float maxError,
+    int minWidth = 16, int maxWidth = 4096);
+
+/**
+ * Evaluates the transfer function \p tf at \p width evenly spaced texels, where the
+ * first texel corresponds to the position 0 and the last to the position 1. The result
+ * contains four premultiplied color values in the range [0, 1] per texel and texels
+ * outside the lower and upper bounds are 0.
+ */
+std::vector<float> bakeTransferFunction(const PiecewiseTransferFunction& tf, int width);
+
 } // namespace openspace
 
 #endif // __OPENSPACE_CORE___TRANSFERFUNCTION___H__
@@ -27,13 +27,18 @@
 
 #include <openspace/util/syncable.h>
 #include <openspace/scripting/lualibrary.h>
+#include <openspace/util/completionindex.h>
 #include <ghoul/lua/luastate.h>
 #include <ghoul/misc/boolean.h>
+#include <ghoul/misc/dictionary.h>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <functional>
+#include <unordered_map>
 
 namespace openspace { class SyncBuffer; }
 
@@ -58,6 +63,12 @@ public:
         /// The Lua script that should be executed
         std::string code;
 
+        /// Arguments that are made available to the script in the global `args` table.
+        /// The arguments are passed to the precompiled script rather than being spliced
+        /// into its source, so invocations with different arguments share the same
+        /// compiled chunk
+        ghoul::Dictionary arguments;
+
         /// Determines whether a script should be sent to computers that are in the same
         /// _cluster_ as the master machine that the user is interacting with. These are
         /// usually different computers that tile a bigger display area and that need to
@@ -79,8 +90,25 @@ public:
         Callback callback = Callback();
     };
 
+    /**
+     * Counters for the compilation and execution of scripts by the #runScript function.
+     */
+    struct Statistics {
+        /// The number of scripts that had to be compiled from source
+        uint64_t nCompilations = 0;
+        /// The number of scripts that were found in the cache of compiled scripts
+        uint64_t nCacheHits = 0;
+        /// The accumulated time spent compiling scripts
+        std::chrono::nanoseconds compileTime = std::chrono::nanoseconds(0);
+        /// The accumulated time spent executing scripts
+        std::chrono::nanoseconds executionTime = std::chrono::nanoseconds(0);
+    };
+
     static constexpr std::string_view OpenSpaceLibraryName = "openspace";
 
+    /// The maximum number of compiled scripts that are kept in the cache
+    static constexpr size_t MaxCompiledScripts = 256;
+
     explicit ScriptEngine(bool sandboxedLua = true);
 
     /**
@@ -120,6 +148,15 @@ public:
     std::vector<std::string> allLuaFunctions() const;
     const std::vector<LuaLibrary>& allLuaLibraries() const;
 
+    /**
+     * Returns a sorted index of the fully qualified names of all registered Lua
+     * functions that can be used for auto-completion. The index is rebuilt lazily
+     * whenever a library has been added since the last call.
+     */
+    const CompletionIndex& luaFunctionIndex();
+
+    const Statistics& statistics() const;
+
 private:
     BooleanType(Replace);
 
@@ -134,8 +171,20 @@ private:
 
     bool runScript(const Script& script);
 
+    /**
+     * Pushes the compiled function for the provided \p code onto the stack of the Lua
+     * state, compiling and caching it if it was not already present in the cache. If the
+     * cache is full, the least recently used entry is evicted. Returns `false` and leaves
+     * an error message on the stack if the \p code could not be compiled.
+     */
+    bool pushCompiledScript(const std::string& code);
+
+    void clearCompiledScripts();
+
     ghoul::lua::LuaState _state;
     std::vector<LuaLibrary> _registeredLibraries;
+    CompletionIndex _luaFunctionIndex;
+    bool _isLuaFunctionIndexDirty = true;
 
     std::queue<Script> _incomingScripts;
 
@@ -169,6 +218,18 @@ private:
     };
     std::vector<ScheduledScriptInfo> _scheduledScripts;
 
+    struct CompiledScript {
+        // The reference of the compiled function in the Lua registry
+        int reference = 0;
+
+        // The value of _compiledScriptsClock when this script was last used
+        uint64_t lastUse = 0;
+    };
+    std::unordered_map<std::string, CompiledScript> _compiledScripts;
+    uint64_t _compiledScriptsClock = 0;
+
+    Statistics _statistics;
+
     // Logging variables
     bool _logFileExists = false;
     bool _logScripts = true;
@@ -0,0 +1,123 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___ASYNCLOG___H__
+#define __OPENSPACE_CORE___ASYNCLOG___H__
+
+#include <ghoul/logging/log.h>
+
+#include <openspace/util/concurrentringbuffer.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace openspace {
+
+/**
+ * An implementation of the ghoul::logging::Log interface that forwards all messages to
+ * another Log on a separate writer thread. The messages are passed through a lock-free
+ * ring buffer with a fixed capacity, so that the threads that log messages neither wait
+ * for each other nor for the formatting and writing of the wrapped Log. If the buffer is
+ * full, messages are dropped and the number of dropped messages is reported once there
+ * is space again. Consecutive identical messages are only written once, followed by a
+ * message stating how often it was repeated.
+ *
+ * Messages with the `Fatal` log level are written before the #log call returns, so that
+ * they are not lost if the application terminates, and they are never dropped.
+ *
+ * The wrapped Log creates the time stamps of the messages when they are written, so
+ * they can be slightly later than the time when the messages were logged.
+ */
+class AsyncLog : public ghoul::logging::Log {
+public:
+    /// Just a shortcut for the LogLevel access
+    using LogLevel = ghoul::logging::LogLevel;
+
+    /**
+     * Creates an AsyncLog that writes the messages with at least the \p logLevel into
+     * the \p log. At most \p capacity messages can be waiting to be written at a time.
+     */
+    explicit AsyncLog(std::unique_ptr<ghoul::logging::Log> log,
+        LogLevel logLevel = LogLevel::AllLogging, size_t capacity = 4096);
+
+    /**
+     * Writes all remaining messages and stops the writer thread.
+     */
+    ~AsyncLog() override;
+
+    void log(LogLevel level, std::string_view category,
+        std::string_view message) override;
+
+    /**
+     * Blocks until all messages that were logged before this call have been passed to
+     * the wrapped Log.
+     */
+    void waitForPendingMessages();
+
+    /// Returns the number of messages that were dropped since the buffer was full
+    uint64_t nDroppedMessages() const;
+
+private:
+    struct Message {
+        LogLevel level = LogLevel::AllLogging;
+        std::string category;
+        std::string message;
+    };
+
+    void writeMessages();
+    // Writes all messages that are in the buffer and returns whether there were any
+    bool writeBufferedMessages();
+    void write(Message message);
+    void writeRepetitions();
+
+    std::unique_ptr<ghoul::logging::Log> _log;
+    const LogLevel _logLevel;
+    ConcurrentRingBuffer<Message> _buffer;
+
+    std::atomic<uint64_t> _nPushed = 0;
+    std::atomic<uint64_t> _nWritten = 0;
+    std::atomic<uint64_t> _nDropped = 0;
+
+    // Guards the wrapped Log and the state below, which are accessed by the writer
+    // thread and by threads that log `Fatal` messages
+    std::mutex _writeMutex;
+    Message _previous;
+    uint64_t _nRepetitions = 0;
+    uint64_t _nReportedDropped = 0;
+
+    std::atomic_bool _isRunning = true;
+    std::mutex _wakeMutex;
+    std::condition_variable _wakeCondition;
+    std::condition_variable _writtenCondition;
+    std::thread _writerThread;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___ASYNCLOG___H__
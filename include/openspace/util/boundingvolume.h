@@ -0,0 +1,116 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___BOUNDINGVOLUME___H__
+#define __OPENSPACE_CORE___BOUNDINGVOLUME___H__
+
+#include <ghoul/glm.h>
+#include <limits>
+#include <span>
+
+namespace openspace {
+
+/**
+ * The bounding volume of a set of positions. It consists of the axis-aligned bounding
+ * box, a bounding sphere centered on the middle of the box, and the radius of the
+ * smallest sphere around the origin that contains all positions. The latter is the
+ * value that is used for the bounding sphere of a Renderable, as those are always
+ * centered on the scene graph node that owns it.
+ */
+struct BoundingVolume {
+    glm::dvec3 minimum = glm::dvec3(std::numeric_limits<double>::max());
+    glm::dvec3 maximum = glm::dvec3(-std::numeric_limits<double>::max());
+
+    glm::dvec3 center = glm::dvec3(0.0);
+    double radius = 0.0;
+
+    double originRadius = 0.0;
+
+    /// Returns `true` if the bounding volume was computed from an empty set of points
+    bool isEmpty() const;
+};
+
+/**
+ * An oriented bounding box of a set of positions, where the axes are the principal
+ * components of the positions. The columns of #axes are orthonormal and sorted by
+ * decreasing variance of the positions along them.
+ */
+struct OrientedBox {
+    glm::dvec3 center = glm::dvec3(0.0);
+    glm::dmat3 axes = glm::dmat3(1.0);
+    glm::dvec3 halfExtents = glm::dvec3(0.0);
+};
+
+/**
+ * Computes the bounding volume of the \p nPoints positions returned by \p positionAt,
+ * which has to be callable as `glm::dvec3 positionAt(size_t index)` and must be safe to
+ * call concurrently. Large sets are split across \p nThreads threads; if \p nThreads is
+ * 0, the number of hardware threads is used.
+ *
+ * \param nPoints The number of positions
+ * \param positionAt The function returning the position with a specific index
+ * \param nThreads The maximum number of threads to use for the computation
+ * \return The bounding volume of all positions
+ */
+template <typename PositionFunc>
+BoundingVolume computeBoundingVolume(size_t nPoints, PositionFunc&& positionAt,
+    unsigned int nThreads = 0);
+
+BoundingVolume computeBoundingVolume(std::span<const glm::vec3> positions,
+    unsigned int nThreads = 0);
+BoundingVolume computeBoundingVolume(std::span<const glm::dvec3> positions,
+    unsigned int nThreads = 0);
+
+/**
+ * Computes the oriented bounding box of the \p positions from the eigenvectors of their
+ * covariance matrix. This box is tighter than the axis-aligned box for elongated or
+ * inclined distributions, such as orbits or galactic disks, but is more expensive to
+ * compute than the BoundingVolume.
+ *
+ * \param positions The positions for which to compute the oriented bounding box
+ * \param nThreads The maximum number of threads to use for the computation
+ * \return The oriented bounding box of all positions
+ */
+OrientedBox computeOrientedBox(std::span<const glm::vec3> positions,
+    unsigned int nThreads = 0);
+OrientedBox computeOrientedBox(std::span<const glm::dvec3> positions,
+    unsigned int nThreads = 0);
+
+/**
+ * Returns the radius of a sphere around the origin that contains the \p volume after it
+ * has been transformed by the affine \p transform. The returned radius is conservative
+ * and exact if the transform consists only of rotations and a uniform scaling.
+ *
+ * \param volume The bounding volume that is transformed
+ * \param transform The affine transformation that is applied to the volume
+ * \return The radius around the origin containing the transformed volume
+ */
+double transformedOriginRadius(const BoundingVolume& volume,
+    const glm::dmat4& transform);
+
+} // namespace openspace
+
+#include "boundingvolume.inl"
+
+#endif // __OPENSPACE_CORE___BOUNDINGVOLUME___H__
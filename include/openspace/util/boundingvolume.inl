@@ -0,0 +1,123 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace openspace {
+
+namespace detail {
+    // Below this number of points per thread, the overhead of starting a thread is
+    // larger than the time it saves
+    constexpr size_t MinPointsPerThread = 1 << 15;
+
+    inline unsigned int numberOfChunks(size_t nPoints, unsigned int nThreads) {
+        if (nThreads == 0) {
+            nThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        const size_t maxChunks = std::max<size_t>(nPoints / MinPointsPerThread, 1);
+        return static_cast<unsigned int>(std::min<size_t>(nThreads, maxChunks));
+    }
+
+    // Calls `func(chunk, begin, end)` for `nChunks` equally sized ranges covering
+    // [0, nPoints). The first chunk is processed on the calling thread
+    template <typename Func>
+    void forEachChunk(size_t nPoints, unsigned int nChunks, Func&& func) {
+        const size_t chunkSize = (nPoints + nChunks - 1) / nChunks;
+
+        std::vector<std::thread> threads;
+        threads.reserve(nChunks - 1);
+        for (unsigned int c = 1; c < nChunks; c++) {
+            const size_t begin = std::min(c * chunkSize, nPoints);
+            const size_t end = std::min(begin + chunkSize, nPoints);
+            threads.emplace_back([&func, c, begin, end]() { func(c, begin, end); });
+        }
+        func(0u, size_t(0), std::min(chunkSize, nPoints));
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+} // namespace detail
+
+template <typename PositionFunc>
+BoundingVolume computeBoundingVolume(size_t nPoints, PositionFunc&& positionAt,
+                                     unsigned int nThreads)
+{
+    BoundingVolume result;
+    if (nPoints == 0) {
+        return result;
+    }
+
+    const unsigned int nChunks = detail::numberOfChunks(nPoints, nThreads);
+
+    // The first pass computes the axis-aligned box and the (squared) distance of the
+    // farthest point from the origin
+    std::vector<BoundingVolume> partials = std::vector<BoundingVolume>(nChunks);
+    detail::forEachChunk(
+        nPoints,
+        nChunks,
+        [&partials, &positionAt](unsigned int chunk, size_t begin, size_t end) {
+            BoundingVolume& partial = partials[chunk];
+            for (size_t i = begin; i < end; i++) {
+                const glm::dvec3 p = positionAt(i);
+                partial.minimum = glm::min(partial.minimum, p);
+                partial.maximum = glm::max(partial.maximum, p);
+                partial.originRadius = std::max(partial.originRadius, glm::dot(p, p));
+            }
+        }
+    );
+
+    for (const BoundingVolume& partial : partials) {
+        result.minimum = glm::min(result.minimum, partial.minimum);
+        result.maximum = glm::max(result.maximum, partial.maximum);
+        result.originRadius = std::max(result.originRadius, partial.originRadius);
+    }
+    result.originRadius = std::sqrt(result.originRadius);
+    result.center = (result.minimum + result.maximum) * 0.5;
+
+    // The second pass computes the radius of the sphere around the center of the box.
+    // This is tighter than half the diagonal of the box for all non-box-like shapes
+    std::vector<double> radii = std::vector<double>(nChunks, 0.0);
+    const glm::dvec3 center = result.center;
+    detail::forEachChunk(
+        nPoints,
+        nChunks,
+        [&radii, &positionAt, center](unsigned int chunk, size_t begin, size_t end) {
+            double r = 0.0;
+            for (size_t i = begin; i < end; i++) {
+                const glm::dvec3 d = positionAt(i) - center;
+                r = std::max(r, glm::dot(d, d));
+            }
+            radii[chunk] = r;
+        }
+    );
+    result.radius = std::sqrt(*std::max_element(radii.begin(), radii.end()));
+
+    return result;
+}
+
+} // namespace openspace
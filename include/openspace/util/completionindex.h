@@ -0,0 +1,87 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___COMPLETIONINDEX___H__
+#define __OPENSPACE_CORE___COMPLETIONINDEX___H__
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A sorted, case-insensitive index of strings that is used for auto-completion. The
+ * entries are lowercased and sorted once when they are assigned, so that all entries
+ * that start with a specific prefix can be found using a binary search rather than
+ * having to compare every entry.
+ */
+class CompletionIndex {
+public:
+    CompletionIndex() = default;
+    explicit CompletionIndex(std::vector<std::string> entries);
+
+    /**
+     * Replaces the contents of this index with the \p entries. Duplicate entries are
+     * removed.
+     */
+    void assign(std::vector<std::string> entries);
+
+    /// Returns the number of entries in this index
+    size_t size() const;
+
+    /// Returns `true` if there are no entries in this index
+    bool empty() const;
+
+    /**
+     * Returns the entry at the \p index. The entries are sorted case-insensitively.
+     *
+     * \pre \p index must be smaller than size()
+     */
+    const std::string& operator[](size_t index) const;
+
+    /**
+     * Returns the half-open range of indices of all entries that start with the
+     * \p prefix, ignoring the case of both.
+     */
+    std::pair<size_t, size_t> prefixRange(std::string_view prefix) const;
+
+    /**
+     * Returns the indices of all entries that contain all of the characters of the
+     * \p pattern in the same order, but not necessarily consecutively, ignoring the case
+     * of both. The indices are returned in ascending order.
+     */
+    std::vector<size_t> fuzzyMatches(std::string_view pattern) const;
+
+private:
+    /// The entries as they were provided
+    std::vector<std::string> _entries;
+    /// The lowercased version of the entry at the same location, sorted
+    std::vector<std::string> _keys;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_CORE___COMPLETIONINDEX___H__
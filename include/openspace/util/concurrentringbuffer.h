@@ -0,0 +1,83 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_CORE___CONCURRENT_RING_BUFFER___H__
+#define __OPENSPACE_CORE___CONCURRENT_RING_BUFFER___H__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace openspace {
+
+/**
+ * Templated lock-free queue with a fixed capacity that can be used by any number of
+ * producer and consumer threads. Instead of blocking or allocating when the buffer is
+ * full, #push fails, which bounds the memory that is used by the buffer. The
+ * implementation follows Dmitry Vyukov's bounded MPMC queue, in which every cell carries
+ * a sequence number that tells producers and consumers whether it is available to them.
+ */
+template <typename T>
+class ConcurrentRingBuffer {
+public:
+    /**
+     * Creates a ring buffer that can hold at least \p capacity items. The capacity is
+     * rounded up to the next power of two.
+     */
+    explicit ConcurrentRingBuffer(size_t capacity);
+
+    /**
+     * Adds the \p item to the buffer. Returns `false` without modifying the \p item if
+     * the buffer is full.
+     */
+    bool push(T&& item);
+
+    /**
+     * Removes the oldest item from the buffer and moves it into \p item. Returns `false`
+     * if the buffer is empty.
+     */
+    bool pop(T& item);
+
+    /// Returns the number of items that the buffer can hold
+    size_t capacity() const;
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    const size_t _mask;
+    std::unique_ptr<Cell[]> _cells;
+
+    // The positions are on separate cache lines as they are written by different threads
+    alignas(64) std::atomic<size_t> _enqueuePosition = 0;
+    alignas(64) std::atomic<size_t> _dequeuePosition = 0;
+};
+
+} // namespace openspace
+
+#include "concurrentringbuffer.inl"
+
+#endif // __OPENSPACE_CORE___CONCURRENT_RING_BUFFER___H__
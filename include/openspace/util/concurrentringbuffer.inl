@@ -0,0 +1,116 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace openspace {
+
+template <typename T>
+ConcurrentRingBuffer<T>::ConcurrentRingBuffer(size_t capacity)
+    : _mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1)
+    , _cells(std::make_unique<Cell[]>(_mask + 1))
+{
+    for (size_t i = 0; i <= _mask; i++) {
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool ConcurrentRingBuffer<T>::push(T&& item) {
+    size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+        cell = &_cells[position & _mask];
+        const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const intptr_t diff =
+            static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+        if (diff == 0) {
+            // The cell is free, so we try to claim it
+            if (_enqueuePosition.compare_exchange_weak(
+                    position,
+                    position + 1,
+                    std::memory_order_relaxed
+                ))
+            {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            // The cell still contains an item from the previous round, the buffer is full
+            return false;
+        }
+        else {
+            // Another producer claimed the cell before us
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->data = std::move(item);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool ConcurrentRingBuffer<T>::pop(T& item) {
+    size_t position = _dequeuePosition.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+        cell = &_cells[position & _mask];
+        const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const intptr_t diff =
+            static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+        if (diff == 0) {
+            // The cell contains an item, so we try to claim it
+            if (_dequeuePosition.compare_exchange_weak(
+                    position,
+                    position + 1,
+                    std::memory_order_relaxed
+                ))
+            {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            // The cell has not been written yet, the buffer is empty
+            return false;
+        }
+        else {
+            // Another consumer claimed the cell before us
+            position = _dequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    item = std::move(cell->data);
+    cell->sequence.store(position + _mask + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+size_t ConcurrentRingBuffer<T>::capacity() const {
+    return _mask + 1;
+}
+
+} // namespace openspace
@@ -27,9 +27,10 @@
 
 #include <ghoul/logging/log.h>
 
+#include <openspace/util/concurrentringbuffer.h>
 #include <ghoul/misc/profiling.h>
+#include <atomic>
 #include <chrono>
-#include <mutex>
 #include <string_view>
 #include <vector>
 
@@ -40,6 +41,13 @@ namespace openspace {
  * can be used to present log messages in an on-screen GUI. For this, every incoming log
  * message (#log) is tagged with the current time and all stored log messages can expire
  * based on the time-to-live as specified in the constructor (#removeExpiredEntries).
+ *
+ * Incoming messages are placed in a lock-free buffer with a fixed capacity and are only
+ * moved into the list of entries by #addIncomingEntries or #removeExpiredEntries.
+ * Messages that arrive while the buffer is full are dropped, as are the oldest entries
+ * if there are too many of them. The number of dropped messages is available through
+ * #nDroppedEntries. An incoming message that is identical to the most recent entry is
+ * not stored again, but increases the number of repetitions of that entry instead.
  */
 class ScreenLog : public ghoul::logging::Log {
 public:
@@ -65,6 +73,9 @@ public:
 
         /// The actual message of the log entry
         std::string message;
+
+        /// The number of times the message was repeated after it arrived first
+        int nRepetitions = 0;
     };
 
     /**
@@ -97,8 +108,17 @@ public:
         std::string_view message) override;
 
     /**
-     * This method removes all the stored LogEntry%s that have expired, calculated by
-     * their `timeStamp` and the #_timeToLive value.
+     * This method moves all messages that have arrived since the last call into the list
+     * of LogEntry%s without removing any expired entries. This method, #entries, and
+     * #removeExpiredEntries must be called from the same thread.
+     */
+    void addIncomingEntries();
+
+    /**
+     * This method moves all messages that have arrived since the last call into the list
+     * of LogEntry%s and removes all the stored LogEntry%s that have expired, calculated
+     * by their `timeStamp` and the #_timeToLive value. This method and #entries must be
+     * called from the same thread.
      *
      * \post All entries retrieved by the #entries function have a `timeStamp` that is
      *       lower than the current time + #_timeToLive. The current time used is the time
@@ -113,6 +133,15 @@ public:
      */
     const std::vector<LogEntry>& entries() const;
 
+    /**
+     * Returns the number of messages that were dropped, either because they arrived
+     * while the buffer of incoming messages was full or because the maximum number of
+     * entries was exceeded.
+     *
+     * \return The number of dropped messages
+     */
+    size_t nDroppedEntries() const;
+
 private:
     /// The list of all LogEntry%s stored by this ScreenLog
     std::vector<LogEntry> _entries;
@@ -124,9 +153,13 @@ private:
     /// The minimum LogLevel of messages
     LogLevel _logLevel;
 
-    /// A mutex to ensure thread-safety since the logging and the removal of expired
-    /// entires can occur on different threads
-    mutable TracyLockable(std::mutex, _mutex);
+    /// The messages that have arrived but have not been added to the entries yet. The
+    /// buffer is used as logging and the removal of expired entries can occur on
+    /// different threads
+    ConcurrentRingBuffer<LogEntry> _incoming;
+
+    /// The number of messages that have been dropped
+    std::atomic<size_t> _nDroppedEntries = 0;
 };
 
 } // namespace openspace
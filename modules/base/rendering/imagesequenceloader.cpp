@@ -0,0 +1,365 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/base/rendering/imagesequenceloader.h>
+
+#include <ghoul/io/texture/texturereader.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/profiling.h>
+#include <ghoul/opengl/texture.h>
+#include <stb_image.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+namespace {
+    constexpr std::string_view _loggerCat = "ImageSequenceLoader";
+
+    // The number of prefetched images that are turned into textures per frame in
+    // addition to the active image
+    constexpr int TexturesPerFrame = 1;
+
+    // The window behind the active image is a quarter of the window size
+    constexpr int BehindFraction = 4;
+
+    // The weight with which a new step between active images contributes to the stride
+    constexpr double StrideSmoothing = 0.25;
+
+    ghoul::opengl::Texture::Format textureFormat(int nChannels) {
+        switch (nChannels) {
+            case 1:  return ghoul::opengl::Texture::Format::Red;
+            case 2:  return ghoul::opengl::Texture::Format::RG;
+            case 3:  return ghoul::opengl::Texture::Format::RGB;
+            default: return ghoul::opengl::Texture::Format::RGBA;
+        }
+    }
+} // namespace
+
+namespace openspace {
+
+ImageSequenceLoader::ImageSequenceLoader(std::vector<std::filesystem::path> files,
+                                         int capacity, size_t nThreads)
+    : _files(std::move(files))
+    , _capacity(std::max(capacity, 1))
+    , _threadPool(nThreads)
+{}
+
+ImageSequenceLoader::~ImageSequenceLoader() {
+    _threadPool.clearTasks();
+
+    const Statistics stats = statistics();
+    LDEBUG(std::format(
+        "Hits: {}, Misses: {}, Reads: {}, Discarded: {}",
+        stats.nHits, stats.nMisses, stats.nReads, stats.nDiscarded
+    ));
+}
+
+void ImageSequenceLoader::update(int activeIndex, WaitForActive waitForActive) {
+    ZoneScoped;
+
+    if (activeIndex < 0 || activeIndex >= static_cast<int>(_files.size())) {
+        _activeIndex = -1;
+        _texture = nullptr;
+        return;
+    }
+
+    if (activeIndex != _activeIndex) {
+        if (_activeIndex != -1) {
+            // Estimate the direction and the number of images by which the active image
+            // moves so that we prefetch the images that are going to be shown next. Large
+            // jumps are limited so that a single jump in time does not spread the window
+            const int step = activeIndex - _activeIndex;
+            _direction = step > 0 ? 1 : -1;
+            _stride = (1.0 - StrideSmoothing) * _stride +
+                      StrideSmoothing * std::min(std::abs(step), _capacity);
+        }
+        _activeIndex = activeIndex;
+        _isActiveCounted = false;
+        updateWindow();
+    }
+
+    if (waitForActive) {
+        waitForFile(_activeIndex);
+    }
+    createTextures();
+
+    bool isReady = false;
+    {
+        const std::lock_guard lock(_mutex);
+        const auto it = _entries.find(_activeIndex);
+        isReady = it != _entries.end() && it->second.state == Entry::State::Ready;
+        // If the image could not be loaded, we keep showing the previous image
+        if (isReady && it->second.texture) {
+            _texture = it->second.texture.get();
+            _displayedIndex = _activeIndex;
+        }
+    }
+
+    if (!_isActiveCounted) {
+        // Whether the active image was available is only counted in the first frame in
+        // which it became active
+        if (isReady) {
+            _statistics.nHits++;
+        }
+        else {
+            _statistics.nMisses++;
+        }
+        _isActiveCounted = true;
+    }
+}
+
+ghoul::opengl::Texture* ImageSequenceLoader::texture() const {
+    return _texture;
+}
+
+void ImageSequenceLoader::clear() {
+    _threadPool.clearTasks();
+
+    const std::lock_guard lock(_mutex);
+    _entries.clear();
+    _window.clear();
+    _activeIndex = -1;
+    _displayedIndex = -1;
+    _texture = nullptr;
+}
+
+ImageSequenceLoader::Statistics ImageSequenceLoader::statistics() const {
+    const std::lock_guard lock(_mutex);
+    return _statistics;
+}
+
+void ImageSequenceLoader::updateWindow() {
+    ZoneScoped;
+
+    const int nFiles = static_cast<int>(_files.size());
+    const int stride = std::max(static_cast<int>(std::round(_stride)), 1);
+    const int nBehind = _capacity / BehindFraction;
+    const int nAhead = _capacity - nBehind - 1;
+
+    _window.clear();
+    _window.push_back(_activeIndex);
+    for (int i = 1; i <= nAhead; i++) {
+        const int index = _activeIndex + _direction * stride * i;
+        if (index < 0 || index >= nFiles) {
+            break;
+        }
+        _window.push_back(index);
+    }
+    for (int i = 1; i <= nBehind; i++) {
+        const int index = _activeIndex - _direction * stride * i;
+        if (index < 0 || index >= nFiles) {
+            break;
+        }
+        _window.push_back(index);
+    }
+
+    // The queued reads are replaced by the reads for the new window in order of their
+    // priority. Reads that are already in progress for images that are no longer in the
+    // window will be discarded by the worker thread
+    _threadPool.clearTasks();
+
+    std::vector<std::unique_ptr<ghoul::opengl::Texture>> removed;
+    const std::lock_guard lock(_mutex);
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        const bool isInWindow =
+            std::find(_window.begin(), _window.end(), it->first) != _window.end();
+        // We keep the currently displayed image until the active image is available
+        if (isInWindow || it->first == _displayedIndex) {
+            it++;
+            continue;
+        }
+
+        if (it->second.state != Entry::State::Ready) {
+            _statistics.nDiscarded++;
+        }
+        removed.push_back(std::move(it->second.texture));
+        it = _entries.erase(it);
+    }
+
+    for (int index : _window) {
+        const Entry& entry = _entries[index];
+        if (entry.state == Entry::State::Queued) {
+            _threadPool.enqueue([this, index]() { readFile(index); });
+        }
+    }
+}
+
+void ImageSequenceLoader::createTextures() {
+    ZoneScoped;
+
+    int nCreated = 0;
+    for (int index : _window) {
+        if (index != _activeIndex && nCreated >= TexturesPerFrame) {
+            break;
+        }
+
+        std::vector<unsigned char> pixels;
+        glm::uvec2 resolution = glm::uvec2(0);
+        int nChannels = 0;
+        std::vector<char> data;
+        {
+            const std::lock_guard lock(_mutex);
+            Entry& entry = _entries[index];
+            if (entry.state != Entry::State::Read) {
+                continue;
+            }
+            pixels = std::move(entry.pixels);
+            resolution = entry.resolution;
+            nChannels = entry.nChannels;
+            data = std::move(entry.data);
+        }
+
+        std::unique_ptr<ghoul::opengl::Texture> texture;
+        if (!pixels.empty()) {
+            const ghoul::opengl::Texture::Format format = textureFormat(nChannels);
+            texture = std::make_unique<ghoul::opengl::Texture>(
+                pixels.data(),
+                glm::uvec3(resolution, 1),
+                GL_TEXTURE_2D,
+                format,
+                static_cast<GLenum>(format),
+                GL_UNSIGNED_BYTE
+            );
+            texture->setDataOwnership(ghoul::opengl::Texture::TakeOwnership::No);
+        }
+        else if (!data.empty()) {
+            // The image could not be decoded on the worker thread, so we let the texture
+            // reader try the formats that it supports in addition to the ones of stb
+            std::string format = _files[index].extension().string();
+            if (!format.empty()) {
+                // Remove the leading '.' from the extension
+                format = format.substr(1);
+            }
+
+            try {
+                texture = ghoul::io::TextureReader::ref().loadTexture(
+                    data.data(),
+                    data.size(),
+                    2,
+                    format
+                );
+            }
+            catch (const ghoul::io::TextureReader::InvalidLoadException& e) {
+                LERRORC(e.component, e.message);
+            }
+        }
+        if (texture) {
+            texture->setInternalFormat(GL_COMPRESSED_RGBA);
+            texture->uploadTexture();
+            texture->setFilter(ghoul::opengl::Texture::FilterMode::Linear);
+            texture->purgeFromRAM();
+        }
+
+        // Only the rendering thread removes entries, so the entry still exists
+        const std::lock_guard lock(_mutex);
+        Entry& entry = _entries[index];
+        entry.texture = std::move(texture);
+        entry.state = Entry::State::Ready;
+        if (index != _activeIndex) {
+            nCreated++;
+        }
+    }
+}
+
+void ImageSequenceLoader::readFile(int index) {
+    ZoneScoped;
+
+    {
+        const std::lock_guard lock(_mutex);
+        const auto it = _entries.find(index);
+        if (it == _entries.end() || it->second.state != Entry::State::Queued) {
+            // The image has been removed or is already read by another thread
+            return;
+        }
+        it->second.state = Entry::State::Reading;
+    }
+
+    const std::filesystem::path& path = _files[index];
+    std::vector<char> data;
+    std::ifstream file = std::ifstream(path, std::ifstream::binary);
+    if (file.good()) {
+        data.resize(std::filesystem::file_size(path));
+        file.read(data.data(), data.size());
+        if (!file.good()) {
+            data.clear();
+        }
+    }
+    if (data.empty()) {
+        LERROR(std::format("Could not read image '{}'", path));
+    }
+
+    std::vector<unsigned char> pixels;
+    int width = 0;
+    int height = 0;
+    int nChannels = 0;
+    if (!data.empty()) {
+        // The flag only applies to this thread. OpenGL expects the bottom row first
+        stbi_set_flip_vertically_on_load_thread(1);
+        stbi_uc* image = stbi_load_from_memory(
+            reinterpret_cast<const stbi_uc*>(data.data()),
+            static_cast<int>(data.size()),
+            &width,
+            &height,
+            &nChannels,
+            0
+        );
+        if (image) {
+            pixels.assign(image, image + static_cast<size_t>(width) * height * nChannels);
+            stbi_image_free(image);
+            data.clear();
+        }
+    }
+
+    {
+        const std::lock_guard lock(_mutex);
+        const auto it = _entries.find(index);
+        if (it != _entries.end() && it->second.state == Entry::State::Reading) {
+            it->second.pixels = std::move(pixels);
+            it->second.resolution = glm::uvec2(width, height);
+            it->second.nChannels = nChannels;
+            it->second.data = std::move(data);
+            it->second.state = Entry::State::Read;
+            _statistics.nReads++;
+        }
+        // Otherwise the image has been removed from the window while it was being read
+    }
+    _readCondition.notify_all();
+}
+
+void ImageSequenceLoader::waitForFile(int index) {
+    ZoneScoped;
+
+    // Reads the file on this thread unless a worker thread has already started reading
+    // it, in which case we wait for the worker thread to finish
+    readFile(index);
+
+    std::unique_lock lock(_mutex);
+    _readCondition.wait(lock, [this, index]() {
+        const auto it = _entries.find(index);
+        return it == _entries.end() || it->second.state != Entry::State::Reading;
+    });
+}
+
+} // namespace openspace
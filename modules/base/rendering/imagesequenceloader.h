@@ -0,0 +1,153 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_BASE___IMAGESEQUENCELOADER___H__
+#define __OPENSPACE_MODULE_BASE___IMAGESEQUENCELOADER___H__
+
+#include <openspace/util/threadpool.h>
+#include <ghoul/glm.h>
+#include <ghoul/misc/boolean.h>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ghoul::opengl { class Texture; }
+
+namespace openspace {
+
+/**
+ * Provides the textures for a sequence of images of which only one is active at any
+ * given time. Rather than loading all images upfront, only a bounded window of images
+ * around the active image is kept in memory. The window extends further in the
+ * direction in which the active image is moving and, if the active image is advancing by
+ * more than one image at a time, only contains the images that are likely to be shown.
+ *
+ * The files in the window are read from disk and decoded on worker threads. Since the
+ * textures require an OpenGL context, the decoded images are uploaded on the rendering
+ * thread in the #update function, which uploads the active image and a limited number of
+ * prefetched images per call.
+ */
+class ImageSequenceLoader {
+public:
+    BooleanType(WaitForActive);
+
+    struct Statistics {
+        /// The number of times the active image was available when it was requested
+        uint64_t nHits = 0;
+        /// The number of times the active image was not available when requested
+        uint64_t nMisses = 0;
+        /// The number of files that were read from disk
+        uint64_t nReads = 0;
+        /// The number of images that were removed before they were turned into textures
+        uint64_t nDiscarded = 0;
+    };
+
+    /**
+     * Creates a loader for the images in \p files. At most \p capacity images are kept
+     * in memory at the same time and the files are read using \p nThreads worker
+     * threads.
+     */
+    explicit ImageSequenceLoader(std::vector<std::filesystem::path> files,
+        int capacity = 16, size_t nThreads = 2);
+    ~ImageSequenceLoader();
+
+    /**
+     * Sets the image at \p activeIndex as the active image, updates the window of
+     * prefetched images and creates the textures for images that have been decoded. A
+     * value of -1 means that no image is active. If \p waitForActive is `Yes`, this
+     * function blocks until the texture for the active image has been created. This
+     * function must be called from the rendering thread.
+     */
+    void update(int activeIndex, WaitForActive waitForActive = WaitForActive::No);
+
+    /**
+     * Returns the texture of the active image. If it has not been loaded yet or could
+     * not be loaded, the texture of the previously shown image is returned instead.
+     * Returns `nullptr` if no image is active or none has been loaded yet.
+     */
+    ghoul::opengl::Texture* texture() const;
+
+    /**
+     * Removes all images that are currently kept in memory. This function must be called
+     * from the rendering thread.
+     */
+    void clear();
+
+    Statistics statistics() const;
+
+private:
+    struct Entry {
+        enum class State {
+            Queued,
+            Reading,
+            Read,
+            Ready
+        };
+        State state = State::Queued;
+        // The decoded image with the bottom row first
+        std::vector<unsigned char> pixels;
+        glm::uvec2 resolution = glm::uvec2(0);
+        int nChannels = 0;
+        // The content of the file if the image could not be decoded on the worker thread
+        std::vector<char> data;
+        std::unique_ptr<ghoul::opengl::Texture> texture;
+    };
+
+    void updateWindow();
+    void createTextures();
+    void readFile(int index);
+    void waitForFile(int index);
+
+    const std::vector<std::filesystem::path> _files;
+    const int _capacity;
+
+    int _activeIndex = -1;
+    int _displayedIndex = -1;
+    int _direction = 1;
+    double _stride = 1.0;
+    bool _isActiveCounted = false;
+
+    // The indices of images that should be kept in memory, ordered by their priority
+    std::vector<int> _window;
+    ghoul::opengl::Texture* _texture = nullptr;
+
+    // The entries are accessed by the worker threads, which only change the state and
+    // data of the entry for the file they are reading
+    mutable std::mutex _mutex;
+    std::condition_variable _readCondition;
+    std::unordered_map<int, Entry> _entries;
+    Statistics _statistics;
+
+    // Declared last so that the worker threads are stopped before anything else is
+    // destroyed
+    ThreadPool _threadPool;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_BASE___IMAGESEQUENCELOADER___H__
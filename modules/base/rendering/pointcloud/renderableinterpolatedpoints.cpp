@@ -384,8 +384,7 @@ bool RenderableInterpolatedPoints::useSplineInterpolation() const {
 }
 
 void RenderableInterpolatedPoints::addPositionDataForPoint(unsigned int index,
-                                                           std::vector<float>& result,
-                                                           double& maxRadius) const
+                                                        std::vector<float>& result) const
 {
     using namespace dataloader;
     auto [firstIndex, secondIndex] = interpolationIndices(index);
@@ -396,9 +395,6 @@ void RenderableInterpolatedPoints::addPositionDataForPoint(unsigned int index,
     glm::dvec3 position0 = transformedPosition(e0);
     glm::dvec3 position1 = transformedPosition(e1);
 
-    const double r = glm::max(glm::length(position0), glm::length(position1));
-    maxRadius = glm::max(maxRadius, r);
-
     for (int j = 0; j < 3; ++j) {
         result.push_back(static_cast<float>(position0[j]));
     }
@@ -66,11 +66,9 @@ protected:
      * 2-4 positions, depending on if spline interpolation is used or not.
      *
      * The values are computed based on the current interpolation value.
-     *
-     * Also, compute the maxRadius to use for setting the bounding sphere.
      */
-    void addPositionDataForPoint(unsigned int index, std::vector<float>& result,
-        double& maxRadius) const override;
+    void addPositionDataForPoint(unsigned int index,
+        std::vector<float>& result) const override;
 
     /**
      * Create the rendering data for the color and size data for the point with the given
@@ -33,7 +33,6 @@
 #include <ghoul/filesystem/file.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/glm.h>
-#include <ghoul/io/texture/texturereader.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/crc32.h>
 #include <ghoul/misc/templatefactory.h>
@@ -49,6 +48,7 @@
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <locale>
@@ -955,6 +955,7 @@ void RenderablePointCloud::initializeMultiTextures() {
 
 void RenderablePointCloud::clearTextureDataStructures() {
     _textures.clear();
+    _convertedTextures.clear();
     _textureNameToIndex.clear();
     _indexInDataToTextureIndex.clear();
     _textureMapByFormat.clear();
@@ -980,23 +981,47 @@ void RenderablePointCloud::loadTexture(const std::filesystem::path& path, int in
         return;
     }
 
-    std::unique_ptr<ghoul::opengl::Texture> t =
-        ghoul::io::TextureReader::ref().loadTexture(path, 2);
+    using Texture = ghoul::opengl::Texture;
 
-    bool useAlpha = (t->numberOfChannels() > 3) && _texture.useAlphaChannel;
+    auto component = std::make_unique<TextureComponent>(2);
+    component->setFilterMode(Texture::FilterMode::Linear);
+    component->setWrapping(Texture::WrappingMode::ClampToEdge);
+    component->setShouldWatchFileForChanges(false);
+    // Do not upload the loaded texture to the GPU, we just want it to hold the data
+    component->setShouldPurgeFromRAM(false);
+    component->loadFromFile(path);
 
-    if (t) {
-        LINFOC("RenderablePlanesCloud", std::format("Loaded texture {}", path));
-        // Do not upload the loaded texture to the GPU, we just want it to hold the data.
-        // However, convert textures make sure they all use the same format
-        ghoul::opengl::Texture::Format targetFormat = glFormat(useAlpha);
-        convertTextureFormat(*t, targetFormat);
-    }
-    else {
+    const Texture* t = component->texture();
+    if (!t) {
         throw ghoul::RuntimeError(std::format(
             "Could not find image file {}", path
         ));
     }
+    LINFOC("RenderablePlanesCloud", std::format("Loaded texture {}", path));
+
+    const bool useAlpha = (t->numberOfChannels() > 3) && _texture.useAlphaChannel;
+    const Texture::Format f = t->format();
+    const bool isColor = f == Texture::Format::RGB || f == Texture::Format::RGBA ||
+                         f == Texture::Format::BGR || f == Texture::Format::BGRA;
+    if (!isColor) {
+        // OpenGL converts between the color formats when filling the texture arrays, but
+        // other formats have to be converted here. The shared texture must not change,
+        // so the conversion is done on a copy of its pixels rather than decoding the
+        // file again
+        const size_t size = t->expectedPixelDataSize();
+        std::unique_ptr<std::byte[]> pixels = std::make_unique<std::byte[]>(size);
+        std::memcpy(pixels.get(), t->pixelData(), size);
+        auto converted = std::make_unique<Texture>(
+            pixels.release(),
+            t->dimensions(),
+            t->type(),
+            t->format(),
+            t->internalFormat(),
+            t->dataType()
+        );
+        convertTextureFormat(*converted, glFormat(useAlpha));
+        _convertedTextures[_textures.size()] = std::move(converted);
+    }
 
     TextureFormat format = {
         .resolution = glm::uvec2(t->width(), t->height()),
@@ -1004,7 +1029,7 @@ void RenderablePointCloud::loadTexture(const std::filesystem::path& path, int in
     };
 
     size_t indexInTextureArray = _textures.size();
-    _textures.push_back(std::move(t));
+    _textures.push_back(std::move(component));
     _textureNameToIndex[filename] = indexInTextureArray;
     _textureMapByFormat[format].push_back(indexInTextureArray);
     _indexInDataToTextureIndex[index] = indexInTextureArray;
@@ -1053,10 +1078,12 @@ void RenderablePointCloud::fillAndUploadTextureLayer(unsigned int arrayIndex,
                                                      unsigned int layer,
                                                      size_t textureIndex,
                                                      glm::uvec2 resolution,
-                                                     bool useAlpha,
+                                         ghoul::opengl::Texture::Format pixelFormat,
+                                                     gl::GLenum dataType,
                                                      const void* pixelData)
 {
-    gl::GLenum format = gl::GLenum(glFormat(useAlpha));
+    // OpenGL converts the pixel data to the format of the texture array if they differ
+    gl::GLenum format = gl::GLenum(pixelFormat);
 
     glTexSubImage3D(
         GL_TEXTURE_2D_ARRAY,
@@ -1068,7 +1095,7 @@ void RenderablePointCloud::fillAndUploadTextureLayer(unsigned int arrayIndex,
         gl::GLsizei(resolution.y), // height
         1, // depth
         format,
-        GL_UNSIGNED_BYTE, // type
+        dataType, // type
         pixelData
     );
 
@@ -1099,20 +1126,26 @@ void RenderablePointCloud::generateArrayTextures() {
         // Fill that storage with the data from the individual textures
         unsigned int layer = 0;
         for (const size_t& i : textureListIndices) {
-            ghoul::opengl::Texture* texture = _textures[i].get();
+            const auto it = _convertedTextures.find(i);
+            const ghoul::opengl::Texture& texture = it != _convertedTextures.end() ?
+                *it->second :
+                *_textures[i]->texture();
             fillAndUploadTextureLayer(
                 arrayIndex,
                 layer,
                 i,
                 res,
-                useAlpha,
-                texture->pixelData()
+                texture.format(),
+                texture.dataType(),
+                texture.pixelData()
             );
             layer++;
 
             // At this point we don't need the keep the texture data around anymore. If
-            // the textures need updating, we will reload them from file
-            texture->purgeFromRAM();
+            // the textures need updating, we will reload them from file. The shared
+            // texture is released once no other component uses it
+            _textures[i] = nullptr;
+            _convertedTextures.erase(i);
         }
 
         int nMaxTextureLayers = 0;
@@ -1594,19 +1627,15 @@ bool RenderablePointCloud::useOrientationData() const {
 }
 
 void RenderablePointCloud::addPositionDataForPoint(unsigned int index,
-                                                   std::vector<float>& result,
-                                                   double& maxRadius) const
+                                                   std::vector<float>& result) const
 {
     const dataloader::Dataset::Entry& e = _dataset.entries[index];
     glm::dvec3 position = transformedPosition(e);
-    const double r = glm::length(position);
 
     // Add values to result
     for (int j = 0; j < 3; ++j) {
         result.push_back(static_cast<float>(position[j]));
     }
-
-    maxRadius = std::max(maxRadius, r);
 }
 
 void RenderablePointCloud::addColorAndSizeDataForPoint(unsigned int index,
@@ -1650,8 +1679,6 @@ std::vector<float> RenderablePointCloud::createDataSlice() {
         return std::vector<float>();
     }
 
-    double maxRadius = 0.0;
-
     // One sub-array per texture array, since each of these will correspond to a separate
     // draw call. We need at least one sub result array
     std::vector<std::vector<float>> subResults = std::vector<std::vector<float>>(
@@ -1685,7 +1712,7 @@ std::vector<float> RenderablePointCloud::createDataSlice() {
         std::vector<float>& subArrayToUse = subResults[subresultIndex];
 
         // Add position, color and size data (subclasses may compute these differently)
-        addPositionDataForPoint(i, subArrayToUse, maxRadius);
+        addPositionDataForPoint(i, subArrayToUse);
         addColorAndSizeDataForPoint(i, subArrayToUse);
 
         if (useOrientationData()) {
@@ -1717,7 +1744,11 @@ std::vector<float> RenderablePointCloud::createDataSlice() {
     }
     result.shrink_to_fit();
 
-    setBoundingSphere(maxRadius);
+    // The bounding volume of the dataset is computed when loading, so we only have to
+    // apply the current transformation to it. This also covers all interpolation steps
+    const glm::dmat4 modelTransform = _transformationMatrix *
+        glm::scale(glm::dmat4(1.0), glm::dvec3(toMeter(_unit)));
+    setBoundingSphere(transformedOriginRadius(_dataset.bounds, modelTransform));
     return result;
 }
 
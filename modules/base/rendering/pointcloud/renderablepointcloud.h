@@ -39,6 +39,7 @@
 #include <openspace/properties/vector/vec3property.h>
 #include <openspace/rendering/colormappingcomponent.h>
 #include <openspace/rendering/labelscomponent.h>
+#include <openspace/rendering/texturecomponent.h>
 #include <openspace/util/distanceconversion.h>
 #include <ghoul/opengl/ghoul_gl.h>
 #include <ghoul/opengl/uniformcache.h>
@@ -124,8 +125,8 @@ protected:
     bool hasMultiTextureData() const;
     bool useOrientationData() const;
 
-    virtual void addPositionDataForPoint(unsigned int index, std::vector<float>& result,
-        double& maxRadius) const;
+    virtual void addPositionDataForPoint(unsigned int index,
+        std::vector<float>& result) const;
     virtual void addColorAndSizeDataForPoint(unsigned int index,
         std::vector<float>& result) const;
     virtual void addOrientationDataForPoint(unsigned int index,
@@ -148,7 +149,8 @@ protected:
         glm::uvec2 resolution, size_t nLayers, bool useAlpha);
 
     void fillAndUploadTextureLayer(unsigned int arrayindex, unsigned int layer,
-        size_t textureIndex, glm::uvec2 resolution, bool useAlpha, const void* pixelData);
+        size_t textureIndex, glm::uvec2 resolution, ghoul::opengl::Texture::Format format,
+        gl::GLenum dataType, const void* pixelData);
 
     void generateArrayTextures();
 
@@ -256,10 +258,16 @@ protected:
     GLuint _vao = 0;
     GLuint _vbo = 0;
 
-    // List of (unique) loaded textures. The other maps refer to the index in this vector
-    std::vector<std::unique_ptr<ghoul::opengl::Texture>> _textures;
+    // List of (unique) loaded textures. The other maps refer to the index in this vector.
+    // The decoded textures are shared with other components that load the same files
+    std::vector<std::unique_ptr<TextureComponent>> _textures;
     std::unordered_map<std::string, size_t> _textureNameToIndex;
 
+    // Converted copies of the textures whose format can not be converted by OpenGL when
+    // uploading them to the texture arrays, keyed by their index in the textures vector
+    std::unordered_map<size_t, std::unique_ptr<ghoul::opengl::Texture>>
+        _convertedTextures;
+
     // Texture index in dataset to index in vector of textures
     std::unordered_map<int, size_t> _indexInDataToTextureIndex;
 
@@ -143,7 +143,15 @@ void RenderablePolygonCloud::initializeCustomTexture() {
     glGenTextures(1, &id);
     glBindTexture(GL_TEXTURE_2D_ARRAY, id);
     initAndAllocateTextureArray(id, glm::uvec2(TexSize), 1, useAlpha);
-    fillAndUploadTextureLayer(0, 0, 0, glm::uvec2(TexSize), useAlpha, pixelData.data());
+    fillAndUploadTextureLayer(
+        0,
+        0,
+        0,
+        glm::uvec2(TexSize),
+        glFormat(useAlpha),
+        GL_UNSIGNED_BYTE,
+        pixelData.data()
+    );
     glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
 
     _textureIsInitialized = true;
@@ -103,7 +103,13 @@ RenderableDisc::RenderableDisc(const ghoul::Dictionary& dictionary)
     addProperty(Fadeable::_opacity);
 
     _texturePath = p.texture.string();
-    _texturePath.onChange([this]() { _texture->loadFromFile(_texturePath.value()); });
+    _texturePath.onChange([this]() {
+        // The previous texture is shown until the new one has been loaded
+        _texture->loadFromFile(
+            _texturePath.value(),
+            TextureComponent::WaitForTexture::No
+        );
+    });
     addProperty(_texturePath);
 
     _size.setExponent(7.f);
@@ -24,7 +24,7 @@
 
 #include <modules/base/rendering/renderableplanetimevaryingimage.h>
 
-#include <modules/base/basemodule.h>
+#include <modules/base/rendering/imagesequenceloader.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/documentation/verifier.h>
 #include <openspace/engine/globals.h>
@@ -33,7 +33,6 @@
 #include <openspace/scene/scene.h>
 #include <openspace/util/updatestructures.h>
 #include <ghoul/filesystem/filesystem.h>
-#include <ghoul/io/texture/texturereader.h>
 #include <ghoul/logging/logmanager.h>
 #include <optional>
 
@@ -53,8 +52,9 @@ namespace {
         // [[codegen::verbatim(SourceFolderInfo.description)]]
         std::string sourceFolder;
 
-        // If set to `true` the images are only loaded when it is about to be shown
-        // instead of preloading them
+        // If set to `true` the images that are kept in memory are released while the
+        // plane is disabled. Independent of this value, only the images around the
+        // currently shown image are loaded
         std::optional<bool> lazyLoading;
     };
 #include "renderableplanetimevaryingimage_codegen.cpp"
@@ -85,22 +85,20 @@ RenderablePlaneTimeVaryingImage::RenderablePlaneTimeVaryingImage(
     }
 
     addProperty(_sourceFolder);
-    _sourceFolder.onChange([this]() { _texture = loadTexture(); });
 
     _isLoadingLazily = p.lazyLoading.value_or(_isLoadingLazily);
     if (_isLoadingLazily) {
         _enabled.onChange([this]() {
-            if (_enabled) {
-                _textureIsDirty = true;
-            }
-            else {
-                BaseModule::TextureManager.release(_texture);
+            if (!_enabled && _imageSequence) {
+                _imageSequence->clear();
                 _texture = nullptr;
             }
         });
     }
 }
 
+RenderablePlaneTimeVaryingImage::~RenderablePlaneTimeVaryingImage() = default;
+
 void RenderablePlaneTimeVaryingImage::initialize() {
     RenderablePlane::initialize();
     const bool success = extractMandatoryInfoFromDictionary();
@@ -114,20 +112,7 @@ void RenderablePlaneTimeVaryingImage::initialize() {
 void RenderablePlaneTimeVaryingImage::initializeGL() {
     RenderablePlane::initializeGL();
 
-    _textureFiles.resize(_sourceFiles.size());
-    for (size_t i = 0; i < _sourceFiles.size(); i++) {
-        _textureFiles[i] = ghoul::io::TextureReader::ref().loadTexture(
-            absPath(_sourceFiles[i]),
-            2
-        );
-        _textureFiles[i]->setInternalFormat(GL_COMPRESSED_RGBA);
-        _textureFiles[i]->uploadTexture();
-        _textureFiles[i]->setFilter(ghoul::opengl::Texture::FilterMode::Linear);
-        _textureFiles[i]->purgeFromRAM();
-    }
-    if (!_isLoadingLazily) {
-        _texture = loadTexture();
-    }
+    _imageSequence = std::make_unique<ImageSequenceLoader>(_sourceFiles);
 }
 
 bool RenderablePlaneTimeVaryingImage::extractMandatoryInfoFromDictionary() {
@@ -157,14 +142,13 @@ bool RenderablePlaneTimeVaryingImage::extractMandatoryInfoFromDictionary() {
 }
 
 void RenderablePlaneTimeVaryingImage::deinitializeGL() {
-    BaseModule::TextureManager.release(_texture);
-
-    _textureFiles.clear();
+    _texture = nullptr;
+    _imageSequence = nullptr;
     RenderablePlane::deinitializeGL();
 }
 
 void RenderablePlaneTimeVaryingImage::bindTexture() {
-    if (_texture && !_textureIsDirty) {
+    if (_texture) {
         _texture->bind();
     }
 }
@@ -173,10 +157,9 @@ void RenderablePlaneTimeVaryingImage::update(const UpdateData& data) {
     ZoneScoped;
     RenderablePlane::update(data);
 
-    if (!_enabled || _startTimes.empty()) {
+    if (!_enabled || _startTimes.empty() || !_imageSequence) {
         return;
     }
-    bool needsUpdate = false;
     const double currentTime = data.time.j2000Seconds();
     const bool isInInterval = (currentTime >= _startTimes[0]) &&
                               (currentTime < _sequenceEndTime);
@@ -191,19 +174,17 @@ void RenderablePlaneTimeVaryingImage::update(const UpdateData& data) {
             (nextIdx < _sourceFiles.size() && currentTime >= _startTimes[nextIdx]))
         {
             _activeTriggerTimeIndex = updateActiveTriggerTimeIndex(currentTime);
-            needsUpdate = true;
         } // else we're still in same state as previous frame (no changes needed)
     }
     else {
         // not in interval => set everything to false
         _activeTriggerTimeIndex = -1;
-        needsUpdate = false;
     }
 
-    if (needsUpdate || _textureIsDirty) {
-        _texture = loadTexture();
-        _textureIsDirty = false;
-    }
+    // The loader needs to be updated every frame to create the textures of images that
+    // have been read in the background
+    _imageSequence->update(_activeTriggerTimeIndex);
+    _texture = _imageSequence->texture();
 }
 
 void RenderablePlaneTimeVaryingImage::render(const RenderData& data, RendererTasks& t) {
@@ -263,11 +244,4 @@ void RenderablePlaneTimeVaryingImage::computeSequenceEndTime() {
     }
 }
 
-ghoul::opengl::Texture* RenderablePlaneTimeVaryingImage::loadTexture() const {
-    ghoul::opengl::Texture* texture = nullptr;
-    if (_activeTriggerTimeIndex != -1) {
-        texture = _textureFiles[_activeTriggerTimeIndex].get();
-    }
-    return texture;
-}
 } // namespace openspace
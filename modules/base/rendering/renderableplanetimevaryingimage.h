@@ -28,12 +28,14 @@
 #include <modules/base/rendering/renderableplane.h>
 
 #include <filesystem>
+#include <memory>
 
 namespace ghoul::filesystem { class File; }
 namespace ghoul::opengl { class Texture; }
 
 namespace openspace {
 
+class ImageSequenceLoader;
 struct RenderData;
 struct UpdateData;
 
@@ -42,6 +44,7 @@ namespace documentation { struct Documentation; }
 class RenderablePlaneTimeVaryingImage : public RenderablePlane {
 public:
     explicit RenderablePlaneTimeVaryingImage(const ghoul::Dictionary& dictionary);
+    ~RenderablePlaneTimeVaryingImage() override;
 
     void initialize() override;
     void initializeGL() override;
@@ -56,7 +59,6 @@ protected:
     virtual void bindTexture() override;
 
 private:
-    ghoul::opengl::Texture* loadTexture() const;
     void extractTriggerTimesFromFileNames();
     bool extractMandatoryInfoFromDictionary();
     int updateActiveTriggerTimeIndex(double currentTime) const;
@@ -69,9 +71,8 @@ private:
     int _activeTriggerTimeIndex = 0;
     properties::StringProperty _sourceFolder;
     ghoul::opengl::Texture* _texture = nullptr;
-    std::vector<std::unique_ptr<ghoul::opengl::Texture>> _textureFiles;
+    std::unique_ptr<ImageSequenceLoader> _imageSequence;
     bool _isLoadingLazily = false;
-    bool _textureIsDirty = false;
 };
 
 } // namespace openspace
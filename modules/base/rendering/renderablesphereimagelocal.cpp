@@ -65,7 +65,13 @@ RenderableSphereImageLocal::RenderableSphereImageLocal(
     const Parameters p = codegen::bake<Parameters>(dictionary);
 
     _texturePath = p.texture.string();
-    _texturePath.onChange([this]() { _texture->loadFromFile(_texturePath.value()); });
+    _texturePath.onChange([this]() {
+        // The previous texture is shown until the new one has been loaded
+        _texture->loadFromFile(
+            _texturePath.value(),
+            TextureComponent::WaitForTexture::No
+        );
+    });
     addProperty(_texturePath);
 }
 
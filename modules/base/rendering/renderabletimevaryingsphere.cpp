@@ -24,12 +24,12 @@
 
 #include <modules/base/rendering/renderabletimevaryingsphere.h>
 
+#include <modules/base/rendering/imagesequenceloader.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/documentation/verifier.h>
 #include <openspace/util/sphere.h>
 #include <openspace/util/updatestructures.h>
 #include <ghoul/filesystem/filesystem.h>
-#include <ghoul/io/texture/texturereader.h>
 #include <ghoul/misc/crc32.h>
 #include <ghoul/opengl/texture.h>
 
@@ -81,8 +81,10 @@ RenderableTimeVaryingSphere::RenderableTimeVaryingSphere(
     _textureSourcePath = p.textureSource.string();
 }
 
+RenderableTimeVaryingSphere::~RenderableTimeVaryingSphere() = default;
+
 bool RenderableTimeVaryingSphere::isReady() const {
-    return RenderableSphere::isReady() && _texture;
+    return RenderableSphere::isReady() && _imageSequence && _texture;
 }
 
 void RenderableTimeVaryingSphere::initializeGL() {
@@ -90,7 +92,20 @@ void RenderableTimeVaryingSphere::initializeGL() {
 
     extractMandatoryInfoFromSourceFolder();
     computeSequenceEndTime();
-    loadTexture();
+
+    std::vector<std::filesystem::path> paths;
+    paths.reserve(_files.size());
+    for (const FileData& file : _files) {
+        paths.push_back(file.path);
+    }
+    _imageSequence = std::make_unique<ImageSequenceLoader>(std::move(paths));
+    // The renderable is only updated once it is ready, so the first texture has to be
+    // available before that. The remaining images are loaded in the background
+    _imageSequence->update(
+        _activeTriggerTimeIndex,
+        ImageSequenceLoader::WaitForActive::Yes
+    );
+    _texture = _imageSequence->texture();
 }
 
 void RenderableTimeVaryingSphere::deinitializeGL() {
@@ -119,15 +134,7 @@ void RenderableTimeVaryingSphere::extractMandatoryInfoFromSourceFolder() {
         }
         std::filesystem::path filePath = e.path();
         const double time = extractTriggerTimeFromFileName(filePath);
-        std::unique_ptr<ghoul::opengl::Texture> t =
-            ghoul::io::TextureReader::ref().loadTexture(filePath, 2);
-
-        t->setInternalFormat(GL_COMPRESSED_RGBA);
-        t->uploadTexture();
-        t->setFilter(ghoul::opengl::Texture::FilterMode::Linear);
-        t->purgeFromRAM();
-
-        _files.push_back({ std::move(filePath), time, std::move(t) });
+        _files.push_back({ std::move(filePath), time });
     }
 
     std::sort(
@@ -160,17 +167,16 @@ void RenderableTimeVaryingSphere::update(const UpdateData& data) {
             (nextIdx < _files.size() && currentTime >= _files[nextIdx].time))
         {
             updateActiveTriggerTimeIndex(currentTime);
-            _textureIsDirty = true;
         } // else {we're still in same state as previous frame (no changes needed)}
     }
     else {
         // not in interval => set everything to false
         _activeTriggerTimeIndex = 0;
     }
-    if (_textureIsDirty) {
-        loadTexture();
-        _textureIsDirty = false;
-    }
+    // The loader needs to be updated every frame to create the textures of images that
+    // have been read in the background
+    _imageSequence->update(_activeTriggerTimeIndex);
+    _texture = _imageSequence->texture();
 }
 
 void RenderableTimeVaryingSphere::bindTexture() {
@@ -215,10 +221,4 @@ void RenderableTimeVaryingSphere::computeSequenceEndTime() {
     }
 }
 
-void RenderableTimeVaryingSphere::loadTexture() {
-    if (_activeTriggerTimeIndex != -1) {
-        _texture = _files[_activeTriggerTimeIndex].texture.get();
-    }
-}
-
 } // namespace openspace
@@ -28,11 +28,13 @@
 #include <modules/base/rendering/renderablesphere.h>
 
 #include <filesystem>
+#include <memory>
 
 namespace ghoul::opengl { class Texture; }
 
 namespace openspace {
 
+class ImageSequenceLoader;
 struct RenderData;
 struct UpdateData;
 
@@ -41,6 +43,7 @@ namespace documentation { struct Documentation; }
 class RenderableTimeVaryingSphere : public RenderableSphere {
 public:
     explicit RenderableTimeVaryingSphere(const ghoul::Dictionary& dictionary);
+    ~RenderableTimeVaryingSphere() override;
 
     void initializeGL() override;
     void deinitializeGL() override;
@@ -58,9 +61,7 @@ private:
     struct FileData {
         std::filesystem::path path;
         double time;
-        std::unique_ptr<ghoul::opengl::Texture> texture;
     };
-    void loadTexture();
     void extractMandatoryInfoFromSourceFolder();
     void updateActiveTriggerTimeIndex(double currenttime);
     void computeSequenceEndTime();
@@ -68,11 +69,11 @@ private:
     // If there's just one state it should never disappear!
     double _sequenceEndTime = std::numeric_limits<double>::max();
     std::vector<FileData> _files;
+    std::unique_ptr<ImageSequenceLoader> _imageSequence;
     int _activeTriggerTimeIndex = 0;
 
     properties::StringProperty _textureSourcePath;
     ghoul::opengl::Texture* _texture = nullptr;
-    bool _textureIsDirty = false;
 };
 
 } // namespace openspace
@@ -27,6 +27,7 @@
 #include <openspace/documentation/documentation.h>
 #include <openspace/documentation/verifier.h>
 #include <openspace/scene/translation.h>
+#include <openspace/util/boundingvolume.h>
 #include <openspace/util/spicemanager.h>
 #include <openspace/util/timeconversion.h>
 #include <openspace/util/updatestructures.h>
@@ -170,8 +171,6 @@ RenderableTrailTrajectory::RenderableTrailTrajectory(const ghoul::Dictionary& di
     , _timeStampSubsamplingFactor(TimeSubSampleInfo, 1, 1, 1000000000)
     , _renderFullTrail(RenderFullPathInfo, false)
     , _numberOfReplacementPoints(AccurateTrailPositionsInfo, 100, 0, 1000)
-    , _maxVertex(glm::vec3(-std::numeric_limits<float>::max()))
-    , _minVertex(glm::vec3(std::numeric_limits<float>::max()))
 {
     const Parameters p = codegen::bake<Parameters>(dictionary);
 
@@ -252,8 +251,6 @@ void RenderableTrailTrajectory::deinitializeGL() {
 void RenderableTrailTrajectory::reset() {
     _needsFullSweep = true;
     _sweepIteration = 0;
-    _maxVertex = glm::vec3(-std::numeric_limits<float>::max());
-    _minVertex = glm::vec3(std::numeric_limits<float>::max());
 }
 
 void RenderableTrailTrajectory::update(const UpdateData& data) {
@@ -313,10 +310,6 @@ void RenderableTrailTrajectory::update(const UpdateData& data) {
             _vertexArray[i] = { p.x, p.y, p.z };
             _timeVector[i] = Time(_start + i * _totalSampleInterval).j2000Seconds();
             _dVertexArray[i] = {dp.x, dp.y, dp.z};
-
-            // Set max and min vertex for bounding sphere calculations
-            _maxVertex = glm::max(_maxVertex, dp);
-            _minVertex = glm::min(_minVertex, dp);
         }
         ++_sweepIteration;
 
@@ -335,7 +328,17 @@ void RenderableTrailTrajectory::update(const UpdateData& data) {
             _dVertexArray[stopIndex] = { dp.x, dp.y, dp.z };
 
             _sweepIteration = 0;
-            setBoundingSphere(glm::distance(_maxVertex, _minVertex) / 2.0);
+
+            // The trail is rendered relative to the parent, so the bounding sphere has
+            // to contain all vertices around the origin rather than around their center
+            const BoundingVolume bounds = computeBoundingVolume(
+                _dVertexArray.size(),
+                [this](size_t i) {
+                    const TrailVBOLayout<double>& v = _dVertexArray[i];
+                    return glm::dvec3(v.x, v.y, v.z);
+                }
+            );
+            setBoundingSphere(bounds.originRadius);
         }
         else {
             // Early return as we don't need to render if we are still
@@ -106,10 +106,6 @@ private:
 
     double _totalSampleInterval = 0.0;
 
-    /// Max and min vertex used to calculate the bounding sphere
-    glm::dvec3 _maxVertex;
-    glm::dvec3 _minVertex;
-
     /// Contains all timestamps corresponding to the positions in _vertexArray
     std::vector<double> _timeVector;
 
@@ -24,11 +24,13 @@
 
 #include <modules/base/rendering/screenspaceimagelocal.h>
 
+#include <modules/base/basemodule.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/documentation/verifier.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/io/texture/texturereader.h>
 #include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/crc32.h>
 #include <ghoul/opengl/programobject.h>
 #include <ghoul/opengl/texture.h>
 #include <ghoul/opengl/textureconversion.h>
@@ -106,6 +108,7 @@ ScreenSpaceImageLocal::ScreenSpaceImageLocal(const ghoul::Dictionary& dictionary
 }
 
 bool ScreenSpaceImageLocal::deinitializeGL() {
+    BaseModule::TextureManager.release(_texture);
     _texture = nullptr;
 
     return ScreenSpaceRenderable::deinitializeGL();
@@ -113,23 +116,38 @@ bool ScreenSpaceImageLocal::deinitializeGL() {
 
 void ScreenSpaceImageLocal::update() {
     if (_textureIsDirty && !_texturePath.value().empty()) {
-        std::unique_ptr<ghoul::opengl::Texture> texture =
-            ghoul::io::TextureReader::ref().loadTexture(absPath(_texturePath), 2);
-
-        if (texture) {
-            // Images don't need to start on 4-byte boundaries, for example if the
-            // image is only RGB
-            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-
-            if (texture->format() == ghoul::opengl::Texture::Format::Red) {
-                texture->setSwizzleMask({ GL_RED, GL_RED, GL_RED, GL_ONE });
+        ghoul::opengl::Texture* t = _texture;
+
+        // Screen space images with the same content share a texture. The key differs
+        // from the one used by planes as the textures are set up differently
+        const unsigned int hash = ghoul::hashCRC32File(absPath(_texturePath));
+        _texture = BaseModule::TextureManager.request(
+            std::format("{}-ScreenSpaceImage", hash),
+            [path = _texturePath.value()]() -> std::unique_ptr<ghoul::opengl::Texture> {
+                std::unique_ptr<ghoul::opengl::Texture> texture =
+                    ghoul::io::TextureReader::ref().loadTexture(absPath(path), 2);
+                if (!texture) {
+                    return nullptr;
+                }
+
+                // Images don't need to start on 4-byte boundaries, for example if the
+                // image is only RGB
+                glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+                if (texture->format() == ghoul::opengl::Texture::Format::Red) {
+                    texture->setSwizzleMask({ GL_RED, GL_RED, GL_RED, GL_ONE });
+                }
+
+                texture->uploadTexture();
+                texture->setFilter(ghoul::opengl::Texture::FilterMode::LinearMipMap);
+                texture->purgeFromRAM();
+                return texture;
             }
+        );
 
-            texture->uploadTexture();
-            texture->setFilter(ghoul::opengl::Texture::FilterMode::LinearMipMap);
-            texture->purgeFromRAM();
+        BaseModule::TextureManager.release(t);
 
-            _texture = std::move(texture);
+        if (_texture) {
             _objectSize = _texture->dimensions();
             _textureIsDirty = false;
         }
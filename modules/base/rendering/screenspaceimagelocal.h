@@ -50,7 +50,7 @@ private:
 
     properties::StringProperty _texturePath;
 
-    std::unique_ptr<ghoul::opengl::Texture> _texture;
+    ghoul::opengl::Texture* _texture = nullptr;
     bool _textureIsDirty = false;
 };
 
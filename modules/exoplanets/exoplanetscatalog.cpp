@@ -0,0 +1,200 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/exoplanets/exoplanetscatalog.h>
+
+#include <modules/exoplanets/exoplanetshelper.h>
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/exception.h>
+#include <ghoul/misc/stringhelper.h>
+#include <algorithm>
+#include <fstream>
+
+namespace {
+    constexpr std::string_view _loggerCat = "ExoplanetsCatalog";
+
+    // The data file starts with a version number, followed by the tightly packed entries
+    constexpr std::streamoff DataFileHeaderSize = sizeof(int);
+} // namespace
+
+namespace openspace::exoplanets {
+
+ExoplanetsCatalog::ExoplanetsCatalog(const std::filesystem::path& dataFile,
+                                     const std::filesystem::path& lookUpTable)
+{
+    std::ifstream data(dataFile, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!data.good()) {
+        throw ghoul::RuntimeError(std::format(
+            "Failed to open exoplanets data file '{}'", dataFile
+        ));
+    }
+
+    // Read all entries in one go instead of seeking to each planet individually
+    const std::streamoff fileSize = data.tellg();
+    const size_t nEntries = fileSize > DataFileHeaderSize ?
+        static_cast<size_t>(fileSize - DataFileHeaderSize) / sizeof(ExoplanetDataEntry) :
+        0;
+    _planets.resize(nEntries);
+    _planetNames.resize(nEntries);
+    data.seekg(DataFileHeaderSize);
+    data.read(
+        reinterpret_cast<char*>(_planets.data()),
+        nEntries * sizeof(ExoplanetDataEntry)
+    );
+
+    std::ifstream lut(lookUpTable);
+    if (!lut.good()) {
+        throw ghoul::RuntimeError(std::format(
+            "Failed to open exoplanets look-up table '{}'", lookUpTable
+        ));
+    }
+
+    // Each line in the look-up table has the form '<star> <planet>,<location>', where
+    // the planet is always specified by a single letter
+    std::string line;
+    while (ghoul::getline(lut, line)) {
+        const size_t comma = line.find(',');
+        if (comma == std::string::npos || comma < 2) {
+            continue;
+        }
+
+        const long location = std::stol(line.substr(comma + 1));
+        const size_t index = static_cast<size_t>(
+            (location - DataFileHeaderSize) / sizeof(ExoplanetDataEntry)
+        );
+        if (location < DataFileHeaderSize || index >= nEntries) {
+            LWARNING(std::format("Invalid location in look-up table entry '{}'", line));
+            continue;
+        }
+
+        std::string planetName = line.substr(0, comma);
+        std::string starName = planetName.substr(0, planetName.size() - 2);
+        sanitizeNameString(planetName);
+        _planetNames[index] = std::move(planetName);
+
+        auto it = _systemIndices.find(starName);
+        if (it == _systemIndices.end()) {
+            it = _systemIndices.emplace(starName, _systems.size()).first;
+            System system;
+            system.starName = std::move(starName);
+            _systems.push_back(std::move(system));
+        }
+
+        System& system = _systems[it->second];
+        system.planets.push_back(index);
+
+        const ExoplanetDataEntry& p = _planets[index];
+        if (!system.hasSufficientData && hasSufficientData(p)) {
+            system.hasSufficientData = true;
+            system.position = glm::vec3(p.positionX, p.positionY, p.positionZ);
+        }
+    }
+
+    for (size_t i = 0; i < _systems.size(); i++) {
+        if (_systems[i].hasSufficientData) {
+            _systemsByDistance.emplace_back(glm::length(_systems[i].position), i);
+        }
+    }
+    std::sort(_systemsByDistance.begin(), _systemsByDistance.end());
+
+    LDEBUG(std::format(
+        "Loaded {} exoplanets in {} systems", _planets.size(), _systems.size()
+    ));
+}
+
+std::optional<ExoplanetSystem> ExoplanetsCatalog::system(
+                                                          std::string_view starName) const
+{
+    auto it = _systemIndices.find(std::string(starName));
+    if (it == _systemIndices.end()) {
+        return std::nullopt;
+    }
+
+    ExoplanetSystem result;
+    result.starName = starName;
+    for (const size_t i : _systems[it->second].planets) {
+        const ExoplanetDataEntry& p = _planets[i];
+        if (!hasSufficientData(p)) {
+            LWARNING(std::format(
+                "Insufficient data for exoplanet '{}'", _planetNames[i]
+            ));
+            continue;
+        }
+
+        result.planetNames.push_back(_planetNames[i]);
+        result.planetsData.push_back(p);
+        updateStarDataFromNewPlanet(result.starData, p);
+    }
+    return result;
+}
+
+std::vector<std::string> ExoplanetsCatalog::hostStarsWithSufficientData() const {
+    std::vector<std::string> names;
+    names.reserve(_systemsByDistance.size());
+    for (const System& system : _systems) {
+        if (system.hasSufficientData) {
+            names.push_back(system.starName);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+std::vector<std::string> ExoplanetsCatalog::systemsWithinDistance(
+                                                                  const glm::vec3& center,
+                                                                     float distance) const
+{
+    // Every system within the distance from the center has to be inside a shell around
+    // the Sun, so only those systems have to be tested
+    const float centerDistance = glm::length(center);
+    auto begin = std::lower_bound(
+        _systemsByDistance.begin(),
+        _systemsByDistance.end(),
+        centerDistance - distance,
+        [](const std::pair<float, size_t>& s, float d) { return s.first < d; }
+    );
+
+    std::vector<std::pair<float, size_t>> found;
+    for (auto it = begin; it != _systemsByDistance.end(); it++) {
+        if (it->first > centerDistance + distance) {
+            break;
+        }
+
+        const float d = glm::distance(_systems[it->second].position, center);
+        if (d <= distance) {
+            found.emplace_back(d, it->second);
+        }
+    }
+    std::sort(found.begin(), found.end());
+
+    std::vector<std::string> names;
+    names.reserve(found.size());
+    for (const std::pair<float, size_t>& f : found) {
+        names.push_back(_systems[f.second].starName);
+    }
+    return names;
+}
+
+} // namespace openspace::exoplanets
@@ -0,0 +1,99 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_EXOPLANETS___EXOPLANETSCATALOG___H__
+#define __OPENSPACE_MODULE_EXOPLANETS___EXOPLANETSCATALOG___H__
+
+#include <modules/exoplanets/datastructure.h>
+#include <ghoul/glm.h>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace openspace::exoplanets {
+
+/**
+ * An in-memory index over the prepared exoplanet data file and its look-up table. Both
+ * files are read once in a single pass, after which the planet entries are stored
+ * contiguously and grouped by host star. Systems can be found by name through a hash
+ * index, and by distance through an index of all systems sorted by their distance to the
+ * Sun.
+ */
+class ExoplanetsCatalog {
+public:
+    /**
+     * Reads the binary exoplanets data file \p dataFile and the look-up table
+     * \p lookUpTable that were created by the ExoplanetsDataPreparationTask.
+     *
+     * \throw ghoul::RuntimeError If either of the files could not be read
+     */
+    ExoplanetsCatalog(const std::filesystem::path& dataFile,
+        const std::filesystem::path& lookUpTable);
+
+    /**
+     * Returns the system with the host star \p starName, containing only the planets
+     * that have sufficient data for a visualization, or `std::nullopt` if there is no
+     * system with that name.
+     */
+    std::optional<ExoplanetSystem> system(std::string_view starName) const;
+
+    /**
+     * Returns the names of the host stars of all systems with at least one planet that
+     * has sufficient data for generating a visualization, sorted by name.
+     */
+    std::vector<std::string> hostStarsWithSufficientData() const;
+
+    /**
+     * Returns the names of the host stars of all systems that have sufficient data for
+     * generating a visualization and that are at most \p distance parsec away from
+     * \p center, sorted by increasing distance from \p center.
+     */
+    std::vector<std::string> systemsWithinDistance(const glm::vec3& center,
+        float distance) const;
+
+private:
+    struct System {
+        std::string starName;
+        std::vector<size_t> planets;
+        glm::vec3 position = glm::vec3(std::numeric_limits<float>::quiet_NaN());
+        bool hasSufficientData = false;
+    };
+
+    std::vector<ExoplanetDataEntry> _planets;
+    std::vector<std::string> _planetNames;
+    std::vector<System> _systems;
+    std::unordered_map<std::string, size_t> _systemIndices;
+
+    /// Distance to the Sun and index of all systems with sufficient data
+    std::vector<std::pair<float, size_t>> _systemsByDistance;
+};
+
+} // namespace openspace::exoplanets
+
+#endif // __OPENSPACE_MODULE_EXOPLANETS___EXOPLANETSCATALOG___H__
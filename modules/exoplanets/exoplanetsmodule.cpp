@@ -258,6 +258,8 @@ ExoplanetsModule::ExoplanetsModule()
     addProperty(_enabled);
 
     _exoplanetsDataFolder.onChange([this]() {
+        _catalog = nullptr;
+
         std::filesystem::path f = _exoplanetsDataFolder.value();
        if (!std::filesystem::is_directory(f)) {
             LERROR(std::format(
@@ -330,6 +332,18 @@ std::filesystem::path ExoplanetsModule::lookUpTablePath() const {
     );
 }
 
+const exoplanets::ExoplanetsCatalog& ExoplanetsModule::catalog() const {
+    ghoul_assert(hasDataFiles(), "Data files not loaded");
+
+    if (!_catalog) {
+        _catalog = std::make_unique<ExoplanetsCatalog>(
+            exoplanetsDataPath(),
+            lookUpTablePath()
+        );
+    }
+    return *_catalog;
+}
+
 std::filesystem::path ExoplanetsModule::teffToBvConversionFilePath() const {
     ghoul_assert(hasDataFiles(), "Data files not loaded");
 
@@ -457,6 +471,8 @@ scripting::LuaLibrary ExoplanetsModule::luaLibrary() const {
         .functions = {
             codegen::lua::RemoveExoplanetSystem,
             codegen::lua::SystemData,
+            codegen::lua::SystemsData,
+            codegen::lua::SystemsWithinDistance,
             codegen::lua::ListOfExoplanets,
             codegen::lua::ListOfExoplanetsDeprecated,
             codegen::lua::ListAvailableExoplanetSystems,
@@ -27,12 +27,14 @@
 
 #include <openspace/util/openspacemodule.h>
 
+#include <modules/exoplanets/exoplanetscatalog.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/properties/scalar/boolproperty.h>
 #include <openspace/properties/scalar/floatproperty.h>
 #include <openspace/properties/stringproperty.h>
 #include <openspace/properties/vector/vec3property.h>
 #include <filesystem>
+#include <memory>
 
 namespace openspace {
 
@@ -46,6 +48,15 @@ public:
     bool hasDataFiles() const;
     std::filesystem::path exoplanetsDataPath() const;
     std::filesystem::path lookUpTablePath() const;
+
+    /**
+     * Returns the catalog of all exoplanets in the data folder. The catalog is loaded the
+     * first time this function is called.
+     *
+     * \throw ghoul::RuntimeError If the data files could not be read
+     * \pre hasDataFiles() must be true
+     */
+    const exoplanets::ExoplanetsCatalog& catalog() const;
     std::filesystem::path teffToBvConversionFilePath() const;
     std::filesystem::path bvColormapPath() const;
     std::filesystem::path starTexturePath() const;
@@ -85,6 +96,8 @@ protected:
     properties::BoolProperty _useOptimisticZone;
 
     properties::FloatProperty _habitableZoneOpacity;
+
+    mutable std::unique_ptr<exoplanets::ExoplanetsCatalog> _catalog;
 };
 
 } // namespace openspace
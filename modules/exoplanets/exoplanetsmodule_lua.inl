@@ -27,9 +27,11 @@
 #include <modules/exoplanets/tasks/exoplanetsdatapreparationtask.h>
 #include <openspace/scene/scene.h>
 #include <ghoul/misc/csvreader.h>
+#include <ghoul/misc/exception.h>
 #include <ghoul/misc/stringhelper.h>
 #include <algorithm>
 #include <map>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -37,71 +39,8 @@ namespace {
 
 constexpr std::string_view _loggerCat = "ExoplanetsModule";
 
-openspace::exoplanets::ExoplanetSystem findSystemInData(std::string_view starName) {
+const openspace::exoplanets::ExoplanetsCatalog& catalog() {
     using namespace openspace;
-    using namespace exoplanets;
-
-    const ExoplanetsModule* module = global::moduleEngine->module<ExoplanetsModule>();
-
-    const std::filesystem::path binPath = module->exoplanetsDataPath();
-    std::ifstream data(absPath(binPath), std::ios::in | std::ios::binary);
-    if (!data.good()) {
-        throw ghoul::lua::LuaError(std::format(
-            "Failed to open exoplanets data file '{}'", binPath
-        ));
-    }
-
-    const std::filesystem::path lutPath = module->lookUpTablePath();
-    std::ifstream lut(absPath(lutPath));
-    if (!lut.good()) {
-        throw ghoul::lua::LuaError(std::format(
-            "Failed to open exoplanets look-up table '{}'", lutPath
-        ));
-    }
-
-    ExoplanetSystem system;
-
-    // 1. search lut for the starname and return the corresponding location
-    // 2. go to that location in the data file
-    // 3. read sizeof(exoplanet) bytes into an exoplanet object.
-    ExoplanetDataEntry p;
-    std::string line;
-    while (ghoul::getline(lut, line)) {
-        std::istringstream ss(line);
-        std::string name;
-        ghoul::getline(ss, name, ',');
-
-        if (name.substr(0, name.length() - 2) != starName) {
-            continue;
-        }
-
-        std::string location_s;
-        ghoul::getline(ss, location_s);
-        long location = std::stol(location_s.c_str());
-
-        data.seekg(location);
-        data.read(reinterpret_cast<char*>(&p), sizeof(ExoplanetDataEntry));
-
-        sanitizeNameString(name);
-
-        if (!hasSufficientData(p)) {
-            LWARNING(std::format("Insufficient data for exoplanet '{}'", name));
-            continue;
-        }
-
-        system.planetNames.push_back(name);
-        system.planetsData.push_back(p);
-
-        updateStarDataFromNewPlanet(system.starData, p);
-    }
-
-    system.starName = starName;
-    return system;
-}
-
-std::vector<std::string> hostStarsWithSufficientData() {
-    using namespace openspace;
-    using namespace exoplanets;
     const ExoplanetsModule* module = global::moduleEngine->module<ExoplanetsModule>();
 
     if (!module->hasDataFiles()) {
@@ -109,58 +48,12 @@ std::vector<std::string> hostStarsWithSufficientData() {
         throw ghoul::lua::LuaError("No data path was configured for the exoplanets");
     }
 
-    const std::filesystem::path lutPath = module->lookUpTablePath();
-    std::ifstream lookupTableFile(absPath(lutPath));
-    if (!lookupTableFile.good()) {
-        throw ghoul::lua::LuaError(std::format(
-            "Failed to open lookup table file '{}'", lutPath
-        ));
-    }
-
-    const std::filesystem::path binPath = module->exoplanetsDataPath();
-    std::ifstream data(absPath(binPath), std::ios::in | std::ios::binary);
-    if (!data.good()) {
-        throw ghoul::lua::LuaError(std::format("Failed to open data file '{}'", binPath));
-    }
-
-    std::vector<std::string> names;
-    std::string line;
-
-    // Read number of lines
-    int nExoplanets = 0;
-    while (ghoul::getline(lookupTableFile, line)) {
-        ++nExoplanets;
+    try {
+        return module->catalog();
     }
-    lookupTableFile.clear();
-    lookupTableFile.seekg(0);
-    names.reserve(nExoplanets);
-
-    ExoplanetDataEntry p;
-    while (ghoul::getline(lookupTableFile, line)) {
-        std::stringstream ss(line);
-        std::string name;
-        ghoul::getline(ss, name, ',');
-        // Remove the last two characters, that specify the planet
-        name = name.substr(0, name.size() - 2);
-
-        // Don't want to list systems where there is not enough data to visualize.
-        // So, test if there is before adding the name to the list.
-        std::string location_s;
-        ghoul::getline(ss, location_s);
-        long location = std::stol(location_s.c_str());
-
-        data.seekg(location);
-        data.read(reinterpret_cast<char*>(&p), sizeof(ExoplanetDataEntry));
-
-        if (hasSufficientData(p)) {
-            names.push_back(name);
-        }
+    catch (const ghoul::RuntimeError& e) {
+        throw ghoul::lua::LuaError(e.message);
     }
-
-    // For easier read, sort by names and remove duplicates
-    std::sort(names.begin(), names.end());
-    names.erase(std::unique(names.begin(), names.end()), names.end());
-    return names;
 }
 
 /**
@@ -176,15 +69,64 @@ std::vector<std::string> hostStarsWithSufficientData() {
 [[codegen::luawrap]] ghoul::Dictionary systemData(std::string starName){
     using namespace openspace;
 
-    exoplanets::ExoplanetSystem systemData = findSystemInData(starName);
+    std::optional<exoplanets::ExoplanetSystem> systemData = catalog().system(starName);
 
-    if (systemData.planetsData.empty()) {
+    if (!systemData.has_value() || systemData->planetsData.empty()) {
         throw ghoul::lua::LuaError(std::format(
             "Exoplanet system '{}' could not be found", starName
         ));
     }
 
-    return systemData.toDataDictionary();
+    return systemData->toDataDictionary();
+}
+
+/**
+ * Return a list of objects containing the information needed to add the exoplanet
+ * systems with the provided host star names. This is equivalent to calling `systemData`
+ * for every star, but only requires a single call. Stars for which no system could be
+ * found are skipped with a warning.
+ *
+ * \param starNames The names of the stars to get the information for
+ *
+ * \return A list of objects of the type
+ *         [ExoplanetSystemData](#exoplanets_exoplanet_system_data) that can be used to
+ *         create the scene graph nodes for the exoplanet systems
+ */
+[[codegen::luawrap]] std::vector<ghoul::Dictionary> systemsData(
+                                                       std::vector<std::string> starNames)
+{
+    using namespace openspace;
+
+    const exoplanets::ExoplanetsCatalog& c = catalog();
+
+    std::vector<ghoul::Dictionary> result;
+    result.reserve(starNames.size());
+    for (const std::string& starName : starNames) {
+        std::optional<exoplanets::ExoplanetSystem> systemData = c.system(starName);
+        if (!systemData.has_value() || systemData->planetsData.empty()) {
+            LWARNING(std::format("Exoplanet system '{}' could not be found", starName));
+            continue;
+        }
+        result.push_back(systemData->toDataDictionary());
+    }
+    return result;
+}
+
+/**
+ * Returns the names of the host stars of all exoplanet systems that have sufficient data
+ * for generating a visualization and that are within the provided distance of a
+ * position, sorted by their distance to that position.
+ *
+ * \param distance The maximum distance to the systems, in parsec
+ * \param center The position to measure the distance from, in parsec in the same galactic
+ *        coordinate system as the exoplanet data. Defaults to the position of the Sun
+ *
+ * \return A list of exoplanet host star names
+ */
+[[codegen::luawrap]] std::vector<std::string> systemsWithinDistance(float distance,
+                                                          std::optional<glm::vec3> center)
+{
+    return catalog().systemsWithinDistance(center.value_or(glm::vec3(0.f)), distance);
 }
 
 /**
@@ -214,8 +156,7 @@ std::vector<std::string> hostStarsWithSufficientData() {
  * \return A list of exoplanet host star names.
  */
 [[codegen::luawrap]] std::vector<std::string> listOfExoplanets() {
-    std::vector<std::string> names = hostStarsWithSufficientData();
-    return names;
+    return catalog().hostStarsWithSufficientData();
 }
 
 /**
@@ -237,7 +178,7 @@ listOfExoplanetsDeprecated()
  * data for generating a visualization, and prints the list to the console.
  */
 [[codegen::luawrap]] void listAvailableExoplanetSystems() {
-    std::vector<std::string> names = hostStarsWithSufficientData();
+    std::vector<std::string> names = catalog().hostStarsWithSufficientData();
 
     std::string output;
     for (const std::string& name : names) {
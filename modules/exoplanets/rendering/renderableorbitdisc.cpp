@@ -127,7 +127,13 @@ RenderableOrbitDisc::RenderableOrbitDisc(const ghoul::Dictionary& dictionary)
     setBoundingSphere(_size + _offset.value().y * _size);
 
     _texturePath = p.texture.string();
-    _texturePath.onChange([this]() { _texture->loadFromFile(_texturePath.value()); });
+    _texturePath.onChange([this]() {
+        // The previous texture is shown until the new one has been loaded
+        _texture->loadFromFile(
+            _texturePath.value(),
+            TextureComponent::WaitForTexture::No
+        );
+    });
     addProperty(_texturePath);
 
     _multiplyColor = p.multiplyColor.value_or(_multiplyColor);
@@ -27,6 +27,18 @@ openspace.exoplanets.documentation = {
       \\param listOfStarNames A list of star names for which to create the exoplanet systems
     ]]
   },
+  {
+    Name = "addExoplanetSystemsWithinDistance",
+    Arguments = {
+      { "distance", "Number" }
+    },
+    Documentation = [[
+      Add all exoplanet systems that have sufficient data for a visualization and that
+      are within a certain distance from the Sun to the scene.
+
+      \\param distance The maximum distance from the Sun, in parsec
+    ]]
+  },
   {
     Name = "loadExoplanetsFromCsv",
     Arguments = {
@@ -60,12 +72,17 @@ openspace.exoplanets.addExoplanetSystem = function (starName)
 end
 
 openspace.exoplanets.addExoplanetSystems = function (listOfStarNames)
-  for _,starName in pairs(listOflistOfStarNamesNames) do
-    local data = openspace.exoplanets.systemData(starName)
+  local dataList = openspace.exoplanets.systemsData(listOfStarNames)
+  for _,data in pairs(dataList) do
     addExoplanetSystem(data)
   end
 end
 
+openspace.exoplanets.addExoplanetSystemsWithinDistance = function (distance)
+  local starNames = openspace.exoplanets.systemsWithinDistance(distance)
+  openspace.exoplanets.addExoplanetSystems(starNames)
+end
+
 openspace.exoplanets.loadExoplanetsFromCsv = function (csvFile)
   local dataList = openspace.exoplanets.loadSystemDataFromCsv(csvFile)
   for _,data in pairs(dataList) do
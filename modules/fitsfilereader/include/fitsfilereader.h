@@ -85,9 +85,9 @@ public:
 
     /**
      * Reads a single FITS file with pre-defined columns (defined for Viennas TGAS-file).
-     * Returns a vector with all read stars with `nValuesPerStar`. If additional columns
-     * are given by `filterColumnNames`, they will be read but it will slow doen the
-     * reading tremendously.
+     * Returns a vector with all read stars with `nValuesPerStar`. Additional columns can
+     * be given by `filterColumnNames`. Only the requested columns are decoded, using all
+     * available hardware threads.
      */
     std::vector<float> readFitsFile(std::filesystem::path filePath, int& nValuesPerStar,
         int firstRow, int lastRow, std::vector<std::string> filterColumnNames,
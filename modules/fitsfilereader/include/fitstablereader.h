@@ -0,0 +1,126 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_FITSFILEREADER___FITSTABLEREADER___H__
+#define __OPENSPACE_MODULE_FITSFILEREADER___FITSTABLEREADER___H__
+
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A reader for binary table extensions of FITS files that only decodes the requested
+ * columns. The header is parsed when the reader is created, and the rows are read later
+ * in chunks. Each chunk is read from a separate file stream, so the chunks can be decoded
+ * and byte-swapped by multiple threads at the same time. The values are written directly
+ * into one buffer per column.
+ *
+ * Only scalar numerical (`B`, `I`, `J`, `K`, `E`, `D`) and logical (`L`) columns can be
+ * read. The `TSCALn` and `TZEROn` keywords are applied. Integer values that match
+ * `TNULLn`, and undefined logical values, are returned as NaN.
+ */
+class FitsTableReader {
+public:
+    struct Column {
+        /// The name of the column as given by the `TTYPEn` keyword
+        std::string name;
+
+        /// The data type character of the `TFORMn` keyword
+        char type = 0;
+
+        /// The repeat count of the `TFORMn` keyword
+        int repeat = 1;
+
+        /// The offset of the column in bytes from the beginning of a row
+        size_t offset = 0;
+
+        /// The `TSCALn` value of the column
+        double scale = 1.0;
+
+        /// The `TZEROn` value of the column
+        double zero = 0.0;
+
+        /// The `TNULLn` value of the column, if it exists
+        std::optional<int64_t> null;
+    };
+
+    /**
+     * Opens the FITS file at \p path and parses the header of the binary table at the
+     * extension with index \p hduIndex, where 1 is the first extension after the
+     * primary HDU.
+     *
+     * \throw ghoul::RuntimeError If the file could not be opened or the HDU is not a
+     *        valid binary table
+     */
+    explicit FitsTableReader(std::filesystem::path path, int hduIndex = 1);
+
+    /**
+     * Reads \p nRows rows starting at the (0-based) \p firstRow from the columns with
+     * the names \p columnNames. The values of the `i`-th column are written to
+     * `destinations[i]`, which must have room for \p nRows values. The rows are split
+     * into chunks that are distributed over \p nThreads threads.
+     *
+     * \throw ghoul::RuntimeError If a column does not exist, has an unsupported type, or
+     *        the file could not be read
+     * \pre \p columnNames and \p destinations must have the same size
+     * \pre `firstRow + nRows` must not be larger than #nRows
+     */
+    void readColumns(std::span<const std::string> columnNames, size_t firstRow,
+        size_t nRows, std::span<float* const> destinations, size_t nThreads = 1) const;
+
+    /**
+     * Reads the rows from \p firstRow up to at most \p nRows rows from the columns with
+     * the names \p columnNames and returns one buffer per column.
+     *
+     * \throw ghoul::RuntimeError If a column does not exist, has an unsupported type, or
+     *        the file could not be read
+     */
+    std::vector<std::vector<float>> readColumns(std::span<const std::string> columnNames,
+        size_t firstRow = 0, size_t nRows = std::numeric_limits<size_t>::max(),
+        size_t nThreads = 1) const;
+
+    /// Returns the index of the column with the provided name, ignoring case
+    std::optional<size_t> columnIndex(std::string_view name) const;
+
+    const std::vector<Column>& columns() const;
+    size_t nRows() const;
+    size_t rowSize() const;
+
+private:
+    std::filesystem::path _path;
+    std::vector<Column> _columns;
+    size_t _nRows = 0;
+    size_t _rowSize = 0;
+    size_t _dataOffset = 0;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_FITSFILEREADER___FITSTABLEREADER___H__
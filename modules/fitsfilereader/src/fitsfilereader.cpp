@@ -24,12 +24,16 @@
 
 #include <modules/fitsfilereader/include/fitsfilereader.h>
 
+#include <modules/fitsfilereader/include/fitstablereader.h>
+
 #include <openspace/util/distanceconversion.h>
 #include <ghoul/format.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/dictionary.h>
 #include <ghoul/misc/stringhelper.h>
 #include <fstream>
+#include <limits>
+#include <thread>
 
 #ifdef WIN32
 #pragma warning (push)
@@ -241,57 +245,52 @@ std::vector<float> FitsFileReader::readFitsFile(std::filesystem::path filePath,
     LINFO(allNames);
 
     // Read columns from FITS file. If rows aren't specified then full table will be read
-    const std::shared_ptr<TableData<float>> table = readTable<float>(
-        filePath,
+    const FitsTableReader reader = FitsTableReader(filePath);
+    const size_t first = static_cast<size_t>(firstRow - 1);
+    const size_t nRows = lastRow < firstRow ?
+        std::numeric_limits<size_t>::max() :
+        static_cast<size_t>(lastRow - firstRow + 1);
+    const std::vector<std::vector<float>> columns = reader.readColumns(
         allColumnNames,
-        firstRow,
-        lastRow
+        first,
+        nRows,
+        std::max(std::thread::hardware_concurrency(), 1u)
     );
 
-    if (!table) {
-        throw ghoul::RuntimeError(std::format("Failed to open Fits file '{}'", filePath));
-    }
-
-    int nStars = table->readRows - firstRow + 1;
+    const int nStars = static_cast<int>(columns[0].size());
 
     int nNullArr = 0;
     const int nColumnsRead = static_cast<int>(allColumnNames.size());
     const int defaultCols = 17; // Number of columns that are copied by predefined code
-    if (nColumnsRead != defaultCols) {
-        LINFO("Additional columns will be read! Consider add column in code for "
-            "significant speedup");
-    }
     // Declare how many values to save per star
     nValuesPerStar = nColumnsRead + 1; // +1 for B-V color value
 
-    // Copy columns to local variables
-    std::unordered_map<std::string, std::vector<float>>& tableContent = table->contents;
-
     // Default render parameters
-    std::vector<float> posXcol = std::move(tableContent[allColumnNames[0]]);
-    std::vector<float> posYcol = std::move(tableContent[allColumnNames[1]]);
-    std::vector<float> posZcol = std::move(tableContent[allColumnNames[2]]);
-    std::vector<float> velXcol = std::move(tableContent[allColumnNames[3]]);
-    std::vector<float> velYcol = std::move(tableContent[allColumnNames[4]]);
-    std::vector<float> velZcol = std::move(tableContent[allColumnNames[5]]);
-    std::vector<float> parallax = std::move(tableContent[allColumnNames[6]]);
-    std::vector<float> magCol = std::move(tableContent[allColumnNames[7]]);
-    std::vector<float> tycho_b = std::move(tableContent[allColumnNames[8]]);
-    std::vector<float> tycho_v = std::move(tableContent[allColumnNames[9]]);
+    const std::vector<float>& posXcol = columns[0];
+    const std::vector<float>& posYcol = columns[1];
+    const std::vector<float>& posZcol = columns[2];
+    const std::vector<float>& velXcol = columns[3];
+    const std::vector<float>& velYcol = columns[4];
+    const std::vector<float>& velZcol = columns[5];
+    const std::vector<float>& parallax = columns[6];
+    const std::vector<float>& magCol = columns[7];
+    const std::vector<float>& tycho_b = columns[8];
+    const std::vector<float>& tycho_v = columns[9];
 
     // Default filter parameters
-    // Additional filter parameters are handled as well but slows down reading
-    std::vector<float> parallax_err = std::move(tableContent[allColumnNames[10]]);
-    std::vector<float> pr_mot_ra = std::move(tableContent[allColumnNames[11]]);
-    std::vector<float> pr_mot_ra_err = std::move(tableContent[allColumnNames[12]]);
-    std::vector<float> pr_mot_dec = std::move(tableContent[allColumnNames[13]]);
-    std::vector<float> pr_mot_dec_err = std::move(tableContent[allColumnNames[14]]);
-    std::vector<float> tycho_b_err = std::move(tableContent[allColumnNames[15]]);
-    std::vector<float> tycho_v_err = std::move(tableContent[allColumnNames[16]]);
+    const std::vector<float>& parallax_err = columns[10];
+    const std::vector<float>& pr_mot_ra = columns[11];
+    const std::vector<float>& pr_mot_ra_err = columns[12];
+    const std::vector<float>& pr_mot_dec = columns[13];
+    const std::vector<float>& pr_mot_dec_err = columns[14];
+    const std::vector<float>& tycho_b_err = columns[15];
+    const std::vector<float>& tycho_v_err = columns[16];
+
+    fullData.reserve(static_cast<size_t>(nStars) * multiplier * nValuesPerStar);
+    std::vector<float> values(nValuesPerStar);
 
     // Construct data array. OBS: ORDERING IS IMPORTANT! This is where slicing happens.
     for (int i = 0; i < nStars * multiplier; i++) {
-        std::vector<float> values(nValuesPerStar);
         size_t idx = 0;
 
         // Default order for rendering:
@@ -341,10 +340,9 @@ std::vector<float> FitsFileReader::readFitsFile(std::filesystem::path filePath,
         values[idx++] = tycho_v[i % nStars];
         values[idx++] = tycho_v_err[i % nStars];
 
-        // Read extra columns, if any. This will slow down the sorting tremendously!
+        // Read extra columns, if any
         for (int col = defaultCols; col < nColumnsRead; ++col) {
-            std::vector<float> vecData = std::move(tableContent[allColumnNames[col]]);
-            values[idx++] = vecData[i];
+            values[idx++] = columns[col][i % nStars];
         }
 
         for (int j = 0; j < nValuesPerStar; j++) {
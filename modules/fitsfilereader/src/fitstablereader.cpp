@@ -0,0 +1,497 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/fitsfilereader/include/fitstablereader.h>
+
+#include <ghoul/format.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/exception.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+    // FITS files are organized in blocks of 2880 bytes and header cards of 80 bytes
+    constexpr size_t BlockSize = 2880;
+    constexpr size_t CardSize = 80;
+
+    // The number of bytes of rows that are read and decoded at a time by one thread
+    constexpr size_t ChunkSize = 8 << 20;
+
+    using Header = std::unordered_map<std::string, std::string>;
+
+    std::string trim(std::string_view str) {
+        const size_t first = str.find_first_not_of(' ');
+        if (first == std::string_view::npos) {
+            return "";
+        }
+        const size_t last = str.find_last_not_of(' ');
+        return std::string(str.substr(first, last - first + 1));
+    }
+
+    std::string toUpper(std::string_view str) {
+        std::string result = std::string(str);
+        std::transform(
+            result.begin(),
+            result.end(),
+            result.begin(),
+            [](unsigned char c) { return static_cast<char>(std::toupper(c)); }
+        );
+        return result;
+    }
+
+    // Reads the header that starts at the current position of the \p file and leaves the
+    // position at the beginning of the data of the HDU
+    Header readHeader(std::ifstream& file) {
+        Header header;
+        std::array<char, BlockSize> block;
+        while (true) {
+            file.read(block.data(), BlockSize);
+            if (!file.good()) {
+                throw ghoul::RuntimeError("Unexpected end of file while reading header");
+            }
+
+            for (size_t i = 0; i < BlockSize; i += CardSize) {
+                const std::string_view card =
+                    std::string_view(block.data() + i, CardSize);
+                const std::string keyword = trim(card.substr(0, 8));
+                if (keyword == "END") {
+                    return header;
+                }
+                // Cards without the value indicator are comments
+                if (card.substr(8, 2) != "= ") {
+                    continue;
+                }
+
+                const std::string_view value = card.substr(10);
+                const size_t start = value.find_first_not_of(' ');
+                if (start != std::string_view::npos && value[start] == '\'') {
+                    // String value where a quote is escaped by doubling it
+                    std::string str;
+                    for (size_t j = start + 1; j < value.size(); j++) {
+                        if (value[j] == '\'') {
+                            if (j + 1 < value.size() && value[j + 1] == '\'') {
+                                str += '\'';
+                                j++;
+                                continue;
+                            }
+                            break;
+                        }
+                        str += value[j];
+                    }
+                    header[keyword] = trim(str);
+                }
+                else {
+                    header[keyword] = trim(value.substr(0, value.find('/')));
+                }
+            }
+        }
+    }
+
+    int64_t intValue(const Header& header, const std::string& keyword,
+                     std::optional<int64_t> defaultValue = std::nullopt)
+    {
+        const auto it = header.find(keyword);
+        if (it == header.end()) {
+            if (defaultValue.has_value()) {
+                return *defaultValue;
+            }
+            throw ghoul::RuntimeError(std::format("Missing keyword '{}'", keyword));
+        }
+        return std::stoll(it->second);
+    }
+
+    double doubleValue(const Header& header, const std::string& keyword,
+                       double defaultValue)
+    {
+        const auto it = header.find(keyword);
+        if (it == header.end()) {
+            return defaultValue;
+        }
+        // FITS allows 'D' as the exponent character
+        std::string value = it->second;
+        std::replace(value.begin(), value.end(), 'D', 'E');
+        return std::stod(value);
+    }
+
+    // Returns the number of bytes of the data of an HDU including the padding
+    size_t dataSize(const Header& header) {
+        const int64_t nAxis = intValue(header, "NAXIS");
+        if (nAxis == 0) {
+            return 0;
+        }
+        int64_t nElements = 1;
+        for (int64_t i = 1; i <= nAxis; i++) {
+            nElements *= intValue(header, std::format("NAXIS{}", i));
+        }
+        const int64_t bitpix = std::abs(intValue(header, "BITPIX"));
+        const int64_t pCount = intValue(header, "PCOUNT", 0);
+        const int64_t gCount = intValue(header, "GCOUNT", 1);
+        const size_t size =
+            static_cast<size_t>(bitpix / 8 * gCount * (pCount + nElements));
+        return (size + BlockSize - 1) / BlockSize * BlockSize;
+    }
+
+    size_t typeSize(char type, int repeat) {
+        switch (type) {
+            case 'L':
+            case 'B':
+            case 'A':
+                return repeat;
+            case 'X':
+                return (repeat + 7) / 8;
+            case 'I':
+                return 2 * repeat;
+            case 'J':
+            case 'E':
+                return 4 * repeat;
+            case 'K':
+            case 'D':
+            case 'C':
+            case 'P':
+                return 8 * repeat;
+            case 'M':
+            case 'Q':
+                return 16 * repeat;
+            default:
+                throw ghoul::RuntimeError(std::format("Unknown column type '{}'", type));
+        }
+    }
+
+    // Loads an unsigned big-endian integer of size N. The loop has a constant trip count,
+    // which lets the compiler turn it into a single load and byte swap
+    template <int N>
+    uint64_t loadBigEndian(const char* data) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+        uint64_t value = 0;
+        for (int i = 0; i < N; i++) {
+            value = (value << 8) | p[i];
+        }
+        return value;
+    }
+
+    template <typename Int>
+    void decodeInteger(const openspace::FitsTableReader::Column& column,
+                       const char* data, size_t rowSize, size_t nRows, float* out)
+    {
+        constexpr int N = sizeof(Int);
+        const double scale = column.scale;
+        const double zero = column.zero;
+        const bool hasNull = column.null.has_value();
+        const int64_t null = column.null.value_or(0);
+        for (size_t i = 0; i < nRows; i++) {
+            const uint64_t raw = loadBigEndian<N>(data + i * rowSize);
+            const int64_t value = static_cast<Int>(raw);
+            out[i] = (hasNull && value == null) ?
+                std::numeric_limits<float>::quiet_NaN() :
+                static_cast<float>(value * scale + zero);
+        }
+    }
+
+    template <typename Float>
+    void decodeFloat(const openspace::FitsTableReader::Column& column, const char* data,
+                     size_t rowSize, size_t nRows, float* out)
+    {
+        using UInt = std::conditional_t<sizeof(Float) == 4, uint32_t, uint64_t>;
+        constexpr int N = sizeof(Float);
+        const double scale = column.scale;
+        const double zero = column.zero;
+        if (scale == 1.0 && zero == 0.0) {
+            for (size_t i = 0; i < nRows; i++) {
+                const UInt raw = static_cast<UInt>(loadBigEndian<N>(data + i * rowSize));
+                out[i] = static_cast<float>(std::bit_cast<Float>(raw));
+            }
+        }
+        else {
+            for (size_t i = 0; i < nRows; i++) {
+                const UInt raw = static_cast<UInt>(loadBigEndian<N>(data + i * rowSize));
+                out[i] = static_cast<float>(std::bit_cast<Float>(raw) * scale + zero);
+            }
+        }
+    }
+
+    void decodeColumn(const openspace::FitsTableReader::Column& column, const char* rows,
+                      size_t rowSize, size_t nRows, float* out)
+    {
+        const char* data = rows + column.offset;
+        switch (column.type) {
+            case 'L':
+                for (size_t i = 0; i < nRows; i++) {
+                    const char v = data[i * rowSize];
+                    out[i] = v == 'T' ? 1.f :
+                        (v == 'F' ? 0.f : std::numeric_limits<float>::quiet_NaN());
+                }
+                break;
+            case 'B':
+                decodeInteger<uint8_t>(column, data, rowSize, nRows, out);
+                break;
+            case 'I':
+                decodeInteger<int16_t>(column, data, rowSize, nRows, out);
+                break;
+            case 'J':
+                decodeInteger<int32_t>(column, data, rowSize, nRows, out);
+                break;
+            case 'K':
+                decodeInteger<int64_t>(column, data, rowSize, nRows, out);
+                break;
+            case 'E':
+                decodeFloat<float>(column, data, rowSize, nRows, out);
+                break;
+            case 'D':
+                decodeFloat<double>(column, data, rowSize, nRows, out);
+                break;
+            default:
+                throw ghoul::MissingCaseException();
+        }
+    }
+} // namespace
+
+namespace openspace {
+
+FitsTableReader::FitsTableReader(std::filesystem::path path, int hduIndex)
+    : _path(std::move(path))
+{
+    std::ifstream file = std::ifstream(_path, std::ios::binary);
+    if (!file.good()) {
+        throw ghoul::RuntimeError(std::format("Could not open FITS file '{}'", _path));
+    }
+
+    try {
+        Header header = readHeader(file);
+        if (header.find("SIMPLE") == header.end()) {
+            throw ghoul::RuntimeError("File does not start with a primary HDU");
+        }
+        // Headers consist of whole blocks, so we are now at the beginning of the data
+        size_t offset = static_cast<size_t>(file.tellg()) + dataSize(header);
+
+        for (int i = 1; i <= hduIndex; i++) {
+            file.seekg(offset);
+            header = readHeader(file);
+            offset = static_cast<size_t>(file.tellg());
+            if (i < hduIndex) {
+                offset += dataSize(header);
+            }
+        }
+
+        if (header["XTENSION"] != "BINTABLE") {
+            throw ghoul::RuntimeError(
+                std::format("HDU {} is not a binary table", hduIndex)
+            );
+        }
+
+        _dataOffset = offset;
+        _rowSize = static_cast<size_t>(intValue(header, "NAXIS1"));
+        _nRows = static_cast<size_t>(intValue(header, "NAXIS2"));
+
+        const int64_t nFields = intValue(header, "TFIELDS");
+        size_t columnOffset = 0;
+        for (int64_t i = 1; i <= nFields; i++) {
+            Column column;
+            const auto name = header.find(std::format("TTYPE{}", i));
+            if (name != header.end()) {
+                column.name = name->second;
+            }
+
+            const std::string form = header[std::format("TFORM{}", i)];
+            const size_t typePos = form.find_first_not_of("0123456789");
+            if (typePos == std::string::npos) {
+                throw ghoul::RuntimeError(std::format("Invalid TFORM{} '{}'", i, form));
+            }
+            column.repeat = typePos > 0 ? std::stoi(form.substr(0, typePos)) : 1;
+            column.type = form[typePos];
+            column.offset = columnOffset;
+            column.scale = doubleValue(header, std::format("TSCAL{}", i), 1.0);
+            column.zero = doubleValue(header, std::format("TZERO{}", i), 0.0);
+            const std::string nullKey = std::format("TNULL{}", i);
+            if (header.find(nullKey) != header.end()) {
+                column.null = intValue(header, nullKey);
+            }
+
+            columnOffset += typeSize(column.type, column.repeat);
+            _columns.push_back(std::move(column));
+        }
+
+        if (columnOffset != _rowSize) {
+            throw ghoul::RuntimeError(std::format(
+                "Size of the columns ({}) does not match the row size ({})",
+                columnOffset, _rowSize
+            ));
+        }
+    }
+    catch (const std::logic_error& e) {
+        // Thrown by the std::sto* functions for malformed values
+        throw ghoul::RuntimeError(
+            std::format("Malformed header in FITS file '{}': {}", _path, e.what())
+        );
+    }
+}
+
+void FitsTableReader::readColumns(std::span<const std::string> columnNames,
+                                  size_t firstRow, size_t nRows,
+                                  std::span<float* const> destinations,
+                                  size_t nThreads) const
+{
+    ghoul_assert(
+        columnNames.size() == destinations.size(),
+        "Column names and destinations must have the same size"
+    );
+    ghoul_assert(firstRow + nRows <= _nRows, "Rows out of range");
+
+    std::vector<const Column*> columns;
+    columns.reserve(columnNames.size());
+    for (const std::string& name : columnNames) {
+        const std::optional<size_t> index = columnIndex(name);
+        if (!index.has_value()) {
+            throw ghoul::RuntimeError(
+                std::format("Could not find column '{}' in '{}'", name, _path)
+            );
+        }
+        const Column& column = _columns[*index];
+        if (column.repeat != 1 || std::string_view("LBIJKED").find(column.type) ==
+                                  std::string_view::npos)
+        {
+            throw ghoul::RuntimeError(std::format(
+                "Column '{}' in '{}' with format {}{} is not a scalar numerical column",
+                name, _path, column.repeat, column.type
+            ));
+        }
+        columns.push_back(&column);
+    }
+
+    if (nRows == 0 || columns.empty()) {
+        return;
+    }
+
+    const size_t rowSize = std::max<size_t>(_rowSize, 1);
+    const size_t chunkRows = std::max<size_t>(ChunkSize / rowSize, 1);
+    const size_t nChunks = (nRows + chunkRows - 1) / chunkRows;
+    std::atomic<size_t> nextChunk = 0;
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    // Every thread uses its own stream and buffer, so the only shared state is the chunk
+    // counter. The destinations of different chunks never overlap
+    auto worker = [&]() {
+        try {
+            std::ifstream file = std::ifstream(_path, std::ios::binary);
+            std::vector<char> buffer;
+            for (size_t c = nextChunk++; c < nChunks; c = nextChunk++) {
+                const size_t first = c * chunkRows;
+                const size_t n = std::min(chunkRows, nRows - first);
+                buffer.resize(n * _rowSize);
+
+                file.seekg(_dataOffset + (firstRow + first) * _rowSize);
+                file.read(buffer.data(), buffer.size());
+                if (static_cast<size_t>(file.gcount()) != buffer.size()) {
+                    throw ghoul::RuntimeError(
+                        std::format("Unexpected end of FITS file '{}'", _path)
+                    );
+                }
+
+                for (size_t i = 0; i < columns.size(); i++) {
+                    decodeColumn(
+                        *columns[i],
+                        buffer.data(),
+                        _rowSize,
+                        n,
+                        destinations[i] + first
+                    );
+                }
+            }
+        }
+        catch (...) {
+            const std::lock_guard lock(errorMutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            // Stop the other threads from starting new chunks
+            nextChunk = nChunks;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const size_t nWorkers = std::clamp<size_t>(nThreads, 1, nChunks);
+    for (size_t i = 1; i < nWorkers; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+std::vector<std::vector<float>> FitsTableReader::readColumns(
+                                                 std::span<const std::string> columnNames,
+                                                            size_t firstRow, size_t nRows,
+                                                                    size_t nThreads) const
+{
+    firstRow = std::min(firstRow, _nRows);
+    nRows = std::min(nRows, _nRows - firstRow);
+
+    std::vector<std::vector<float>> result(columnNames.size());
+    std::vector<float*> destinations;
+    destinations.reserve(columnNames.size());
+    for (std::vector<float>& column : result) {
+        column.resize(nRows);
+        destinations.push_back(column.data());
+    }
+    readColumns(columnNames, firstRow, nRows, destinations, nThreads);
+    return result;
+}
+
+std::optional<size_t> FitsTableReader::columnIndex(std::string_view name) const {
+    const std::string upper = toUpper(name);
+    for (size_t i = 0; i < _columns.size(); i++) {
+        if (toUpper(_columns[i].name) == upper) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+const std::vector<FitsTableReader::Column>& FitsTableReader::columns() const {
+    return _columns;
+}
+
+size_t FitsTableReader::nRows() const {
+    return _nRows;
+}
+
+size_t FitsTableReader::rowSize() const {
+    return _rowSize;
+}
+
+} // namespace openspace
@@ -29,7 +29,11 @@
 #include <ghoul/format.h>
 #include <ghoul/glm.h>
 #include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/assert.h>
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <numeric>
 #include <thread>
 
 namespace {
@@ -53,6 +57,61 @@ namespace {
         }
         return index;
     }
+
+    // Subtrees with more stars than this are built on separate threads in a bulk
+    // insert if there are free hardware threads
+    constexpr size_t BulkParallelThreshold = 1 << 20;
+
+    /**
+     * Spreads the lowest 21 bits of \p v so that there are two zero bits between each of
+     * them.
+     */
+    uint64_t spreadBits(uint64_t v) {
+        v &= 0x1fffff;
+        v = (v | (v << 32)) & 0x1f00000000ffff;
+        v = (v | (v << 16)) & 0x1f0000ff0000ff;
+        v = (v | (v << 8)) & 0x100f00f00f00f00f;
+        v = (v | (v << 4)) & 0x10c30c30c30c30c3;
+        v = (v | (v << 2)) & 0x1249249249249249;
+        return v;
+    }
+
+    /**
+     * \return the index of the child of a node at \p depth that contains \p code
+     */
+    size_t mortonDigit(uint64_t code, size_t depth) {
+        using namespace openspace;
+        return static_cast<size_t>(
+            (code >> (3 * (OctreeManager::MortonLevels - depth - 1))) & 7
+        );
+    }
+
+    /**
+     * \return the indices of the \p nStars brightest stars in \p starValues, ordered by
+     *         increasing magnitude
+     */
+    std::vector<size_t> brightestStars(std::span<const float> starValues,
+                                       size_t valuesPerStar, size_t magIndex,
+                                       size_t nStars)
+    {
+        std::vector<size_t> indices(starValues.size() / valuesPerStar);
+        std::iota(indices.begin(), indices.end(), 0);
+        auto brighter = [&](size_t lhs, size_t rhs) {
+            return starValues[lhs * valuesPerStar + magIndex] <
+                   starValues[rhs * valuesPerStar + magIndex];
+        };
+
+        nStars = std::min(nStars, indices.size());
+        std::nth_element(
+            indices.begin(),
+            indices.begin() + nStars,
+            indices.end(),
+            brighter
+        );
+        indices.resize(nStars);
+        std::sort(indices.begin(), indices.end(), brighter);
+        return indices;
+    }
 } // namespace
 
 namespace openspace {
@@ -141,6 +200,177 @@ void OctreeManager::insert(const std::vector<float>& starValues) {
     insertInNode(*_root->children[index], starValues);
 }
 
+uint64_t OctreeManager::mortonCode(float posX, float posY, float posZ) const {
+    constexpr uint64_t MaxCoordinate = (uint64_t(1) << MortonLevels) - 1;
+    const double maxDist = static_cast<double>(MAX_DIST);
+
+    auto quantize = [maxDist](float pos) {
+        const double t = (static_cast<double>(pos) + maxDist) / (2.0 * maxDist);
+        const double scaled = std::clamp(
+            std::floor(t * (MaxCoordinate + 1)),
+            0.0,
+            static_cast<double>(MaxCoordinate)
+        );
+        // Mirror the coordinate so that the lower half of each axis gets the bit set,
+        // which makes every octal digit equal to the child index (see childIndex)
+        return MaxCoordinate - static_cast<uint64_t>(scaled);
+    };
+
+    return spreadBits(quantize(posX)) |
+           (spreadBits(quantize(posY)) << 1) |
+           (spreadBits(quantize(posZ)) << 2);
+}
+
+uint64_t OctreeManager::mortonPrefix(uint64_t code, size_t depth) {
+    return code >> (3 * (MortonLevels - depth));
+}
+
+void OctreeManager::prepareBulkInsert(const std::vector<uint32_t>& cellCounts,
+                                      size_t partitionDepth,
+                                      std::filesystem::path outFolderPath)
+{
+    ghoul_assert(
+        partitionDepth > 0 && partitionDepth <= static_cast<size_t>(MortonLevels),
+        "Invalid partition depth"
+    );
+    ghoul_assert(
+        cellCounts.size() == size_t(1) << (3 * partitionDepth),
+        "Wrong number of cell counts for partition depth"
+    );
+
+    _bulkInsert.nodes.clear();
+    _bulkInsert.innerNodes.clear();
+    _bulkInsert.branches.clear();
+    _bulkInsert.partitionDepth = partitionDepth;
+    _bulkInsert.currentNode = 0;
+    _bulkInsert.codeBuffer.clear();
+    _bulkInsert.valueBuffer.clear();
+    _bulkInsert.outFolderPath = std::move(outFolderPath);
+    _bulkInsert.nSkippedStars = 0;
+    _bulkInsert.nFreeThreads = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+
+    std::vector<uint64_t> cellOffsets(cellCounts.size() + 1, 0);
+    std::partial_sum(cellCounts.begin(), cellCounts.end(), cellOffsets.begin() + 1);
+
+    const size_t cellsPerBranch = cellCounts.size() / 8;
+    std::vector<OctreeNode*> ancestors;
+    for (size_t i = 0; i < 8; i++) {
+        const size_t cellBegin = i * cellsPerBranch;
+        const size_t cellEnd = cellBegin + cellsPerBranch;
+        if (cellOffsets[cellEnd] == cellOffsets[cellBegin]) {
+            continue;
+        }
+
+        if (!_root->children[i]->isLeaf || _root->children[i]->numStars > 0) {
+            LERROR(std::format("Branch {} is not empty, skipping bulk insert", i));
+            continue;
+        }
+
+        _bulkInsert.branches.push_back(i);
+        prepareBulkNode(
+            _root->children[i],
+            1,
+            cellBegin,
+            cellEnd,
+            cellOffsets,
+            ancestors
+        );
+    }
+}
+
+void OctreeManager::insertSorted(std::span<const uint64_t> codes,
+                                 std::span<const float> starValues)
+{
+    std::vector<BulkNode>& nodes = _bulkInsert.nodes;
+    std::vector<uint64_t>& codeBuffer = _bulkInsert.codeBuffer;
+    std::vector<float>& valueBuffer = _bulkInsert.valueBuffer;
+
+    size_t i = 0;
+    while (i < codes.size()) {
+        // Finish all nodes that end before the next star
+        while (_bulkInsert.currentNode < nodes.size() &&
+               codes[i] >= nodes[_bulkInsert.currentNode].endCode)
+        {
+            if (!codeBuffer.empty()) {
+                fillBulkNode(codeBuffer, valueBuffer);
+                codeBuffer.clear();
+                valueBuffer.clear();
+            }
+            _bulkInsert.currentNode++;
+        }
+
+        if (_bulkInsert.currentNode == nodes.size()) {
+            _bulkInsert.nSkippedStars += codes.size() - i;
+            return;
+        }
+
+        // Stars in front of the current node belong to a branch that was skipped
+        const uint64_t beginCode = nodes[_bulkInsert.currentNode].beginCode;
+        if (codes[i] < beginCode) {
+            const size_t begin =
+                std::lower_bound(codes.begin() + i, codes.end(), beginCode) -
+                codes.begin();
+            _bulkInsert.nSkippedStars += begin - i;
+            i = begin;
+            continue;
+        }
+
+        const uint64_t endCode = nodes[_bulkInsert.currentNode].endCode;
+        const size_t end = std::lower_bound(codes.begin() + i, codes.end(), endCode) -
+                           codes.begin();
+
+        if (codeBuffer.empty() && end < codes.size()) {
+            // All stars of the node are in this batch, so no need to copy them
+            fillBulkNode(
+                codes.subspan(i, end - i),
+                starValues.subspan(i * _valuesPerStar, (end - i) * _valuesPerStar)
+            );
+            _bulkInsert.currentNode++;
+        }
+        else {
+            // The node might continue in the next batch
+            codeBuffer.insert(codeBuffer.end(), codes.begin() + i, codes.begin() + end);
+            valueBuffer.insert(
+                valueBuffer.end(),
+                starValues.begin() + i * _valuesPerStar,
+                starValues.begin() + end * _valuesPerStar
+            );
+        }
+        i = end;
+    }
+}
+
+void OctreeManager::finishBulkInsert() {
+    if (!_bulkInsert.codeBuffer.empty()) {
+        fillBulkNode(_bulkInsert.codeBuffer, _bulkInsert.valueBuffer);
+    }
+    _bulkInsert.codeBuffer = std::vector<uint64_t>();
+    _bulkInsert.valueBuffer = std::vector<float>();
+
+    if (_bulkInsert.nSkippedStars > 0) {
+        LERROR(std::format(
+            "{} stars are outside of the prepared branches and were skipped",
+            _bulkInsert.nSkippedStars
+        ));
+    }
+
+    for (OctreeNode* node : _bulkInsert.innerNodes) {
+        compactLodCache(*node);
+    }
+
+    if (!_bulkInsert.outFolderPath.empty()) {
+        // Everything below the partition depth has already been written and cleared, so
+        // this only writes the LOD cache of the upper levels
+        for (size_t branchIndex : _bulkInsert.branches) {
+            writeToMultipleFiles(_bulkInsert.outFolderPath, branchIndex);
+        }
+    }
+
+    _bulkInsert.nodes.clear();
+    _bulkInsert.innerNodes.clear();
+    _bulkInsert.branches.clear();
+}
+
 void OctreeManager::sliceLodData(size_t branchIndex) {
     if (branchIndex != 8) {
         sliceNodeLodCache(*_root->children[branchIndex]);
@@ -1057,7 +1287,7 @@ void OctreeManager::sliceNodeLodCache(OctreeNode& node) {
 }
 
 void OctreeManager::storeStarData(OctreeNode& node,
-                                  const std::vector<float>& starValues) const
+                                  std::span<const float> starValues) const
 {
     // Insert star data at the back of vectors and store a vector with pairs consisting of
     // star magnitude and insert index for later sorting and slicing of LOD cache
@@ -1065,18 +1295,215 @@ void OctreeManager::storeStarData(OctreeNode& node,
     node.magOrder.insert(node.magOrder.end(), std::make_pair(mag, node.numStars));
     node.numStars++;
 
-    // If LOD is growing too large then sort it and resize to [chunk size] to avoid too
-    // much RAM usage and increase threshold for adding new stars
-    if (node.magOrder.size() > MAX_STARS_PER_NODE * 2) {
-        std::sort(node.magOrder.begin(), node.magOrder.end());
-        node.magOrder.resize(MAX_STARS_PER_NODE);
-    }
-
     auto posEnd = starValues.begin() + POS_SIZE;
     auto colEnd = posEnd + COL_SIZE;
     node.posData.insert(node.posData.end(), starValues.begin(), posEnd);
     node.colData.insert(node.colData.end(), posEnd, colEnd);
     node.velData.insert(node.velData.end(), colEnd, starValues.end());
+
+    // If LOD is growing too large then sort it and resize to [chunk size] to avoid too
+    // much RAM usage and increase threshold for adding new stars
+    if (node.magOrder.size() > MAX_STARS_PER_NODE * 2) {
+        compactLodCache(node);
+    }
+}
+
+void OctreeManager::compactLodCache(OctreeNode& node) const {
+    std::sort(node.magOrder.begin(), node.magOrder.end());
+    node.magOrder.resize(std::min(node.magOrder.size(), MAX_STARS_PER_NODE));
+
+    std::vector<float> tmpPos;
+    std::vector<float> tmpCol;
+    std::vector<float> tmpVel;
+    tmpPos.reserve(node.magOrder.size() * POS_SIZE);
+    tmpCol.reserve(node.magOrder.size() * COL_SIZE);
+    tmpVel.reserve(node.magOrder.size() * VEL_SIZE);
+    for (size_t i = 0; i < node.magOrder.size(); i++) {
+        const size_t placement = node.magOrder[i].second;
+        auto posBegin = node.posData.begin() + placement * POS_SIZE;
+        auto colBegin = node.colData.begin() + placement * COL_SIZE;
+        auto velBegin = node.velData.begin() + placement * VEL_SIZE;
+        tmpPos.insert(tmpPos.end(), posBegin, posBegin + POS_SIZE);
+        tmpCol.insert(tmpCol.end(), colBegin, colBegin + COL_SIZE);
+        tmpVel.insert(tmpVel.end(), velBegin, velBegin + VEL_SIZE);
+        node.magOrder[i].second = i;
+    }
+    node.posData = std::move(tmpPos);
+    node.colData = std::move(tmpCol);
+    node.velData = std::move(tmpVel);
+    node.numStars = node.magOrder.size();
+}
+
+void OctreeManager::prepareBulkNode(const std::shared_ptr<OctreeNode>& node,
+                                    size_t depth, size_t cellBegin, size_t cellEnd,
+                                    const std::vector<uint64_t>& cellOffsets,
+                                    std::vector<OctreeNode*>& ancestors)
+{
+    const uint64_t nStars = cellOffsets[cellEnd] - cellOffsets[cellBegin];
+    if (nStars <= MAX_STARS_PER_NODE || depth == _bulkInsert.partitionDepth) {
+        // All stars of this node will be inserted in one go by insertSorted
+        const size_t shift = 3 * (MortonLevels - _bulkInsert.partitionDepth);
+        _bulkInsert.nodes.push_back({
+            .node = node,
+            .ancestors = ancestors,
+            .beginCode = static_cast<uint64_t>(cellBegin) << shift,
+            .endCode = static_cast<uint64_t>(cellEnd) << shift,
+            .depth = depth
+        });
+        return;
+    }
+
+    createNodeChildren(*node);
+    _bulkInsert.innerNodes.push_back(node.get());
+
+    ancestors.push_back(node.get());
+    const size_t cellsPerChild = (cellEnd - cellBegin) / 8;
+    for (size_t i = 0; i < 8; i++) {
+        const size_t childBegin = cellBegin + i * cellsPerChild;
+        prepareBulkNode(
+            node->children[i],
+            depth + 1,
+            childBegin,
+            childBegin + cellsPerChild,
+            cellOffsets,
+            ancestors
+        );
+    }
+    ancestors.pop_back();
+}
+
+void OctreeManager::fillBulkNode(std::span<const uint64_t> codes,
+                                 std::span<const float> starValues)
+{
+    const BulkNode& bulkNode = _bulkInsert.nodes[_bulkInsert.currentNode];
+    buildBulkNode(*bulkNode.node, codes, starValues, bulkNode.depth);
+
+    // The brightest stars of this node are LOD candidates for all of its ancestors
+    if (!bulkNode.ancestors.empty()) {
+        const std::vector<size_t> brightest = brightestStars(
+            starValues,
+            _valuesPerStar,
+            POS_SIZE,
+            MAX_STARS_PER_NODE
+        );
+        for (OctreeNode* ancestor : bulkNode.ancestors) {
+            for (const size_t i : brightest) {
+                storeStarData(
+                    *ancestor,
+                    starValues.subspan(i * _valuesPerStar, _valuesPerStar)
+                );
+            }
+        }
+    }
+
+    if (!_bulkInsert.outFolderPath.empty()) {
+        // Name the files the same way as writeToMultipleFiles does, i.e. by the position
+        // of the node in the Octree without the root
+        const std::string position =
+            std::to_string(bulkNode.node->octreePositionIndex).substr(1);
+        writeNodeToMultipleFiles(
+            std::format("{}{}", _bulkInsert.outFolderPath, position),
+            *bulkNode.node,
+            false
+        );
+        clearNodeData(*bulkNode.node);
+    }
+}
+
+void OctreeManager::buildBulkNode(OctreeNode& node, std::span<const uint64_t> codes,
+                                  std::span<const float> starValues, size_t depth)
+{
+    const size_t nStars = codes.size();
+
+    // Stars that share the same Morton code can't be split any further
+    if (nStars <= MAX_STARS_PER_NODE || depth >= static_cast<size_t>(MortonLevels)) {
+        node.numStars = nStars;
+        node.posData.reserve(nStars * POS_SIZE);
+        node.colData.reserve(nStars * COL_SIZE);
+        node.velData.reserve(nStars * VEL_SIZE);
+        for (size_t i = 0; i < nStars; i++) {
+            auto posBegin = starValues.begin() + i * _valuesPerStar;
+            auto colBegin = posBegin + POS_SIZE;
+            auto velBegin = colBegin + COL_SIZE;
+            node.posData.insert(node.posData.end(), posBegin, colBegin);
+            node.colData.insert(node.colData.end(), colBegin, velBegin);
+            node.velData.insert(node.velData.end(), velBegin, velBegin + VEL_SIZE);
+        }
+
+        size_t total = _totalDepth;
+        while (depth > total && !_totalDepth.compare_exchange_weak(total, depth)) {}
+        return;
+    }
+
+    createNodeChildren(node);
+
+    // The stars are sorted, so the stars of each child are stored contiguously
+    std::array<size_t, 9> bounds = {};
+    for (size_t i = 0; i < 8; i++) {
+        auto it = std::partition_point(
+            codes.begin() + bounds[i],
+            codes.end(),
+            [depth, i](uint64_t code) { return mortonDigit(code, depth) <= i; }
+        );
+        bounds[i + 1] = it - codes.begin();
+    }
+
+    auto buildChild = [&](size_t i) {
+        buildBulkNode(
+            *node.children[i],
+            codes.subspan(bounds[i], bounds[i + 1] - bounds[i]),
+            starValues.subspan(
+                bounds[i] * _valuesPerStar,
+                (bounds[i + 1] - bounds[i]) * _valuesPerStar
+            ),
+            depth + 1
+        );
+    };
+    // Large children are built on a thread of their own as long as there are free
+    // hardware threads left, all others are built on this thread
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 8; i++) {
+        size_t nFree = 0;
+        if (bounds[i + 1] - bounds[i] > BulkParallelThreshold) {
+            nFree = _bulkInsert.nFreeThreads;
+            while (nFree > 0 &&
+                   !_bulkInsert.nFreeThreads.compare_exchange_weak(nFree, nFree - 1))
+            {}
+        }
+
+        if (nFree > 0) {
+            threads.emplace_back(buildChild, i);
+        }
+        else {
+            buildChild(i);
+        }
+    }
+    for (std::thread& t : threads) {
+        t.join();
+        _bulkInsert.nFreeThreads++;
+    }
+
+    // Store the brightest stars of all descendants as LOD data, ordered by magnitude
+    const std::vector<size_t> brightest = brightestStars(
+        starValues,
+        _valuesPerStar,
+        POS_SIZE,
+        MAX_STARS_PER_NODE
+    );
+    node.posData.reserve(brightest.size() * POS_SIZE);
+    node.colData.reserve(brightest.size() * COL_SIZE);
+    node.velData.reserve(brightest.size() * VEL_SIZE);
+    node.magOrder.reserve(brightest.size());
+    for (const size_t i : brightest) {
+        auto posBegin = starValues.begin() + i * _valuesPerStar;
+        auto colBegin = posBegin + POS_SIZE;
+        auto velBegin = colBegin + COL_SIZE;
+        node.magOrder.emplace_back(*colBegin, node.magOrder.size());
+        node.posData.insert(node.posData.end(), posBegin, colBegin);
+        node.colData.insert(node.colData.end(), colBegin, velBegin);
+        node.velData.insert(node.velData.end(), velBegin, velBegin + VEL_SIZE);
+    }
+    node.numStars = brightest.size();
 }
 
 std::string OctreeManager::printStarsPerNode(const OctreeNode& node,
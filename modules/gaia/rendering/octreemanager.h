@@ -29,10 +29,12 @@
 #include <ghoul/glm.h>
 #include <ghoul/opengl/ghoul_gl.h>
 #include <array>
+#include <atomic>
 #include <filesystem>
 #include <map>
 #include <mutex>
 #include <queue>
+#include <span>
 #include <stack>
 #include <vector>
 
@@ -61,6 +63,9 @@ public:
         unsigned long long octreePositionIndex;
     };
 
+    /// The number of levels that are encoded in a Morton code (3 bits per level)
+    static constexpr int MortonLevels = 21;
+
     OctreeManager() = default;
     ~OctreeManager() = default;
 
@@ -84,6 +89,60 @@ public:
      */
     void insert(const std::vector<float>& starValues);
 
+    /**
+     * Computes the Morton code (Z-order) of a star position. The position is quantized
+     * to #MortonLevels bits per axis inside the MAX_DIST cube, and the octal digit at
+     * each level of the code is the index of the child that contains the star, so
+     * sorting stars by this code orders them the same way as the nodes are stored in the
+     * Octree files. Stars outside of the cube are clamped to the border nodes.
+     */
+    uint64_t mortonCode(float posX, float posY, float posZ) const;
+
+    /**
+     * \return the leading \p depth octal digits of the Morton \p code, which is the
+     *         index of the cell that contains the star in a uniform grid with `8^depth`
+     *         cells
+     */
+    static uint64_t mortonPrefix(uint64_t code, size_t depth);
+
+    /**
+     * Prepares a bulk construction of the Octree from stars that are sorted by their
+     * #mortonCode. \p cellCounts contains the number of stars in every cell of a uniform
+     * grid at \p partitionDepth (see #mortonPrefix) and is used to create the upper
+     * levels of the node structure up front. All stars of a branch that has stars in
+     * \p cellCounts have to be inserted with #insertSorted before #finishBulkInsert is
+     * called, and the branch has to be empty before. Stars of branches that are not
+     * empty are skipped by #insertSorted.
+     *
+     * \param cellCounts The number of stars per cell at the partition depth
+     * \param partitionDepth The depth of the grid that is used for the cell counts
+     * \param outFolderPath If this is not empty, every node below the partition depth is
+     *        written to its own file in this folder and cleared as soon as all of its
+     *        stars have been inserted, which bounds the memory usage of the construction
+     */
+    void prepareBulkInsert(const std::vector<uint32_t>& cellCounts, size_t partitionDepth,
+        std::filesystem::path outFolderPath = std::filesystem::path());
+
+    /**
+     * Inserts a batch of stars that are sorted by their #mortonCode. Consecutive calls
+     * have to continue where the previous batch ended. Nodes are created top-down from
+     * the sorted data and the LOD cache of inner nodes is filled with the
+     * MAX_STARS_PER_NODE brightest stars of their descendants, which results in the same
+     * node structure as calling #insert for every star followed by #sliceLodData.
+     *
+     * \param codes The Morton codes of the stars in increasing order
+     * \param starValues The render values of the stars, in the same order as \p codes
+     */
+    void insertSorted(std::span<const uint64_t> codes, std::span<const float> starValues);
+
+    /**
+     * Finishes a bulk construction that was started with #prepareBulkInsert by slicing
+     * the LOD cache of the upper levels of the Octree. If an output folder was provided,
+     * the remaining node data of all constructed branches is written to that folder and
+     * cleared.
+     */
+    void finishBulkInsert();
+
     /**
      * Slices LOD data so only the MAX_STARS_PER_NODE brightest stars are stored in inner
      * nodes. If \p branchIndex is defined then only that branch will be sliced. Calls
@@ -225,7 +284,39 @@ private:
      * Private help function for `insertInNode()`. Stores star data in node and
      * keeps track of the brightest stars all children.
      */
-    void storeStarData(OctreeNode& node, const std::vector<float>& starValues) const;
+    void storeStarData(OctreeNode& node, std::span<const float> starValues) const;
+
+    /**
+     * Sorts the LOD cache of \p node by magnitude and only keeps the MAX_STARS_PER_NODE
+     * brightest stars, both in the magnitude order and in the stored star data.
+     */
+    void compactLodCache(OctreeNode& node) const;
+
+    /**
+     * Private help function for `prepareBulkInsert()`. Creates the children of \p node
+     * if the cells in the range [\p cellBegin, \p cellEnd) contain more than
+     * MAX_STARS_PER_NODE stars and \p depth is above the partition depth. Otherwise the
+     * node is stored as a node that is filled by `insertSorted()`.
+     */
+    void prepareBulkNode(const std::shared_ptr<OctreeNode>& node, size_t depth,
+        size_t cellBegin, size_t cellEnd, const std::vector<uint64_t>& cellOffsets,
+        std::vector<OctreeNode*>& ancestors);
+
+    /**
+     * Private help function for `insertSorted()`. Builds the subtree of the current bulk
+     * node from all of its stars and propagates its brightest stars to the LOD cache of
+     * its ancestors.
+     */
+    void fillBulkNode(std::span<const uint64_t> codes, std::span<const float> starValues);
+
+    /**
+     * Recursively builds the subtree of \p node from Morton sorted stars. Nodes with more
+     * than MAX_STARS_PER_NODE stars are split and store their brightest descendants as
+     * LOD data. Large subtrees are built in parallel, using at most as many threads as
+     * there are hardware threads in total.
+     */
+    void buildBulkNode(OctreeNode& node, std::span<const uint64_t> codes,
+        std::span<const float> starValues, size_t depth);
 
     /**
      * Private help function for `printStarsPerNode()`.
@@ -390,6 +481,27 @@ private:
      */
     void propagateUnloadedNodes(std::vector<std::shared_ptr<OctreeNode>> ancestorNodes);
 
+    struct BulkNode {
+        std::shared_ptr<OctreeNode> node;
+        std::vector<OctreeNode*> ancestors;
+        uint64_t beginCode = 0;
+        uint64_t endCode = 0;
+        size_t depth = 0;
+    };
+
+    struct {
+        std::vector<BulkNode> nodes;
+        std::vector<OctreeNode*> innerNodes;
+        std::vector<size_t> branches;
+        size_t partitionDepth = 0;
+        size_t currentNode = 0;
+        std::vector<uint64_t> codeBuffer;
+        std::vector<float> valueBuffer;
+        std::filesystem::path outFolderPath;
+        size_t nSkippedStars = 0;
+        std::atomic<size_t> nFreeThreads = 0;
+    } _bulkInsert;
+
     std::shared_ptr<OctreeNode> _root;
     std::unique_ptr<OctreeCuller> _culler;
     std::stack<int> _freeSpotsInBuffer;
@@ -397,9 +509,9 @@ private:
     std::queue<unsigned long long> _leastRecentlyFetchedNodes;
     std::mutex _leastRecentlyFetchedNodesMutex;
 
-    size_t _totalDepth = 0;
-    size_t _numLeafNodes = 0;
-    size_t _numInnerNodes = 0;
+    std::atomic<size_t> _totalDepth = 0;
+    std::atomic<size_t> _numLeafNodes = 0;
+    std::atomic<size_t> _numInnerNodes = 0;
     size_t _biggestChunkIndexInUse = 0;
     size_t _valuesPerStar = 0;
     float _minTotalPixelsLod = 0.f;
@@ -30,13 +30,153 @@
 #include <ghoul/format.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/dictionary.h>
+#include <ghoul/misc/exception.h>
+#include <array>
 #include <filesystem>
 #include <fstream>
+#include <queue>
 #include <thread>
 
 namespace {
     constexpr std::string_view _loggerCat = "ConstructOctreeTask";
 
+    // The depth of the grid that is used to create the upper levels of the Octree in a
+    // bulk construction. Nodes below this depth are built from the sorted data
+    constexpr size_t BulkPartitionDepth = 6;
+
+    // The number of stars that are read, written or inserted at a time when merging
+    // sorted chunks
+    constexpr size_t SortedBlockSize = 1 << 20;
+
+    size_t numberOfThreads() {
+        return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    /**
+     * Splits [0, \p n) into \p nThreads contiguous blocks and calls
+     * `func(threadIndex, begin, end)` for each of them on a separate thread.
+     */
+    template <typename Func>
+    void parallelFor(size_t n, size_t nThreads, const Func& func) {
+        const size_t blockSize = (n + nThreads - 1) / nThreads;
+        std::vector<std::thread> threads;
+        threads.reserve(nThreads);
+        for (size_t t = 0; t < nThreads; t++) {
+            const size_t begin = std::min(n, t * blockSize);
+            const size_t end = std::min(n, begin + blockSize);
+            threads.emplace_back([&func, t, begin, end]() { func(t, begin, end); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Stable parallel least-significant-digit radix sort of (key, payload) pairs. Passes
+     * in which all keys share the same digit are skipped.
+     */
+    void radixSort(std::vector<std::pair<uint64_t, uint32_t>>& keys) {
+        const size_t nThreads = numberOfThreads();
+        std::vector<std::pair<uint64_t, uint32_t>> buffer(keys.size());
+        std::vector<std::array<size_t, 256>> histograms(nThreads);
+
+        for (int shift = 0; shift < 64; shift += 8) {
+            parallelFor(keys.size(), nThreads, [&](size_t t, size_t begin, size_t end) {
+                histograms[t].fill(0);
+                for (size_t i = begin; i < end; i++) {
+                    histograms[t][(keys[i].first >> shift) & 0xff]++;
+                }
+            });
+
+            // Turn the histograms into scatter offsets. Going through the threads in
+            // order for each digit keeps the sort stable
+            bool isSortedByDigit = false;
+            size_t offset = 0;
+            for (size_t digit = 0; digit < 256; digit++) {
+                size_t nInDigit = 0;
+                for (size_t t = 0; t < nThreads; t++) {
+                    const size_t count = histograms[t][digit];
+                    histograms[t][digit] = offset;
+                    offset += count;
+                    nInDigit += count;
+                }
+                isSortedByDigit |= (nInDigit == keys.size());
+            }
+            if (isSortedByDigit) {
+                continue;
+            }
+
+            parallelFor(keys.size(), nThreads, [&](size_t t, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    buffer[histograms[t][(keys[i].first >> shift) & 0xff]++] = keys[i];
+                }
+            });
+            keys.swap(buffer);
+        }
+    }
+
+    void countCells(std::span<const uint64_t> codes, std::vector<uint32_t>& cellCounts) {
+        using namespace openspace;
+        for (const uint64_t code : codes) {
+            cellCounts[OctreeManager::mortonPrefix(code, BulkPartitionDepth)]++;
+        }
+    }
+
+    /**
+     * Writes sorted stars to a temporary file in blocks of `SortedBlockSize` stars.
+     */
+    void writeSortedRun(const std::filesystem::path& path,
+                        std::span<const uint64_t> codes, std::span<const float> values,
+                        size_t valuesPerStar)
+    {
+        std::ofstream outFileStream(path, std::ofstream::binary);
+        if (!outFileStream.good()) {
+            throw ghoul::RuntimeError(std::format(
+                "Error opening file '{}' for sorted star data", path
+            ));
+        }
+
+        for (size_t i = 0; i < codes.size(); i += SortedBlockSize) {
+            const uint64_t nStars = std::min(SortedBlockSize, codes.size() - i);
+            outFileStream.write(reinterpret_cast<const char*>(&nStars), sizeof(uint64_t));
+            outFileStream.write(
+                reinterpret_cast<const char*>(&codes[i]),
+                nStars * sizeof(uint64_t)
+            );
+            outFileStream.write(
+                reinterpret_cast<const char*>(&values[i * valuesPerStar]),
+                nStars * valuesPerStar * sizeof(float)
+            );
+        }
+    }
+
+    /**
+     * Reads back the blocks of a file written by writeSortedRun.
+     */
+    struct SortedRunReader {
+        bool nextBlock(size_t valuesPerStar) {
+            uint64_t nStars = 0;
+            stream.read(reinterpret_cast<char*>(&nStars), sizeof(uint64_t));
+            if (!stream.good() || nStars == 0) {
+                return false;
+            }
+            codes.resize(nStars);
+            values.resize(nStars * valuesPerStar);
+            stream.read(reinterpret_cast<char*>(codes.data()), nStars * sizeof(uint64_t));
+            stream.read(
+                reinterpret_cast<char*>(values.data()),
+                values.size() * sizeof(float)
+            );
+            pos = 0;
+            return stream.good();
+        }
+
+        std::ifstream stream;
+        std::vector<uint64_t> codes;
+        std::vector<float> values;
+        size_t pos = 0;
+    };
+
     struct [[codegen::Dictionary(ConstructOctreeTask)]] Parameters {
         // If SingleFileInput is set to true then this specifies the path to a single BIN
         // file containing a full dataset. Otherwise this specifies the path to a folder
@@ -59,6 +199,17 @@ namespace {
         // folder and output multiple files for the Octree
         std::optional<bool> singleFileInput;
 
+        // If true then the Octree is constructed in bulk instead of inserting one star at
+        // a time. All stars are sorted by their Morton code with a parallel radix sort
+        // and the nodes are created top-down from the sorted data, which results in the
+        // same node and file layout as the default construction
+        std::optional<bool> bulkConstruction;
+
+        // The number of stars that are sorted in memory at a time when constructing the
+        // Octree in bulk from a folder. Files with more stars are sorted in chunks that
+        // are written to temporary files in the output folder and merged afterwards
+        std::optional<int> bulkChunkSize [[codegen::greater(0)]];
+
         // If defined then only stars with Position X values between [min, max] will be
         // inserted into Octree (if min is set to 0.0 it is read as -Inf, if max is set to
         // 0.0 it is read as +Inf). If min = max then all values equal min|max will be
@@ -216,6 +367,10 @@ ConstructOctreeTask::ConstructOctreeTask(const ghoul::Dictionary& dictionary) {
     _maxDist = p.maxDist.value_or(_maxDist);
     _maxStarsPerNode = p.maxStarsPerNode.value_or(_maxStarsPerNode);
     _singleFileInput = p.singleFileInput.value_or(_singleFileInput);
+    _bulkConstruction = p.bulkConstruction.value_or(_bulkConstruction);
+    if (p.bulkChunkSize.has_value()) {
+        _bulkChunkSize = static_cast<size_t>(*p.bulkChunkSize);
+    }
 
     _octreeManager = std::make_shared<OctreeManager>();
     _indexOctreeManager = std::make_shared<OctreeManager>();
@@ -386,21 +541,41 @@ void ConstructOctreeTask::constructOctreeFromSingleFile(
         progressCallback(0.3f);
         LINFO("Constructing Octree");
 
-        // Insert star into octree. We assume the data already is in correct order.
-        for (size_t i = 0; i < fullData.size(); i += nValuesPerStar) {
-            auto first = fullData.begin() + i;
-            auto last = fullData.begin() + i + nValuesPerStar;
-            const std::vector<float> filterValues(first, last);
-            const std::vector<float> renderValues(first, first + RENDER_VALUES);
+        if (_bulkConstruction) {
+            SortedStars stars = sortStars(
+                *_octreeManager,
+                fullData,
+                nValuesPerStar,
+                nFilteredStars
+            );
+            // The sorted copy contains everything that is needed from here on
+            fullData.clear();
+            fullData.shrink_to_fit();
+
+            std::vector<uint32_t> cellCounts(size_t(1) << (3 * BulkPartitionDepth), 0);
+            countCells(stars.codes, cellCounts);
+
+            _octreeManager->prepareBulkInsert(cellCounts, BulkPartitionDepth);
+            _octreeManager->insertSorted(stars.codes, stars.values);
+            _octreeManager->finishBulkInsert();
+        }
+        else {
+            // Insert star into octree. We assume the data already is in correct order.
+            for (size_t i = 0; i < fullData.size(); i += nValuesPerStar) {
+                auto first = fullData.begin() + i;
+                auto last = fullData.begin() + i + nValuesPerStar;
+                const std::vector<float> filterValues(first, last);
+                const std::vector<float> renderValues(first, first + RENDER_VALUES);
+
+                // Filter data by parameters.
+                if (checkAllFilters(filterValues)) {
+                    nFilteredStars++;
+                    continue;
+                }
 
-            // Filter data by parameters.
-            if (checkAllFilters(filterValues)) {
-                nFilteredStars++;
-                continue;
+                // If all filters passed then insert render values into Octree.
+                _octreeManager->insert(renderValues);
             }
-
-            // If all filters passed then insert render values into Octree.
-            _octreeManager->insert(renderValues);
         }
         inFileStream.close();
     }
@@ -411,8 +586,10 @@ void ConstructOctreeTask::constructOctreeFromSingleFile(
     }
     LINFO(std::format("{} of {} read stars were filtered", nFilteredStars, nTotalStars));
 
-    // Slice LOD data before writing to files.
-    _octreeManager->sliceLodData();
+    // Slice LOD data before writing to files. A bulk construction is already sliced
+    if (!_bulkConstruction) {
+        _octreeManager->sliceLodData();
+    }
 
     LINFO(std::format("Writing octree to '{}'", _outFileOrFolderPath));
     std::ofstream outFileStream(_outFileOrFolderPath, std::ofstream::binary);
@@ -479,6 +656,27 @@ void ConstructOctreeTask::constructOctreeFromFolder(
         std::filesystem::path inFilePath = allInputFiles[idx];
         int nStarsInfile = 0;
 
+        if (_bulkConstruction) {
+            // Sorts, slices and writes the nodes of the branch to the output folder
+            LINFO(std::format("Reading and sorting data file '{}'", inFilePath));
+            nStarsInfile = static_cast<int>(
+                bulkConstructFromFile(inFilePath, idx, nFilteredStars)
+            );
+
+            progressCallback((idx + 1) * processOneFile);
+            nStars += nStarsInfile;
+
+            LINFO(std::format("Wrote {} stars to octree files", nStarsInfile));
+            LINFO(std::format(
+                "Number leaf nodes: {}\n Number inner nodes: {}\n "
+                "Total depth of tree: {}",
+                _indexOctreeManager->numLeafNodes(),
+                _indexOctreeManager->numInnerNodes(),
+                _indexOctreeManager->totalDepth()
+            ));
+            continue;
+        }
+
         LINFO(std::format("Reading data file '{}'", inFilePath));
 
         std::ifstream inFileStream(inFilePath, std::ifstream::binary);
@@ -607,11 +805,182 @@ void ConstructOctreeTask::constructOctreeFromFolder(
 
     // Make sure all threads are done.
     for (int i = 0; i < 8; i++) {
-        writeThreads[i].join();
+        if (writeThreads[i].joinable()) {
+            writeThreads[i].join();
+        }
     }
 }
 
-bool ConstructOctreeTask::checkAllFilters(const std::vector<float>& filterValues) {
+ConstructOctreeTask::SortedStars ConstructOctreeTask::sortStars(
+                                                       const OctreeManager& octreeManager,
+                                                              std::span<const float> data,
+                                                                    size_t nValuesPerStar,
+                                                                   size_t& nFilteredStars)
+{
+    const size_t nStars = data.size() / nValuesPerStar;
+    const size_t nThreads = numberOfThreads();
+
+    // Filter the stars and compute the Morton code of the remaining ones, with the index
+    // of the star as payload
+    std::vector<std::vector<std::pair<uint64_t, uint32_t>>> blockKeys(nThreads);
+    parallelFor(nStars, nThreads, [&](size_t t, size_t begin, size_t end) {
+        std::vector<std::pair<uint64_t, uint32_t>>& keys = blockKeys[t];
+        keys.reserve(end - begin);
+        for (size_t i = begin; i < end; i++) {
+            std::span<const float> star =
+                data.subspan(i * nValuesPerStar, nValuesPerStar);
+            if (checkAllFilters(star)) {
+                continue;
+            }
+            const uint64_t code = octreeManager.mortonCode(star[0], star[1], star[2]);
+            keys.emplace_back(code, static_cast<uint32_t>(i));
+        }
+    });
+
+    std::vector<std::pair<uint64_t, uint32_t>> keys;
+    for (std::vector<std::pair<uint64_t, uint32_t>>& block : blockKeys) {
+        keys.insert(keys.end(), block.begin(), block.end());
+        block = std::vector<std::pair<uint64_t, uint32_t>>();
+    }
+    nFilteredStars += nStars - keys.size();
+
+    radixSort(keys);
+
+    // Gather the render values in sorted order
+    SortedStars result;
+    result.codes.resize(keys.size());
+    result.values.resize(keys.size() * RENDER_VALUES);
+    parallelFor(keys.size(), nThreads, [&](size_t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            result.codes[i] = keys[i].first;
+            const float* star = &data[keys[i].second * nValuesPerStar];
+            std::copy(star, star + RENDER_VALUES, &result.values[i * RENDER_VALUES]);
+        }
+    });
+    return result;
+}
+
+size_t ConstructOctreeTask::bulkConstructFromFile(const std::filesystem::path& inFilePath,
+                                                  size_t fileIndex,
+                                                  size_t& nFilteredStars)
+{
+    std::ifstream inFileStream(inFilePath, std::ifstream::binary);
+    if (!inFileStream.good()) {
+        LERROR(std::format(
+            "Error opening file '{}' for loading preprocessed file", inFilePath
+        ));
+        return 0;
+    }
+
+    int32_t nValuesPerStar = 0;
+    inFileStream.read(reinterpret_cast<char*>(&nValuesPerStar), sizeof(int32_t));
+
+    std::vector<uint32_t> cellCounts(size_t(1) << (3 * BulkPartitionDepth), 0);
+    std::vector<std::filesystem::path> runFiles;
+    auto spillRun = [&](const SortedStars& run) {
+        runFiles.push_back(
+            _outFileOrFolderPath /
+            std::format("sortedrun_{}_{}.tmp", fileIndex, runFiles.size())
+        );
+        writeSortedRun(runFiles.back(), run.codes, run.values, RENDER_VALUES);
+    };
+
+    // Sort the file in chunks. A chunk is only written to disk if the file doesn't fit
+    // into a single one
+    size_t nStars = 0;
+    SortedStars pendingRun;
+    std::vector<float> chunk;
+    while (inFileStream.good()) {
+        chunk.resize(_bulkChunkSize * nValuesPerStar);
+        inFileStream.read(
+            reinterpret_cast<char*>(chunk.data()),
+            chunk.size() * sizeof(float)
+        );
+        const size_t nRead = inFileStream.gcount() / (nValuesPerStar * sizeof(float));
+        if (nRead == 0) {
+            break;
+        }
+        chunk.resize(nRead * nValuesPerStar);
+
+        SortedStars run = sortStars(
+            *_indexOctreeManager,
+            chunk,
+            nValuesPerStar,
+            nFilteredStars
+        );
+        countCells(run.codes, cellCounts);
+        nStars += run.codes.size();
+
+        if (!pendingRun.codes.empty()) {
+            spillRun(pendingRun);
+        }
+        pendingRun = std::move(run);
+    }
+    chunk = std::vector<float>();
+
+    _indexOctreeManager->prepareBulkInsert(
+        cellCounts,
+        BulkPartitionDepth,
+        _outFileOrFolderPath
+    );
+
+    if (runFiles.empty()) {
+        _indexOctreeManager->insertSorted(pendingRun.codes, pendingRun.values);
+    }
+    else {
+        if (!pendingRun.codes.empty()) {
+            spillRun(pendingRun);
+        }
+        pendingRun = SortedStars();
+
+        // K-way merge of the sorted chunks
+        LINFO(std::format("Merging {} sorted chunks", runFiles.size()));
+        std::vector<SortedRunReader> readers(runFiles.size());
+        using HeapEntry = std::pair<uint64_t, size_t>;
+        std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<>> heap;
+        for (size_t i = 0; i < runFiles.size(); i++) {
+            readers[i].stream = std::ifstream(runFiles[i], std::ifstream::binary);
+            if (readers[i].nextBlock(RENDER_VALUES)) {
+                heap.emplace(readers[i].codes[0], i);
+            }
+        }
+
+        SortedStars batch;
+        batch.codes.reserve(SortedBlockSize);
+        batch.values.reserve(SortedBlockSize * RENDER_VALUES);
+        while (!heap.empty()) {
+            const auto [code, i] = heap.top();
+            heap.pop();
+
+            SortedRunReader& reader = readers[i];
+            batch.codes.push_back(code);
+            auto star = reader.values.begin() + reader.pos * RENDER_VALUES;
+            batch.values.insert(batch.values.end(), star, star + RENDER_VALUES);
+
+            reader.pos++;
+            if (reader.pos < reader.codes.size() || reader.nextBlock(RENDER_VALUES)) {
+                heap.emplace(reader.codes[reader.pos], i);
+            }
+
+            if (batch.codes.size() == SortedBlockSize) {
+                _indexOctreeManager->insertSorted(batch.codes, batch.values);
+                batch.codes.clear();
+                batch.values.clear();
+            }
+        }
+        _indexOctreeManager->insertSorted(batch.codes, batch.values);
+
+        readers.clear();
+        for (const std::filesystem::path& runFile : runFiles) {
+            std::filesystem::remove(runFile);
+        }
+    }
+
+    _indexOctreeManager->finishBulkInsert();
+    return nStars;
+}
+
+bool ConstructOctreeTask::checkAllFilters(std::span<const float> filterValues) const {
     // Return true if star is caught in any filter.
     return (_filterPosX && filterStar(_posX, filterValues[0])) ||
         (_filterPosY && filterStar(_posY, filterValues[1])) ||
@@ -640,7 +1009,7 @@ bool ConstructOctreeTask::checkAllFilters(const std::vector<float>& filterValues
 }
 
 bool ConstructOctreeTask::filterStar(const glm::vec2& range, float filterValue,
-                                     float normValue)
+                                     float normValue) const
 {
     // Return true if star should be filtered away, i.e. if min = max = filterValue or
     // if filterValue < min (when min != 0.0) or filterValue > max (when max != 0.0).
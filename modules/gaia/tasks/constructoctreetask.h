@@ -30,6 +30,7 @@
 #include <modules/gaia/rendering/octreeculler.h>
 #include <modules/gaia/rendering/octreemanager.h>
 #include <filesystem>
+#include <span>
 
 namespace openspace {
 
@@ -47,6 +48,12 @@ public:
 private:
     const int RENDER_VALUES = 8;
 
+    /// Render values of stars that are sorted by their Morton code
+    struct SortedStars {
+        std::vector<uint64_t> codes;
+        std::vector<float> values;
+    };
+
     /**
      * Reads a single binary file with preprocessed star data and insert the render values
      * into an octree structure (if star data passed all defined filters). Stores the
@@ -62,6 +69,30 @@ private:
      */
     void constructOctreeFromFolder(const Task::ProgressCallback& progressCallback);
 
+    /**
+     * Filters all stars in \p data, computes the Morton code of the remaining stars and
+     * sorts their render values by that code with a parallel radix sort.
+     *
+     * \param octreeManager The octree whose dimensions are used for the Morton codes
+     * \param data The star values of all stars, \p nValuesPerStar values per star
+     * \param nValuesPerStar The number of values that are stored for each star
+     * \param nFilteredStars Is increased by the number of stars that were filtered away
+     * \return The render values and Morton codes of all stars that passed the filters
+     */
+    SortedStars sortStars(const OctreeManager& octreeManager,
+        std::span<const float> data, size_t nValuesPerStar, size_t& nFilteredStars);
+
+    /**
+     * Reads a binary file with preprocessed star data in chunks of `BulkChunkSize`
+     * stars, sorts each chunk by Morton code and spills it to a temporary file if more
+     * than one chunk is needed. The sorted chunks are then merged and inserted into the
+     * index octree in bulk, which writes the node files into the output folder.
+     *
+     * \return The number of stars that were inserted into the octree
+     */
+    size_t bulkConstructFromFile(const std::filesystem::path& inFilePath,
+        size_t fileIndex, size_t& nFilteredStars);
+
     /**
      * Checks all defined filter ranges and returns true if any of the corresponding
      * \p filterValues are outside of the defined range.
@@ -70,7 +101,7 @@ private:
      *
      * \return `false` if value should be inserted into Octree
      */
-    bool checkAllFilters(const std::vector<float>& filterValues);
+    bool checkAllFilters(std::span<const float> filterValues) const;
 
     /**
      * \p range contains ]min, max[ and \p filterValue corresponding value in star. Star
@@ -79,13 +110,16 @@ private:
      *
      * \return `true` if star should be filtered away and `false` if all filters passed
      */
-    bool filterStar(const glm::vec2& range, float filterValue, float normValue = 0.f);
+    bool filterStar(const glm::vec2& range, float filterValue,
+        float normValue = 0.f) const;
 
     std::filesystem::path _inFileOrFolderPath;
     std::filesystem::path _outFileOrFolderPath;
     int _maxDist = 0;
     int _maxStarsPerNode = 0;
     bool _singleFileInput = false;
+    bool _bulkConstruction = false;
+    size_t _bulkChunkSize = 20000000;
 
     std::shared_ptr<OctreeManager> _octreeManager;
     std::shared_ptr<OctreeManager> _indexOctreeManager;
@@ -24,85 +24,66 @@
 
 #include <modules/gaia/tasks/readfilejob.h>
 
+#include <modules/fitsfilereader/include/fitstablereader.h>
+
 #include <openspace/util/distanceconversion.h>
-#include <ghoul/format.h>
-#include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/dictionary.h>
-
-namespace {
-    constexpr std::string_view _loggerCat = "ReadFileJob";
-} // namespace
+#include <algorithm>
+#include <limits>
 
 namespace openspace::gaia {
 
 ReadFileJob::ReadFileJob(std::filesystem::path filePath,
                          std::vector<std::string> allColumns, int firstRow, int lastRow,
-                         size_t nDefaultCols, int nValuesPerStar,
-                         std::shared_ptr<FitsFileReader> fitsReader)
+                         size_t nDefaultCols, int nValuesPerStar)
     : _inFilePath(std::move(filePath))
     , _firstRow(firstRow)
     , _lastRow(lastRow)
     , _nDefaultCols(nDefaultCols)
     , _nValuesPerStar(nValuesPerStar)
     , _allColumns(std::move(allColumns))
-    , _fitsFileReader(std::move(fitsReader))
     , _octants(8)
 {}
 
 void ReadFileJob::execute() {
     // Read columns from FITS file. If rows aren't specified then full table will be read.
-    const std::shared_ptr<TableData<float>> table = _fitsFileReader->readTable<float>(
-        _inFilePath,
-        _allColumns,
-        _firstRow,
-        _lastRow
-    );
-
-    if (!table) {
-        throw ghoul::RuntimeError(
-            std::format("Failed to open Fits file '{}'", _inFilePath
-        ));
-    }
-
-    const int nStars = table->readRows - _firstRow + 1;
-
+    // The files are already read in parallel by the job manager, so each job only uses a
+    // single thread
+    const FitsTableReader reader = FitsTableReader(_inFilePath);
+    const size_t firstRow = static_cast<size_t>(std::max(_firstRow, 1) - 1);
+    const size_t nRows = _lastRow < _firstRow ?
+        std::numeric_limits<size_t>::max() :
+        static_cast<size_t>(_lastRow - std::max(_firstRow, 1) + 1);
+    std::vector<std::vector<float>> columns =
+        reader.readColumns(_allColumns, firstRow, nRows);
+
+    const int nStars = static_cast<int>(columns[0].size());
     const size_t nColumnsRead = _allColumns.size();
-    if (nColumnsRead != _nDefaultCols) {
-        LINFO(
-            "Additional columns will be read! Consider add column in code for "
-            "significant speedup"
-        );
-    }
-
-    // Copy columns to local variables.
-    std::unordered_map<std::string, std::vector<float>>& tableContent = table->contents;
 
     // Default columns parameters.
-    //std::vector<float> l_longitude = std::move(tableContent[_allColumns[0]]);
-    //std::vector<float> b_latitude = std::move(tableContent[_allColumns[1]]);
-    std::vector<float> ra = std::move(tableContent[_allColumns[0]]);
-    std::vector<float> ra_err = std::move(tableContent[_allColumns[1]]);
-    std::vector<float> dec = std::move(tableContent[_allColumns[2]]);
-    std::vector<float> dec_err = std::move(tableContent[_allColumns[3]]);
-    std::vector<float> parallax = std::move(tableContent[_allColumns[4]]);
-    std::vector<float> parallax_err = std::move(tableContent[_allColumns[5]]);
-    std::vector<float> pmra = std::move(tableContent[_allColumns[6]]);
-    std::vector<float> pmra_err = std::move(tableContent[_allColumns[7]]);
-    std::vector<float> pmdec = std::move(tableContent[_allColumns[8]]);
-    std::vector<float> pmdec_err = std::move(tableContent[_allColumns[9]]);
-    std::vector<float> meanMagG = std::move(tableContent[_allColumns[10]]);
-    std::vector<float> meanMagBp = std::move(tableContent[_allColumns[11]]);
-    std::vector<float> meanMagRp = std::move(tableContent[_allColumns[12]]);
-    std::vector<float> bp_rp = std::move(tableContent[_allColumns[13]]);
-    std::vector<float> bp_g = std::move(tableContent[_allColumns[14]]);
-    std::vector<float> g_rp = std::move(tableContent[_allColumns[15]]);
-    std::vector<float> radial_vel = std::move(tableContent[_allColumns[16]]);
-    std::vector<float> radial_vel_err = std::move(tableContent[_allColumns[17]]);
-
+    const std::vector<float>& ra = columns[0];
+    const std::vector<float>& ra_err = columns[1];
+    const std::vector<float>& dec = columns[2];
+    const std::vector<float>& dec_err = columns[3];
+    const std::vector<float>& parallax = columns[4];
+    const std::vector<float>& parallax_err = columns[5];
+    std::vector<float>& pmra = columns[6];
+    const std::vector<float>& pmra_err = columns[7];
+    std::vector<float>& pmdec = columns[8];
+    const std::vector<float>& pmdec_err = columns[9];
+    const std::vector<float>& meanMagG = columns[10];
+    const std::vector<float>& meanMagBp = columns[11];
+    const std::vector<float>& meanMagRp = columns[12];
+    const std::vector<float>& bp_rp = columns[13];
+    const std::vector<float>& bp_g = columns[14];
+    const std::vector<float>& g_rp = columns[15];
+    std::vector<float>& radial_vel = columns[16];
+    const std::vector<float>& radial_vel_err = columns[17];
+
+    std::vector<float> values(_nValuesPerStar);
 
     // Construct data array. OBS: ORDERING IS IMPORTANT! This is where slicing happens.
     for (int i = 0; i < nStars; i++) {
-        std::vector<float> values(_nValuesPerStar);
         size_t idx = 0;
 
         // Default order for rendering:
@@ -240,10 +221,9 @@ void ReadFileJob::execute() {
         values[idx++] = radial_vel[i];
         values[idx++] = std::isnan(radial_vel_err[i]) ? 0.f : radial_vel_err[i];
 
-        // Read extra columns, if any. This will slow down the sorting tremendously!
+        // Read extra columns, if any
         for (size_t col = _nDefaultCols; col < nColumnsRead; ++col) {
-            std::vector<float> vecData = std::move(tableContent[_allColumns[col]]);
-            values[idx++] = std::isnan(vecData[col]) ? 0.f : vecData[col];
+            values[idx++] = std::isnan(columns[col][i]) ? 0.f : columns[col][i];
         }
 
         size_t index = 0;
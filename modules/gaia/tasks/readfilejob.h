@@ -27,8 +27,9 @@
 
 #include <openspace/util/concurrentjobmanager.h>
 
-#include <modules/fitsfilereader/include/fitsfilereader.h>
 #include <filesystem>
+#include <string>
+#include <vector>
 
 namespace openspace::gaia {
 
@@ -39,8 +40,7 @@ struct ReadFileJob : public Job<std::vector<std::vector<float>>> {
      *
      * \param filePath The file from which to load the data
      * \param allColumns Define which columns that will be read, it should correspond to
-     *        the pre-defined order in the job. If additional columns are defined they
-     *        will be read but slow down the process. Proper conversions of positions and
+     *        the pre-defined order in the job. Proper conversions of positions and
      *        velocities will take place and all values will be checked for NaNs. If
      *        \p firstRow is < 1 then reading will begin at first row in table. If
      *        \p lastRow < firstRow then entire table will be read
@@ -48,11 +48,9 @@ struct ReadFileJob : public Job<std::vector<std::vector<float>>> {
      * \param lastRow The index of the last row to be read
      * \param nDefaultCols Defines how many columns that will be read per star
      * \param nValuesPerStar Defines how many values that will be stored per star
-     * \param fitsReader The reader that should be used in this job
      */
     ReadFileJob(std::filesystem::path filePath, std::vector<std::string> allColumns,
-        int firstRow, int lastRow, size_t nDefaultCols, int nValuesPerStar,
-        std::shared_ptr<FitsFileReader> fitsReader);
+        int firstRow, int lastRow, size_t nDefaultCols, int nValuesPerStar);
 
     ~ReadFileJob() override = default;
 
@@ -68,7 +66,6 @@ private:
     int _nValuesPerStar;
     std::vector<std::string> _allColumns;
 
-    std::shared_ptr<FitsFileReader> _fitsFileReader;
     std::vector<std::vector<float>> _octants;
 };
 
@@ -245,7 +245,6 @@ void ReadFitsTask::readAllFitsFilesFromFolder(const Task::ProgressCallback&) {
     // Declare how many values to save for each star.
     constexpr int32_t NValuesPerStar = 24;
     const size_t nDefaultColumns = defaultColumnNames.size();
-    auto fitsFileReader = std::make_shared<FitsFileReader>(false);
 
     // Divide all files into ReadFilejobs and then delegate them onto several threads!
     while (!allInputFiles.empty()) {
@@ -259,8 +258,7 @@ void ReadFitsTask::readAllFitsFilesFromFolder(const Task::ProgressCallback&) {
             _firstRow,
             _lastRow,
             nDefaultColumns,
-            NValuesPerStar,
-            fitsFileReader
+            NValuesPerStar
         );
         jobManager.enqueueJob(readFileJob);
     }
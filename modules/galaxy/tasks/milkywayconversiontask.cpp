@@ -25,12 +25,20 @@
 #include <modules/galaxy/tasks/milkywayconversiontask.h>
 
 #include <modules/volume/textureslicevolumereader.h>
-#include <modules/volume/rawvolumewriter.h>
 #include <modules/volume/volumesampler.h>
 #include <openspace/documentation/documentation.h>
+#include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/dictionary.h>
+#include <ghoul/misc/exception.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <thread>
 
 namespace {
+    constexpr std::string_view _loggerCat = "MilkywayConversionTask";
+
     struct [[codegen::Dictionary(MilkywayConversionTask)]] Parameters {
         std::string inFilenamePrefix;
         std::string inFilenameSuffix;
@@ -38,6 +46,10 @@ namespace {
         int inNSlices;
         std::string outFilename;
         glm::ivec3 outDimensions;
+
+        // Defines how many threads are used to decode the image slices and to resample
+        // the volume. If this value is not specified, all hardware threads are used
+        std::optional<int> threadsToUse [[codegen::greater(0)]];
     };
 #include "milkywayconversiontask_codegen.cpp"
 } // namespace
@@ -56,6 +68,9 @@ MilkywayConversionTask::MilkywayConversionTask(const ghoul::Dictionary& dictiona
     _inNSlices = p.inNSlices;
     _outFilename = p.outFilename;
     _outDimensions = p.outDimensions;
+    _nThreads = p.threadsToUse.has_value() ?
+        static_cast<size_t>(*p.threadsToUse) :
+        std::max<size_t>(std::thread::hardware_concurrency(), 1);
 }
 
 std::string MilkywayConversionTask::description() {
@@ -64,6 +79,9 @@ std::string MilkywayConversionTask::description() {
 
 void MilkywayConversionTask::perform(const Task::ProgressCallback& onProgress) {
     using namespace openspace::volume;
+    using Voxel = glm::tvec4<GLfloat>;
+
+    const auto start = std::chrono::steady_clock::now();
 
     std::vector<std::string> filenames;
     for (size_t i = 0; i < _inNSlices; i++) {
@@ -72,27 +90,97 @@ void MilkywayConversionTask::perform(const Task::ProgressCallback& onProgress) {
         );
     }
 
-    TextureSliceVolumeReader<glm::tvec4<GLfloat>> sliceReader(filenames, _inNSlices, 10);
+    const glm::ivec3 outDims = _outDimensions;
+    const float depthRatio = static_cast<float>(_inNSlices) / outDims.z;
+
+    // The output volume is resampled in slabs of consecutive z slices. The slab depth is
+    // chosen such that each slab requires roughly one new input slice per thread, which
+    // keeps all threads busy reading while bounding the number of slices in memory
+    const int slabDepth =
+        std::max(static_cast<int>(std::ceil(_nThreads / depthRatio)), 1);
+    // Number of input slices that are needed on either side of the sampled position
+    const int filterMargin = static_cast<int>(std::ceil(depthRatio)) + 1;
+    const int maxWindowSize =
+        static_cast<int>(std::ceil(slabDepth * depthRatio)) + 2 * filterMargin + 1;
+
+    TextureSliceVolumeReader<Voxel> sliceReader(
+        filenames,
+        _inNSlices,
+        std::max<size_t>(maxWindowSize, 10)
+    );
     sliceReader.initialize();
 
-    RawVolumeWriter<glm::tvec4<GLfloat>> rawWriter(_outFilename);
-    rawWriter.setDimensions(_outDimensions);
+    const glm::vec3 ratio = glm::vec3(sliceReader.dimensions()) / glm::vec3(outDims);
+    const VolumeSampler<TextureSliceVolumeReader<Voxel>> sampler(&sliceReader, ratio);
+
+    std::ofstream file = std::ofstream(_outFilename, std::ios::binary);
+    if (!file.good()) {
+        throw ghoul::RuntimeError(
+            std::format("Could not create file '{}'", _outFilename)
+        );
+    }
+
+    const size_t sliceSize = static_cast<size_t>(outDims.x) * outDims.y;
+    std::vector<Voxel> buffer = std::vector<Voxel>(sliceSize * slabDepth);
+    const int nSlabs = (outDims.z + slabDepth - 1) / slabDepth;
+    for (int slab = 0; slab < nSlabs; slab++) {
+        const int firstZ = slab * slabDepth;
+        const int lastZ = std::min(firstZ + slabDepth, outDims.z) - 1;
 
-    const glm::vec3 resolutionRatio = static_cast<glm::vec3>(sliceReader.dimensions()) /
-                                      static_cast<glm::vec3>(rawWriter.dimensions());
+        auto inputZ = [&ratio](int z) {
+            return static_cast<int>(std::floor((z + 0.5f) * ratio.z - 0.5f));
+        };
+        const int firstSlice = std::max(inputZ(firstZ) - filterMargin, 0);
+        const int lastSlice = std::min(
+            inputZ(lastZ) + filterMargin,
+            static_cast<int>(_inNSlices) - 1
+        );
+        sliceReader.prefetchSlices(firstSlice, lastSlice, _nThreads);
 
-    const VolumeSampler<TextureSliceVolumeReader<glm::tvec4<GLfloat>>> sampler(
-        &sliceReader,
-        resolutionRatio
-    );
-    auto sampleFunction = [resolutionRatio, sampler](const glm::ivec3& outCoord) {
-        const glm::vec3 inCoord =
-            ((glm::vec3(outCoord) + glm::vec3(0.5f)) * resolutionRatio) - glm::vec3(0.5f);
-        const glm::tvec4<GLfloat> value = sampler.sample(inCoord);
-        return value;
-    };
+        // All slices of the slab are cached, so the sampling can run concurrently. Each
+        // thread resamples an interleaved subset of the rows
+        const int nRows = (lastZ - firstZ + 1) * outDims.y;
+        const int stride = static_cast<int>(_nThreads);
+        auto resample = [&](int thread) {
+            for (int row = thread; row < nRows; row += stride) {
+                const int y = row % outDims.y;
+                const int z = firstZ + row / outDims.y;
+                Voxel* out = buffer.data() + static_cast<size_t>(row) * outDims.x;
+                for (int x = 0; x < outDims.x; x++) {
+                    const glm::vec3 inCoord =
+                        (glm::vec3(x, y, z) + glm::vec3(0.5f)) * ratio - glm::vec3(0.5f);
+                    out[x] = sampler.sample(inCoord);
+                }
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int t = 1; t < stride; t++) {
+            threads.emplace_back(resample, t);
+        }
+        resample(0);
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        file.write(
+            reinterpret_cast<const char*>(buffer.data()),
+            static_cast<size_t>(nRows) * outDims.x * sizeof(Voxel)
+        );
+        if (!file.good()) {
+            throw ghoul::RuntimeError(
+                std::format("Error writing to file '{}'", _outFilename)
+            );
+        }
+        onProgress(static_cast<float>(slab + 1) / nSlabs);
+    }
 
-    rawWriter.write(sampleFunction, onProgress);
+    const std::chrono::duration<double> duration =
+        std::chrono::steady_clock::now() - start;
+    const size_t nVoxels = sliceSize * outDims.z;
+    LINFO(std::format(
+        "Resampled {} voxels in {:.2f} s ({:.0f} voxels/s)",
+        nVoxels, duration.count(), nVoxels / duration.count()
+    ));
 }
 
 } // namespace openspace
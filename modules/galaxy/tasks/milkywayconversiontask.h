@@ -36,7 +36,10 @@ namespace documentation { struct Documentation; }
 
 /**
  * Converts a set of exr image slices to a raw volume with floating point RGBA data (32
- * bit per channel).
+ * bit per channel). The output volume is resampled in slabs of z slices that are written
+ * to the file as soon as they are finished, so only the input slices needed for the
+ * current slab are kept in memory. The slices are decoded and the slabs are resampled on
+ * multiple threads.
  */
 class MilkywayConversionTask : public Task {
 public:
@@ -54,6 +57,7 @@ private:
     size_t _inNSlices = 0;
     std::string _outFilename;
     glm::ivec3 _outDimensions = glm::ivec3(0);
+    size_t _nThreads = 1;
 };
 
 } // namespace openspace
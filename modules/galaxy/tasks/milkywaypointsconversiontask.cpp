@@ -25,20 +25,40 @@
 #include <modules/galaxy/tasks/milkywaypointsconversiontask.h>
 
 #include <openspace/documentation/documentation.h>
-
+#include <ghoul/misc/dictionary.h>
+#include <ghoul/misc/exception.h>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
-#include <iostream>
 #include <vector>
 
-namespace openspace {
+namespace {
+    // The number of bytes that are read from the input file at a time
+    constexpr size_t ReadBlockSize = 1 << 22;
+
+    // The number of values per point: x, y, z, r, g, b, a
+    constexpr int64_t ValuesPerPoint = 7;
 
-/*MilkywayPointsConversionTask::MilkywayPointsConversionTask(
-    const std::string& inFilename,
-    const std::string& outFilename)
-    : _inFilename(inFilename)
-    , _outFilename(outFilename) {}*/
+    struct [[codegen::Dictionary(MilkywayPointsConversionTask)]] Parameters {
+        // The ASCII file containing the point data
+        std::string inFilename;
+
+        // The binary file to which the point data is written
+        std::string outFilename;
+    };
+#include "milkywaypointsconversiontask_codegen.cpp"
+} // namespace
 
-MilkywayPointsConversionTask::MilkywayPointsConversionTask(const ghoul::Dictionary&) {}
+namespace openspace {
+
+MilkywayPointsConversionTask::MilkywayPointsConversionTask(
+                                                      const ghoul::Dictionary& dictionary)
+{
+    const Parameters p = codegen::bake<Parameters>(dictionary);
+    _inFilename = p.inFilename;
+    _outFilename = p.outFilename;
+}
 
 std::string MilkywayPointsConversionTask::description() {
     return std::string();
@@ -46,55 +66,102 @@ std::string MilkywayPointsConversionTask::description() {
 
 void MilkywayPointsConversionTask::perform(const Task::ProgressCallback& progressCallback)
 {
-    std::ifstream in(_inFilename, std::ios::in);
-    std::ofstream out(_outFilename, std::ios::out | std::ios::binary);
+    std::ifstream in = std::ifstream(_inFilename, std::ios::in | std::ios::binary);
+    if (!in.good()) {
+        throw ghoul::RuntimeError(std::format("Could not open file '{}'", _inFilename));
+    }
+    std::ofstream out = std::ofstream(_outFilename, std::ios::out | std::ios::binary);
+    if (!out.good()) {
+        throw ghoul::RuntimeError(
+            std::format("Could not create file '{}'", _outFilename)
+        );
+    }
 
     std::string format;
     int64_t nPoints = 0;
     in >> format >> nPoints;
+    if (!in.good() || nPoints < 0) {
+        throw ghoul::RuntimeError(
+            std::format("Could not read the header of '{}'", _inFilename)
+        );
+    }
+    out.write(reinterpret_cast<const char*>(&nPoints), sizeof(int64_t));
+
+    // The file is read in blocks and the values are parsed directly from the block. A
+    // value that is cut off at the end of a block is moved to the front of the buffer
+    // before the next block is read. The parsed values are written out after each block,
+    // so the memory usage does not depend on the size of the file
+    std::vector<char> buffer = std::vector<char>(ReadBlockSize + 1);
+    std::vector<float> values;
+    values.reserve(ReadBlockSize / 2);
+    const int64_t nValues = nPoints * ValuesPerPoint;
+    int64_t nParsedValues = 0;
+    size_t carry = 0;
+    while (nParsedValues < nValues) {
+        in.read(buffer.data() + carry, ReadBlockSize - carry);
+        const size_t nRead = static_cast<size_t>(in.gcount());
+        const bool isLastBlock = !in.good();
+        size_t length = carry + nRead;
+
+        // Only parse up to the last whitespace, unless this is the last block
+        size_t parseEnd = length;
+        if (!isLastBlock) {
+            auto isSpace = [](char c) {
+                return std::isspace(static_cast<unsigned char>(c)) != 0;
+            };
+            while (parseEnd > 0 && !isSpace(buffer[parseEnd - 1])) {
+                parseEnd--;
+            }
+            if (parseEnd == 0) {
+                throw ghoul::RuntimeError(
+                    std::format("Malformed point data in '{}'", _inFilename)
+                );
+            }
+        }
 
-    const size_t nFloats = nPoints * 7;
-
-    std::vector<float> pointData(nFloats);
-
-    float x = 0.f;
-    float y = 0.f;
-    float z = 0.f;
-    float r = 0.f;
-    float g = 0.f;
-    float b = 0.f;
-    float a = 0.f;
-
-    for (int64_t i = 0; i < nPoints; i++) {
-        in >> x >> y >> z >> r >> g >> b >> a;
-        if (in.good()) {
-            pointData[i * 7 + 0] = x;
-            pointData[i * 7 + 1] = y;
-            pointData[i * 7 + 2] = z;
-            pointData[i * 7 + 3] = r;
-            pointData[i * 7 + 4] = g;
-            pointData[i * 7 + 5] = b;
-            pointData[i * 7 + 6] = a;
-            progressCallback(static_cast<float>(i + 1) / nPoints);
+        const char terminator = buffer[parseEnd];
+        buffer[parseEnd] = '\0';
+        const char* ptr = buffer.data();
+        const char* end = buffer.data() + parseEnd;
+        values.clear();
+        while (ptr < end && nParsedValues + static_cast<int64_t>(values.size()) < nValues)
+        {
+            char* next = nullptr;
+            const float v = std::strtof(ptr, &next);
+            if (next == ptr) {
+                break;
+            }
+            values.push_back(v);
+            ptr = next;
         }
-        else {
-            std::cout << "Failed to convert point data";
-            return;
+        buffer[parseEnd] = terminator;
+
+        out.write(
+            reinterpret_cast<const char*>(values.data()),
+            values.size() * sizeof(float)
+        );
+        nParsedValues += static_cast<int64_t>(values.size());
+        if (nValues > 0) {
+            progressCallback(static_cast<float>(nParsedValues) / nValues);
         }
-    }
 
-    out.write(reinterpret_cast<char*>(&nPoints), sizeof(int64_t));
-    out.write(reinterpret_cast<char*>(pointData.data()), nFloats * sizeof(float));
+        if (isLastBlock) {
+            break;
+        }
+        carry = length - parseEnd;
+        std::memmove(buffer.data(), buffer.data() + parseEnd, carry);
+    }
 
-    in.close();
-    out.close();
+    if (nParsedValues != nValues) {
+        throw ghoul::RuntimeError(std::format(
+            "Failed to convert point data. Expected {} points but read {}",
+            nPoints, nParsedValues / ValuesPerPoint
+        ));
+    }
 }
 
 documentation::Documentation MilkywayPointsConversionTask::Documentation() {
-    return {
-        "MilkywayPointsConversionTask",
-        "galaxy_milkywaypointsconversiontask"
-    };
+    return codegen::doc<Parameters>("galaxy_milkywaypointsconversiontask");
 }
 
 } // namespace openspace
@@ -37,9 +37,10 @@ namespace documentation { struct Documentation; }
  * Converts ASCII based point data
  * ```
  * int64_t n
- * (float x, float y, float z, float r, float g, float b) * n
+ * (float x, float y, float z, float r, float g, float b, float a) * n
  * ```
- * to a binary (floating point) representation with the same layout.
+ * to a binary (floating point) representation with the same layout. The input is parsed
+ * in blocks that are written out immediately, so files of any size can be converted.
  */
 class MilkywayPointsConversionTask : public Task {
 public:
@@ -43,7 +43,11 @@ AsyncTileDataProvider::AsyncTileDataProvider(std::string name,
                                     std::unique_ptr<RawTileDataReader> rawTileDataReader)
     : _name(std::move(name))
     , _rawTileDataReader(std::move(rawTileDataReader))
-    , _concurrentJobManager(LRUThreadPool<TileIndex::TileHashKey>(1, 10))
+    , _concurrentJobManager(LRUThreadPool<TileIndex::TileHashKey>(
+        // One thread per dataset handle that the reader is allowed to open
+        static_cast<size_t>(_rawTileDataReader->maxConcurrentReads()),
+        10
+    ))
 {
     ZoneScoped;
 
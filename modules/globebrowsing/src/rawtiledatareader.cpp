@@ -244,11 +244,13 @@ RawTile::ReadError postProcessErrorCheck(const RawTile& rawTile,
 RawTileDataReader::RawTileDataReader(std::string filePath,
                                      TileTextureInitData initData,
                                      TileCacheProperties cacheProperties,
-                                     PerformPreprocessing preprocess)
+                                     PerformPreprocessing preprocess,
+                                     int maxConcurrentReads)
     : _datasetFilePath(std::move(filePath))
     , _initData(std::move(initData))
     , _cacheProperties(std::move(cacheProperties))
     , _preprocess(preprocess)
+    , _maxConcurrentReads(std::max(maxConcurrentReads, 1))
 {
     ZoneScoped;
 
@@ -257,10 +259,8 @@ RawTileDataReader::RawTileDataReader(std::string filePath,
 
 RawTileDataReader::~RawTileDataReader() {
     const std::lock_guard lockGuard(_datasetLock);
-    if (_dataset) {
-        GDALClose(_dataset);
-        _dataset = nullptr;
-    }
+    ghoul_assert(_nDatasetsInUse == 0, "Reader destroyed while tiles are being read");
+    closeDatasets();
 }
 
 std::optional<std::string> RawTileDataReader::mrfCache() {
@@ -382,30 +382,36 @@ void RawTileDataReader::initialize() {
     if (_datasetFilePath.empty()) {
         throw ghoul::RuntimeError("File path must not be empty");
     }
-    std::string content = _datasetFilePath;
+    _openedFilePath = _datasetFilePath;
 
     if (_cacheProperties.enabled) {
         ZoneScopedN("MRF Caching");
 
         std::optional<std::string> cache = mrfCache();
         if (cache.has_value()) {
-            content = cache.value();
+            _openedFilePath = cache.value();
         }
     }
 
+    GDALDataset* dataset = nullptr;
     {
         ZoneScopedN("GDALOpen");
-        _dataset = static_cast<GDALDataset*>(GDALOpen(content.c_str(), GA_ReadOnly));
-        if (!_dataset) {
+        dataset = static_cast<GDALDataset*>(
+            GDALOpen(_openedFilePath.c_str(), GA_ReadOnly)
+        );
+        if (!dataset) {
             throw ghoul::RuntimeError(std::format(
                 "Failed to load dataset '{}'. GDAL error: {}",
                 _datasetFilePath, CPLGetLastErrorMsg()
             ));
         }
     }
+    // The handle used for reading the metadata becomes the first handle of the pool
+    _idleDatasets.push_back(dataset);
+    _nOpenDatasets = 1;
 
     // Assume all raster bands have the same data type
-    _rasterCount = _dataset->GetRasterCount();
+    _rasterCount = dataset->GetRasterCount();
 
     // calculateTileDepthTransform
     const unsigned long long maximumValue = [](GLenum t) {
@@ -424,27 +430,27 @@ void RawTileDataReader::initialize() {
 
 
     _depthTransform.scale = static_cast<float>(
-        _dataset->GetRasterBand(1)->GetScale() * maximumValue
+        dataset->GetRasterBand(1)->GetScale() * maximumValue
     );
     _depthTransform.offset = static_cast<float>(
-        _dataset->GetRasterBand(1)->GetOffset()
+        dataset->GetRasterBand(1)->GetOffset()
     );
-    _rasterXSize = _dataset->GetRasterXSize();
-    _rasterYSize = _dataset->GetRasterYSize();
-    _noDataValue = static_cast<float>(_dataset->GetRasterBand(1)->GetNoDataValue());
+    _rasterXSize = dataset->GetRasterXSize();
+    _rasterYSize = dataset->GetRasterYSize();
+    _noDataValue = static_cast<float>(dataset->GetRasterBand(1)->GetNoDataValue());
     _dataType = toGDALDataType(_initData.glType);
 
-    const CPLErr error = _dataset->GetGeoTransform(_padfTransform.data());
+    const CPLErr error = dataset->GetGeoTransform(_padfTransform.data());
     if (error == CE_Failure) {
         _padfTransform = geoTransform(_rasterXSize, _rasterYSize);
     }
 
     const double tileLevelDifference = calculateTileLevelDifference(
-        _dataset,
+        dataset,
         _initData.dimensions.x
     );
 
-    const int numOverviews = _dataset->GetRasterBand(1)->GetOverviewCount();
+    const int numOverviews = dataset->GetRasterBand(1)->GetOverviewCount();
     _maxChunkLevel = static_cast<int>(-tileLevelDifference);
     if (numOverviews > 0) {
         _maxChunkLevel += numOverviews;
@@ -453,16 +459,79 @@ void RawTileDataReader::initialize() {
 }
 
 void RawTileDataReader::reset() {
-    const std::lock_guard lockGuard(_datasetLock);
+    std::unique_lock lock(_datasetLock);
+
+    // Prevent new reads from starting and wait for the running ones to finish, as the
+    // dataset parameters are changed while reinitializing
+    _isResetting = true;
+    defer {
+        _isResetting = false;
+        _datasetAvailable.notify_all();
+    };
+    _datasetAvailable.wait(lock, [this]() { return _nDatasetsInUse == 0; });
+
     _maxChunkLevel = -1;
-    if (_dataset) {
-        GDALClose(_dataset);
-        _dataset = nullptr;
-    }
+    closeDatasets();
     initialize();
 }
 
-RawTile::ReadError RawTileDataReader::rasterRead(int rasterBand,
+GDALDataset* RawTileDataReader::acquireDataset() const {
+    std::unique_lock lock(_datasetLock);
+    _datasetAvailable.wait(lock, [this]() {
+        return !_isResetting &&
+            (!_idleDatasets.empty() || _nOpenDatasets < _maxConcurrentReads);
+    });
+
+    _nDatasetsInUse++;
+    if (!_idleDatasets.empty()) {
+        GDALDataset* dataset = _idleDatasets.back();
+        _idleDatasets.pop_back();
+        return dataset;
+    }
+
+    // All open handles are in use, but we are allowed to open another one. Opening a
+    // dataset can take a while, so we don't want to block the other threads meanwhile
+    _nOpenDatasets++;
+    const std::string path = _openedFilePath;
+    lock.unlock();
+
+    ZoneScopedN("GDALOpen");
+    GDALDataset* dataset = static_cast<GDALDataset*>(
+        GDALOpen(path.c_str(), GA_ReadOnly)
+    );
+    if (!dataset) {
+        LERROR(std::format(
+            "Failed to open additional handle for dataset '{}'. GDAL error: {}",
+            _datasetFilePath, CPLGetLastErrorMsg()
+        ));
+
+        lock.lock();
+        _nOpenDatasets--;
+        _nDatasetsInUse--;
+        lock.unlock();
+        _datasetAvailable.notify_all();
+    }
+    return dataset;
+}
+
+void RawTileDataReader::releaseDataset(GDALDataset* dataset) const {
+    {
+        const std::lock_guard lockGuard(_datasetLock);
+        _idleDatasets.push_back(dataset);
+        _nDatasetsInUse--;
+    }
+    _datasetAvailable.notify_all();
+}
+
+void RawTileDataReader::closeDatasets() {
+    for (GDALDataset* dataset : _idleDatasets) {
+        GDALClose(dataset);
+    }
+    _idleDatasets.clear();
+    _nOpenDatasets = 0;
+}
+
+RawTile::ReadError RawTileDataReader::rasterRead(GDALDataset* dataset, int rasterBand,
                                                  const IODescription& io,
                                                  char* dataDestination) const
 {
@@ -489,7 +558,7 @@ RawTile::ReadError RawTileDataReader::rasterRead(int rasterBand,
     dataDest -= io.write.region.start.y * io.write.bytesPerLine;
     dataDest += io.write.region.start.x * _initData.bytesPerPixel;
 
-    GDALRasterBand* gdalRasterBand = _dataset->GetRasterBand(rasterBand);
+    GDALRasterBand* gdalRasterBand = dataset->GetRasterBand(rasterBand);
     CPLErr readError = CE_Failure;
     readError = gdalRasterBand->RasterIO(
         GF_Read,
@@ -523,9 +592,23 @@ RawTile RawTileDataReader::readTileData(TileIndex tileIndex) const {
     rawTile.imageData = std::unique_ptr<std::byte[]>(new std::byte[numBytes]);
     memset(rawTile.imageData.get(), 0xFF, numBytes);
 
+    GDALDataset* dataset = acquireDataset();
+    if (!dataset) {
+        rawTile.error = RawTile::ReadError::Fatal;
+        rawTile.tileIndex = std::move(tileIndex);
+        rawTile.textureInitData = _initData;
+        return rawTile;
+    }
+    defer { releaseDataset(dataset); };
+
     IODescription io = ioDescription(tileIndex);
     RawTile::ReadError worstError = RawTile::ReadError::None;
-    readImageData(io, worstError, reinterpret_cast<char*>(rawTile.imageData.get()));
+    readImageData(
+        dataset,
+        io,
+        worstError,
+        reinterpret_cast<char*>(rawTile.imageData.get())
+    );
 
     rawTile.error = worstError;
     rawTile.tileIndex = std::move(tileIndex);
@@ -542,7 +625,8 @@ RawTile RawTileDataReader::readTileData(TileIndex tileIndex) const {
     return rawTile;
 }
 
-void RawTileDataReader::readImageData(IODescription& io, RawTile::ReadError& worstError,
+void RawTileDataReader::readImageData(GDALDataset* dataset, IODescription& io,
+                                      RawTile::ReadError& worstError,
                                       char* imageDataDest) const
 {
     // Only read the minimum number of rasters
@@ -551,7 +635,7 @@ void RawTileDataReader::readImageData(IODescription& io, RawTile::ReadError& wor
     switch (_initData.ghoulTextureFormat) {
         case ghoul::opengl::Texture::Format::Red: {
             char* dest = imageDataDest;
-            const RawTile::ReadError err = rasterRead(1, io, dest);
+            const RawTile::ReadError err = rasterRead(dataset, 1, io, dest);
             worstError = std::max(worstError, err);
             break;
         }
@@ -563,7 +647,7 @@ void RawTileDataReader::readImageData(IODescription& io, RawTile::ReadError& wor
                     // The final destination pointer is offsetted by one datum byte size
                     // for every raster (or data channel, i.e. R in RGB)
                     char* dest = imageDataDest + (i * _initData.bytesPerDatum);
-                    const RawTile::ReadError err = rasterRead(1, io, dest);
+                    const RawTile::ReadError err = rasterRead(dataset, 1, io, dest);
                     worstError = std::max(worstError, err);
                 }
             }
@@ -572,12 +656,12 @@ void RawTileDataReader::readImageData(IODescription& io, RawTile::ReadError& wor
                     // The final destination pointer is offsetted by one datum byte size
                     // for every raster (or data channel, i.e. R in RGB)
                     char* dest = imageDataDest + (i * _initData.bytesPerDatum);
-                    const RawTile::ReadError err = rasterRead(1, io, dest);
+                    const RawTile::ReadError err = rasterRead(dataset, 1, io, dest);
                     worstError = std::max(worstError, err);
                 }
                 // Last read is the alpha channel
                 char* dest = imageDataDest + (3 * _initData.bytesPerDatum);
-                const RawTile::ReadError err = rasterRead(2, io, dest);
+                const RawTile::ReadError err = rasterRead(dataset, 2, io, dest);
                 worstError = std::max(worstError, err);
             }
             else { // Three or more rasters
@@ -585,7 +669,7 @@ void RawTileDataReader::readImageData(IODescription& io, RawTile::ReadError& wor
                     // The final destination pointer is offsetted by one datum byte size
                     // for every raster (or data channel, i.e. R in RGB)
                     char* dest = imageDataDest + (i * _initData.bytesPerDatum);
-                    const RawTile::ReadError err = rasterRead(i + 1, io, dest);
+                    const RawTile::ReadError err = rasterRead(dataset, i + 1, io, dest);
                     worstError = std::max(worstError, err);
                 }
             }
@@ -598,7 +682,7 @@ void RawTileDataReader::readImageData(IODescription& io, RawTile::ReadError& wor
                     // The final destination pointer is offsetted by one datum byte size
                     // for every raster (or data channel, i.e. R in RGB)
                     char* dest = imageDataDest + (i * _initData.bytesPerDatum);
-                    const RawTile::ReadError err = rasterRead(1, io, dest);
+                    const RawTile::ReadError err = rasterRead(dataset, 1, io, dest);
                     worstError = std::max(worstError, err);
                 }
             }
@@ -607,12 +691,12 @@ void RawTileDataReader::readImageData(IODescription& io, RawTile::ReadError& wor
                     // The final destination pointer is offsetted by one datum byte size
                     // for every raster (or data channel, i.e. R in RGB)
                     char* dest = imageDataDest + (i * _initData.bytesPerDatum);
-                    const RawTile::ReadError err = rasterRead(1, io, dest);
+                    const RawTile::ReadError err = rasterRead(dataset, 1, io, dest);
                     worstError = std::max(worstError, err);
                 }
                 // Last read is the alpha channel
                 char* dest = imageDataDest + (3 * _initData.bytesPerDatum);
-                const RawTile::ReadError err = rasterRead(2, io, dest);
+                const RawTile::ReadError err = rasterRead(dataset, 2, io, dest);
                 worstError = std::max(worstError, err);
             }
             else { // Three or more rasters
@@ -620,14 +704,14 @@ void RawTileDataReader::readImageData(IODescription& io, RawTile::ReadError& wor
                     // The final destination pointer is offsetted by one datum byte size
                     // for every raster (or data channel, i.e. R in RGB)
                     char* dest = imageDataDest + (i * _initData.bytesPerDatum);
-                    const RawTile::ReadError err = rasterRead(3 - i, io, dest);
+                    const RawTile::ReadError err = rasterRead(dataset, 3 - i, io, dest);
                     worstError = std::max(worstError, err);
                 }
             }
             if (nReadRasters > 3) { // Alpha channel exists
                 // Last read is the alpha channel
                 char* dest = imageDataDest + (3 * _initData.bytesPerDatum);
-                const RawTile::ReadError err = rasterRead(4, io, dest);
+                const RawTile::ReadError err = rasterRead(dataset, 4, io, dest);
                 worstError = std::max(worstError, err);
             }
             break;
@@ -733,6 +817,10 @@ int RawTileDataReader::maxChunkLevel() const {
     return _maxChunkLevel;
 }
 
+int RawTileDataReader::maxConcurrentReads() const {
+    return _maxConcurrentReads;
+}
+
 float RawTileDataReader::noDataValueAsFloat() const {
     return _noDataValue;
 }
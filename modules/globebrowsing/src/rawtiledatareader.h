@@ -30,8 +30,10 @@
 #include <modules/globebrowsing/src/tiletextureinitdata.h>
 #include <modules/globebrowsing/src/tilecacheproperties.h>
 #include <ghoul/misc/boolean.h>
-#include <string>
+#include <condition_variable>
 #include <mutex>
+#include <string>
+#include <vector>
 #include <gdal.h>
 
 class GDALDataset;
@@ -55,14 +57,23 @@ public:
      *        utilize cache
      * \param preprocess whether the loaded data should be calculate meta data about the
      *        dataset
+     * \param maxConcurrentReads the maximum number of tiles that can be read at the same
+     *        time. Each concurrent read uses its own handle to the GDAL dataset
      */
     RawTileDataReader(std::string filePath, TileTextureInitData initData,
         TileCacheProperties cacheProperties,
-        PerformPreprocessing preprocess = PerformPreprocessing::No);
+        PerformPreprocessing preprocess = PerformPreprocessing::No,
+        int maxConcurrentReads = 1);
     ~RawTileDataReader();
 
+    /**
+     * Closes all dataset handles and reopens the dataset. Waits for all tile reads that
+     * are currently in progress to finish first. Tile reads that are started while the
+     * reader is being reset will wait until the reset has been completed.
+     */
     void reset();
     int maxChunkLevel() const;
+    int maxConcurrentReads() const;
     float noDataValueAsFloat() const;
 
     RawTile readTileData(TileIndex tileIndex) const;
@@ -74,18 +85,32 @@ private:
 
     void initialize();
 
-    RawTile::ReadError rasterRead(int rasterBand, const IODescription& io,
-        char* dataDestination) const;
+    /**
+     * Returns a dataset handle that is not used by any other thread. If all open handles
+     * are in use, a new one is opened unless the maximum number of handles is reached,
+     * in which case this function blocks until another thread releases its handle.
+     * Returns `nullptr` if a new handle could not be opened.
+     */
+    GDALDataset* acquireDataset() const;
+
+    /// Returns a handle that was retrieved through #acquireDataset back to the pool
+    void releaseDataset(GDALDataset* dataset) const;
+
+    void closeDatasets();
+
+    RawTile::ReadError rasterRead(GDALDataset* dataset, int rasterBand,
+        const IODescription& io, char* dataDestination) const;
 
-    void readImageData(IODescription& io, RawTile::ReadError& worstError,
-        char* imageDataDest) const;
+    void readImageData(GDALDataset* dataset, IODescription& io,
+        RawTile::ReadError& worstError, char* imageDataDest) const;
 
     IODescription ioDescription(const TileIndex& tileIndex) const;
 
     TileMetaData tileMetaData(RawTile& rawTile, const PixelRegion& region) const;
 
     const std::string _datasetFilePath;
-    GDALDataset* _dataset = nullptr;
+    /// The path that is opened by GDAL, which points to the MRF cache if it is used
+    std::string _openedFilePath;
 
     // Dataset parameters
     int _rasterCount;
@@ -101,6 +126,14 @@ private:
     const PerformPreprocessing _preprocess;
     TileDepthTransform _depthTransform = { .scale = 0.f, .offset = 0.f };
 
+    // Pool of dataset handles. GDAL datasets must not be accessed from multiple threads
+    // at the same time, so each concurrent tile read needs its own handle
+    const int _maxConcurrentReads;
+    mutable std::vector<GDALDataset*> _idleDatasets;
+    mutable int _nOpenDatasets = 0;
+    mutable int _nDatasetsInUse = 0;
+    bool _isResetting = false;
+    mutable std::condition_variable _datasetAvailable;
     mutable std::mutex _datasetLock;
 };
 
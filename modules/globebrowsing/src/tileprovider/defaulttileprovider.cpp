@@ -29,7 +29,11 @@
 #include <openspace/documentation/documentation.h>
 #include <openspace/engine/globals.h>
 #include <openspace/engine/moduleengine.h>
+#include <ghoul/misc/stringhelper.h>
+#include <algorithm>
+#include <filesystem>
 #include <optional>
+#include <thread>
 
 namespace {
     constexpr openspace::properties::Property::PropertyInfo FilePathInfo = {
@@ -77,6 +81,13 @@ namespace {
         // Determines if the tiles should be preprocessed before uploading to the GPU
         std::optional<bool> performPreProcessing;
 
+        // The maximum number of tiles of this layer that are read at the same time. Each
+        // concurrent read opens its own handle to the dataset, so higher values are most
+        // useful for large local datasets where reading is limited by the disk latency.
+        // For local raster files, the default value depends on the number of available
+        // hardware threads. For all other datasets, the default value is 1
+        std::optional<int> concurrentReads [[codegen::inrange(1, 32)]];
+
         struct CacheSettings {
             // Specifies whether to use caching or not
             std::optional<bool> enabled;
@@ -137,6 +148,19 @@ DefaultTileProvider::DefaultTileProvider(const ghoul::Dictionary& dictionary)
     _performPreProcessing = (_layerGroupID == layers::Group::ID::HeightLayers);
     _performPreProcessing = p.performPreProcessing.value_or(_performPreProcessing);
 
+    // Additional dataset handles only pay off for local raster files. Remote datasets,
+    // including local files that describe a WMS or TMS service, are read one tile at a
+    // time unless configured otherwise, as each handle has its own connection
+    const std::filesystem::path datasetPath = std::filesystem::path(p.filePath);
+    const std::string extension = ghoul::toLowerCase(datasetPath.extension().string());
+    const bool isLocalRaster = std::filesystem::is_regular_file(datasetPath) &&
+                               extension != ".wms" && extension != ".xml";
+    _concurrentReads = p.concurrentReads.value_or(
+        isLocalRaster ?
+            std::clamp(static_cast<int>(std::thread::hardware_concurrency()) / 4, 1, 4) :
+            1
+    );
+
     // Get the name of the layergroup to which this layer belongs
     auto it = std::find_if(
         layers::Groups.begin(),
@@ -200,7 +224,8 @@ void DefaultTileProvider::initAsyncTileDataReader(TileTextureInitData initData,
             _filePath,
             std::move(initData),
             std::move(cacheProperties),
-            RawTileDataReader::PerformPreprocessing(_performPreProcessing)
+            RawTileDataReader::PerformPreprocessing(_performPreProcessing),
+            _concurrentReads
         )
     );
 }
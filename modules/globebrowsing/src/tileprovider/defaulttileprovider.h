@@ -57,6 +57,7 @@ private:
     std::unique_ptr<AsyncTileDataProvider> _asyncTextureDataProvider;
     layers::Group::ID _layerGroupID = layers::Group::ID::Unknown;
     bool _performPreProcessing = false;
+    int _concurrentReads = 1;
     TileCacheProperties _cacheProperties;
 };
 
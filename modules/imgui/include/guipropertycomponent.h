@@ -28,16 +28,23 @@
 #include <modules/imgui/include/guicomponent.h>
 
 #include <openspace/properties/list/stringlistproperty.h>
+#include <openspace/properties/property.h>
 #include <openspace/properties/scalar/boolproperty.h>
 #include <ghoul/misc/boolean.h>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <span>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
-namespace openspace::properties {
-    class Property;
-    class PropertyOwner;
-} // namespace openspace::properties
+namespace openspace { class SceneGraphNode; }
+
+namespace openspace::events { struct Event; }
+
+namespace openspace::properties { class PropertyOwner; }
 
 namespace openspace::gui {
 
@@ -62,6 +69,78 @@ protected:
     std::function<std::vector<properties::PropertyOwner*>()> _propertyOwnerFunction;
 
     properties::BoolProperty _useTreeLayout;
+
+private:
+    /**
+     * The information about a single PropertyOwner that is needed to render it. These
+     * are created the first time an owner is rendered and are kept until the property
+     * tree or the visibility filter changes.
+     */
+    struct OwnerView {
+        /// The number of properties of the owner and all of its sub owners
+        int nPropertiesRecursive = 0;
+        /// The number of visible properties of the owner itself
+        int nVisible = 0;
+        /// The number of visible properties of the owner and all of its sub owners
+        int nVisibleRecursive = 0;
+        /// The grouped properties of the owner, sorted by the group identifier
+        std::vector<std::pair<std::string, std::vector<properties::Property*>>> groups;
+        /// The properties of the owner that do not belong to a group
+        std::vector<properties::Property*> ungrouped;
+    };
+
+    /// A node in the tree that is created from the GUI paths of SceneGraphNodes
+    struct TreeNode {
+        std::string path;
+        std::vector<std::unique_ptr<TreeNode>> children;
+        std::vector<SceneGraphNode*> nodes;
+    };
+
+    /**
+     * Throws away all cached OwnerView%s and the tree if the property tree has been
+     * changed or the visibility filter has been changed since the last frame, or if the
+     * component was not rendered in the previous frame.
+     */
+    void updateViewModel();
+
+    /**
+     * Returns whether an event that changes the property tree, including the visibility
+     * of its properties, is in the list of events starting at \p first. Sets
+     * \p last to the last event in the list, or leaves it unchanged if the list is
+     * empty.
+     */
+    static bool hasPropertyTreeChanged(const events::Event* first,
+        const events::Event*& last);
+
+    /// Sorts the owners and rebuilds the tree of GUI paths
+    void rebuildTree();
+    static void addPathToTree(TreeNode& node, std::span<const std::string> path,
+        SceneGraphNode* owner);
+    static void simplifyTree(TreeNode& node);
+
+    const OwnerView& ownerView(properties::PropertyOwner* owner);
+    void renderOwner(properties::PropertyOwner* owner);
+    void renderTree(const TreeNode& node);
+    void renderOwnerHeader(properties::PropertyOwner* owner);
+
+    /// The owners as they were returned by the owner function, or set directly
+    std::vector<properties::PropertyOwner*> _sourceOwners;
+    /// The owners in the order in which they are rendered
+    std::vector<properties::PropertyOwner*> _sortedOwners;
+    TreeNode _tree;
+    /// The number of owners at the beginning of _sortedOwners that are in the _tree
+    size_t _nOwnersInTree = 0;
+    bool _hasGuiGroups = false;
+    bool _isTreeDirty = true;
+    /// Set if the property tree changed while the component was rendered
+    bool _isViewModelDirty = false;
+    /// The last event of the current frame that has been checked by the component
+    const events::Event* _lastCheckedEvent = nullptr;
+
+    std::unordered_map<const properties::PropertyOwner*, OwnerView> _ownerViews;
+    using Visibility = properties::Property::Visibility;
+    Visibility _visibility = Visibility::Hidden;
+    uint64_t _lastUpdatedFrame = std::numeric_limits<uint64_t>::max();
 };
 
 } // namespace openspace::gui
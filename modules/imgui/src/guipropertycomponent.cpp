@@ -28,11 +28,14 @@
 #include <modules/imgui/include/renderproperties.h>
 #include <openspace/engine/globals.h>
 #include <openspace/engine/openspaceengine.h>
+#include <openspace/events/event.h>
+#include <openspace/events/eventengine.h>
+#include <openspace/rendering/renderengine.h>
 #include <openspace/scene/scenegraphnode.h>
 #include <ghoul/misc/stringhelper.h>
 #include <algorithm>
-
-//#define Debugging_ImGui_TreeNode_Indices
+#include <iterator>
+#include <map>
 
 namespace {
     const ImVec2 Size = ImVec2(350, 500);
@@ -46,11 +49,10 @@ namespace {
         openspace::properties::Property::Visibility::AdvancedUser
     };
 
-    int nVisibleProperties(const std::vector<openspace::properties::Property*>& props)
+    int nVisibleProperties(const std::vector<openspace::properties::Property*>& props,
+                           openspace::properties::Property::Visibility visibilityFilter)
     {
         using namespace openspace;
-        using Visibility = properties::Property::Visibility;
-        const Visibility visibilityFilter = global::openSpaceEngine->visibility();
 
         return static_cast<int>(std::count_if(
             props.begin(),
@@ -71,151 +73,296 @@ namespace {
             ImGui::SetTooltip("%s", propOwner->description().c_str());
         }
     }
+} // namespace
 
-    struct TreeNode {
-        explicit TreeNode(std::string p)
-            : path(std::move(p))
-#ifdef Debugging_ImGui_TreeNode_Indices
-            , index(nextIndex++)
-#endif // Debugging_ImGui_TreeNode_Indices
-        {}
+namespace openspace::gui {
 
-        std::string path;
-        std::vector<std::unique_ptr<TreeNode>> children;
-        std::vector<openspace::SceneGraphNode*> nodes;
-#ifdef Debugging_ImGui_TreeNode_Indices
-        int index = 0;
-        static int nextIndex;
-#endif // Debugging_ImGui_TreeNode_Indices
+GuiPropertyComponent::GuiPropertyComponent(std::string identifier, std::string guiName,
+                                           UseTreeLayout useTree)
+    : GuiComponent(std::move(identifier), std::move(guiName))
+    , _useTreeLayout(UseTreeInfo, useTree)
+{
+    addProperty(_useTreeLayout);
+    _useTreeLayout.onChange([this]() { _isTreeDirty = true; });
+}
 
-    };
+void GuiPropertyComponent::setPropertyOwners(
+                                   std::vector<properties::PropertyOwner*> propertyOwners)
+{
+    _propertyOwners = std::move(propertyOwners);
+}
 
-#ifdef Debugging_ImGui_TreeNode_Indices
+void GuiPropertyComponent::setPropertyOwnerFunction(
+                            std::function<std::vector<properties::PropertyOwner*>()> func)
+{
+    _propertyOwnerFunction = std::move(func);
+}
 
-    int TreeNode::nextIndex = 0;
+void GuiPropertyComponent::updateViewModel() {
+    // This function is called for every owner that is rendered, but we only need to
+    // check for changes once per frame
+    const uint64_t frame = global::renderEngine->frameNumber();
+    if (frame == _lastUpdatedFrame) {
+        return;
+    }
+    // The events of frames in which the component was not rendered have been missed,
+    // so the cached views might point to properties that no longer exist
+    const bool hasSkippedFrames = frame != _lastUpdatedFrame + 1;
+    _lastUpdatedFrame = frame;
+
+    _lastCheckedEvent = nullptr;
+    const bool hasTreeChanged =
+        hasPropertyTreeChanged(global::eventEngine->firstEvent(), _lastCheckedEvent);
+    const bool isChanged = hasSkippedFrames || _isViewModelDirty || hasTreeChanged ||
+        global::openSpaceEngine->visibility() != _visibility;
+    if (isChanged) {
+        _visibility = global::openSpaceEngine->visibility();
+        _ownerViews.clear();
+        _isTreeDirty = true;
+        _isViewModelDirty = false;
+    }
+}
 
-#endif // Debugging_ImGui_TreeNode_Indices
+bool GuiPropertyComponent::hasPropertyTreeChanged(const events::Event* first,
+                                                   const events::Event*& last)
+{
+    bool hasChanged = false;
+    for (const events::Event* e = first; e; e = e->next) {
+        using Type = events::Event::Type;
+        hasChanged |= e->type == Type::PropertyTreeUpdated ||
+                      e->type == Type::PropertyTreePruned ||
+                      e->type == Type::GuiTreeUpdated;
+        last = e;
+    }
+    return hasChanged;
+}
 
-    void addPathToTree(TreeNode& node, const std::vector<std::string>& path,
-                       openspace::SceneGraphNode* owner)
-    {
-        if (path.empty()) {
-            // No more path, so we have reached a leaf
-            node.nodes.push_back(owner);
-            return;
-        }
+const GuiPropertyComponent::OwnerView& GuiPropertyComponent::ownerView(
+                                                         properties::PropertyOwner* owner)
+{
+    auto it = _ownerViews.find(owner);
+    if (it != _ownerViews.end()) {
+        return it->second;
+    }
 
-        // Check if any of the children's paths contains the first part of the path
-        const auto it = std::find_if(
-            node.children.begin(),
-            node.children.end(),
-            [p = *path.begin()](const std::unique_ptr<TreeNode>& c) {
-                return c->path == p;
-            }
-        );
+    OwnerView view;
+    const std::vector<properties::Property*>& props = owner->properties();
+    view.nPropertiesRecursive = static_cast<int>(props.size());
+    view.nVisible = nVisibleProperties(props, _visibility);
+    view.nVisibleRecursive = view.nVisible;
+    for (properties::PropertyOwner* subOwner : owner->propertySubOwners()) {
+        const OwnerView& sub = ownerView(subOwner);
+        view.nPropertiesRecursive += sub.nPropertiesRecursive;
+        view.nVisibleRecursive += sub.nVisibleRecursive;
+    }
 
-        TreeNode* n = nullptr;
-        if (it != node.children.end()) {
-            // We have a child, so we use it
-            n = it->get();
+    std::map<std::string, std::vector<properties::Property*>> propertiesByGroup;
+    for (properties::Property* p : props) {
+        const std::string& group = p->groupIdentifier();
+        if (group.empty()) {
+            view.ungrouped.push_back(p);
         }
         else {
-            // We don't have a child, so we must generate it
-            auto newNode = std::make_unique<TreeNode>(*path.begin());
-            n = newNode.get();
-            node.children.push_back(std::move(newNode));
+            propertiesByGroup[group].push_back(p);
         }
+    }
+    view.groups.assign(
+        std::make_move_iterator(propertiesByGroup.begin()),
+        std::make_move_iterator(propertiesByGroup.end())
+    );
+
+    return _ownerViews.emplace(owner, std::move(view)).first->second;
+}
+
+void GuiPropertyComponent::addPathToTree(TreeNode& node,
+                                         std::span<const std::string> path,
+                                         SceneGraphNode* owner)
+{
+    if (path.empty()) {
+        // No more path, so we have reached a leaf
+        node.nodes.push_back(owner);
+        return;
+    }
+
+    // Check if any of the children's paths contains the first part of the path
+    const auto it = std::find_if(
+        node.children.begin(),
+        node.children.end(),
+        [&p = path.front()](const std::unique_ptr<TreeNode>& c) { return c->path == p; }
+    );
+
+    TreeNode* n = nullptr;
+    if (it != node.children.end()) {
+        // We have a child, so we use it
+        n = it->get();
+    }
+    else {
+        // We don't have a child, so we must generate it
+        auto newNode = std::make_unique<TreeNode>();
+        newNode->path = path.front();
+        n = newNode.get();
+        node.children.push_back(std::move(newNode));
+    }
+
+    // Recurse into the tree and chop off the first path
+    addPathToTree(*n, path.subspan(1), owner);
+}
+
+void GuiPropertyComponent::simplifyTree(TreeNode& node) {
+    // Merging consecutive nodes if they only have a single child
 
-        // Recurse into the tree and chop off the first path
-        addPathToTree(
-            *n,
-            std::vector<std::string>(path.begin() + 1, path.end()),
-            owner
+    for (const std::unique_ptr<TreeNode>& c : node.children) {
+        simplifyTree(*c);
+    }
+
+    if ((node.children.size() == 1) && (node.nodes.empty())) {
+        node.path = node.path + "/" + node.children[0]->path;
+        node.nodes = std::move(node.children[0]->nodes);
+        std::vector<std::unique_ptr<TreeNode>> children = std::move(
+            node.children[0]->children
         );
+        node.children = std::move(children);
     }
+}
 
-    void simplifyTree(TreeNode& node) {
-        // Merging consecutive nodes if they only have a single child
+void GuiPropertyComponent::rebuildTree() {
+    using namespace properties;
 
-        for (const std::unique_ptr<TreeNode>& c : node.children) {
-            simplifyTree(*c);
+    _sortedOwners = _sourceOwners;
+    std::sort(
+        _sortedOwners.begin(),
+        _sortedOwners.end(),
+        [](PropertyOwner* lhs, PropertyOwner* rhs) {
+            return lhs->guiName() < rhs->guiName();
         }
+    );
 
-        if ((node.children.size() == 1) && (node.nodes.empty())) {
-            node.path = node.path + "/" + node.children[0]->path;
-            node.nodes = std::move(node.children[0]->nodes);
-            std::vector<std::unique_ptr<TreeNode>> children = std::move(
-                node.children[0]->children
-            );
-            node.children = std::move(children);
-        }
+    _tree = TreeNode();
+    _hasGuiGroups = false;
+    _nOwnersInTree = 0;
+    if (!_useTreeLayout) {
+        return;
     }
 
-    void renderTree(const TreeNode& node,
-            const std::function<void (openspace::properties::PropertyOwner*)>& renderFunc)
-    {
-        if (node.path.empty() || ImGui::TreeNode(node.path.c_str())) {
-            for (const std::unique_ptr<TreeNode>& c : node.children) {
-                renderTree(*c, renderFunc);
-            }
+    for (PropertyOwner* owner : _sortedOwners) {
+        ghoul_assert(
+            dynamic_cast<SceneGraphNode*>(owner),
+            "When using the tree layout, all owners must be SceneGraphNodes"
+        );
+        (void)owner; // using [[maybe_unused]] in the for loop gives an error
+    }
 
-            for (openspace::SceneGraphNode* n : node.nodes) {
-                renderFunc(n);
+    // Sort: by name and shortest first
+    std::vector<std::pair<std::string, PropertyOwner*>> paths;
+    paths.reserve(_sortedOwners.size());
+    for (PropertyOwner* owner : _sortedOwners) {
+        // We checked above that owner is a SceneGraphNode
+        paths.emplace_back(static_cast<SceneGraphNode*>(owner)->guiPath(), owner);
+    }
+    std::stable_sort(
+        paths.begin(),
+        paths.end(),
+        [](const std::pair<std::string, PropertyOwner*>& lhs,
+           const std::pair<std::string, PropertyOwner*>& rhs)
+        {
+            if (lhs.first.empty()) {
+                return false;
             }
-
-            if (!node.path.empty()) {
-                ImGui::TreePop();
+            if (rhs.first.empty()) {
+                return true;
             }
+            return lhs.first < rhs.first;
         }
+    );
+    for (size_t i = 0; i < paths.size(); i++) {
+        _sortedOwners[i] = paths[i].second;
     }
-} // namespace
 
-namespace openspace::gui {
+    // If the owners list is empty, we want to do the normal thing (-> nothing)
+    // Otherwise, check if the first owner has a GUI group
+    _hasGuiGroups = !paths.empty() && !paths.front().first.empty();
+    if (!_hasGuiGroups) {
+        return;
+    }
 
-GuiPropertyComponent::GuiPropertyComponent(std::string identifier, std::string guiName,
-                                           UseTreeLayout useTree)
-    : GuiComponent(std::move(identifier), std::move(guiName))
-    , _useTreeLayout(UseTreeInfo, useTree)
-{
-    addProperty(_useTreeLayout);
+    for (const auto& [gui, owner] : paths) {
+        if (gui.empty()) {
+            // We know that we are done now since we stable_sort:ed them above
+            break;
+        }
+        const std::vector<std::string> tokens = ghoul::tokenizeString(gui.substr(1), '/');
+        addPathToTree(_tree, tokens, static_cast<SceneGraphNode*>(owner));
+        _nOwnersInTree++;
+    }
+
+    simplifyTree(_tree);
 }
 
-void GuiPropertyComponent::setPropertyOwners(
-                                   std::vector<properties::PropertyOwner*> propertyOwners)
-{
-    _propertyOwners = std::move(propertyOwners);
+void GuiPropertyComponent::renderTree(const TreeNode& node) {
+    if (node.path.empty() || ImGui::TreeNode(node.path.c_str())) {
+        for (const std::unique_ptr<TreeNode>& c : node.children) {
+            renderTree(*c);
+        }
+
+        for (SceneGraphNode* n : node.nodes) {
+            renderOwnerHeader(n);
+        }
+
+        if (!node.path.empty()) {
+            ImGui::TreePop();
+        }
+    }
 }
 
-void GuiPropertyComponent::setPropertyOwnerFunction(
-                            std::function<std::vector<properties::PropertyOwner*>()> func)
-{
-    _propertyOwnerFunction = std::move(func);
+void GuiPropertyComponent::renderOwnerHeader(properties::PropertyOwner* owner) {
+    if (ownerView(owner).nVisibleRecursive == 0) {
+        return;
+    }
+
+    bool isOpen = true;
+    if (_sortedOwners.size() > 1) {
+        // Create a header in case we have multiple owners
+        isOpen = ImGui::CollapsingHeader(owner->guiName().c_str());
+    }
+    else if (!owner->identifier().empty()) {
+        // If the owner has a name, print it first
+        ImGui::Text("%s", owner->guiName().c_str());
+        ImGui::Spacing();
+    }
+
+    if (isOpen) {
+        renderOwner(owner);
+    }
 }
 
 void GuiPropertyComponent::renderPropertyOwner(properties::PropertyOwner* owner) {
+    updateViewModel();
+    renderOwner(owner);
+}
+
+void GuiPropertyComponent::renderOwner(properties::PropertyOwner* owner) {
     using namespace properties;
 
-    if (owner->propertiesRecursive().empty()) {
+    const OwnerView& view = ownerView(owner);
+    if (view.nPropertiesRecursive == 0) {
         return;
     }
 
-    const int nThisProperty = nVisibleProperties(owner->properties());
     ImGui::PushID(owner->identifier().c_str());
     const std::vector<PropertyOwner*>& subOwners = owner->propertySubOwners();
     for (PropertyOwner* subOwner : subOwners) {
-        const std::vector<Property*>& properties = subOwner->propertiesRecursive();
-        const int count = nVisibleProperties(properties);
-        if (count == 0) {
+        if (ownerView(subOwner).nVisibleRecursive == 0) {
             continue;
         }
-        if (subOwners.size() == 1 && (nThisProperty == 0)) {
-            renderPropertyOwner(subOwner);
+        if (subOwners.size() == 1 && (view.nVisible == 0)) {
+            renderOwner(subOwner);
         }
         else {
+            // Closed subtrees are not walked at all
             const bool opened = ImGui::TreeNode(subOwner->guiName().c_str());
             renderTooltip(subOwner);
             if (opened) {
-                renderPropertyOwner(subOwner);
+                renderOwner(subOwner);
                 ImGui::TreePop();
             }
         }
@@ -225,36 +372,21 @@ void GuiPropertyComponent::renderPropertyOwner(properties::PropertyOwner* owner)
         ImGui::Spacing();
     }
 
-    std::map<std::string, std::vector<Property*>> propertiesByGroup;
-    std::vector<Property*> remainingProperies;
-
-    for (properties::Property* p : owner->properties()) {
-        const std::string& group = p->groupIdentifier();
-        if (group.empty()) {
-            remainingProperies.push_back(p);
-        }
-        else {
-            propertiesByGroup[group].push_back(p);
-        }
-    }
-
-    using K = std::string;
-    using V = std::vector<Property*>;
-    for (const std::pair<const K, V>& p : propertiesByGroup) {
-        const std::string& groupName = owner->propertyGroupName(p.first);
+    for (const auto& [group, props] : view.groups) {
+        const std::string& groupName = owner->propertyGroupName(group);
         if (ImGui::TreeNode(groupName.c_str())) {
-            for (properties::Property* prop : p.second) {
+            for (Property* prop : props) {
                 renderProperty(prop, owner);
             }
             ImGui::TreePop();
         }
     }
 
-    if (!propertiesByGroup.empty()) {
+    if (!view.groups.empty()) {
         ImGui::Spacing();
     }
 
-    for (properties::Property* prop : remainingProperies) {
+    for (Property* prop : view.ungrouped) {
         renderProperty(prop, owner);
     }
     ImGui::PopID();
@@ -270,122 +402,49 @@ void GuiPropertyComponent::render() {
     _isEnabled = v;
 
     _isCollapsed = ImGui::IsWindowCollapsed();
-    using namespace properties;
 
+    updateViewModel();
+
+    // Events can be missed if they are published after the GUI has been rendered in a
+    // frame, so we also compare the owners themselves to notice added or removed nodes
     std::vector<properties::PropertyOwner*> owners =
         _propertyOwnerFunction ? _propertyOwnerFunction() : _propertyOwners;
-
-    std::sort(
-        owners.begin(),
-        owners.end(),
-        [](properties::PropertyOwner* lhs, properties::PropertyOwner* rhs) {
-            return lhs->guiName() < rhs->guiName();
-        }
-    );
-
-    if (_useTreeLayout) {
-        for (properties::PropertyOwner* owner : owners) {
-            ghoul_assert(
-                dynamic_cast<SceneGraphNode*>(owner),
-                "When using the tree layout, all owners must be SceneGraphNodes"
-            );
-            (void)owner; // using [[maybe_unused]] in the for loop gives an error
-        }
-
-        // Sort: by name and shortest first
-        std::stable_sort(
-            owners.begin(),
-            owners.end(),
-            [](PropertyOwner* lhs, PropertyOwner* rhs) {
-                const std::string lhsGrp = dynamic_cast<SceneGraphNode*>(lhs)->guiPath();
-                const std::string rhsGrp = dynamic_cast<SceneGraphNode*>(rhs)->guiPath();
-
-                if (lhsGrp.empty()) {
-                    return false;
-                }
-                if (rhsGrp.empty()) {
-                    return true;
-                }
-
-                return lhsGrp < rhsGrp;
-            }
-        );
+    if (owners != _sourceOwners) {
+        _sourceOwners = std::move(owners);
+        _ownerViews.clear();
+        _isTreeDirty = true;
     }
 
-    // If the owners list is empty, we wnat to do the normal thing (-> nothing)
-    // Otherwise, check if the first owner has a GUI group
-    // This makes the assumption that the tree layout is only used if the owners are
-    // SceenGraphNodes (checked above)
-    const bool noGuiGroups = owners.empty() ||
-                             (dynamic_cast<SceneGraphNode*>(*owners.begin()) &&
-                       dynamic_cast<SceneGraphNode*>(*owners.begin())->guiPath().empty());
-
-    auto renderProp = [this, owners](properties::PropertyOwner* pOwner) {
-        const int count = nVisibleProperties(pOwner->propertiesRecursive());
-
-        if (count == 0) {
-            return;
-        }
-
-        auto header = [&owners, &pOwner]() -> bool {
-            if (owners.size() > 1) {
-                // Create a header in case we have multiple owners
-                return ImGui::CollapsingHeader(pOwner->guiName().c_str());
-            }
-            else if (!pOwner->identifier().empty()) {
-                // If the owner has a name, print it first
-                ImGui::Text("%s", pOwner->guiName().c_str());
-                ImGui::Spacing();
-                return true;
-            }
-            else {
-                // Otherwise, do nothing
-                return true;
-            }
-        };
+    if (_isTreeDirty) {
+        rebuildTree();
+        _isTreeDirty = false;
+    }
 
-        if (header()) {
-            renderPropertyOwner(pOwner);
+    if (!_useTreeLayout || !_hasGuiGroups) {
+        for (properties::PropertyOwner* owner : _sortedOwners) {
+            renderOwnerHeader(owner);
         }
-    };
-
-    if (!_useTreeLayout || noGuiGroups) {
-        std::for_each(owners.begin(), owners.end(), renderProp);
     }
     else { // _useTreeLayout && gui groups exist
-        TreeNode root("");
-
-        for (properties::PropertyOwner* pOwner : owners) {
-            // We checked above that pOwner is a SceneGraphNode
-            SceneGraphNode* nOwner = static_cast<SceneGraphNode*>(pOwner);
-            const std::string gui = nOwner->guiPath();
-            if (gui.empty()) {
-                // We know that we are done now since we stable_sort:ed them above
-                break;
-            }
-            const std::vector<std::string> paths =
-                ghoul::tokenizeString(gui.substr(1), '/');
-            addPathToTree(root, paths, nOwner);
-        }
-
-        simplifyTree(root);
-
-        renderTree(root, renderProp);
+        renderTree(_tree);
 
         ImGui::SetCursorPosY(ImGui::GetCursorPosY() + 20.f);
 
-        for (properties::PropertyOwner* pOwner : owners) {
-            // We checked above that pOwner is a SceneGraphNode
-            SceneGraphNode* nOwner = static_cast<SceneGraphNode*>(pOwner);
-
-            if (!nOwner->guiPath().empty()) {
-                continue;
-            }
-
-            renderProp(pOwner);
+        // The owners without a GUI path are sorted to the end of the list
+        for (size_t i = _nOwnersInTree; i < _sortedOwners.size(); i++) {
+            renderOwnerHeader(_sortedOwners[i]);
         }
     }
 
+    // Changing a property through the GUI can remove properties or change their
+    // visibility. The events are cleared at the end of the frame, so we have to check
+    // the events that were published while rendering to update the counts in the next
+    // frame
+    const events::Event* first = _lastCheckedEvent ?
+        _lastCheckedEvent->next :
+        global::eventEngine->firstEvent();
+    _isViewModelDirty = hasPropertyTreeChanged(first, _lastCheckedEvent);
+
     ImGui::End();
 }
 
@@ -395,7 +454,7 @@ void GuiPropertyComponent::renderProperty(properties::Property* prop,
     using Func = std::function<
         void(properties::Property*, const std::string&, ShowToolTip, double)
     >;
-    static const std::map<std::string, Func> FunctionMapping = {
+    static const std::map<std::string, Func, std::less<>> FunctionMapping = {
         { "BoolProperty", &renderBoolProperty },
         { "DoubleProperty", &renderDoubleProperty },
         { "IntProperty", &renderIntProperty },
@@ -428,7 +487,7 @@ void GuiPropertyComponent::renderProperty(properties::Property* prop,
     const auto v = static_cast<std::underlying_type_t<V>>(visibilityFilter);
     const auto propV = static_cast<std::underlying_type_t<V>>(prop->visibility());
     if (v >= propV) {
-        auto it = FunctionMapping.find(std::string(prop->className()));
+        auto it = FunctionMapping.find(prop->className());
         if (it != FunctionMapping.end()) {
             if (owner) {
                 it->second(
@@ -151,16 +151,16 @@ void IswaManager::addIswaCygnet(int id, const std::string& type, std::string gro
     }
     else if (id < 0) {
         // create metadata object and assign group and id
-        MetadataFuture metaFuture;
-        metaFuture.id = id;
-        metaFuture.group = std::move(group);
+        auto metaFuture = std::make_shared<MetadataFuture>();
+        metaFuture->id = id;
+        metaFuture->group = std::move(group);
 
         // Assign type of cygnet Texture/Data
         if (type == _type[CygnetType::Texture]) {
-            metaFuture.type = CygnetType::Texture;
+            metaFuture->type = CygnetType::Texture;
         }
         else if (type  == _type[CygnetType::Data]) {
-            metaFuture.type = CygnetType::Data;
+            metaFuture->type = CygnetType::Data;
         }
         else {
             LERROR("\""+ type + "\" is not a valid type");
@@ -170,27 +170,28 @@ void IswaManager::addIswaCygnet(int id, const std::string& type, std::string gro
         // This callback determines what geometry should be used and creates
         // the right cygnet
         auto metadataCallback =
-            [this, &metaFuture](const DownloadManager::MemoryFile& file) {
+            [this, metaFuture](const DownloadManager::MemoryFile& file) {
                 //Create a string from downloaded file
                 std::string res(file.buffer, file.buffer + file.size);
-                metaFuture.json = res;
+                metaFuture->json = res;
 
                 //convert to json
                 nlohmann::json j = nlohmann::json::parse(res);
 
                 // Check what kind of geometry here
                 if (j["Coordinate Type"].is_null()) {
-                    metaFuture.geom = CygnetGeometry::Sphere;
-                    createSphere(metaFuture);
+                    metaFuture->geom = CygnetGeometry::Sphere;
+                    createSphere(*metaFuture);
                 }
                 else if (j["Coordinate Type"] == "Cartesian") {
-                    metaFuture.geom = CygnetGeometry::Plane;
-                    createPlane(metaFuture);
+                    metaFuture->geom = CygnetGeometry::Plane;
+                    createPlane(*metaFuture);
                 }
                 LDEBUG("Download to memory finished");
             };
 
-        // Download metadata
+        // Download metadata. The callback runs on the download thread and creates the
+        // cygnet groups, so we wait for it to not modify them while this thread does
         global::downloadManager->fetchFile(
             _baseUrl + std::to_string(-id),
             metadataCallback,
@@ -200,7 +201,7 @@ void IswaManager::addIswaCygnet(int id, const std::string& type, std::string gro
                     std::to_string(id) + ": " + err
                 );
             }
-        );
+        ).wait();
     }
 }
 
@@ -338,16 +339,18 @@ std::map<std::string, std::vector<CdfInfo>>& IswaManager::cdfInformation() {
 std::shared_ptr<MetadataFuture> IswaManager::downloadMetadata(int id) {
     auto metaFuture = std::make_shared<MetadataFuture>();
     metaFuture->id = id;
+    // The metadata is finished when it is returned, so that its values are not written
+    // by the download thread while they are read
     global::downloadManager->fetchFile(
         _baseUrl + std::to_string(-id),
-        [&metaFuture](const DownloadManager::MemoryFile& file) {
+        [metaFuture](const DownloadManager::MemoryFile& file) {
             metaFuture->json = std::string(file.buffer, file.buffer + file.size);
             metaFuture->isFinished = true;
         },
         [](const std::string& err) {
             LWARNING("Download Metadata to memory was aborted: " + err);
         }
-    );
+    ).wait();
     return metaFuture;
 }
 
@@ -25,10 +25,12 @@
 #ifndef __OPENSPACE_MODULE_KAMELEON___KAMELEONWRAPPER___H__
 #define __OPENSPACE_MODULE_KAMELEON___KAMELEONWRAPPER___H__
 
+#include <modules/kameleon/include/uniformgridsampler.h>
 #include <ghoul/glm.h>
 #include <glm/gtx/std_based_type.hpp>
 #include <array>
 #include <filesystem>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -127,6 +129,14 @@ public:
 private:
     using TraceLine = std::vector<glm::vec3>;
 
+    // Writes the nChannels samples of the voxel with the provided index into the output
+    using Sampler = std::function<void(ccmc::Interpolator&, const glm::size3_t&, float*)>;
+
+    // Samples every voxel of the grid with the sampler on multiple threads, each of which
+    // uses its own interpolator, and passes the results to the consumer in order
+    void sampleUniformGrid(const glm::size3_t& dimensions, size_t nChannels,
+        const Sampler& sampler, const SampleConsumer& consumer) const;
+
     TraceLine traceCartesianFieldline(const std::string& xVar, const std::string& yVar,
         const std::string& zVar, const glm::vec3& seedPoint, float stepSize,
         TraceDirection direction, FieldlineEnd& end) const;
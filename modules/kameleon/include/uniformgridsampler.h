@@ -0,0 +1,81 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_KAMELEON___UNIFORMGRIDSAMPLER___H__
+#define __OPENSPACE_MODULE_KAMELEON___UNIFORMGRIDSAMPLER___H__
+
+#include <ghoul/glm.h>
+#include <glm/gtx/std_based_type.hpp>
+#include <atomic>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/// Controls how a uniform grid is sampled and how the progress is reported
+struct SamplingOptions {
+    /// Called on the calling thread with the fraction [0,1] of finished samples
+    std::function<void(float)> progress;
+    /// If this is set to `true` while sampling, the sampling stops as soon as possible
+    const std::atomic_bool* cancel = nullptr;
+    /// The number of threads that sample in parallel, 0 uses all cores
+    unsigned int nThreads = 0;
+};
+
+/// Receives the samples of consecutive voxels, starting at the voxel \p first
+using SampleConsumer = std::function<void(size_t first, std::span<const float>)>;
+
+/// Writes the samples of the voxel with the provided index into the output
+using VoxelSampler = std::function<void(const glm::size3_t& index, float* out)>;
+
+/**
+ * Returns the number of threads that #sampleUniformGrid uses for a grid with the
+ * provided \p dimensions, which is the number of VoxelSampler%s it needs.
+ */
+size_t nSamplingThreads(const glm::size3_t& dimensions, const SamplingOptions& options);
+
+/**
+ * Samples every voxel of a grid with the provided \p dimensions on multiple threads. The
+ * grid is split into slabs of consecutive rows, which are sampled in memory order by the
+ * threads. Each thread uses one of the \p samplers exclusively, so they do not have to be
+ * thread-safe. The samples are passed to the \p consumer on the calling thread in the
+ * order of the voxels, with \p nChannels values per voxel. Only a few slabs are kept in
+ * memory at a time. If a sampler throws an exception, the sampling stops and the
+ * exception is rethrown on the calling thread.
+ *
+ * \param dimensions The number of voxels along each axis of the grid
+ * \param nChannels The number of values that are written for each voxel
+ * \param samplers The samplers of the threads, there must be #nSamplingThreads of them
+ * \param consumer Receives the sampled values
+ * \param options The options that control the sampling
+ * \return `false` if the sampling was cancelled, `true` otherwise
+ */
+bool sampleUniformGrid(const glm::size3_t& dimensions, size_t nChannels,
+    const std::vector<VoxelSampler>& samplers, const SampleConsumer& consumer,
+    const SamplingOptions& options);
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_KAMELEON___UNIFORMGRIDSAMPLER___H__
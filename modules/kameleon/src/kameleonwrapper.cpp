@@ -31,7 +31,9 @@
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/assert.h>
 #include <ghoul/misc/stringhelper.h>
+#include <algorithm>
 #include <filesystem>
+#include <memory>
 
 #ifdef WIN32
 #pragma warning (push)
@@ -176,10 +178,12 @@ float* KameleonWrapper::uniformSampledValues(const std::string& var,
         "Loading variable '{}' from CDF data with a uniform sampling", var
     ));
 
-    const size_t size = outDimensions.x * outDimensions.y * outDimensions.z;
-    float* data = new float[size];
-    std::vector<double> doubleData(size);
+    // The variable has to be loaded before multiple threads access it
+    _model->loadVariable(var);
+    const long varId = _model->getVariableID(var);
 
+    const size_t size = outDimensions.x * outDimensions.y * outDimensions.z;
+    auto data = std::make_unique<float[]>(size);
 
     const double varMin =
         _model->getVariableAttribute(var, "actual_min").getAttributeFloat();
@@ -190,7 +194,7 @@ float* KameleonWrapper::uniformSampledValues(const std::string& var,
 
     // HISTOGRAM
     constexpr int NBins = 200;
-    std::vector<int> histogram(NBins, 0);
+    std::vector<size_t> histogram(NBins, 0);
     // Explicitly mentioning the capture list provides either an error on MSVC (if NBins)
     // is not specified or a warning on Clang if it is specified. Sigh...
     auto mapToHistogram = [=](double val) {
@@ -201,97 +205,120 @@ float* KameleonWrapper::uniformSampledValues(const std::string& var,
         return glm::clamp(izerotoone, 0, NBins - 1);
     };
 
-    // ProgressBar pb(static_cast<int>(outDimensions.x));
-    for (size_t x = 0; x < outDimensions.x; ++x) {
-        for (size_t y = 0; y < outDimensions.y; ++y) {
-            for (size_t z = 0; z < outDimensions.z; ++z) {
-                const size_t index = x + y * outDimensions.x +
-                                     z * outDimensions.x * outDimensions.y;
-
-                if (_gridType == GridType::Spherical) {
-                    // Put r in the [0..sqrt(3)] range
-                    const double rNorm = glm::root_three<double>() * x /
-                                         outDimensions.x - 1;
-
-                    // Put theta in the [0..PI] range
-                    const double thetaNorm = glm::pi<double>() * y / outDimensions.y - 1;
-
-                    // Put phi in the [0..2PI] range
-                    const double phiNorm = glm::two_pi<double>() * z /
-                                           outDimensions.z - 1;
-
-                    // Go to physical coordinates before sampling
-                    const double rPh = _min.x + rNorm * (_max.x - _min.x);
-                    const double thetaPh = thetaNorm;
-                    // phi range needs to be mapped to the slightly different model
-                    // range to avoid gaps in the data Subtract a small term to
-                    // avoid rounding errors when comparing to phiMax.
-                    const double phiPh = _min.z + phiNorm /
-                                    glm::two_pi<double>() * (_max.z - _min.z - 0.000001);
-
-                    double value = 0.0;
-                    // See if sample point is inside domain
-                    if (rPh < _min.x || rPh > _max.x || thetaPh < _min.y ||
-                        thetaPh > _max.y || phiPh < _min.z || phiPh > _max.z)
-                    {
-                        if (phiPh > _max.z) {
-                            LWARNING("Warning: There might be a gap in the data");
-                        }
-                        // Leave values at zero if outside domain
-                    }
-                    else { // if inside
-                        // ENLIL CDF specific hacks!
-                        // Convert from meters to AU for interpolator
-                        const double localRPh = rPh / ccmc::constants::AU_in_meters;
-                        // Convert from colatitude [0, pi] rad to latitude [-90, 90] deg
-                        const double localThetaPh = -thetaPh * 180.f /
-                                                    glm::pi<double>() + 90.f;
-                        // Convert from [0, 2pi] rad to [0, 360] degrees
-                        const double localPhiPh = phiPh * 180.f / glm::pi<double>();
-                        // Sample
-                        value = _interpolator->interpolate(
-                            var,
-                            static_cast<float>(localRPh),
-                            static_cast<float>(localThetaPh),
-                            static_cast<float>(localPhiPh)
-                        );
-                    }
-
-                    doubleData[index] = value;
-                    histogram[mapToHistogram(value)]++;
-                }
-                else {
-                    // Assume cartesian for fallback purpose
-                    const double stepX = (_max.x - _min.x) /
-                                         (static_cast<double>(outDimensions.x));
-                    const double stepY = (_max.y - _min.y) /
-                                         (static_cast<double>(outDimensions.y));
-                    const double stepZ = (_max.z - _min.z) /
-                                         (static_cast<double>(outDimensions.z));
-
-                    const double xPos = _min.x + stepX * x;
-                    const double yPos = _min.y + stepY * y;
-                    const double zPos = _min.z + stepZ * z;
-
-                    // get interpolated data value for (xPos, yPos, zPos)
-                    // swap yPos and zPos because model has Z as up
-                    double value = _interpolator->interpolate(
-                        var,
-                        static_cast<float>(xPos),
-                        static_cast<float>(zPos),
-                        static_cast<float>(yPos)
-                    );
-                    doubleData[index] = value;
-                    histogram[mapToHistogram(value)]++;
-                }
-            }
+    Sampler sampler;
+    if (_gridType == GridType::Spherical) {
+        // The conversion to the interpolator's coordinates only depends on one grid
+        // index each, so we compute them once per axis rather than once per sample
+        std::vector<float> localR(outDimensions.x);
+        std::vector<char> isInsideR(outDimensions.x);
+        for (size_t x = 0; x < outDimensions.x; x++) {
+            // Put r in the [0..sqrt(3)] range
+            const double rNorm = glm::root_three<double>() * x / outDimensions.x - 1;
+            // Go to physical coordinates before sampling
+            const double rPh = _min.x + rNorm * (_max.x - _min.x);
+            isInsideR[x] = rPh >= _min.x && rPh <= _max.x;
+            // ENLIL CDF specific hacks!
+            // Convert from meters to AU for interpolator
+            localR[x] = static_cast<float>(rPh / ccmc::constants::AU_in_meters);
+        }
+
+        std::vector<float> localTheta(outDimensions.y);
+        std::vector<char> isInsideTheta(outDimensions.y);
+        for (size_t y = 0; y < outDimensions.y; y++) {
+            // Put theta in the [0..PI] range
+            const double thetaNorm = glm::pi<double>() * y / outDimensions.y - 1;
+            const double thetaPh = thetaNorm;
+            isInsideTheta[y] = thetaPh >= _min.y && thetaPh <= _max.y;
+            // Convert from colatitude [0, pi] rad to latitude [-90, 90] deg
+            localTheta[y] = static_cast<float>(
+                -thetaPh * 180.f / glm::pi<double>() + 90.f
+            );
         }
+
+        std::vector<float> localPhi(outDimensions.z);
+        std::vector<char> isInsidePhi(outDimensions.z);
+        bool hasGap = false;
+        for (size_t z = 0; z < outDimensions.z; z++) {
+            // Put phi in the [0..2PI] range
+            const double phiNorm = glm::two_pi<double>() * z / outDimensions.z - 1;
+            // phi range needs to be mapped to the slightly different model
+            // range to avoid gaps in the data Subtract a small term to
+            // avoid rounding errors when comparing to phiMax.
+            const double phiPh = _min.z + phiNorm /
+                            glm::two_pi<double>() * (_max.z - _min.z - 0.000001);
+            isInsidePhi[z] = phiPh >= _min.z && phiPh <= _max.z;
+            hasGap |= phiPh > _max.z;
+            // Convert from [0, 2pi] rad to [0, 360] degrees
+            localPhi[z] = static_cast<float>(phiPh * 180.f / glm::pi<double>());
+        }
+        if (hasGap) {
+            LWARNING("Warning: There might be a gap in the data");
+        }
+
+        sampler = [varId, localR = std::move(localR), isInsideR = std::move(isInsideR),
+                   localTheta = std::move(localTheta),
+                   isInsideTheta = std::move(isInsideTheta),
+                   localPhi = std::move(localPhi), isInsidePhi = std::move(isInsidePhi)](
+                                                       ccmc::Interpolator& interpolator,
+                                                               const glm::size3_t& index,
+                                                                               float* out)
+        {
+            // Leave values at zero if outside domain
+            float value = 0.f;
+            if (isInsideR[index.x] && isInsideTheta[index.y] && isInsidePhi[index.z]) {
+                value = interpolator.interpolate(
+                    varId,
+                    localR[index.x],
+                    localTheta[index.y],
+                    localPhi[index.z]
+                );
+            }
+            *out = value;
+        };
+    }
+    else {
+        // Assume cartesian for fallback purpose
+        const double stepX = (_max.x - _min.x) / (static_cast<double>(outDimensions.x));
+        const double stepY = (_max.y - _min.y) / (static_cast<double>(outDimensions.y));
+        const double stepZ = (_max.z - _min.z) / (static_cast<double>(outDimensions.z));
+        const glm::dvec3 min = _min;
+
+        sampler = [varId, min, stepX, stepY, stepZ](ccmc::Interpolator& interpolator,
+                                                    const glm::size3_t& index, float* out)
+        {
+            const double xPos = min.x + stepX * index.x;
+            const double yPos = min.y + stepY * index.y;
+            const double zPos = min.z + stepZ * index.z;
+
+            // get interpolated data value for (xPos, yPos, zPos)
+            // swap yPos and zPos because model has Z as up
+            *out = interpolator.interpolate(
+                varId,
+                static_cast<float>(xPos),
+                static_cast<float>(zPos),
+                static_cast<float>(yPos)
+            );
+        };
     }
 
-    int sum = 0;
+    // The histogram is built while the slabs arrive, so the values do not have to be
+    // read again in a separate pass
+    sampleUniformGrid(
+        outDimensions,
+        1,
+        sampler,
+        [&](size_t first, std::span<const float> values) {
+            for (const float v : values) {
+                histogram[mapToHistogram(v)]++;
+            }
+            std::copy(values.begin(), values.end(), data.get() + first);
+        }
+    );
+
+    size_t sum = 0;
     int stop = 0;
     constexpr float TruncationLimit = 0.9f;
-    const int upperLimit = static_cast<int>(size * TruncationLimit);
+    const size_t upperLimit = static_cast<size_t>(size * TruncationLimit);
     for (int i = 0; i < NBins; i++) {
         sum += histogram[i];
         if (sum > upperLimit) {
@@ -301,21 +328,13 @@ float* KameleonWrapper::uniformSampledValues(const std::string& var,
     }
 
     const double dist = ((varMax - varMin) / NBins) * stop;
-
     const double varMaxNew = varMin + dist;
     for (size_t i = 0; i < size; i++) {
-        const double normalizedVal = (doubleData[i] - varMin) / (varMaxNew - varMin);
-
+        const double normalizedVal = (data[i] - varMin) / (varMaxNew - varMin);
         data[i] = static_cast<float>(glm::clamp(normalizedVal, 0.0, 1.0));
-        if (data[i] < 0.f) {
-            LERROR(std::format("Datapoint {} less than 0", i));
-        }
-        if (data[i] > 1.f) {
-            LERROR(std::format("Datapoint {} more than 1", i));
-        }
     }
 
-    return data;
+    return data.release();
 }
 
 // This method returns new'd memory,  turn into std::vector<float> instead?
@@ -330,10 +349,10 @@ float* KameleonWrapper::uniformSliceValues(const std::string& var,
     ));
 
     const size_t size = outDimensions.x * outDimensions.y * outDimensions.z;
-    float* data = new float[size];
-    std::vector<double> doubleData(size);
+    auto data = std::make_unique<float[]>(size);
 
     _model->loadVariable(var);
+    const long varId = _model->getVariableID(var);
 
     const double varMin =
         _model->getVariableAttribute(var, "actual_min").getAttributeFloat();
@@ -355,97 +374,113 @@ float* KameleonWrapper::uniformSliceValues(const std::string& var,
     LDEBUG(std::format("{} min: {}", var, varMin));
     LDEBUG(std::format("{} max: {}", var, varMax));
 
-    //double maxValue = 0.0;
-    //double minValue = std::numeric_limits<double>::max();
-
-    float missingValue = _model->getMissingValue();
-
-    for (size_t x = 0; x < outDimensions.x; ++x) {
-        for (size_t y = 0; y < outDimensions.y; ++y) {
-            for (size_t z = 0; z < outDimensions.z; ++z) {
-
-                const float xi = (hasXSlice) ? slice : x;
-                const float yi = (hasYSlice) ? slice : y;
-                const float zi = (hasZSlice) ? slice : z;
-
-                double value = 0;
-                const size_t index = x + y * outDimensions.x +
-                                     z * outDimensions.x * outDimensions.y;
-                if (_gridType == GridType::Spherical) {
-                        // int z = zSlice;
-                        // Put r in the [0..sqrt(3)] range
-                        const double rNorm = glm::root_three<double>() * xi / xDim;
-
-                        // Put theta in the [0..PI] range
-                        const double thetaNorm = glm::pi<double>() * yi / yDim;
-
-                        // Put phi in the [0..2PI] range
-                        const double phiNorm = glm::two_pi<double>() * zi / zDim;
-
-                        // Go to physical coordinates before sampling
-                        const double rPh = _min.x + rNorm * (_max.x - _min.x);
-                        const double thetaPh = thetaNorm;
-                        // phi range needs to be mapped to the slightly different model
-                        // range to avoid gaps in the data Subtract a small term to
-                        // avoid rounding errors when comparing to phiMax.
-                        const double phiPh = _min.z + phiNorm / glm::two_pi<double>() *
-                                             (_max.z - _min.z - 0.000001);
-
-                        // See if sample point is inside domain
-                        if (rPh < _min.x || rPh > _max.x || thetaPh < _min.y ||
-                            thetaPh > _max.y || phiPh < _min.z || phiPh > _max.z)
-                        {
-                            if (phiPh > _max.z) {
-                                LWARNING("Warning: There might be a gap in the data");
-                            }
-                            // Leave values at zero if outside domain
-                        }
-                        else {
-                            // if inside
-                            // ENLIL CDF specific hacks!
-                            // Convert from meters to AU for interpolator
-                            const double localRPh = rPh / ccmc::constants::AU_in_meters;
-                            // Convert from colatitude [0, pi] rad to [-90, 90] deg
-                            const double localThetaPh = -thetaPh * 180.f /
-                                                        glm::pi<double>() + 90.f;
-                            // Convert from [0, 2pi] rad to [0, 360] degrees
-                            const double localPhiPh = phiPh * 180.f / glm::pi<double>();
-                            // Sample
-                            value = _interpolator->interpolate(
-                                var,
-                                static_cast<float>(localRPh),
-                                static_cast<float>(localPhiPh),
-                                static_cast<float>(localThetaPh)
-                            );
-                        }
-
-                }
-                else {
-                    const double xPos = _min.x + stepX * xi;
-                    const double yPos = _min.y + stepY * yi;
-                    const double zPos = _min.z + stepZ * zi;
-
-                    // std::cout << zPos << ", " << zpos << std::endl;
-                    // Should y and z be flipped?
-                    value = _interpolator->interpolate(
-                        var,
-                        static_cast<float>(xPos),
-                        static_cast<float>(zPos),
-                        static_cast<float>(yPos));
-                }
-
-                if (value != missingValue) {
-                    doubleData[index] = value;
-                    data[index] = static_cast<float>(value);
-                }
-                else {
-                    doubleData[index] = 0;
-                }
-            }
+    const float missingValue = _model->getMissingValue();
+
+    Sampler sampler;
+    if (_gridType == GridType::Spherical) {
+        std::vector<float> localR(outDimensions.x);
+        std::vector<char> isInsideR(outDimensions.x);
+        for (size_t x = 0; x < outDimensions.x; x++) {
+            const float xi = hasXSlice ? slice : x;
+            // Put r in the [0..sqrt(3)] range
+            const double rNorm = glm::root_three<double>() * xi / xDim;
+            // Go to physical coordinates before sampling
+            const double rPh = _min.x + rNorm * (_max.x - _min.x);
+            isInsideR[x] = rPh >= _min.x && rPh <= _max.x;
+            // ENLIL CDF specific hacks!
+            // Convert from meters to AU for interpolator
+            localR[x] = static_cast<float>(rPh / ccmc::constants::AU_in_meters);
+        }
+
+        std::vector<float> localTheta(outDimensions.y);
+        std::vector<char> isInsideTheta(outDimensions.y);
+        for (size_t y = 0; y < outDimensions.y; y++) {
+            const float yi = hasYSlice ? slice : y;
+            // Put theta in the [0..PI] range
+            const double thetaPh = glm::pi<double>() * yi / yDim;
+            isInsideTheta[y] = thetaPh >= _min.y && thetaPh <= _max.y;
+            // Convert from colatitude [0, pi] rad to [-90, 90] deg
+            localTheta[y] = static_cast<float>(
+                -thetaPh * 180.f / glm::pi<double>() + 90.f
+            );
+        }
+
+        std::vector<float> localPhi(outDimensions.z);
+        std::vector<char> isInsidePhi(outDimensions.z);
+        bool hasGap = false;
+        for (size_t z = 0; z < outDimensions.z; z++) {
+            const float zi = hasZSlice ? slice : z;
+            // Put phi in the [0..2PI] range
+            const double phiNorm = glm::two_pi<double>() * zi / zDim;
+            // phi range needs to be mapped to the slightly different model
+            // range to avoid gaps in the data Subtract a small term to
+            // avoid rounding errors when comparing to phiMax.
+            const double phiPh = _min.z + phiNorm / glm::two_pi<double>() *
+                                 (_max.z - _min.z - 0.000001);
+            isInsidePhi[z] = phiPh >= _min.z && phiPh <= _max.z;
+            hasGap |= phiPh > _max.z;
+            // Convert from [0, 2pi] rad to [0, 360] degrees
+            localPhi[z] = static_cast<float>(phiPh * 180.f / glm::pi<double>());
+        }
+        if (hasGap) {
+            LWARNING("Warning: There might be a gap in the data");
         }
+
+        sampler = [varId, missingValue, localR = std::move(localR),
+                   isInsideR = std::move(isInsideR), localTheta = std::move(localTheta),
+                   isInsideTheta = std::move(isInsideTheta),
+                   localPhi = std::move(localPhi), isInsidePhi = std::move(isInsidePhi)](
+                                                       ccmc::Interpolator& interpolator,
+                                                               const glm::size3_t& index,
+                                                                               float* out)
+        {
+            // Leave values at zero if outside domain
+            float value = 0.f;
+            if (isInsideR[index.x] && isInsideTheta[index.y] && isInsidePhi[index.z]) {
+                value = interpolator.interpolate(
+                    varId,
+                    localR[index.x],
+                    localPhi[index.z],
+                    localTheta[index.y]
+                );
+            }
+            *out = (value != missingValue) ? value : 0.f;
+        };
+    }
+    else {
+        const glm::dvec3 min = _min;
+        sampler = [varId, missingValue, min, stepX, stepY, stepZ, hasXSlice, hasYSlice,
+                   hasZSlice, slice](ccmc::Interpolator& interpolator,
+                                     const glm::size3_t& index, float* out)
+        {
+            const float xi = hasXSlice ? slice : index.x;
+            const float yi = hasYSlice ? slice : index.y;
+            const float zi = hasZSlice ? slice : index.z;
+
+            const double xPos = min.x + stepX * xi;
+            const double yPos = min.y + stepY * yi;
+            const double zPos = min.z + stepZ * zi;
+
+            // Should y and z be flipped?
+            const float value = interpolator.interpolate(
+                varId,
+                static_cast<float>(xPos),
+                static_cast<float>(zPos),
+                static_cast<float>(yPos)
+            );
+            *out = (value != missingValue) ? value : 0.f;
+        };
     }
 
-    return data;
+    sampleUniformGrid(
+        outDimensions,
+        1,
+        sampler,
+        [&data](size_t first, std::span<const float> values) {
+            std::copy(values.begin(), values.end(), data.get() + first);
+        }
+    );
+    return data.release();
 }
 
 float* KameleonWrapper::uniformSampledVectorValues(const std::string& xVar,
@@ -464,63 +499,92 @@ float* KameleonWrapper::uniformSampledVectorValues(const std::string& xVar,
 
     constexpr int NumChannels = 4;
     const size_t size = NumChannels * outDimensions.x * outDimensions.y * outDimensions.z;
-    float* data = new float[size];
-
-    float varXMin = _model->getVariableAttribute(xVar, "actual_min").getAttributeFloat();
-    float varXMax = _model->getVariableAttribute(xVar, "actual_max").getAttributeFloat();
-    float varYMin = _model->getVariableAttribute(yVar, "actual_min").getAttributeFloat();
-    float varYMax = _model->getVariableAttribute(yVar, "actual_max").getAttributeFloat();
-    float varZMin = _model->getVariableAttribute(zVar, "actual_min").getAttributeFloat();
-    float varZMax = _model->getVariableAttribute(zVar, "actual_max").getAttributeFloat();
-
-    const float stepX = (_max.x - _min.x) / (static_cast<float>(outDimensions.x));
-    const float stepY = (_max.y - _min.y) / (static_cast<float>(outDimensions.y));
-    const float stepZ = (_max.z - _min.z) / (static_cast<float>(outDimensions.z));
-
-    //LDEBUG(xVar << "Min: " << varXMin);
-    //LDEBUG(xVar << "Max: " << varXMax);
-    //LDEBUG(yVar << "Min: " << varYMin);
-    //LDEBUG(yVar << "Max: " << varYMax);
-    //LDEBUG(zVar << "Min: " << varZMin);
-    //LDEBUG(zVar << "Max: " << varZMax);
-
-    //ProgressBar pb(static_cast<int>(outDimensions.x));
-    for (size_t x = 0; x < outDimensions.x; ++x) {
-        //pb.print(x);
-        for (size_t y = 0; y < outDimensions.y; ++y) {
-            for (size_t z = 0; z < outDimensions.z; ++z) {
-                const size_t index = x * NumChannels + y * NumChannels * outDimensions.x +
-                                     z * NumChannels * outDimensions.x * outDimensions.y;
-
-                if (_gridType == GridType::Cartesian) {
-                    const float xPos = _min.x + stepX * x;
-                    const float yPos = _min.y + stepY * y;
-                    const float zPos = _min.z + stepZ * z;
-
-                    // get interpolated data value for (xPos, yPos, zPos)
-                    const float xVal = _interpolator->interpolate(xVar, xPos, yPos, zPos);
-                    const float yVal = _interpolator->interpolate(yVar, xPos, yPos, zPos);
-                    const float zVal = _interpolator->interpolate(zVar, xPos, yPos, zPos);
-
-                    // scale to [0,1]
-                    data[index]     = (xVal - varXMin) / (varXMax - varXMin); // R
-                    data[index + 1] = (yVal - varYMin) / (varYMax - varYMin); // G
-                    data[index + 2] = (zVal - varZMin) / (varZMax - varZMin); // B
-                    // GL_RGB refuses to work. Workaround doing a GL_RGBA  hardcoded alpha
-                    data[index + 3] = 1.f;
-                }
-                else {
-                    LERROR(
-                        "Only cartesian grid supported for "
-                        "uniformSampledVectorValues (for now)"
-                    );
-                    return data;
-                }
-            }
+    auto data = std::make_unique<float[]>(size);
+
+    if (_gridType != GridType::Cartesian) {
+        LERROR("Only cartesian grid supported for uniformSampledVectorValues (for now)");
+        return data.release();
+    }
+
+    _model->loadVariable(xVar);
+    _model->loadVariable(yVar);
+    _model->loadVariable(zVar);
+    const glm::tvec3<long> varIds = glm::tvec3<long>(
+        _model->getVariableID(xVar),
+        _model->getVariableID(yVar),
+        _model->getVariableID(zVar)
+    );
+
+    const float varXMin =
+        _model->getVariableAttribute(xVar, "actual_min").getAttributeFloat();
+    const float varXMax =
+        _model->getVariableAttribute(xVar, "actual_max").getAttributeFloat();
+    const float varYMin =
+        _model->getVariableAttribute(yVar, "actual_min").getAttributeFloat();
+    const float varYMax =
+        _model->getVariableAttribute(yVar, "actual_max").getAttributeFloat();
+    const float varZMin =
+        _model->getVariableAttribute(zVar, "actual_min").getAttributeFloat();
+    const float varZMax =
+        _model->getVariableAttribute(zVar, "actual_max").getAttributeFloat();
+    const glm::vec3 varMin = glm::vec3(varXMin, varYMin, varZMin);
+    const glm::vec3 varMax = glm::vec3(varXMax, varYMax, varZMax);
+
+    const glm::vec3 step = (_max - _min) / glm::vec3(outDimensions);
+    const glm::vec3 min = _min;
+
+    sampleUniformGrid(
+        outDimensions,
+        NumChannels,
+        [varIds, varMin, varMax, step, min](ccmc::Interpolator& interpolator,
+                                            const glm::size3_t& index, float* out)
+        {
+            const glm::vec3 pos = min + step * glm::vec3(index);
+
+            // get interpolated data value for (xPos, yPos, zPos)
+            const float xVal = interpolator.interpolate(varIds.x, pos.x, pos.y, pos.z);
+            const float yVal = interpolator.interpolate(varIds.y, pos.x, pos.y, pos.z);
+            const float zVal = interpolator.interpolate(varIds.z, pos.x, pos.y, pos.z);
+
+            // scale to [0,1]
+            out[0] = (xVal - varMin.x) / (varMax.x - varMin.x); // R
+            out[1] = (yVal - varMin.y) / (varMax.y - varMin.y); // G
+            out[2] = (zVal - varMin.z) / (varMax.z - varMin.z); // B
+            // GL_RGB refuses to work. Workaround doing a GL_RGBA  hardcoded alpha
+            out[3] = 1.f;
+        },
+        [&data](size_t first, std::span<const float> values) {
+            std::copy(values.begin(), values.end(), data.get() + first * NumChannels);
         }
+    );
+    return data.release();
+}
+
+void KameleonWrapper::sampleUniformGrid(const glm::size3_t& dimensions, size_t nChannels,
+                                        const Sampler& sampler,
+                                        const SampleConsumer& consumer) const
+{
+    // The interpolators are not thread-safe, so every thread gets its own. They are
+    // created up front as the model does not support creating them concurrently. As each
+    // thread samples neighboring voxels one after another, the interpolator can start its
+    // search at the cell it found for the previous sample
+    const SamplingOptions options;
+    const size_t nThreads = nSamplingThreads(dimensions, options);
+    std::vector<std::unique_ptr<ccmc::Interpolator>> interpolators;
+    std::vector<VoxelSampler> samplers;
+    interpolators.reserve(nThreads);
+    samplers.reserve(nThreads);
+    for (size_t i = 0; i < nThreads; i++) {
+        ccmc::Interpolator* interpolator = _model->createNewInterpolator();
+        interpolators.emplace_back(interpolator);
+        samplers.emplace_back(
+            [&sampler, interpolator](const glm::size3_t& index, float* out) {
+                sampler(*interpolator, index, out);
+            }
+        );
     }
 
-    return data;
+    openspace::sampleUniformGrid(dimensions, nChannels, samplers, consumer, options);
 }
 
 KameleonWrapper::Fieldlines KameleonWrapper::classifiedFieldLines(const std::string& xVar,
@@ -0,0 +1,197 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/kameleon/include/uniformgridsampler.h>
+
+#include <ghoul/misc/assert.h>
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace {
+    // The number of voxels that a thread samples in one piece
+    constexpr size_t SamplesPerSlab = 64 * 1024;
+
+    size_t rowsPerSlab(const glm::size3_t& dimensions) {
+        return std::max<size_t>(SamplesPerSlab / std::max<size_t>(dimensions.x, 1), 1);
+    }
+
+    size_t nSlabs(const glm::size3_t& dimensions) {
+        const size_t nRows = dimensions.y * dimensions.z;
+        const size_t rows = rowsPerSlab(dimensions);
+        return dimensions.x > 0 ? (nRows + rows - 1) / rows : 0;
+    }
+} // namespace
+
+namespace openspace {
+
+size_t nSamplingThreads(const glm::size3_t& dimensions, const SamplingOptions& options) {
+    return std::min<size_t>(
+        options.nThreads > 0 ?
+            options.nThreads :
+            std::max(std::thread::hardware_concurrency(), 1u),
+        nSlabs(dimensions)
+    );
+}
+
+bool sampleUniformGrid(const glm::size3_t& dimensions, size_t nChannels,
+                       const std::vector<VoxelSampler>& samplers,
+                       const SampleConsumer& consumer, const SamplingOptions& options)
+{
+    ghoul_assert(
+        samplers.size() == nSamplingThreads(dimensions, options),
+        "There must be one sampler per thread"
+    );
+
+    // The grid is split into slabs of consecutive rows that are sampled by the worker
+    // threads. Each slab is a contiguous part of the output and covers whole z-planes
+    // for large volumes
+    const size_t rows = rowsPerSlab(dimensions);
+    const size_t nRows = dimensions.y * dimensions.z;
+    const size_t nTotalSlabs = nSlabs(dimensions);
+    const size_t nThreads = samplers.size();
+    // Limit the number of slabs that are finished but not yet consumed, so that the
+    // memory usage does not depend on the size of the grid
+    const size_t maxSlabsInFlight = 2 * nThreads;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::map<size_t, std::vector<float>> finished;
+    size_t nextSlab = 0;
+    size_t nConsumed = 0;
+    std::atomic_bool isCancelled = false;
+    std::exception_ptr exception;
+
+    auto cancelled = [&]() {
+        return isCancelled || (options.cancel && *options.cancel);
+    };
+
+    auto work = [&](const VoxelSampler& sampler) {
+        try {
+            while (true) {
+                size_t slab = 0;
+                {
+                    std::unique_lock lock(mutex);
+                    condition.wait(lock, [&]() {
+                        return cancelled() || nextSlab >= nTotalSlabs ||
+                               nextSlab < nConsumed + maxSlabsInFlight;
+                    });
+                    if (cancelled() || nextSlab >= nTotalSlabs) {
+                        break;
+                    }
+                    slab = nextSlab;
+                    nextSlab++;
+                }
+
+                const size_t firstRow = slab * rows;
+                const size_t endRow = std::min(firstRow + rows, nRows);
+                std::vector<float> values((endRow - firstRow) * dimensions.x * nChannels);
+                float* out = values.data();
+                for (size_t row = firstRow; row < endRow && !cancelled(); row++) {
+                    const size_t y = row % dimensions.y;
+                    const size_t z = row / dimensions.y;
+                    for (size_t x = 0; x < dimensions.x; x++) {
+                        sampler(glm::size3_t(x, y, z), out);
+                        out += nChannels;
+                    }
+                }
+
+                {
+                    const std::lock_guard lock(mutex);
+                    finished[slab] = std::move(values);
+                }
+                condition.notify_all();
+            }
+        }
+        catch (...) {
+            const std::lock_guard lock(mutex);
+            if (!exception) {
+                exception = std::current_exception();
+            }
+            isCancelled = true;
+        }
+        // Wake up the calling thread in case it is waiting for a slab that this thread
+        // will no longer produce
+        condition.notify_all();
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads);
+    for (const VoxelSampler& sampler : samplers) {
+        threads.emplace_back(work, std::cref(sampler));
+    }
+
+    size_t nFinishedSlabs = 0;
+    try {
+        while (nFinishedSlabs < nTotalSlabs) {
+            std::vector<float> values;
+            {
+                std::unique_lock lock(mutex);
+                condition.wait(lock, [&]() {
+                    return cancelled() || finished.contains(nFinishedSlabs);
+                });
+                if (cancelled()) {
+                    break;
+                }
+                auto it = finished.find(nFinishedSlabs);
+                values = std::move(it->second);
+                finished.erase(it);
+                nConsumed = nFinishedSlabs + 1;
+            }
+            condition.notify_all();
+
+            consumer(nFinishedSlabs * rows * dimensions.x, values);
+            nFinishedSlabs++;
+
+            if (options.progress) {
+                options.progress(
+                    static_cast<float>(nFinishedSlabs) / static_cast<float>(nTotalSlabs)
+                );
+            }
+        }
+    }
+    catch (...) {
+        // The threads have to be joined before the exception leaves this function
+        const std::lock_guard lock(mutex);
+        if (!exception) {
+            exception = std::current_exception();
+        }
+    }
+
+    isCancelled = true;
+    condition.notify_all();
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    return nFinishedSlabs == nTotalSlabs;
+}
+
+} // namespace openspace
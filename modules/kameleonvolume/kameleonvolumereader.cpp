@@ -31,7 +31,9 @@
 #include <ghoul/format.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/dictionary.h>
+#include <algorithm>
 #include <filesystem>
+#include <limits>
 
 #ifdef WIN32
 #pragma warning (push)
@@ -83,17 +85,13 @@ KameleonVolumeReader::KameleonVolumeReader(std::filesystem::path path)
         throw ghoul::FileNotFoundError(_path);
     }
 
+    _kameleon = std::make_unique<ccmc::Kameleon>();
     const long status = _kameleon->open(_path.string());
     if (status != ccmc::FileReader::OK) {
         throw ghoul::RuntimeError(std::format(
             "Failed to open file '{}' with Kameleon", _path
         ));
     }
-
-    // Possibly use a kameleon interpolator instead of a model interpolator?
-    _interpolator = std::unique_ptr<ccmc::Interpolator>(
-        _kameleon->model->createNewInterpolator()
-    );
 }
 
 KameleonVolumeReader::~KameleonVolumeReader() {}
@@ -121,33 +119,75 @@ std::unique_ptr<volume::RawVolume<float>> KameleonVolumeReader::readFloatVolume(
                                                               const glm::vec3& lowerBound,
                                                               const glm::vec3& upperBound,
                                                                           float& minValue,
-                                                                    float& maxValue) const
+                                                                          float& maxValue,
+                                                     const SamplingOptions& options) const
 {
     minValue = std::numeric_limits<float>::max();
     maxValue = -std::numeric_limits<float>::max();
 
     auto volume = std::make_unique<volume::RawVolume<float>>(dimensions);
-
-    const glm::vec3 dims = volume->dimensions();
-    const glm::vec3 diff = upperBound - lowerBound;
-
-    auto interpolate = [this](const std::string& var, const glm::vec3& coords) {
-        return _interpolator->interpolate(var, coords[0], coords[1], coords[2]);
-    };
-
     float* data = volume->data();
-    for (size_t index = 0; index < volume->nCells(); index++) {
-        const glm::vec3 coords = volume->indexToCoords(index);
-        const glm::vec3 coordsZeroToOne = coords / dims;
-        const glm::vec3 volumeCoords = lowerBound + diff * coordsZeroToOne;
+    const bool isComplete = sampleFloatVolume(
+        dimensions,
+        variable,
+        lowerBound,
+        upperBound,
+        [&](size_t first, std::span<const float> values) {
+            std::copy(values.begin(), values.end(), data + first);
+            for (const float v : values) {
+                minValue = std::min(minValue, v);
+                maxValue = std::max(maxValue, v);
+            }
+        },
+        options
+    );
+    if (!isComplete) {
+        return nullptr;
+    }
+    return volume;
+}
 
-        data[index] = interpolate(variable, volumeCoords);
+bool KameleonVolumeReader::sampleFloatVolume(const glm::uvec3& dimensions,
+                                             const std::string& variable,
+                                             const glm::vec3& lowerBound,
+                                             const glm::vec3& upperBound,
+                                             const SampleConsumer& consumer,
+                                             const SamplingOptions& options) const
+{
+    // The variable has to be loaded before multiple threads access it
+    _kameleon->model->loadVariable(variable);
+    const long variableId = _kameleon->model->getVariableID(variable);
 
-        minValue = glm::min(minValue, data[index]);
-        maxValue = glm::max(maxValue, data[index]);
+    const glm::vec3 dims = glm::vec3(dimensions);
+    const glm::vec3 diff = upperBound - lowerBound;
+
+    // The interpolators are not thread-safe, so every thread gets its own. They are
+    // created on this thread as the model does not support creating them concurrently
+    const size_t nThreads = nSamplingThreads(glm::size3_t(dimensions), options);
+    std::vector<std::unique_ptr<ccmc::Interpolator>> interpolators;
+    std::vector<VoxelSampler> samplers;
+    interpolators.reserve(nThreads);
+    samplers.reserve(nThreads);
+    for (size_t i = 0; i < nThreads; i++) {
+        ccmc::Interpolator* interpolator = _kameleon->model->createNewInterpolator();
+        interpolators.emplace_back(interpolator);
+        samplers.emplace_back(
+            [interpolator, variableId, lowerBound, diff, dims](const glm::size3_t& index,
+                                                                               float* out)
+            {
+                const glm::vec3 coordsZeroToOne = glm::vec3(index) / dims;
+                const glm::vec3 volumeCoords = lowerBound + diff * coordsZeroToOne;
+                *out = interpolator->interpolate(
+                    variableId,
+                    volumeCoords.x,
+                    volumeCoords.y,
+                    volumeCoords.z
+                );
+            }
+        );
     }
 
-    return volume;
+    return sampleUniformGrid(glm::size3_t(dimensions), 1, samplers, consumer, options);
 }
 
 std::vector<std::string> KameleonVolumeReader::variableNames() const {
@@ -25,6 +25,7 @@
 #ifndef __OPENSPACE_MODULE_KAMELEONVOLUME___KAMELEONVOLUMEREADER___H__
 #define __OPENSPACE_MODULE_KAMELEONVOLUME___KAMELEONVOLUMEREADER___H__
 
+#include <modules/kameleon/include/uniformgridsampler.h>
 #include <ghoul/glm.h>
 #include <filesystem>
 #include <memory>
@@ -33,7 +34,6 @@
 
 namespace ccmc {
     class Attribute;
-    class Interpolator;
     class Kameleon;
 } // namespce ccmc
 
@@ -54,7 +54,19 @@ public:
     std::unique_ptr<volume::RawVolume<float>> readFloatVolume(
         const glm::uvec3& dimensions, const std::string& variable,
         const glm::vec3& lowerBound, const glm::vec3& upperBound, float& minValue,
-        float& maxValue) const;
+        float& maxValue, const SamplingOptions& options = SamplingOptions()) const;
+
+    /**
+     * Samples the \p variable on the same grid as #readFloatVolume, but passes the values
+     * to the \p consumer in order instead of returning the whole volume. Only a few slabs
+     * of the volume are kept in memory at a time, so this can be used to write volumes
+     * that are larger than the available memory.
+     *
+     * \return `false` if the sampling was cancelled, `true` otherwise
+     */
+    bool sampleFloatVolume(const glm::uvec3& dimensions, const std::string& variable,
+        const glm::vec3& lowerBound, const glm::vec3& upperBound,
+        const SampleConsumer& consumer, const SamplingOptions& options) const;
 
     ghoul::Dictionary readMetaData() const;
 
@@ -78,7 +90,6 @@ private:
 
     std::filesystem::path _path;
     std::unique_ptr<ccmc::Kameleon> _kameleon;
-    std::unique_ptr<ccmc::Interpolator> _interpolator;
 };
 
 } // namespace openspace::kameleonvolume
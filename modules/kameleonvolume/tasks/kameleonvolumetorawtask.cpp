@@ -25,14 +25,16 @@
 #include <modules/kameleonvolume/tasks/kameleonvolumetorawtask.h>
 
 #include <modules/kameleonvolume/kameleonvolumereader.h>
-#include <modules/volume/rawvolumewriter.h>
 #include <openspace/documentation/verifier.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/format.h>
 #include <ghoul/misc/dictionaryluaformatter.h>
+#include <ghoul/misc/exception.h>
 #include <array>
 #include <filesystem>
+#include <fstream>
 #include <optional>
+#include <span>
 
 namespace {
     struct [[codegen::Dictionary(KameleonVolumeToRawTask)]] Parameters {
@@ -123,17 +125,30 @@ void KameleonVolumeToRawTask::perform(const Task::ProgressCallback& progressCall
         );
     }
 
-    std::unique_ptr<volume::RawVolume<float>> rawVolume = reader.readFloatVolume(
+    std::ofstream file(_rawVolumeOutputPath, std::ios::binary);
+    if (!file.good()) {
+        throw ghoul::RuntimeError(std::format(
+            "Could not create file '{}'", _rawVolumeOutputPath
+        ));
+    }
+
+    // The samples are written as they arrive, so the volume does not have to fit into
+    // memory
+    SamplingOptions options;
+    options.progress = [&progressCallback](float progress) {
+        progressCallback(0.9f * progress);
+    };
+    reader.sampleFloatVolume(
         _dimensions,
         _variable,
         _lowerDomainBound,
-        _upperDomainBound
+        _upperDomainBound,
+        [&file](size_t, std::span<const float> values) {
+            file.write(reinterpret_cast<const char*>(values.data()), values.size_bytes());
+        },
+        options
     );
-
-    progressCallback(0.5f);
-
-    volume::RawVolumeWriter<float> writer(_rawVolumeOutputPath);
-    writer.write(*rawVolume);
+    file.close();
 
     progressCallback(0.9f);
 
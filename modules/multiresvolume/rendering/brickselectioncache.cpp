@@ -0,0 +1,59 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/multiresvolume/rendering/brickselectioncache.h>
+
+#include <algorithm>
+
+namespace openspace {
+
+bool BrickSelectionCache::restore(int timestep, int memoryBudget, int streamingBudget,
+                                  std::vector<int>& bricks) const
+{
+    const bool isUnchanged = _isValid && _timestep == timestep &&
+        _memoryBudget == memoryBudget && _streamingBudget == streamingBudget &&
+        _bricks.size() == bricks.size();
+    if (!isUnchanged) {
+        return false;
+    }
+
+    std::copy(_bricks.begin(), _bricks.end(), bricks.begin());
+    return true;
+}
+
+void BrickSelectionCache::store(int timestep, int memoryBudget, int streamingBudget,
+                                const std::vector<int>& bricks)
+{
+    _isValid = true;
+    _timestep = timestep;
+    _memoryBudget = memoryBudget;
+    _streamingBudget = streamingBudget;
+    _bricks.assign(bricks.begin(), bricks.end());
+}
+
+void BrickSelectionCache::invalidate() {
+    _isValid = false;
+}
+
+} // namespace openspace
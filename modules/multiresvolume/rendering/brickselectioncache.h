@@ -0,0 +1,70 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_MULTIRESVOLUME___BRICKSELECTIONCACHE___H__
+#define __OPENSPACE_MODULE_MULTIRESVOLUME___BRICKSELECTIONCACHE___H__
+
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Keeps the result of the previous brick selection of a brick selector. The selection
+ * only depends on the timestep, the budgets, and the brick errors, so as long as none of
+ * them change, the previous selection can be reused instead of being computed anew.
+ */
+class BrickSelectionCache {
+public:
+    /**
+     * Copies the cached selection into \p bricks if it was stored for the same
+     * \p timestep, \p memoryBudget, and \p streamingBudget and for the same number of
+     * bricks. Returns `true` if the cached selection was used.
+     */
+    bool restore(int timestep, int memoryBudget, int streamingBudget,
+        std::vector<int>& bricks) const;
+
+    /**
+     * Stores the selected \p bricks for the \p timestep, \p memoryBudget, and
+     * \p streamingBudget.
+     */
+    void store(int timestep, int memoryBudget, int streamingBudget,
+        const std::vector<int>& bricks);
+
+    /**
+     * Discards the cached selection, which has to be called whenever the brick errors
+     * change.
+     */
+    void invalidate();
+
+private:
+    bool _isValid = false;
+    int _timestep = 0;
+    int _memoryBudget = 0;
+    int _streamingBudget = 0;
+    std::vector<int> _bricks;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_MULTIRESVOLUME___BRICKSELECTIONCACHE___H__
@@ -27,6 +27,7 @@
 #include <modules/multiresvolume/rendering/tsp.h>
 #include <modules/multiresvolume/rendering/localerrorhistogrammanager.h>
 #include <openspace/rendering/transferfunction.h>
+#include <openspace/util/histogram.h>
 #include <ghoul/misc/assert.h>
 #include <algorithm>
 
@@ -51,6 +52,8 @@ LocalTfBrickSelector::LocalTfBrickSelector(TSP* tsp, LocalErrorHistogramManager*
 {}
 
 bool LocalTfBrickSelector::initialize() {
+    // The histograms might have been rebuilt, so all errors have to be computed anew
+    _errorWeights = TfErrorWeights();
     return calculateBrickErrors();
 }
 
@@ -63,6 +66,15 @@ void LocalTfBrickSelector::setStreamingBudget(int streamingBudget) {
 }
 
 void LocalTfBrickSelector::selectBricks(int timestep, std::vector<int>& bricks) {
+    if (_selectionCache.restore(timestep, _memoryBudget, _streamingBudget, bricks)) {
+        return;
+    }
+
+    computeSelection(timestep, bricks);
+    _selectionCache.store(timestep, _memoryBudget, _streamingBudget, bricks);
+}
+
+void LocalTfBrickSelector::computeSelection(int timestep, std::vector<int>& bricks) {
     const int numTimeSteps = _tsp->header().numTimesteps;
     const int numBricksPerDim = _tsp->header().xNumBricks;
 
@@ -344,21 +356,42 @@ bool LocalTfBrickSelector::calculateBrickErrors() {
         return false;
     }
 
-    size_t tfWidth = tf->width();
-
-    std::vector<float> gradients(tfWidth - 1);
-    for (size_t offset = 0; offset < tfWidth - 1; offset++) {
-        const glm::vec4 prevRgba = tf->sample(offset);
-        const glm::vec4 nextRgba = tf->sample(offset + 1);
+    const unsigned int nHistograms = _tsp->numTotalNodes();
+    if (_brickErrors.size() != nHistograms) {
+        _brickErrors = std::vector<Error>(nHistograms, Error{ 0.f, 0.f });
+        _errorWeights = TfErrorWeights();
+    }
 
-        const float colorDifference = glm::distance(prevRgba, nextRgba);
-        const float alpha = (prevRgba.w + nextRgba.w) * 0.5f;
+    // All histograms share the binning of the root, which is only missing if the root
+    // is the only brick, in which case there is no error
+    const Histogram* root = _histogramManager->spatialHistogram(0);
+    if (!root) {
+        std::fill(_brickErrors.begin(), _brickErrors.end(), Error{ 0.f, 0.f });
+        _selectionCache.invalidate();
+        return true;
+    }
 
-        gradients[offset] = colorDifference*alpha;
+    // Only the errors of bins that the changed part of the transfer function covers
+    // have to be updated
+    const TfErrorWeights::Change change = _errorWeights.update(
+        TfErrorWeights::gradients(*tf),
+        root->numBins(),
+        root->minValue(),
+        root->maxValue()
+    );
+    if (change.isEmpty()) {
+        return true;
     }
+    _selectionCache.invalidate();
 
-    const unsigned int nHistograms = _tsp->numTotalNodes();
-    _brickErrors = std::vector<Error>(nHistograms);
+    auto updateError = [this, &change](float& error, const Histogram& histogram) {
+        if (change.isComplete) {
+            error = _errorWeights.error(histogram);
+        }
+        else {
+            error += _errorWeights.errorChange(histogram, change);
+        }
+    };
 
     for (unsigned int brickIndex = 0; brickIndex < nHistograms; brickIndex++) {
         if (_tsp->isOctreeLeaf(brickIndex)) {
@@ -368,15 +401,7 @@ bool LocalTfBrickSelector::calculateBrickErrors() {
             const Histogram* histogram = _histogramManager->spatialHistogram(
                 brickIndex
             );
-            float error = 0;
-            for (size_t i = 0; i < gradients.size(); i++) {
-                float x = (i + 0.5f) / tfWidth;
-                float sample = histogram->interpolate(x);
-                ghoul_assert(sample >= 0, "@MISSING");
-                ghoul_assert(gradients[i] >= 0, "@MISSING");
-                error += sample * gradients[i];
-            }
-            _brickErrors[brickIndex].spatial = error;
+            updateError(_brickErrors[brickIndex].spatial, *histogram);
         }
 
         if (_tsp->isBstLeaf(brickIndex)) {
@@ -386,15 +411,7 @@ bool LocalTfBrickSelector::calculateBrickErrors() {
             const Histogram* histogram = _histogramManager->temporalHistogram(
                 brickIndex
             );
-            float error = 0;
-            for (size_t i = 0; i < gradients.size(); i++) {
-                float x = (i + 0.5f) / tfWidth;
-                float sample = histogram->interpolate(x);
-                ghoul_assert(sample >= 0, "@MISSING");
-                ghoul_assert(gradients[i] >= 0, "@MISSING");
-                error += sample * gradients[i];
-            }
-            _brickErrors[brickIndex].temporal = error;
+            updateError(_brickErrors[brickIndex].temporal, *histogram);
         }
     }
 
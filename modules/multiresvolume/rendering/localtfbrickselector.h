@@ -28,6 +28,8 @@
 #include <modules/multiresvolume/rendering/brickselector.h>
 
 #include <modules/multiresvolume/rendering/brickselection.h>
+#include <modules/multiresvolume/rendering/brickselectioncache.h>
+#include <modules/multiresvolume/rendering/tferrorweights.h>
 #include <vector>
 
 namespace openspace {
@@ -55,10 +57,15 @@ public:
     bool calculateBrickErrors();
 
 private:
+    void computeSelection(int timestep, std::vector<int>& bricks);
+
     TSP* _tsp;
     LocalErrorHistogramManager* _histogramManager;
     TransferFunction* _transferFunction;
     std::vector<Error> _brickErrors;
+    // The spatial and temporal histograms share their binning and thus their weights
+    TfErrorWeights _errorWeights;
+    BrickSelectionCache _selectionCache;
 
     float spatialSplitPoints(unsigned int brickIndex) const;
     float temporalSplitPoints(unsigned int brickIndex) const;
@@ -52,6 +52,8 @@ TfBrickSelector::TfBrickSelector(TSP* tsp, ErrorHistogramManager* hm,
 {}
 
 bool TfBrickSelector::initialize() {
+    // The histograms might have been rebuilt, so all errors have to be computed anew
+    _errorWeights = TfErrorWeights();
     return calculateBrickErrors();
 }
 
@@ -64,6 +66,15 @@ void TfBrickSelector::setStreamingBudget(int streamingBudget) {
 }
 
 void TfBrickSelector::selectBricks(int timestep, std::vector<int>& bricks) {
+    if (_selectionCache.restore(timestep, _memoryBudget, _streamingBudget, bricks)) {
+        return;
+    }
+
+    computeSelection(timestep, bricks);
+    _selectionCache.store(timestep, _memoryBudget, _streamingBudget, bricks);
+}
+
+void TfBrickSelector::computeSelection(int timestep, std::vector<int>& bricks) {
     int numTimeSteps = _tsp->header().numTimesteps;
     int numBricksPerDim = _tsp->header().xNumBricks;
 
@@ -391,19 +402,33 @@ bool TfBrickSelector::calculateBrickErrors() {
         return false;
     }
 
-    std::vector<float> gradients(tfWidth - 1);
-    for (size_t offset = 0; offset < tfWidth - 1; offset++) {
-        glm::vec4 prevRgba = tf->sample(offset);
-        glm::vec4 nextRgba = tf->sample(offset + 1);
-
-        float colorDifference = glm::distance(prevRgba, nextRgba);
-        float alpha = (prevRgba.w + nextRgba.w) * 0.5f;
+    unsigned int nHistograms = _tsp->numTotalNodes();
+    if (_brickErrors.size() != nHistograms) {
+        _brickErrors = std::vector<float>(nHistograms, 0.f);
+        _errorWeights = TfErrorWeights();
+    }
 
-        gradients[offset] = colorDifference*alpha;
+    // All histograms share the binning of the root, which is only missing if the root
+    // is the only brick, in which case there is no error
+    const Histogram* root = _histogramManager->histogram(0);
+    if (!root) {
+        std::fill(_brickErrors.begin(), _brickErrors.end(), 0.f);
+        _selectionCache.invalidate();
+        return true;
     }
 
-    unsigned int nHistograms = _tsp->numTotalNodes();
-    _brickErrors = std::vector<float>(nHistograms);
+    // Only the errors of bins that the changed part of the transfer function covers
+    // have to be updated
+    const TfErrorWeights::Change change = _errorWeights.update(
+        TfErrorWeights::gradients(*tf),
+        root->numBins(),
+        root->minValue(),
+        root->maxValue()
+    );
+    if (change.isEmpty()) {
+        return true;
+    }
+    _selectionCache.invalidate();
 
     for (unsigned int brickIndex = 0; brickIndex < nHistograms; brickIndex++) {
         if (_tsp->isBstLeaf(brickIndex) && _tsp->isOctreeLeaf(brickIndex)) {
@@ -411,15 +436,12 @@ bool TfBrickSelector::calculateBrickErrors() {
         }
         else {
             const Histogram* histogram = _histogramManager->histogram(brickIndex);
-            float error = 0;
-            for (size_t i = 0; i < gradients.size(); i++) {
-                float x = (i + 0.5f) / tfWidth;
-                float sample = histogram->interpolate(x);
-                ghoul_assert(sample >= 0, "@MISSING");
-                ghoul_assert(gradients[i] >= 0, "@MISSING");
-                error += sample * gradients[i];
+            if (change.isComplete) {
+                _brickErrors[brickIndex] = _errorWeights.error(*histogram);
+            }
+            else {
+                _brickErrors[brickIndex] += _errorWeights.errorChange(*histogram, change);
             }
-            _brickErrors[brickIndex] = error;
         }
     }
 
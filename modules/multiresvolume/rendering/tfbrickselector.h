@@ -28,6 +28,8 @@
 #include <modules/multiresvolume/rendering/brickselector.h>
 
 #include <modules/multiresvolume/rendering/brickselection.h>
+#include <modules/multiresvolume/rendering/brickselectioncache.h>
+#include <modules/multiresvolume/rendering/tferrorweights.h>
 #include <vector>
 
 namespace openspace {
@@ -50,10 +52,14 @@ public:
     bool calculateBrickErrors();
 
 private:
+    void computeSelection(int timestep, std::vector<int>& bricks);
+
     TSP* _tsp;
     ErrorHistogramManager* _histogramManager;
     TransferFunction* _transferFunction;
     std::vector<float> _brickErrors;
+    TfErrorWeights _errorWeights;
+    BrickSelectionCache _selectionCache;
 
     float spatialSplitPoints(unsigned int brickIndex);
     float temporalSplitPoints(unsigned int brickIndex);
@@ -0,0 +1,151 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/multiresvolume/rendering/tferrorweights.h>
+
+#include <openspace/rendering/transferfunction.h>
+#include <openspace/util/histogram.h>
+#include <ghoul/glm.h>
+#include <ghoul/misc/assert.h>
+#include <algorithm>
+#include <cmath>
+
+namespace openspace {
+
+bool TfErrorWeights::Change::isEmpty() const {
+    return firstBin >= endBin;
+}
+
+std::vector<float> TfErrorWeights::gradients(TransferFunction& tf) {
+    const size_t tfWidth = tf.width();
+    if (tfWidth == 0) {
+        return std::vector<float>();
+    }
+
+    std::vector<float> gradients(tfWidth - 1);
+    for (size_t offset = 0; offset < tfWidth - 1; offset++) {
+        const glm::vec4 prevRgba = tf.sample(offset);
+        const glm::vec4 nextRgba = tf.sample(offset + 1);
+
+        const float colorDifference = glm::distance(prevRgba, nextRgba);
+        const float alpha = (prevRgba.w + nextRgba.w) * 0.5f;
+
+        gradients[offset] = colorDifference * alpha;
+        ghoul_assert(gradients[offset] >= 0, "@MISSING");
+    }
+    return gradients;
+}
+
+TfErrorWeights::Change TfErrorWeights::update(std::vector<float> gradients, int numBins,
+                                              float minValue, float maxValue)
+{
+    ghoul_assert(numBins > 0, "There must be at least one bin");
+
+    const bool isSameLayout = gradients.size() == _gradients.size() &&
+        numBins == _numBins && minValue == _minValue && maxValue == _maxValue;
+    if (!isSameLayout) {
+        _numBins = numBins;
+        _minValue = minValue;
+        _maxValue = maxValue;
+        _weights.assign(numBins, 0.f);
+        _weightChanges.assign(numBins, 0.f);
+
+        _gradients = std::move(gradients);
+        Change change = { .firstBin = numBins, .endBin = 0 };
+        for (size_t i = 0; i < _gradients.size(); i++) {
+            addWeight(i, _gradients[i], _weights, change);
+        }
+        return { .firstBin = 0, .endBin = numBins, .isComplete = true };
+    }
+
+    // Find the range of texels whose gradient changed
+    size_t first = 0;
+    while (first < gradients.size() && gradients[first] == _gradients[first]) {
+        first++;
+    }
+    if (first == gradients.size()) {
+        return Change();
+    }
+    size_t last = gradients.size() - 1;
+    while (gradients[last] == _gradients[last]) {
+        last--;
+    }
+
+    std::fill(_weightChanges.begin(), _weightChanges.end(), 0.f);
+    Change change = { .firstBin = numBins, .endBin = 0 };
+    for (size_t i = first; i <= last; i++) {
+        addWeight(i, gradients[i] - _gradients[i], _weightChanges, change);
+        _gradients[i] = gradients[i];
+    }
+    for (int bin = change.firstBin; bin < change.endBin; bin++) {
+        _weights[bin] += _weightChanges[bin];
+    }
+    return change;
+}
+
+float TfErrorWeights::error(const Histogram& histogram) const {
+    ghoul_assert(histogram.numBins() == _numBins, "Binning must match the weights");
+
+    const float* data = histogram.data();
+    float error = 0.f;
+    for (int bin = 0; bin < _numBins; bin++) {
+        ghoul_assert(data[bin] >= 0, "@MISSING");
+        error += data[bin] * _weights[bin];
+    }
+    return error;
+}
+
+float TfErrorWeights::errorChange(const Histogram& histogram, const Change& change) const
+{
+    ghoul_assert(histogram.numBins() == _numBins, "Binning must match the weights");
+
+    const float* data = histogram.data();
+    float errorChange = 0.f;
+    for (int bin = change.firstBin; bin < change.endBin; bin++) {
+        errorChange += data[bin] * _weightChanges[bin];
+    }
+    return errorChange;
+}
+
+void TfErrorWeights::addWeight(size_t texel, float gradient, std::vector<float>& weights,
+                               Change& change) const
+{
+    // The same computation that Histogram::interpolate does for the texel center
+    const float tfWidth = static_cast<float>(_gradients.size() + 1);
+    const float x = (texel + 0.5f) / tfWidth;
+    const float normalizedBin = (x - _minValue) / (_maxValue - _minValue);
+    const float binIndex = normalizedBin * _numBins - 0.5f;
+
+    const float interpolator = binIndex - std::floor(binIndex);
+    const int lastBin = _numBins - 1;
+    const int binLow = std::clamp(static_cast<int>(std::floor(binIndex)), 0, lastBin);
+    const int binHigh = std::clamp(static_cast<int>(std::ceil(binIndex)), 0, lastBin);
+
+    weights[binLow] += (1.f - interpolator) * gradient;
+    weights[binHigh] += interpolator * gradient;
+    change.firstBin = std::min(change.firstBin, binLow);
+    change.endBin = std::max(change.endBin, binHigh + 1);
+}
+
+} // namespace openspace
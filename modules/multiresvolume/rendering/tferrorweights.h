@@ -0,0 +1,102 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_MULTIRESVOLUME___TFERRORWEIGHTS___H__
+#define __OPENSPACE_MODULE_MULTIRESVOLUME___TFERRORWEIGHTS___H__
+
+#include <vector>
+
+namespace openspace {
+
+class Histogram;
+class TransferFunction;
+
+/**
+ * The transfer function dependent error of a brick is the sum over all texels of the
+ * transfer function of the brick's error histogram, sampled at the texel, times the
+ * gradient of the transfer function at that texel. As the histogram is interpolated
+ * linearly between its bins, the same error is the sum over the bins of the histogram
+ * times a weight per bin that only depends on the transfer function. This class keeps
+ * these weights, so that the errors of all bricks can be computed from the bins rather
+ * than the texels, and so that a change to a part of the transfer function only has to
+ * revisit the bins that this part of the transfer function covers.
+ */
+class TfErrorWeights {
+public:
+    /// The range of histogram bins whose weights were changed by an #update
+    struct Change {
+        int firstBin = 0;
+        int endBin = 0;
+
+        /// If `true`, all weights were computed anew and the errors have to be
+        /// recomputed using #error instead of being updated using #errorChange
+        bool isComplete = false;
+
+        bool isEmpty() const;
+    };
+
+    /**
+     * Returns the gradients between neighboring texels of the transfer function \p tf,
+     * which is the difference in color weighted by the average opacity of the texels.
+     */
+    static std::vector<float> gradients(TransferFunction& tf);
+
+    /**
+     * Updates the weights to the \p gradients of the transfer function for histograms
+     * with \p numBins bins in the range [\p minValue, \p maxValue]. If the number of
+     * gradients or the binning is the same as in the previous call, only the weights of
+     * the bins that are covered by the gradients that changed are updated.
+     */
+    Change update(std::vector<float> gradients, int numBins, float minValue,
+        float maxValue);
+
+    /**
+     * Returns the error of a brick with the provided \p histogram, which must have the
+     * binning that was passed to the last #update.
+     */
+    float error(const Histogram& histogram) const;
+
+    /**
+     * Returns by how much the error of a brick with the provided \p histogram changed
+     * with the last #update, which returned the \p change.
+     */
+    float errorChange(const Histogram& histogram, const Change& change) const;
+
+private:
+    // Adds the contribution of the gradient at the texel to the two bins that the
+    // histogram would be interpolated from at the center of the texel
+    void addWeight(size_t texel, float gradient, std::vector<float>& weights,
+        Change& change) const;
+
+    std::vector<float> _gradients;
+    std::vector<float> _weights;
+    std::vector<float> _weightChanges;
+    int _numBins = 0;
+    float _minValue = 0.f;
+    float _maxValue = 0.f;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_MULTIRESVOLUME___TFERRORWEIGHTS___H__
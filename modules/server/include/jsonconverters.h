@@ -28,6 +28,9 @@
 #include <openspace/json.h>
 #include <ghoul/glm.h>
 #include <ghoul/misc/dictionary.h>
+#include <functional>
+#include <string>
+#include <vector>
 
 namespace openspace::properties {
 
@@ -39,6 +42,32 @@ void to_json(nlohmann::json& j, const Property* pP);
 void to_json(nlohmann::json& j, const PropertyOwner& p);
 void to_json(nlohmann::json& j, const PropertyOwner* p);
 
+/**
+ * Appends the JSON representation of the Property \p p to the \p out buffer. The result
+ * contains the same information as the `to_json` converter, but it is written directly
+ * into the buffer without creating and parsing intermediate JSON objects.
+ */
+void writeJson(std::string& out, const Property& p);
+
+/**
+ * Appends the JSON representation of the PropertyOwner \p p and all of its Property%s to
+ * the \p out buffer. If \p recursive is `true`, the subowners are written as nested
+ * objects, otherwise only the URIs of the subowners are written.
+ */
+void writeJson(std::string& out, const PropertyOwner& p, bool recursive = true);
+
+/**
+ * Appends the PropertyOwner%s \p owners and all of their subowners to the \p out buffer
+ * as comma-separated objects in depth-first order, where each owner lists the URIs of
+ * its subowners instead of containing them. Whenever the buffer has reached
+ * \p chunkSize bytes, \p endChunk is called with `false`, and after the last owner it is
+ * called with `true`. The \p endChunk function is responsible for sending the chunk and
+ * for resetting the buffer for the next chunk. Chunks are only split between owners, so
+ * a chunk can be larger than \p chunkSize.
+ */
+void writeJsonChunked(std::string& out, const std::vector<PropertyOwner*>& owners,
+    size_t chunkSize, const std::function<void(bool)>& endChunk);
+
 } // namespace openspace::properties
 
 namespace openspace {
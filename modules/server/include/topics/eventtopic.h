@@ -46,6 +46,9 @@ private:
     bool isSubscribed() const;
 
     std::unordered_map<events::Event::Type, bool> _subscribedEvents;
+
+    // If this is true, all events of a frame are sent in a single payload
+    bool _batchEvents = false;
 };
 
 } // namespace openspace
@@ -27,6 +27,10 @@
 
 #include <modules/server/include/topics/topic.h>
 
+#include <vector>
+
+namespace openspace::properties { class PropertyOwner; }
+
 namespace openspace {
 
 class GetPropertyTopic : public Topic {
@@ -38,8 +42,21 @@ public:
     bool isDone() const override;
 
 private:
-    nlohmann::json allProperties();
-    nlohmann::json propertyFromKey(const std::string& key);
+    void sendPropertyFromKey(const std::string& key, bool isChunked);
+
+    /// Sends the \p owner and all of its subowners as nested objects in one message
+    void sendOwner(const properties::PropertyOwner& owner);
+
+    /// Sends the \p owners and all of their subowners as an array in one message
+    void sendOwners(const std::vector<properties::PropertyOwner*>& owners);
+
+    /**
+     * Sends the \p owners and all of their subowners as a flat list of owners in
+     * depth-first order, split across multiple messages. Each owner lists the URIs of
+     * its subowners instead of containing them, and the payload of the last message has
+     * the `isLastChunk` key set to `true`.
+     */
+    void sendChunked(const std::vector<properties::PropertyOwner*>& owners);
 };
 
 } // namespace openspace
@@ -27,24 +27,62 @@
 #include <openspace/properties/property.h>
 #include <openspace/rendering/renderable.h>
 #include <openspace/scene/scenegraphnode.h>
+#include <openspace/util/json_helper.h>
 #include <ghoul/logging/logmanager.h>
 
 using json = nlohmann::json;
 
-namespace openspace::properties {
+namespace {
+    // Appends the \p value as a quoted JSON string with the same escaping that is used
+    // when dumping a nlohmann::json string
+    void writeJsonString(std::string& out, std::string_view value) {
+        constexpr std::string_view Hex = "0123456789abcdef";
 
-void to_json(json& j, const Property& p) {
-    const std::string description = p.generateJsonDescription();
-    json desc = json::parse(description);
+        out += '"';
+        for (const char c : value) {
+            switch (c) {
+                case '"':
+                    out += "\\\"";
+                    break;
+                case '\\':
+                    out += "\\\\";
+                    break;
+                case '\b':
+                    out += "\\b";
+                    break;
+                case '\f':
+                    out += "\\f";
+                    break;
+                case '\n':
+                    out += "\\n";
+                    break;
+                case '\r':
+                    out += "\\r";
+                    break;
+                case '\t':
+                    out += "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        out += "\\u00";
+                        out += Hex[(c >> 4) & 0xF];
+                        out += Hex[c & 0xF];
+                    }
+                    else {
+                        out += c;
+                    }
+            }
+        }
+        out += '"';
+    }
+} // namespace
 
-    const std::string value = p.jsonValue();
-    json val = json::parse(value);
+namespace openspace::properties {
 
-    j = {
-        { "Description", desc },
-        { "Value", val }
-    };
-    j["Description"]["description"] = p.description();
+void to_json(json& j, const Property& p) {
+    std::string buffer;
+    writeJson(buffer, p);
+    j = json::parse(buffer);
 }
 
 void to_json(json& j, const Property* pP) {
@@ -52,21 +90,104 @@ void to_json(json& j, const Property* pP) {
 }
 
 void to_json(json& j, const PropertyOwner& p) {
-    j = {
-        { "identifier", p.identifier() },
-        { "guiName", p.guiName() },
-        { "description", p.description() },
-        { "properties", p.properties() },
-        { "subowners", p.propertySubOwners() },
-        { "tag", p.tags() },
-        { "uri", p.uri() }
-    };
+    std::string buffer;
+    writeJson(buffer, p);
+    j = json::parse(buffer);
 }
 
 void to_json(json& j, const PropertyOwner* p) {
     j = *p;
 }
 
+void writeJson(std::string& out, const Property& p) {
+    out += R"({"Description":{)";
+    out += p.staticJsonDescription();
+    out += R"(,"Identifier":")";
+    out += escapedJson(p.uri());
+    out += R"(","MetaData":)";
+    out += p.generateMetaDataJsonDescription();
+    out += R"(,"AdditionalData":)";
+    out += p.generateAdditionalJsonDescription();
+    out += R"(},"Value":)";
+    out += p.jsonValue();
+    out += '}';
+}
+
+void writeJson(std::string& out, const PropertyOwner& p, bool recursive) {
+    out += R"({"identifier":)";
+    writeJsonString(out, p.identifier());
+    out += R"(,"guiName":)";
+    writeJsonString(out, p.guiName());
+    out += R"(,"description":)";
+    writeJsonString(out, p.description());
+
+    out += R"(,"properties":[)";
+    for (size_t i = 0; i < p.properties().size(); i++) {
+        if (i > 0) {
+            out += ',';
+        }
+        writeJson(out, *p.properties()[i]);
+    }
+
+    out += R"(],"subowners":[)";
+    const std::vector<PropertyOwner*>& subowners = p.propertySubOwners();
+    for (size_t i = 0; i < subowners.size(); i++) {
+        if (i > 0) {
+            out += ',';
+        }
+        if (recursive) {
+            writeJson(out, *subowners[i]);
+        }
+        else {
+            writeJsonString(out, subowners[i]->uri());
+        }
+    }
+
+    out += R"(],"tag":[)";
+    for (size_t i = 0; i < p.tags().size(); i++) {
+        if (i > 0) {
+            out += ',';
+        }
+        writeJsonString(out, p.tags()[i]);
+    }
+    out += R"(],"uri":)";
+    writeJsonString(out, p.uri());
+    out += '}';
+}
+
+void writeJsonChunked(std::string& out, const std::vector<PropertyOwner*>& owners,
+                      size_t chunkSize, const std::function<void(bool)>& endChunk)
+{
+    bool isEmpty = true;
+
+    // Depth-first traversal so that every owner is written before its subowners
+    std::vector<const PropertyOwner*> stack;
+    for (auto it = owners.rbegin(); it != owners.rend(); it++) {
+        stack.push_back(*it);
+    }
+    while (!stack.empty()) {
+        const PropertyOwner* owner = stack.back();
+        stack.pop_back();
+
+        if (!isEmpty) {
+            out += ',';
+        }
+        writeJson(out, *owner, false);
+        isEmpty = false;
+
+        const std::vector<PropertyOwner*>& subowners = owner->propertySubOwners();
+        for (auto it = subowners.rbegin(); it != subowners.rend(); it++) {
+            stack.push_back(*it);
+        }
+
+        if (out.size() >= chunkSize && !stack.empty()) {
+            endChunk(false);
+            isEmpty = true;
+        }
+    }
+    endChunk(true);
+}
+
 } // namespace openspace::properties
 
 namespace ghoul {
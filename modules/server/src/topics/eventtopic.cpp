@@ -37,6 +37,9 @@ namespace {
 
     constexpr std::string_view StartSubscription = "start_subscription";
     constexpr std::string_view StopSubscription = "stop_subscription";
+
+    // If this optional key is `true`, all events of a frame are sent as a single array
+    constexpr std::string_view BatchKey = "batch";
 } // namespace
 
 using nlohmann::json;
@@ -84,16 +87,35 @@ void EventTopic::handleJson(const nlohmann::json& json) {
 
     const std::string& status = json.at("status").get<std::string>();
 
+    const auto batchJson = json.find(BatchKey);
+    if (status == StartSubscription && batchJson != json.end()) {
+        if (!batchJson->is_boolean()) {
+            LERROR("Batch must be a boolean");
+            return;
+        }
+        _batchEvents = batchJson->get<bool>();
+    }
+
     for (const std::string& event : events) {
         if (status == StartSubscription) {
             const events::Event::Type type = events::fromString(event);
 
             _subscribedEvents[type] = true;
 
-            auto onCallback = [this, event](ghoul::Dictionary params) {
-                // Include the fired event to the caller
-                params.setValue("Event", event);
-                _connection->sendJson(wrappedPayload(params));
+            // The parameters already contain the name of the fired event
+            auto onCallback = [this](const std::vector<ghoul::Dictionary>& params) {
+                if (_batchEvents) {
+                    nlohmann::json payload = nlohmann::json::array();
+                    for (const ghoul::Dictionary& p : params) {
+                        payload.push_back(p);
+                    }
+                    _connection->sendJson(wrappedPayload(payload));
+                }
+                else {
+                    for (const ghoul::Dictionary& p : params) {
+                        _connection->sendJson(wrappedPayload(p));
+                    }
+                }
             };
 
             global::eventEngine->registerEventTopic(_topicId, type, onCallback);
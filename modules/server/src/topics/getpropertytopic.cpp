@@ -47,6 +47,10 @@ namespace {
     constexpr std::string_view AllScreenSpaceRenderablesValue =
         "__screenSpaceRenderables";
     constexpr std::string_view RootPropertyOwner = "__rootOwner";
+
+    // The size at which a chunked response is sent and a new chunk is started. Chunks are
+    // only split between property owners, so a chunk can be larger than this
+    constexpr size_t ChunkSize = 1024 * 1024;
 } // namespace
 
 namespace openspace {
@@ -57,58 +61,113 @@ void GetPropertyTopic::handleJson(const nlohmann::json& json) {
     const std::string requestedKey = json.at("property").get<std::string>();
     ZoneText(requestedKey.c_str(), requestedKey.size());
     LDEBUG("Getting property '" + requestedKey + "'...");
-    nlohmann::json response;
+    const bool isChunked = json.value("chunked", false);
+
     if (requestedKey == AllPropertiesValue) {
-        response = allProperties();
+        const std::vector<properties::PropertyOwner*> owners = {
+            global::renderEngine,
+            global::luaConsole,
+            global::parallelPeer,
+            global::navigationHandler
+        };
+        if (isChunked) {
+            sendChunked(owners);
+        }
+        else {
+            sendOwners(owners);
+        }
     }
     else if (requestedKey == AllNodesValue) {
         const std::vector<SceneGraphNode*>& nodes = sceneGraph()->allSceneGraphNodes();
-        response = wrappedPayload(nodes);
+        _connection->sendJson(wrappedPayload(nodes));
     }
     else if (requestedKey == AllScreenSpaceRenderablesValue) {
-        response = wrappedPayload({
+        _connection->sendJson(wrappedPayload({
             { "value", global::renderEngine->screenSpaceRenderables() }
-        });
+        }));
     }
     else if (requestedKey == RootPropertyOwner) {
-        response = wrappedPayload(global::rootPropertyOwner);
+        if (isChunked) {
+            sendChunked({ global::rootPropertyOwner });
+        }
+        else {
+            sendOwner(*global::rootPropertyOwner);
+        }
     }
     else {
-        response = propertyFromKey(requestedKey);
+        sendPropertyFromKey(requestedKey, isChunked);
     }
-    _connection->sendJson(response);
 }
 
 bool GetPropertyTopic::isDone() const {
     return true;
 }
 
-json GetPropertyTopic::allProperties() {
-    const json payload {
-        {
-            "value",
-            {
-                global::renderEngine,
-                global::luaConsole,
-                global::parallelPeer,
-                global::navigationHandler
-            }
-        }
-    };
-    return wrappedPayload(payload);
-}
-
-json GetPropertyTopic::propertyFromKey(const std::string& key) {
+void GetPropertyTopic::sendPropertyFromKey(const std::string& key, bool isChunked) {
     properties::Property* prop = property(key);
     if (prop) {
-        return wrappedPayload(prop);
+        std::string message = std::format(R"({{"topic":{},"payload":)", _topicId);
+        properties::writeJson(message, *prop);
+        message += '}';
+        _connection->sendMessage(message);
+        return;
     }
     properties::PropertyOwner* node = propertyOwner(key);
     if (node) {
-        return wrappedPayload(node);
+        if (isChunked) {
+            sendChunked({ node });
+        }
+        else {
+            sendOwner(*node);
+        }
+        return;
+    }
+
+    _connection->sendJson(wrappedError(std::format("Property '{}' not found", key), 404));
+}
+
+void GetPropertyTopic::sendOwner(const properties::PropertyOwner& owner) {
+    ZoneScoped;
+
+    std::string message = std::format(R"({{"topic":{},"payload":)", _topicId);
+    properties::writeJson(message, owner);
+    message += '}';
+    _connection->sendMessage(message);
+}
+
+void GetPropertyTopic::sendOwners(const std::vector<properties::PropertyOwner*>& owners)
+{
+    ZoneScoped;
+
+    std::string message = std::format(R"({{"topic":{},"payload":{{"value":[)", _topicId);
+    for (size_t i = 0; i < owners.size(); i++) {
+        if (i > 0) {
+            message += ',';
+        }
+        properties::writeJson(message, *owners[i]);
     }
+    message += "]}}";
+    _connection->sendMessage(message);
+}
 
-    return wrappedError(std::format("Property '{}' not found", key), 404);
+void GetPropertyTopic::sendChunked(const std::vector<properties::PropertyOwner*>& owners)
+{
+    ZoneScoped;
+
+    const std::string header = std::format(
+        R"({{"topic":{},"payload":{{"owners":[)", _topicId
+    );
+    std::string message = header;
+    properties::writeJsonChunked(
+        message,
+        owners,
+        ChunkSize,
+        [this, &message, &header](bool isLastChunk) {
+            message += std::format(R"(],"isLastChunk":{}}}}})", isLastChunk);
+            _connection->sendMessage(message);
+            message = header;
+        }
+    );
 }
 
 } // namespace openspace
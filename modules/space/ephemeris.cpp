@@ -0,0 +1,156 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/space/ephemeris.h>
+
+#include <ghoul/misc/assert.h>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // The samples are considered uniform if every time deviates at most by this fraction
+    // of the time step from the uniform grid. In that case the estimated index is off by
+    // at most one and can be corrected cheaply
+    constexpr double UniformTolerance = 0.25;
+} // namespace
+
+namespace openspace {
+
+Ephemeris::Ephemeris(std::vector<double> times, std::vector<glm::dvec3> positions,
+                     std::vector<glm::dvec3> velocities)
+    : _times(std::move(times))
+    , _positions(std::move(positions))
+    , _velocities(std::move(velocities))
+{
+    ghoul_assert(_times.size() == _positions.size(), "Sizes must match");
+    ghoul_assert(
+        _velocities.empty() || _velocities.size() == _times.size(),
+        "Velocities must be empty or match the sizes"
+    );
+    ghoul_assert(
+        std::adjacent_find(_times.begin(), _times.end(), std::greater_equal<>()) ==
+        _times.end(),
+        "Times must be strictly increasing"
+    );
+
+    if (_times.size() < 2) {
+        return;
+    }
+
+    const double step = (_times.back() - _times.front()) / (_times.size() - 1);
+    for (size_t i = 0; i < _times.size(); i++) {
+        const double expected = _times.front() + i * step;
+        if (std::abs(_times[i] - expected) > UniformTolerance * step) {
+            return;
+        }
+    }
+    _step = step;
+}
+
+glm::dvec3 Ephemeris::position(double time) const {
+    if (_times.empty()) {
+        return glm::dvec3(0.0);
+    }
+    if (time <= _times.front()) {
+        return _positions.front();
+    }
+    if (time >= _times.back()) {
+        return _positions.back();
+    }
+
+    const size_t i = segment(time);
+    const double h = _times[i + 1] - _times[i];
+    const double s = (time - _times[i]) / h;
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+
+    // Cubic Hermite basis functions
+    const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+    const double h10 = s3 - 2.0 * s2 + s;
+    const double h01 = -2.0 * s3 + 3.0 * s2;
+    const double h11 = s3 - s2;
+
+    return h00 * _positions[i] + h10 * h * tangent(i) +
+           h01 * _positions[i + 1] + h11 * h * tangent(i + 1);
+}
+
+size_t Ephemeris::segment(double time) const {
+    ghoul_assert(time > _times.front() && time < _times.back(), "Time out of range");
+
+    if (_step > 0.0) {
+        const size_t last = _times.size() - 2;
+        size_t i = std::min(
+            static_cast<size_t>((time - _times.front()) / _step),
+            last
+        );
+        if (_times[i] > time) {
+            i--;
+        }
+        else if (i < last && _times[i + 1] <= time) {
+            i++;
+        }
+        return i;
+    }
+
+    const auto it = std::upper_bound(_times.begin(), _times.end(), time);
+    return static_cast<size_t>(std::distance(_times.begin(), it)) - 1;
+}
+
+glm::dvec3 Ephemeris::tangent(size_t index) const {
+    if (!_velocities.empty()) {
+        return _velocities[index];
+    }
+
+    // Estimate the tangent from the neighboring samples, which becomes a one-sided
+    // difference at the ends of the table
+    const size_t prev = index > 0 ? index - 1 : index;
+    const size_t next = index + 1 < _times.size() ? index + 1 : index;
+    return (_positions[next] - _positions[prev]) / (_times[next] - _times[prev]);
+}
+
+bool Ephemeris::isEmpty() const {
+    return _times.empty();
+}
+
+bool Ephemeris::hasVelocities() const {
+    return !_velocities.empty();
+}
+
+bool Ephemeris::isUniform() const {
+    return _step > 0.0;
+}
+
+const std::vector<double>& Ephemeris::times() const {
+    return _times;
+}
+
+const std::vector<glm::dvec3>& Ephemeris::positions() const {
+    return _positions;
+}
+
+const std::vector<glm::dvec3>& Ephemeris::velocities() const {
+    return _velocities;
+}
+
+} // namespace openspace
@@ -0,0 +1,91 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_SPACE___EPHEMERIS___H__
+#define __OPENSPACE_MODULE_SPACE___EPHEMERIS___H__
+
+#include <ghoul/glm.h>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A compact table of positions over time that is interpolated with cubic Hermite
+ * splines. The times and positions are stored in contiguous arrays. If the samples are
+ * (almost) uniformly spaced in time, the segment that contains a requested time is found
+ * directly from the time step instead of with a binary search.
+ *
+ * If velocities are provided, they are used as the tangents of the spline, which makes
+ * the interpolation exact up to third order and allows for much sparser samples than a
+ * linear interpolation at the same accuracy. Otherwise the tangents are estimated from
+ * the neighboring samples.
+ */
+class Ephemeris {
+public:
+    Ephemeris() = default;
+
+    /**
+     * Creates an ephemeris from the samples at \p times with the \p positions and the
+     * optional \p velocities. The unit of the velocities has to be the unit of the
+     * positions per unit of time.
+     *
+     * \pre \p times must be strictly increasing
+     * \pre \p positions must have the same size as \p times
+     * \pre \p velocities must be empty or have the same size as \p times
+     */
+    Ephemeris(std::vector<double> times, std::vector<glm::dvec3> positions,
+        std::vector<glm::dvec3> velocities = std::vector<glm::dvec3>());
+
+    /**
+     * Returns the interpolated position at the \p time. Times before the first or after
+     * the last sample return the first or last position, respectively. An empty
+     * ephemeris returns the origin.
+     */
+    glm::dvec3 position(double time) const;
+
+    bool isEmpty() const;
+    bool hasVelocities() const;
+    bool isUniform() const;
+
+    const std::vector<double>& times() const;
+    const std::vector<glm::dvec3>& positions() const;
+    const std::vector<glm::dvec3>& velocities() const;
+
+private:
+    /// Returns the index `i` of the segment so that `times[i] <= time < times[i + 1]`
+    size_t segment(double time) const;
+
+    glm::dvec3 tangent(size_t index) const;
+
+    std::vector<double> _times;
+    std::vector<glm::dvec3> _positions;
+    std::vector<glm::dvec3> _velocities;
+
+    /// The time between two samples if the samples are uniform, or 0 otherwise
+    double _step = 0.0;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_SPACE___EPHEMERIS___H__
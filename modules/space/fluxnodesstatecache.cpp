@@ -0,0 +1,276 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/space/fluxnodesstatecache.h>
+
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/exception.h>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace {
+    constexpr std::string_view _loggerCat = "FluxNodesStateCache";
+
+    // The number of nodes per state and the number of states at the start of the
+    // positions file
+    constexpr size_t HeaderSize = 2 * sizeof(uint32_t);
+} // namespace
+
+namespace openspace {
+
+FluxNodesStateCache::FluxNodesStateCache(std::filesystem::path folder,
+                                         uint32_t nStatesAhead, uint32_t nStatesBehind)
+    : _folder(std::move(folder))
+    , _nStatesAhead(nStatesAhead)
+    , _nStatesBehind(nStatesBehind)
+{
+    _prefetchThread = std::thread(&FluxNodesStateCache::prefetchStates, this);
+}
+
+FluxNodesStateCache::~FluxNodesStateCache() {
+    {
+        const std::lock_guard lock(_mutex);
+        _isRunning = false;
+    }
+    _condition.notify_all();
+    _prefetchThread.join();
+}
+
+bool FluxNodesStateCache::setEnergyBin(const std::string& suffix) {
+    std::shared_ptr<const EnergyBin> bin;
+    auto it = _energyBins.find(suffix);
+    if (it != _energyBins.end()) {
+        bin = it->second;
+    }
+    else {
+        try {
+            EnergyBin b = {
+                .positions = MemoryMappedFile(_folder / ("positions" + suffix)),
+                .fluxes = MemoryMappedFile(_folder / ("fluxes" + suffix)),
+                .radiuses = MemoryMappedFile(_folder / ("radiuses" + suffix))
+            };
+
+            if (b.positions.size() < HeaderSize) {
+                LERROR(std::format("Could not read file '{}'", b.positions.path()));
+                return false;
+            }
+            std::memcpy(&b.nNodes, b.positions.data().data(), sizeof(uint32_t));
+            std::memcpy(
+                &b.nStates,
+                b.positions.data().data() + sizeof(uint32_t),
+                sizeof(uint32_t)
+            );
+
+            const uint64_t nValues = static_cast<uint64_t>(b.nNodes) * b.nStates;
+            const bool isComplete =
+                b.positions.size() >= HeaderSize + nValues * sizeof(glm::vec3) &&
+                b.fluxes.size() >= nValues * sizeof(float) &&
+                b.radiuses.size() >= nValues * sizeof(float);
+            if (!isComplete) {
+                LERROR(std::format(
+                    "Files of energy bin '{}' in '{}' are too small for {} states with "
+                    "{} nodes", suffix, _folder, b.nStates, b.nNodes
+                ));
+                return false;
+            }
+
+            bin = std::make_shared<const EnergyBin>(std::move(b));
+        }
+        catch (const ghoul::RuntimeError& e) {
+            LERROR(e.message);
+            return false;
+        }
+        _energyBins[suffix] = bin;
+    }
+
+    {
+        const std::lock_guard lock(_mutex);
+        if (bin == _activeBin) {
+            return true;
+        }
+        _activeBin = std::move(bin);
+        _generation++;
+        _states.clear();
+        _prefetchQueue.clear();
+        _windowIndex = -1;
+    }
+    return true;
+}
+
+uint32_t FluxNodesStateCache::nStates() const {
+    const std::lock_guard lock(_mutex);
+    return _activeBin ? _activeBin->nStates : 0;
+}
+
+uint32_t FluxNodesStateCache::nNodesPerState() const {
+    const std::lock_guard lock(_mutex);
+    return _activeBin ? _activeBin->nNodes : 0;
+}
+
+std::shared_ptr<const FluxNodesStateCache::State> FluxNodesStateCache::state(
+                                                                          uint32_t index,
+                                                                          bool isForward)
+{
+    std::unique_lock lock(_mutex);
+    ghoul_assert(_activeBin, "No energy bin has been set");
+    ghoul_assert(index < _activeBin->nStates, "Index out of range");
+
+    std::shared_ptr<const State> result;
+    auto it = _states.find(index);
+    if (it != _states.end()) {
+        result = it->second;
+    }
+    else {
+        // The state is needed right away, so we don't wait for the worker thread even if
+        // it is currently reading the same state
+        const std::shared_ptr<const EnergyBin> bin = _activeBin;
+        lock.unlock();
+        result = readState(*bin, index);
+        lock.lock();
+        if (bin == _activeBin) {
+            _states[index] = result;
+        }
+    }
+
+    if (index == _windowIndex && isForward == _isWindowForward) {
+        return result;
+    }
+
+    // Move the window and release all states that are no longer part of it
+    const uint32_t nBefore = isForward ? _nStatesBehind : _nStatesAhead;
+    const uint32_t nAfter = isForward ? _nStatesAhead : _nStatesBehind;
+    _windowFirst = index - std::min(index, nBefore);
+    _windowLast = static_cast<uint32_t>(std::min<uint64_t>(
+        static_cast<uint64_t>(index) + nAfter,
+        _activeBin->nStates - 1
+    ));
+    _windowIndex = index;
+    _isWindowForward = isForward;
+    std::erase_if(_states, [this](const auto& s) {
+        return s.first < _windowFirst || s.first > _windowLast;
+    });
+
+    // Read the states that we will need next first
+    _prefetchQueue.clear();
+    const int64_t step = isForward ? 1 : -1;
+    for (int64_t i = 1; i <= _nStatesAhead; i++) {
+        const int64_t idx = index + step * i;
+        if (idx >= _windowFirst && idx <= _windowLast) {
+            _prefetchQueue.push_back(static_cast<uint32_t>(idx));
+        }
+    }
+    for (int64_t i = 1; i <= _nStatesBehind; i++) {
+        const int64_t idx = index - step * i;
+        if (idx >= _windowFirst && idx <= _windowLast) {
+            _prefetchQueue.push_back(static_cast<uint32_t>(idx));
+        }
+    }
+    lock.unlock();
+    _condition.notify_all();
+
+    return result;
+}
+
+size_t FluxNodesStateCache::nResidentStates() const {
+    const std::lock_guard lock(_mutex);
+    return _states.size();
+}
+
+void FluxNodesStateCache::waitForPrefetch() {
+    std::unique_lock lock(_mutex);
+    _condition.wait(lock, [this]() { return _prefetchQueue.empty() && !_isReading; });
+}
+
+std::shared_ptr<const FluxNodesStateCache::State> FluxNodesStateCache::readState(
+                                                                    const EnergyBin& bin,
+                                                                          uint32_t index)
+{
+    const size_t n = bin.nNodes;
+    const size_t offset = static_cast<size_t>(index) * n;
+
+    auto state = std::make_shared<State>();
+    state->positions.resize(n);
+    std::memcpy(
+        state->positions.data(),
+        bin.positions.data().data() + HeaderSize + offset * sizeof(glm::vec3),
+        n * sizeof(glm::vec3)
+    );
+    state->fluxes.resize(n);
+    std::memcpy(
+        state->fluxes.data(),
+        bin.fluxes.data().data() + offset * sizeof(float),
+        n * sizeof(float)
+    );
+    state->radiuses.resize(n);
+    std::memcpy(
+        state->radiuses.data(),
+        bin.radiuses.data().data() + offset * sizeof(float),
+        n * sizeof(float)
+    );
+    return state;
+}
+
+void FluxNodesStateCache::prefetchStates() {
+    std::unique_lock lock(_mutex);
+    while (true) {
+        if (_prefetchQueue.empty()) {
+            // Wake up the threads that are waiting in waitForPrefetch
+            _condition.notify_all();
+        }
+        _condition.wait(lock, [this]() {
+            return !_isRunning || !_prefetchQueue.empty();
+        });
+        if (!_isRunning) {
+            return;
+        }
+
+        const uint32_t index = _prefetchQueue.front();
+        _prefetchQueue.pop_front();
+        if (_states.contains(index)) {
+            continue;
+        }
+
+        const std::shared_ptr<const EnergyBin> bin = _activeBin;
+        const uint64_t generation = _generation;
+        _isReading = true;
+        lock.unlock();
+
+        std::shared_ptr<const State> state = readState(*bin, index);
+
+        lock.lock();
+        _isReading = false;
+        // The window might have moved on or the energy bin might have changed while we
+        // were reading the state
+        const bool isCurrent = generation == _generation &&
+            index >= _windowFirst && index <= _windowLast;
+        if (isCurrent) {
+            _states[index] = std::move(state);
+        }
+    }
+}
+
+} // namespace openspace
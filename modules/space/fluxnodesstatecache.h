@@ -0,0 +1,152 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_SPACE___FLUXNODESSTATECACHE___H__
+#define __OPENSPACE_MODULE_SPACE___FLUXNODESSTATECACHE___H__
+
+#include <openspace/util/memorymappedfile.h>
+#include <ghoul/glm.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Provides the states of a RenderableFluxNodes sequence from the binary files of an
+ * energy bin without reading the whole sequence into memory. The files are mapped into
+ * memory and only a window of states around the most recently requested state is kept
+ * resident. The states in the window that are missing are read on a worker thread,
+ * starting with the states that follow in the direction in which time is moving.
+ *
+ * An energy bin consists of the files `positions<suffix>`, `fluxes<suffix>`, and
+ * `radiuses<suffix>`. The positions file starts with the number of nodes per state and
+ * the number of states as two `uint32_t`, followed by one `glm::vec3` per node for each
+ * state. The other two files contain one `float` per node for each state.
+ */
+class FluxNodesStateCache {
+public:
+    struct State {
+        std::vector<glm::vec3> positions;
+        std::vector<float> fluxes;
+        std::vector<float> radiuses;
+    };
+
+    /**
+     * Creates a cache for the energy bins in the \p folder that keeps \p nStatesAhead
+     * states ahead of and \p nStatesBehind states behind the current state, in the
+     * direction that time is moving, in memory.
+     */
+    explicit FluxNodesStateCache(std::filesystem::path folder,
+        uint32_t nStatesAhead = 8, uint32_t nStatesBehind = 2);
+
+    /**
+     * Stops the worker thread, waiting for a state that is currently being read.
+     */
+    ~FluxNodesStateCache();
+
+    /**
+     * Switches to the energy bin whose files end in the \p suffix. The files of energy
+     * bins that were used before stay mapped, so switching between bins only has to read
+     * the states around the current time again. Returns `false` if the files are
+     * missing or inconsistent, in which case the previous energy bin stays active.
+     */
+    bool setEnergyBin(const std::string& suffix);
+
+    /// Returns the number of states of the active energy bin
+    uint32_t nStates() const;
+
+    /// Returns the number of nodes in each state of the active energy bin
+    uint32_t nNodesPerState() const;
+
+    /**
+     * Returns the state with the \p index and moves the window of resident states to
+     * it. If the state is not resident, it is read before this function returns. States
+     * that fall outside the window are released and the missing states inside of it are
+     * read on the worker thread.
+     *
+     * \param index The index of the requested state
+     * \param isForward Whether time is moving forward, which decides in which direction
+     *        the window extends further and which states are read first
+     *
+     * \pre An energy bin must have been set successfully
+     * \pre \p index must be smaller than #nStates
+     */
+    std::shared_ptr<const State> state(uint32_t index, bool isForward);
+
+    /// Returns the number of states that are currently kept in memory
+    size_t nResidentStates() const;
+
+    /**
+     * Blocks until the worker thread has read all missing states in the current window.
+     */
+    void waitForPrefetch();
+
+private:
+    struct EnergyBin {
+        MemoryMappedFile positions;
+        MemoryMappedFile fluxes;
+        MemoryMappedFile radiuses;
+        uint32_t nNodes = 0;
+        uint32_t nStates = 0;
+    };
+
+    static std::shared_ptr<const State> readState(const EnergyBin& bin, uint32_t index);
+
+    void prefetchStates();
+
+    const std::filesystem::path _folder;
+    const uint32_t _nStatesAhead;
+    const uint32_t _nStatesBehind;
+
+    // Only accessed by the thread that calls setEnergyBin
+    std::map<std::string, std::shared_ptr<const EnergyBin>> _energyBins;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition;
+    std::shared_ptr<const EnergyBin> _activeBin;
+    // Incremented whenever the energy bin changes, so that the worker thread can detect
+    // that a state it has read belongs to the previous energy bin
+    uint64_t _generation = 0;
+    std::map<uint32_t, std::shared_ptr<const State>> _states;
+    uint32_t _windowFirst = 0;
+    uint32_t _windowLast = 0;
+    int64_t _windowIndex = -1;
+    bool _isWindowForward = true;
+    std::deque<uint32_t> _prefetchQueue;
+    bool _isReading = false;
+    bool _isRunning = true;
+    std::thread _prefetchThread;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_SPACE___FLUXNODESSTATECACHE___H__
@@ -42,9 +42,11 @@ namespace {
     constexpr std::string_view CurrentMajorVersion = "1";
 
     // Values needed to construct the url for the http request to JPL Horizons API
+    // The state vector table (2) contains the velocity on a separate line after the
+    // position, both in kilometers and kilometers per second
     constexpr std::string_view VectorUrl = "https://ssd.jpl.nasa.gov/api/horizons.api?"
-        "format=json&MAKE_EPHEM='YES'&EPHEM_TYPE='VECTORS'&VEC_TABLE='1'&VEC_LABELS='NO'&"
-        "CSV_FORMAT='NO'";
+        "format=json&MAKE_EPHEM='YES'&EPHEM_TYPE='VECTORS'&VEC_TABLE='2'&VEC_LABELS='NO'&"
+        "OUT_UNITS='KM-S'&CSV_FORMAT='NO'";
     constexpr std::string_view ObserverUrl = "https://ssd.jpl.nasa.gov/api/horizons.api?"
         "format=json&MAKE_EPHEM='YES'&EPHEM_TYPE='OBSERVER'&QUANTITIES='20,33'&"
         "RANGE_UNITS='KM'&SUPPRESS_RANGE_RATE='YES'&CSV_FORMAT='NO'";
@@ -579,9 +581,29 @@ HorizonsResult readHorizonsVectorFile(std::filesystem::path file) {
         // Add position to stored data
         dataPoint.time = timeInJ2000;
         dataPoint.position = pos;
-        data.push_back(dataPoint);
 
+        // If the table contains the full state vector, the velocity follows on its own
+        // line in km/s. Unlike the first line of a data point, it does not contain a '='
         ghoul::getline(fileStream, line);
+        if (!line.empty() && line[0] != '$' && line.find('=') == std::string::npos) {
+            //   VX VY VZ
+            double xVel = 0.0;
+            double yVel = 0.0;
+            double zVel = 0.0;
+            std::stringstream str3(line);
+            str3 >> xVel >> yVel >> zVel;
+            if (!str3.fail()) {
+                const glm::dvec3 vel = glm::dvec3(1000 * xVel, 1000 * yVel, 1000 * zVel);
+                dataPoint.velocity = transform * vel;
+            }
+
+            // Skip any further quantities of the same data point
+            do {
+                ghoul::getline(fileStream, line);
+            } while (fileStream.good() && !line.empty() && line[0] != '$' &&
+                     line.find('=') == std::string::npos);
+        }
+        data.push_back(dataPoint);
     }
 
     result.data = data;
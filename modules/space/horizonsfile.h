@@ -28,6 +28,7 @@
 #include <openspace/json.h>
 #include <ghoul/glm.h>
 #include <filesystem>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -91,6 +92,10 @@ enum class HorizonsType {
 struct HorizonsKeyframe {
     double time;            // J2000 seconds
     glm::dvec3 position;    // GALACTIC cartesian coordinates in meters
+
+    // GALACTIC cartesian velocity in meters per second, only available for vector tables
+    // that contain the full state vector
+    std::optional<glm::dvec3> velocity;
 };
 
 struct HorizonsResult {
@@ -395,10 +395,16 @@ RenderableFluxNodes::RenderableFluxNodes(const ghoul::Dictionary& dictionary)
 
 void RenderableFluxNodes::initialize() {
     populateStartTimes();
-    loadNodeData(_goesEnergyBins.option().value);
+    _stateCache = std::make_unique<FluxNodesStateCache>(_binarySourceFolderPath);
+    loadEnergyBin(_goesEnergyBins.option().value);
     computeSequenceEndTime();
 }
 
+void RenderableFluxNodes::deinitialize() {
+    _activeState = nullptr;
+    _stateCache = nullptr;
+}
+
 void RenderableFluxNodes::initializeGL() {
     // Setup shader program
     _shaderProgram = global::renderEngine->buildRenderProgram(
@@ -426,16 +432,14 @@ void RenderableFluxNodes::initializeGL() {
 void RenderableFluxNodes::definePropertyCallbackFunctions() {
     // Add Property Callback Functions
     _goesEnergyBins.onChange([this] {
-        loadNodeData(_goesEnergyBins.option().value);
+        loadEnergyBin(_goesEnergyBins.option().value);
     });
     _colorTablePath.onChange([this]() {
         _transferFunction->setPath(_colorTablePath.value());
     });
 }
 
-void RenderableFluxNodes::loadNodeData(int energybinOption) {
-    LDEBUG("Loading in binary files directly from sync folder");
-
+void RenderableFluxNodes::loadEnergyBin(int energybinOption) {
     std::string energybin;
     switch (energybinOption) {
         case 0:
@@ -446,71 +450,20 @@ void RenderableFluxNodes::loadNodeData(int energybinOption) {
             break;
     }
 
-    const std::string file = std::format(
-        "{}/positions{}", _binarySourceFolderPath, energybin
-    );
-    const std::string file2 = std::format(
-        "{}/fluxes{}", _binarySourceFolderPath, energybin
-    );
-    const std::string file3 = std::format(
-        "{}/radiuses{}", _binarySourceFolderPath, energybin
-    );
-
-    std::ifstream fileStream = std::ifstream(file, std::ifstream::binary);
-    std::ifstream fileStream2 = std::ifstream(file2, std::ifstream::binary);
-    std::ifstream fileStream3 = std::ifstream(file3, std::ifstream::binary);
-
-    if (!fileStream.good()) {
-        LERROR(std::format("Could not read file '{}'", file));
+    if (!_stateCache->setEnergyBin(energybin)) {
         return;
     }
 
-    uint32_t nNodesPerTimestep = 0;
-    fileStream.read(reinterpret_cast<char*>(&nNodesPerTimestep), sizeof(uint32_t));
-
-    uint32_t nTimeSteps = 0;
-    fileStream.read(reinterpret_cast<char*>(&nTimeSteps), sizeof(uint32_t));
-    _nStates = nTimeSteps;
-
+    _nStates = _stateCache->nStates();
     if (_nStates != _startTimes.size()) {
         LERROR(
             "Number of states, _nStates, and number of start times, _startTimes, "
             "do not match"
         );
-        return;
-    }
-
-    _statesColor.clear();
-    _statesPos.clear();
-    _statesRadius.clear();
-
-    for (unsigned int i = 0; i < _nStates; i++) {
-        _vertexPositions.resize(nNodesPerTimestep);
-        fileStream.read(reinterpret_cast<char*>(
-            _vertexPositions.data()), nNodesPerTimestep * sizeof(glm::vec3)
-        );
-
-        _statesPos.push_back(_vertexPositions);
-        _vertexPositions.clear();
-    }
-    for (unsigned int i = 0; i < _nStates; i++) {
-        _vertexColor.resize(nNodesPerTimestep);
-        fileStream2.read(reinterpret_cast<char*>(
-            _vertexColor.data()), nNodesPerTimestep * sizeof(float)
-        );
-
-        _statesColor.push_back(_vertexColor);
-        _vertexColor.clear();
-    }
-    for (unsigned int i = 0; i < _nStates; i++) {
-        _vertexRadius.resize(nNodesPerTimestep);
-        fileStream3.read(reinterpret_cast<char*>(
-            _vertexRadius.data()), nNodesPerTimestep * sizeof(float)
-        );
-
-        _statesRadius.push_back(_vertexRadius);
-        _vertexRadius.clear();
+        _nStates = 0;
     }
+    // The vertex buffers have to be filled from the new energy bin
+    _activeState = nullptr;
 }
 
 void RenderableFluxNodes::setupProperties() {
@@ -670,7 +623,7 @@ void RenderableFluxNodes::updateActiveTriggerTimeIndex(double currentTime) {
     }
 }
 void RenderableFluxNodes::render(const RenderData& data, RendererTasks&) {
-    if (_activeTriggerTimeIndex == -1) {
+    if (_activeTriggerTimeIndex == -1 || !_activeState) {
         return;
     }
     _shaderProgram->activate();
@@ -764,7 +717,7 @@ void RenderableFluxNodes::render(const RenderData& data, RendererTasks&) {
     glDrawArrays(
         GL_POINTS,
         0,
-        static_cast<GLsizei>(_vertexPositions.size())
+        static_cast<GLsizei>(_activeState->positions.size())
     );
 
     glBindVertexArray(0);
@@ -795,6 +748,9 @@ void RenderableFluxNodes::update(const UpdateData& data) {
     if (_shaderProgram->isDirty()) {
         _shaderProgram->rebuildFromFile();
     }
+    if (_nStates == 0) {
+        return;
+    }
     bool needsUpdate = true;
     //Everything below is for updating depending on time
     const double currentTime = data.time.j2000Seconds();
@@ -819,13 +775,20 @@ void RenderableFluxNodes::update(const UpdateData& data) {
         needsUpdate = false;
     }
 
-    if (needsUpdate && !_statesPos[_activeTriggerTimeIndex].empty()) {
-        _vertexPositions = _statesPos[_activeTriggerTimeIndex];
-        _vertexColor = _statesColor[_activeTriggerTimeIndex];
-        _vertexRadius = _statesRadius[_activeTriggerTimeIndex];
-        updatePositionBuffer();
-        updateVertexColorBuffer();
-        updateVertexFilteringBuffer();
+    if (needsUpdate) {
+        // The states that follow in the direction of time are read ahead of time
+        const bool isForward = currentTime >= data.previousFrameTime.j2000Seconds();
+        std::shared_ptr<const FluxNodesStateCache::State> state = _stateCache->state(
+            static_cast<uint32_t>(_activeTriggerTimeIndex),
+            isForward
+        );
+        // Only upload the state if it changed since the last frame
+        if (state != _activeState) {
+            _activeState = std::move(state);
+            updatePositionBuffer();
+            updateVertexColorBuffer();
+            updateVertexFilteringBuffer();
+        }
     }
 
     if (_shaderProgram->isDirty()) {
@@ -844,8 +807,8 @@ void RenderableFluxNodes::updatePositionBuffer() {
 
     glBufferData(
         GL_ARRAY_BUFFER,
-        _vertexPositions.size() * sizeof(glm::vec3),
-        _vertexPositions.data(),
+        _activeState->positions.size() * sizeof(glm::vec3),
+        _activeState->positions.data(),
         GL_STATIC_DRAW
     );
 
@@ -863,8 +826,8 @@ void RenderableFluxNodes::updateVertexColorBuffer() {
 
     glBufferData(
         GL_ARRAY_BUFFER,
-        _vertexColor.size() * sizeof(float),
-        _vertexColor.data(),
+        _activeState->fluxes.size() * sizeof(float),
+        _activeState->fluxes.data(),
         GL_STATIC_DRAW
     );
 
@@ -881,8 +844,8 @@ void RenderableFluxNodes::updateVertexFilteringBuffer() {
 
     glBufferData(
         GL_ARRAY_BUFFER,
-        _vertexRadius.size() * sizeof(float),
-        _vertexRadius.data(),
+        _activeState->radiuses.size() * sizeof(float),
+        _activeState->radiuses.data(),
         GL_STATIC_DRAW
     );
 
@@ -27,6 +27,7 @@
 
 #include <openspace/rendering/renderable.h>
 
+#include <modules/space/fluxnodesstatecache.h>
 #include <openspace/properties/optionproperty.h>
 #include <openspace/properties/scalar/intproperty.h>
 #include <openspace/properties/stringproperty.h>
@@ -37,6 +38,7 @@
 #include <ghoul/opengl/uniformcache.h>
 #include <atomic>
 #include <filesystem>
+#include <memory>
 
 namespace openspace {
 
@@ -46,6 +48,7 @@ public:
 
     void initialize() override;
     void initializeGL() override;
+    void deinitialize() override;
     void deinitializeGL() override;
 
     bool isReady() const override;
@@ -62,7 +65,7 @@ private:
     void setupProperties();
     void updateActiveTriggerTimeIndex(double currentTime);
 
-    void loadNodeData(int energybinOption);
+    void loadEnergyBin(int energybinOption);
     void updatePositionBuffer();
     void updateVertexColorBuffer();
     void updateVertexFilteringBuffer();
@@ -133,18 +136,10 @@ private:
     std::vector<std::filesystem::path> _binarySourceFiles;
     // Contains the _triggerTimes for all streams in the sequence
     std::vector<double> _startTimes;
-    // Contains vertexPositions
-    std::vector<glm::vec3> _vertexPositions;
-    // Contains vertex flux values for color
-    std::vector<float> _vertexColor;
-    // Contains radius of vertices
-    std::vector<float> _vertexRadius;
-    // Stores the states position
-    std::vector<std::vector<glm::vec3>> _statesPos;
-    // Stores the states color
-    std::vector<std::vector<float>> _statesColor;
-    // Stores the states radius
-    std::vector<std::vector<float>> _statesRadius;
+    // Keeps the states around the current time in memory
+    std::unique_ptr<FluxNodesStateCache> _stateCache;
+    // The state whose positions, fluxes and radiuses are in the vertex buffers
+    std::shared_ptr<const FluxNodesStateCache::State> _activeState;
 
     // Group to hold properties regarding distance to earth
     properties::PropertyOwner _earthdistGroup;
@@ -31,6 +31,7 @@
 #include <openspace/engine/globals.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/documentation/verifier.h>
+#include <openspace/util/boundingvolume.h>
 #include <openspace/util/time.h>
 #include <openspace/util/updatestructures.h>
 #include <ghoul/filesystem/filesystem.h>
@@ -730,13 +731,16 @@ void RenderableOrbitalKepler::updateBuffers() {
 
     glBindVertexArray(0);
 
-    double maxSemiMajorAxis = 0.0;
-    for (const kepler::Parameters& kp : parameters) {
-        if (kp.semiMajorAxis > maxSemiMajorAxis) {
-            maxSemiMajorAxis = kp.semiMajorAxis;
+    // Using the vertices rather than the semi-major axes also includes the apoapsis of
+    // eccentric orbits in the bounding sphere
+    const BoundingVolume bounds = computeBoundingVolume(
+        _vertexBufferData.size(),
+        [this](size_t i) {
+            const TrailVBOLayout& v = _vertexBufferData[i];
+            return glm::dvec3(v.x, v.y, v.z);
         }
-    }
-    setBoundingSphere(maxSemiMajorAxis * 1000);
+    );
+    setBoundingSphere(bounds.originRadius);
 }
 
 } // namespace openspace
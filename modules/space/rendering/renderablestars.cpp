@@ -24,6 +24,7 @@
 
 #include <modules/space/rendering/renderablestars.h>
 
+#include <modules/space/starlodoctree.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/documentation/verifier.h>
 #include <openspace/util/updatestructures.h>
@@ -31,10 +32,10 @@
 #include <openspace/engine/openspaceengine.h>
 #include <openspace/engine/globals.h>
 #include <openspace/rendering/renderengine.h>
+#include <ghoul/filesystem/cachemanager.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/templatefactory.h>
-#include <ghoul/io/texture/texturereader.h>
 #include <ghoul/opengl/openglstatecache.h>
 #include <ghoul/opengl/programobject.h>
 #include <ghoul/opengl/texture.h>
@@ -315,6 +316,15 @@ namespace {
         openspace::properties::Property::Visibility::AdvancedUser
     };
 
+    constexpr openspace::properties::Property::PropertyInfo LimitingMagnitudeInfo = {
+        "LimitingMagnitude",
+        "Limiting Magnitude",
+        "The faintest apparent magnitude of the stars that are drawn. This value is only "
+        "used if the level of detail for the stars is enabled through the "
+        "'LevelOfDetail' setting.",
+        openspace::properties::Property::Visibility::AdvancedUser
+    };
+
     struct [[codegen::Dictionary(RenderableStars)]] Parameters {
         // [[codegen::verbatim(SpeckFileInfo.description)]]
         std::filesystem::path speckFile [[codegen::key("File")]];
@@ -408,8 +418,40 @@ namespace {
 
         // [[codegen::verbatim(EnableFadeInInfo.description)]]
         std::optional<bool> enableFadeIn;
+
+        // If this value is `true`, the stars are sorted into an octree ordered by
+        // brightness when they are loaded. The octree is cached on disk. Each frame only
+        // the stars in view that can be brighter than the `LimitingMagnitude` from the
+        // current camera position are drawn. This is meant for very large datasets.
+        std::optional<bool> levelOfDetail;
+
+        // [[codegen::verbatim(LimitingMagnitudeInfo.description)]]
+        std::optional<float> limitingMagnitude;
     };
 #include "renderablestars_codegen.cpp"
+
+    // Loads the texture at the provided path through a TextureComponent, which shares
+    // the texture with other components that load the same file content. Returns
+    // nullptr if there is no texture at the path
+    std::unique_ptr<openspace::TextureComponent> loadTexture(const std::string& path,
+                                                                     int nDimensions,
+                                           ghoul::opengl::Texture::FilterMode filter,
+                                       ghoul::opengl::Texture::WrappingMode wrapping)
+    {
+        if (path.empty() || !std::filesystem::exists(absPath(path))) {
+            return nullptr;
+        }
+
+        auto texture = std::make_unique<openspace::TextureComponent>(nDimensions);
+        texture->setFilterMode(filter);
+        texture->setWrapping(wrapping);
+        texture->loadFromFile(path);
+        if (!texture->texture()) {
+            return nullptr;
+        }
+        texture->uploadToGpu();
+        return texture;
+    }
 }  // namespace
 
 namespace openspace {
@@ -452,7 +494,6 @@ RenderableStars::RenderableStars(const ghoul::Dictionary& dictionary)
         properties::FloatProperty(MultiplierInfo, 1.f, 0.f, 20.f),
         properties::FloatProperty(GammaInfo, 1.f, 0.f, 5.f),
         properties::FloatProperty(ScaleInfo, 1.f, 0.f, 1.f),
-        nullptr,
         nullptr
     }
     , _glare {
@@ -461,7 +502,6 @@ RenderableStars::RenderableStars(const ghoul::Dictionary& dictionary)
         properties::FloatProperty(MultiplierInfo, 1.f, 0.f, 20.f),
         properties::FloatProperty(GammaInfo, 1.f, 0.f, 5.f),
         properties::FloatProperty(ScaleInfo, 1.f, 0.f, 1.f),
-        nullptr,
         nullptr
     }
     , _parameters {
@@ -481,6 +521,7 @@ RenderableStars::RenderableStars(const ghoul::Dictionary& dictionary)
         glm::vec2(100.f)
     )
     , _enableFadeInDistance(EnableFadeInInfo, false)
+    , _limitingMagnitude(LimitingMagnitudeInfo, 25.f, -30.f, 30.f)
 {
     const Parameters p = codegen::bake<Parameters>(dictionary);
 
@@ -492,8 +533,6 @@ RenderableStars::RenderableStars(const ghoul::Dictionary& dictionary)
     addProperty(_speckFile);
 
 
-    _colorTextureFile = std::make_unique<ghoul::filesystem::File>(p.colorMap);
-    _colorTextureFile->setCallback([this]() { _colorTextureIsDirty = true; });
     _colorTexturePath = p.colorMap.string();
     _colorTexturePath.onChange([&] {
         if (std::filesystem::exists(_colorTexturePath.value())) {
@@ -516,7 +555,13 @@ RenderableStars::RenderableStars(const ghoul::Dictionary& dictionary)
 
     _dataMapping.absoluteMagnitude =
         p.dataMapping.absoluteMagnitude.value_or(_dataMapping.absoluteMagnitude);
-    _dataMapping.absoluteMagnitude.onChange([this]() { _dataIsDirty = true; });
+    _dataMapping.absoluteMagnitude.onChange([this]() {
+        _dataIsDirty = true;
+        // The octree is sorted by the absolute magnitude, so it has to be rebuilt
+        if (_useLevelOfDetail) {
+            _speckFileIsDirty = true;
+        }
+    });
     _dataMapping.container.addProperty(_dataMapping.absoluteMagnitude);
 
     _dataMapping.vx = p.dataMapping.vx.value_or(_dataMapping.vx);
@@ -594,8 +639,6 @@ RenderableStars::RenderableStars(const ghoul::Dictionary& dictionary)
 
     if (p.core.has_value()) {
         _core.texturePath = absPath(p.core->texture).string();
-        _core.file = std::make_unique<ghoul::filesystem::File>(_core.texturePath.value());
-        _core.file->setCallback(markTextureAsDirty);
         _core.multiplier = p.core->multiplier.value_or(_core.multiplier);
         _core.gamma = p.core->gamma.value_or(_core.gamma);
         _core.scale = p.core->scale.value_or(_core.scale);
@@ -609,8 +652,6 @@ RenderableStars::RenderableStars(const ghoul::Dictionary& dictionary)
 
     _glare.texturePath = absPath(p.glare.texture).string();
     _glare.texturePath.onChange(markTextureAsDirty);
-    _glare.file = std::make_unique<ghoul::filesystem::File>(_glare.texturePath.value());
-    _glare.file->setCallback(markTextureAsDirty);
     _glare.container.addProperty(_glare.texturePath);
     _glare.multiplier = p.glare.multiplier.value_or(_glare.multiplier);
     _glare.container.addProperty(_glare.multiplier);
@@ -649,6 +690,12 @@ RenderableStars::RenderableStars(const ghoul::Dictionary& dictionary)
         addProperty(_enableFadeInDistance);
     }
 
+    _useLevelOfDetail = p.levelOfDetail.value_or(_useLevelOfDetail);
+    if (_useLevelOfDetail) {
+        _limitingMagnitude = p.limitingMagnitude.value_or(_limitingMagnitude);
+        addProperty(_limitingMagnitude);
+    }
+
     _queuedOtherData = p.otherData.value_or(_queuedOtherData);
     _staticFilterValue = p.staticFilter;
     _staticFilterReplacementValue =
@@ -704,6 +751,9 @@ void RenderableStars::deinitializeGL() {
     _vbo = 0;
 
     _colorTexture = nullptr;
+    _otherDataColorMapTexture = nullptr;
+    _core.texture = nullptr;
+    _glare.texture = nullptr;
 
     if (_program) {
         global::renderEngine->removeRenderProgram(_program.get());
@@ -712,36 +762,21 @@ void RenderableStars::deinitializeGL() {
 }
 
 void RenderableStars::loadPSFTexture() {
-    auto markPsfTextureAsDirty = [this]() { _pointSpreadFunctionTextureIsDirty = true; };
-    auto loadTexture = [markPsfTextureAsDirty](TextureComponent& component) {
-        using Texture = ghoul::opengl::Texture;
-
-        component.texture = nullptr;
-        const std::string path = component.texturePath;
-        if (path.empty() || !std::filesystem::exists(path)) {
-            return;
-        }
-
-        component.texture = ghoul::io::TextureReader::ref().loadTexture(absPath(path), 2);
-
-        if (!component.texture) {
-            return;
-        }
-
-        LDEBUG(std::format("Loaded texture from '{}'", absPath(component.texturePath)));
-        component.texture->uploadTexture();
-        component.texture->setWrapping(Texture::WrappingMode::ClampToBorder);
-
-        constexpr std::array<float, 4> border = { 0.f, 0.f, 0.f, 0.f };
-        glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, border.data());
-        component.texture->setFilter(Texture::FilterMode::AnisotropicMipMap);
-
-        component.file = std::make_unique<ghoul::filesystem::File>(path);
-        component.file->setCallback(markPsfTextureAsDirty);
-    };
-
-    loadTexture(_core);
-    loadTexture(_glare);
+    using Texture = ghoul::opengl::Texture;
+
+    // The border color of the textures is left at OpenGL's default of transparent black
+    _core.texture = loadTexture(
+        _core.texturePath,
+        2,
+        Texture::FilterMode::AnisotropicMipMap,
+        Texture::WrappingMode::ClampToBorder
+    );
+    _glare.texture = loadTexture(
+        _glare.texturePath,
+        2,
+        Texture::FilterMode::AnisotropicMipMap,
+        Texture::WrappingMode::ClampToBorder
+    );
 
     _pointSpreadFunctionTextureIsDirty = false;
 }
@@ -842,7 +877,29 @@ void RenderableStars::render(const RenderData& data, RendererTasks&) {
 
 
     glBindVertexArray(_vao);
-    glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(_dataset.entries.size()));
+    if (_octree.has_value()) {
+        // The octree works in parsecs, so we convert the camera into that space
+        const glm::dmat4 parsecModelMatrix =
+            modelMatrix * glm::scale(glm::dmat4(1.0), glm::dvec3(PARSEC));
+        const glm::dvec3 cameraPosition = glm::dvec3(
+            glm::inverse(parsecModelMatrix) * glm::dvec4(data.camera.positionVec3(), 1.0)
+        );
+        _octree->select(
+            cameraPosition,
+            viewProjectionMatrix * parsecModelMatrix,
+            _limitingMagnitude,
+            _lodSelection
+        );
+        glMultiDrawArrays(
+            GL_POINTS,
+            _lodSelection.first.data(),
+            _lodSelection.count.data(),
+            static_cast<GLsizei>(_lodSelection.first.size())
+        );
+    }
+    else {
+        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(_dataset.entries.size()));
+    }
     glBindVertexArray(0);
     _program->deactivate();
 
@@ -982,42 +1039,38 @@ void RenderableStars::update(const UpdateData&) {
 
     if (_colorTextureIsDirty) {
         LDEBUG("Reloading Color Texture");
-        _colorTexture = nullptr;
-        if (!_colorTexturePath.value().empty()) {
-            _colorTexture = ghoul::io::TextureReader::ref().loadTexture(
-                absPath(_colorTexturePath),
-                1
-            );
-            if (_colorTexture) {
-                LDEBUG(std::format("Loaded texture '{}'", _colorTexturePath.value()));
-                _colorTexture->uploadTexture();
-            }
-
-            _colorTextureFile = std::make_unique<ghoul::filesystem::File>(
-                _colorTexturePath.value()
-            );
-            _colorTextureFile->setCallback([this]() { _colorTextureIsDirty = true; });
-        }
+        _colorTexture = loadTexture(
+            _colorTexturePath,
+            1,
+            ghoul::opengl::Texture::FilterMode::Linear,
+            ghoul::opengl::Texture::WrappingMode::Repeat
+        );
         _colorTextureIsDirty = false;
     }
 
     if (_otherDataColorMapIsDirty) {
         LDEBUG("Reloading Color Texture");
-        _otherDataColorMapTexture = nullptr;
-        if (!_otherDataColorMapPath.value().empty()) {
-            _otherDataColorMapTexture = ghoul::io::TextureReader::ref().loadTexture(
-                absPath(_otherDataColorMapPath),
-                1
-            );
-            if (_otherDataColorMapTexture) {
-                LDEBUG(std::format(
-                    "Loaded texture '{}'", _otherDataColorMapPath.value()
-                ));
-                _otherDataColorMapTexture->uploadTexture();
-            }
-        }
+        _otherDataColorMapTexture = loadTexture(
+            _otherDataColorMapPath,
+            1,
+            ghoul::opengl::Texture::FilterMode::Linear,
+            ghoul::opengl::Texture::WrappingMode::Repeat
+        );
         _otherDataColorMapIsDirty = false;
+    }
 
+    // Reload the textures whose files have changed on disk
+    if (_core.texture) {
+        _core.texture->update();
+    }
+    if (_glare.texture) {
+        _glare.texture->update();
+    }
+    if (_colorTexture) {
+        _colorTexture->update();
+    }
+    if (_otherDataColorMapTexture) {
+        _otherDataColorMapTexture->update();
     }
 
     if (_program->isDirty()) {
@@ -1048,6 +1101,60 @@ void RenderableStars::loadData() {
     if (!success) {
         throw ghoul::RuntimeError("Could not find required variable 'luminosity'");
     }
+
+    // The bounding volume is computed by the data loader and read from the cache, so
+    // the positions don't have to be traversed again here
+    setBoundingSphere(_dataset.bounds.originRadius * distanceconstants::Parsec);
+
+    if (_useLevelOfDetail) {
+        createLevelOfDetail(file);
+    }
+}
+
+void RenderableStars::createLevelOfDetail(const std::filesystem::path& file) {
+    _octree = std::nullopt;
+
+    // The octree depends on the content of the dataset, so the cache has to be
+    // invalidated whenever the file changes
+    const std::filesystem::file_time_type time = std::filesystem::last_write_time(file);
+    const std::string cacheInfo = std::format(
+        "StarLod|{}|{}|{}",
+        file, time.time_since_epoch().count(), _dataMapping.absoluteMagnitude.value()
+    );
+    const std::filesystem::path cached = FileSys.cacheManager()->cachedFilename(
+        file,
+        std::to_string(std::hash<std::string>{}(cacheInfo))
+    );
+    if (std::filesystem::is_regular_file(cached)) {
+        LINFO(std::format("Cached file '{}' used for star octree", cached));
+        _octree = StarLodOctree::loadCache(cached, _dataset.entries.size());
+        if (!_octree.has_value()) {
+            FileSys.cacheManager()->removeCacheFile(cached);
+        }
+    }
+
+    if (!_octree.has_value()) {
+        LINFO(std::format("Creating star octree for '{}'", file));
+        const int absMagIdx = _dataset.index(_dataMapping.absoluteMagnitude);
+        std::vector<glm::vec3> positions;
+        positions.reserve(_dataset.entries.size());
+        std::vector<float> magnitudes;
+        magnitudes.reserve(_dataset.entries.size());
+        for (const dataloader::Dataset::Entry& e : _dataset.entries) {
+            positions.push_back(e.position);
+            magnitudes.push_back(absMagIdx >= 0 ? e.data[absMagIdx] : 0.f);
+        }
+        _octree = StarLodOctree(positions, magnitudes);
+        _octree->saveCache(cached);
+    }
+
+    // Reorder the stars so that the vertex buffer matches the ranges of the octree
+    std::vector<dataloader::Dataset::Entry> entries;
+    entries.reserve(_dataset.entries.size());
+    for (const uint32_t index : _octree->order()) {
+        entries.push_back(std::move(_dataset.entries[index]));
+    }
+    _dataset.entries = std::move(entries);
 }
 
 std::vector<float> RenderableStars::createDataSlice(ColorOption option) {
@@ -1064,15 +1171,12 @@ std::vector<float> RenderableStars::createDataSlice(ColorOption option) {
         -std::numeric_limits<float>::max()
     );
 
-    double maxRadius = 0.0;
-
     std::vector<float> result;
     // 6 for the default Color option of 3 positions + bv + lum + abs
     result.reserve(_dataset.entries.size() * 6);
     for (const dataloader::Dataset::Entry& e : _dataset.entries) {
         glm::dvec3 position = glm::dvec3(e.position) * distanceconstants::Parsec;
         glm::vec3 pos = position;
-        maxRadius = std::max(maxRadius, glm::length(position));
 
         switch (option) {
             case ColorOption::Color:
@@ -1160,7 +1264,6 @@ std::vector<float> RenderableStars::createDataSlice(ColorOption option) {
         }
     }
 
-    setBoundingSphere(maxRadius);
     return result;
 }
 
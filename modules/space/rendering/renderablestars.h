@@ -27,6 +27,7 @@
 
 #include <openspace/rendering/renderable.h>
 
+#include <modules/space/starlodoctree.h>
 #include <openspace/data/dataloader.h>
 #include <openspace/properties/stringproperty.h>
 #include <openspace/properties/optionproperty.h>
@@ -34,15 +35,12 @@
 #include <openspace/properties/propertyowner.h>
 #include <openspace/properties/vector/vec2property.h>
 #include <openspace/properties/vector/vec3property.h>
+#include <openspace/rendering/texturecomponent.h>
 #include <ghoul/opengl/ghoul_gl.h>
 #include <ghoul/opengl/uniformcache.h>
 #include <optional>
 
-namespace ghoul::filesystem { class File; }
-namespace ghoul::opengl {
-    class ProgramObject;
-    class Texture;
-} // namespace ghoul::opengl
+namespace ghoul::opengl { class ProgramObject; }
 
 namespace openspace {
 
@@ -74,13 +72,13 @@ private:
 
     void loadPSFTexture();
     void loadData();
+    void createLevelOfDetail(const std::filesystem::path& file);
     std::vector<float> createDataSlice(ColorOption option);
 
     properties::StringProperty _speckFile;
 
     properties::StringProperty _colorTexturePath;
-    std::unique_ptr<ghoul::opengl::Texture> _colorTexture;
-    std::unique_ptr<ghoul::filesystem::File> _colorTextureFile;
+    std::unique_ptr<TextureComponent> _colorTexture;
 
     struct {
         properties::PropertyOwner container;
@@ -98,11 +96,11 @@ private:
     properties::OptionProperty _otherDataOption;
     properties::StringProperty _otherDataColorMapPath;
     properties::Vec2Property _otherDataRange;
-    std::unique_ptr<ghoul::opengl::Texture> _otherDataColorMapTexture;
+    std::unique_ptr<TextureComponent> _otherDataColorMapTexture;
     properties::Vec3Property _fixedColor;
     properties::BoolProperty _filterOutOfRange;
 
-    struct TextureComponent {
+    struct PointSpreadFunction {
         properties::PropertyOwner container;
 
         properties::StringProperty texturePath;
@@ -110,12 +108,11 @@ private:
         properties::FloatProperty gamma;
         properties::FloatProperty scale;
 
-        std::unique_ptr<ghoul::opengl::Texture> texture;
-        std::unique_ptr<ghoul::filesystem::File> file;
+        std::unique_ptr<TextureComponent> texture;
     };
 
-    TextureComponent _core;
-    TextureComponent _glare;
+    PointSpreadFunction _core;
+    PointSpreadFunction _glare;
 
     struct {
         properties::PropertyOwner container;
@@ -127,6 +124,7 @@ private:
     properties::FloatProperty _magnitudeExponent;
     properties::Vec2Property _fadeInDistances;
     properties::BoolProperty _enableFadeInDistance;
+    properties::FloatProperty _limitingMagnitude;
 
     std::unique_ptr<ghoul::opengl::ProgramObject> _program;
     UniformCache(
@@ -145,6 +143,10 @@ private:
 
     dataloader::Dataset _dataset;
 
+    bool _useLevelOfDetail = false;
+    std::optional<StarLodOctree> _octree;
+    StarLodOctree::Selection _lodSelection;
+
     std::string _queuedOtherData;
 
     std::optional<float> _staticFilterValue;
@@ -0,0 +1,327 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/space/starlodoctree.h>
+
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/profiling.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+
+namespace {
+    constexpr int8_t CacheFileVersion = 2;
+
+    // The maximum depth of the octree, which prevents an infinite subdivision for stars
+    // that share the same position
+    constexpr int MaxDepth = 20;
+
+    int octant(const glm::vec3& position, const glm::vec3& center) {
+        return (position.x >= center.x ? 1 : 0) |
+               (position.y >= center.y ? 2 : 0) |
+               (position.z >= center.z ? 4 : 0);
+    }
+} // namespace
+
+namespace openspace {
+
+StarLodOctree::StarLodOctree(std::span<const glm::vec3> positions,
+                             std::span<const float> absoluteMagnitudes,
+                             uint32_t maxStarsPerNode)
+{
+    ZoneScoped;
+
+    ghoul_assert(
+        positions.size() == absoluteMagnitudes.size(),
+        "Positions and magnitudes must have the same size"
+    );
+    ghoul_assert(maxStarsPerNode > 0, "Maximum number of stars must be positive");
+
+    _order.resize(positions.size());
+    for (size_t i = 0; i < _order.size(); i++) {
+        _order[i] = static_cast<uint32_t>(i);
+    }
+    _magnitudes.resize(positions.size());
+
+    glm::vec3 minPos = glm::vec3(std::numeric_limits<float>::max());
+    glm::vec3 maxPos = glm::vec3(-std::numeric_limits<float>::max());
+    for (const glm::vec3& p : positions) {
+        minPos = glm::min(minPos, p);
+        maxPos = glm::max(maxPos, p);
+    }
+
+    Node root;
+    if (!positions.empty()) {
+        const glm::vec3 extent = maxPos - minPos;
+        root.center = (minPos + maxPos) * 0.5f;
+        // Grow the box slightly so that no star lies exactly on the boundary
+        root.halfSize = std::max({ extent.x, extent.y, extent.z, 1.f }) * 0.5f * 1.001f;
+    }
+    root.count = static_cast<uint32_t>(positions.size());
+    _nodes.push_back(root);
+
+    buildNode(0, positions, absoluteMagnitudes, maxStarsPerNode, 0);
+}
+
+void StarLodOctree::buildNode(size_t nodeIndex, std::span<const glm::vec3> positions,
+                              std::span<const float> absoluteMagnitudes,
+                              uint32_t maxStarsPerNode, int depth)
+{
+    const uint32_t first = _nodes[nodeIndex].first;
+    const uint32_t count = _nodes[nodeIndex].count;
+    const auto begin = _order.begin() + first;
+    const auto end = begin + count;
+    const bool isLeaf = count <= maxStarsPerNode || depth >= MaxDepth;
+
+    // The node keeps the brightest stars of its subtree, sorted by brightness, and a
+    // leaf keeps all of them
+    const uint32_t ownCount = isLeaf ? count : maxStarsPerNode;
+    std::partial_sort(
+        begin,
+        begin + ownCount,
+        end,
+        [&absoluteMagnitudes](uint32_t lhs, uint32_t rhs) {
+            return absoluteMagnitudes[lhs] < absoluteMagnitudes[rhs];
+        }
+    );
+    for (uint32_t i = first; i < first + ownCount; i++) {
+        _magnitudes[i] = absoluteMagnitudes[_order[i]];
+    }
+    _nodes[nodeIndex].ownCount = ownCount;
+    if (ownCount > 0) {
+        _nodes[nodeIndex].brightestMagnitude = _magnitudes[first];
+    }
+    if (isLeaf) {
+        return;
+    }
+
+    // Sort the remaining stars into the eight octants, keeping the octants in order
+    const auto childBegin = begin + ownCount;
+    const glm::vec3 center = _nodes[nodeIndex].center;
+    std::array<uint32_t, 8> counts = {};
+    for (auto it = childBegin; it != end; it++) {
+        counts[octant(positions[*it], center)]++;
+    }
+    std::array<uint32_t, 8> offsets = {};
+    for (int i = 1; i < 8; i++) {
+        offsets[i] = offsets[i - 1] + counts[i - 1];
+    }
+    std::vector<uint32_t> sorted = std::vector<uint32_t>(count - ownCount);
+    for (auto it = childBegin; it != end; it++) {
+        sorted[offsets[octant(positions[*it], center)]++] = *it;
+    }
+    std::copy(sorted.begin(), sorted.end(), childBegin);
+    sorted = std::vector<uint32_t>();
+
+    const float childHalfSize = _nodes[nodeIndex].halfSize * 0.5f;
+    const int32_t firstChild = static_cast<int32_t>(_nodes.size());
+    _nodes[nodeIndex].firstChild = firstChild;
+    uint32_t childFirst = first + ownCount;
+    for (int i = 0; i < 8; i++) {
+        Node child;
+        child.center = center + childHalfSize * glm::vec3(
+            (i & 1) ? 1.f : -1.f,
+            (i & 2) ? 1.f : -1.f,
+            (i & 4) ? 1.f : -1.f
+        );
+        child.halfSize = childHalfSize;
+        child.first = childFirst;
+        child.count = counts[i];
+        childFirst += counts[i];
+        _nodes.push_back(child);
+    }
+
+    for (int i = 0; i < 8; i++) {
+        const size_t childIndex = static_cast<size_t>(firstChild + i);
+        buildNode(childIndex, positions, absoluteMagnitudes, maxStarsPerNode, depth + 1);
+    }
+}
+
+std::optional<StarLodOctree> StarLodOctree::loadCache(const std::filesystem::path& path,
+                                                      size_t nStars)
+{
+    ZoneScoped;
+
+    std::ifstream file = std::ifstream(path, std::ios::binary);
+    if (!file.good()) {
+        return std::nullopt;
+    }
+
+    int8_t fileVersion = 0;
+    file.read(reinterpret_cast<char*>(&fileVersion), sizeof(int8_t));
+    if (fileVersion != CacheFileVersion) {
+        // Incompatible version and we won't be able to read the file
+        return std::nullopt;
+    }
+
+    uint64_t nStoredStars = 0;
+    file.read(reinterpret_cast<char*>(&nStoredStars), sizeof(uint64_t));
+    if (nStoredStars != nStars) {
+        return std::nullopt;
+    }
+
+    uint64_t nNodes = 0;
+    file.read(reinterpret_cast<char*>(&nNodes), sizeof(uint64_t));
+
+    StarLodOctree result;
+    result._nodes.resize(nNodes);
+    file.read(reinterpret_cast<char*>(result._nodes.data()), nNodes * sizeof(Node));
+    result._order.resize(nStars);
+    file.read(reinterpret_cast<char*>(result._order.data()), nStars * sizeof(uint32_t));
+    result._magnitudes.resize(nStars);
+    file.read(
+        reinterpret_cast<char*>(result._magnitudes.data()),
+        nStars * sizeof(float)
+    );
+
+    if (!file.good() || result._nodes.empty()) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+void StarLodOctree::saveCache(const std::filesystem::path& path) const {
+    ZoneScoped;
+
+    std::ofstream file = std::ofstream(path, std::ofstream::binary);
+
+    file.write(reinterpret_cast<const char*>(&CacheFileVersion), sizeof(int8_t));
+
+    const uint64_t nStars = _order.size();
+    file.write(reinterpret_cast<const char*>(&nStars), sizeof(uint64_t));
+
+    const uint64_t nNodes = _nodes.size();
+    file.write(reinterpret_cast<const char*>(&nNodes), sizeof(uint64_t));
+    file.write(reinterpret_cast<const char*>(_nodes.data()), nNodes * sizeof(Node));
+    file.write(reinterpret_cast<const char*>(_order.data()), nStars * sizeof(uint32_t));
+    file.write(
+        reinterpret_cast<const char*>(_magnitudes.data()),
+        nStars * sizeof(float)
+    );
+}
+
+void StarLodOctree::select(const glm::dvec3& cameraPosition,
+                           const glm::dmat4& modelViewProjection, float limitingMagnitude,
+                           Selection& result) const
+{
+    ZoneScoped;
+
+    result.first.clear();
+    result.count.clear();
+    result.nStars = 0;
+
+    // Extract the frustum planes from the combined matrix. A point p is inside the
+    // frustum if dot(plane.xyz, p) + plane.w >= 0 for all six planes
+    const glm::dmat4 m = glm::transpose(modelViewProjection);
+    const std::array<glm::dvec4, 6> planes = {
+        m[3] + m[0], m[3] - m[0],
+        m[3] + m[1], m[3] - m[1],
+        m[3] + m[2], m[3] - m[2]
+    };
+
+    auto addRange = [&result](uint32_t first, uint32_t count) {
+        if (count == 0) {
+            return;
+        }
+        result.nStars += count;
+        // Merge with the previous range if they are adjacent
+        if (!result.first.empty() &&
+            static_cast<uint32_t>(result.first.back() + result.count.back()) == first)
+        {
+            result.count.back() += static_cast<int32_t>(count);
+            return;
+        }
+        result.first.push_back(static_cast<int32_t>(first));
+        result.count.push_back(static_cast<int32_t>(count));
+    };
+
+    // Depth-first traversal that visits the children in order, which keeps the ranges
+    // sorted and allows adjacent ranges to be merged
+    std::array<int32_t, 8 * MaxDepth + 1> stack;
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+        const Node& node = _nodes[stack[--stackSize]];
+        if (node.count == 0) {
+            continue;
+        }
+
+        const glm::dvec3 center = glm::dvec3(node.center);
+        const double halfSize = static_cast<double>(node.halfSize);
+
+        bool isOutside = false;
+        for (const glm::dvec4& plane : planes) {
+            const glm::dvec3 normal = glm::dvec3(plane);
+            const glm::dvec3 positiveVertex = center + halfSize * glm::sign(normal);
+            if (glm::dot(normal, positiveVertex) + plane.w < 0.0) {
+                isOutside = true;
+                break;
+            }
+        }
+        if (isOutside) {
+            continue;
+        }
+
+        // The brightest a star in this node can appear is at the closest point of the
+        // bounding box. The apparent magnitude is m = M + 5 * log10(d) - 5, so all stars
+        // with an absolute magnitude of at most this threshold can be visible
+        const glm::dvec3 delta = glm::max(
+            glm::abs(cameraPosition - center) - glm::dvec3(halfSize),
+            glm::dvec3(0.0)
+        );
+        const double distance = std::max(glm::length(delta), 1e-6);
+        const float threshold = static_cast<float>(
+            limitingMagnitude - 5.0 * std::log10(distance) + 5.0
+        );
+        if (node.brightestMagnitude > threshold) {
+            continue;
+        }
+
+        const auto begin = _magnitudes.begin() + node.first;
+        const auto end = begin + node.ownCount;
+        const auto it = std::upper_bound(begin, end, threshold);
+        addRange(node.first, static_cast<uint32_t>(std::distance(begin, it)));
+
+        // The stars of the children are all dimmer than the own stars of this node, and
+        // the threshold can only decrease for the smaller boxes of the children, so they
+        // only have to be visited if all own stars passed
+        if (node.firstChild != -1 && it == end) {
+            // Push in reverse so that the first child is processed first
+            for (int i = 7; i >= 0; i--) {
+                stack[stackSize++] = node.firstChild + i;
+            }
+        }
+    }
+}
+
+const std::vector<uint32_t>& StarLodOctree::order() const {
+    return _order;
+}
+
+const std::vector<StarLodOctree::Node>& StarLodOctree::nodes() const {
+    return _nodes;
+}
+
+} // namespace openspace
@@ -0,0 +1,162 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_SPACE___STARLODOCTREE___H__
+#define __OPENSPACE_MODULE_SPACE___STARLODOCTREE___H__
+
+#include <ghoul/glm.h>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * A spatial octree over a list of stars that is used to only draw the stars that are
+ * bright enough to be visible from the current camera position. Every node stores its
+ * own stars followed by the stars of its children, and the stars are reordered such that
+ * the stars of each node are stored contiguously. An inner node keeps the brightest stars
+ * of its subtree as its own stars, and the own stars of every node are sorted by their
+ * absolute magnitude, brightest first. This means that the stars of a node that are
+ * brighter than a given threshold always form a prefix of its own stars, and the nodes
+ * that have to be drawn can be expressed as a list of draw ranges into a vertex buffer
+ * that is ordered the same way.
+ *
+ * All positions and distances are expressed in parsecs.
+ */
+class StarLodOctree {
+public:
+    struct Node {
+        /// The center of the cubic bounding box of this node
+        glm::vec3 center = glm::vec3(0.f);
+
+        /// Half the side length of the cubic bounding box of this node
+        float halfSize = 0.f;
+
+        /// The smallest, i.e. brightest, absolute magnitude of any star in this node
+        float brightestMagnitude = std::numeric_limits<float>::max();
+
+        /// The index of the first of the eight children of this node, which are stored
+        /// consecutively, or -1 if this node is a leaf
+        int32_t firstChild = -1;
+
+        /// The index of the first star of this node in the reordered list of stars
+        uint32_t first = 0;
+
+        /// The number of stars in this node and all of its children
+        uint32_t count = 0;
+
+        /// The number of stars that are stored in this node itself at the beginning of
+        /// its range. These are the brightest stars of the subtree and are followed by
+        /// the stars of the children. For a leaf this is equal to #count
+        uint32_t ownCount = 0;
+    };
+
+    /**
+     * The result of a #select call in a form that can be passed directly to
+     * `glMultiDrawArrays`.
+     */
+    struct Selection {
+        std::vector<int32_t> first;
+        std::vector<int32_t> count;
+
+        /// The total number of stars in all ranges
+        size_t nStars = 0;
+    };
+
+    /**
+     * Creates the octree for the stars at the provided \p positions with the provided
+     * \p absoluteMagnitudes. Nodes are subdivided until they contain at most
+     * \p maxStarsPerNode stars or the maximum depth is reached, and every inner node
+     * keeps the \p maxStarsPerNode brightest stars of its subtree.
+     *
+     * \param positions The positions of all stars in parsecs
+     * \param absoluteMagnitudes The absolute magnitudes of all stars
+     * \param maxStarsPerNode The maximum number of stars that are stored in a node
+     *
+     * \pre \p positions and \p absoluteMagnitudes must have the same size
+     * \pre \p maxStarsPerNode must be positive
+     */
+    StarLodOctree(std::span<const glm::vec3> positions,
+        std::span<const float> absoluteMagnitudes, uint32_t maxStarsPerNode = 1024);
+
+    /**
+     * Loads the octree from the cache file at \p path that was previously written by
+     * #saveCache. Returns `std::nullopt` if the file could not be read, was written by a
+     * different version, or does not describe exactly \p nStars stars.
+     */
+    static std::optional<StarLodOctree> loadCache(const std::filesystem::path& path,
+        size_t nStars);
+
+    /**
+     * Writes this octree to the cache file at \p path.
+     */
+    void saveCache(const std::filesystem::path& path) const;
+
+    /**
+     * Selects the stars that are potentially visible and stores their ranges in
+     * \p result. A node is skipped if it is completely outside of the view frustum or if
+     * even its brightest star would appear dimmer than the \p limitingMagnitude at the
+     * smallest possible distance to the camera. For every remaining node, the prefix of
+     * its own stars passing the same test is added, and the children are only visited if
+     * all of its own stars passed. The selection is conservative, so some stars slightly
+     * dimmer than the limit may be included.
+     *
+     * \param cameraPosition The position of the camera in parsecs
+     * \param modelViewProjection The transformation from the parsec-based coordinate
+     *        system of the stars into clip space
+     * \param limitingMagnitude The faintest apparent magnitude that should be drawn
+     * \param result The selection that is filled. The vectors are cleared, but their
+     *        capacity is reused to avoid allocations every frame
+     */
+    void select(const glm::dvec3& cameraPosition, const glm::dmat4& modelViewProjection,
+        float limitingMagnitude, Selection& result) const;
+
+    /**
+     * Returns the new order of the stars, where the value at index `i` is the index of
+     * the star in the original list that was passed to the constructor.
+     */
+    const std::vector<uint32_t>& order() const;
+
+    const std::vector<Node>& nodes() const;
+
+private:
+    StarLodOctree() = default;
+
+    void buildNode(size_t nodeIndex, std::span<const glm::vec3> positions,
+        std::span<const float> absoluteMagnitudes, uint32_t maxStarsPerNode, int depth);
+
+    std::vector<Node> _nodes;
+    std::vector<uint32_t> _order;
+
+    /// The absolute magnitudes of the stars in the reordered order
+    std::vector<float> _magnitudes;
+};
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_SPACE___STARLODOCTREE___H__
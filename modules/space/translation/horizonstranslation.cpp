@@ -33,13 +33,13 @@
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/lua/ghoul_lua.h>
 #include <ghoul/lua/lua_helper.h>
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
-#include <type_traits>
 
 namespace {
     constexpr std::string_view _loggerCat = "HorizonsTranslation";
-    constexpr int8_t CurrentCacheVersion = 2;
+    constexpr int8_t CurrentCacheVersion = 3;
 } // namespace
 
 namespace {
@@ -103,35 +103,11 @@ HorizonsTranslation::HorizonsTranslation(const ghoul::Dictionary& dictionary)
 }
 
 glm::dvec3 HorizonsTranslation::position(const UpdateData& data) const {
-    glm::dvec3 interpolatedPos = glm::dvec3(0.0);
-
-    const Keyframe<glm::dvec3>* lastBefore =
-        _timeline.lastKeyframeBefore(data.time.j2000Seconds(), true);
-    const Keyframe<glm::dvec3>* firstAfter =
-        _timeline.firstKeyframeAfter(data.time.j2000Seconds(), false);
-
-    if (lastBefore && firstAfter) {
-        // We're inbetween first and last value.
-        const double timelineDiff = firstAfter->timestamp - lastBefore->timestamp;
-        const double timeDiff = data.time.j2000Seconds() - lastBefore->timestamp;
-        const double diff = (timelineDiff > DBL_EPSILON) ? timeDiff / timelineDiff : 0.0;
-
-        const glm::dvec3 dir = firstAfter->data - lastBefore->data;
-        interpolatedPos = lastBefore->data + dir * diff;
-    }
-    else if (lastBefore) {
-        // Requesting a time after last value. Return last known position.
-        interpolatedPos = lastBefore->data;
-    }
-    else if (firstAfter) {
-        // Requesting a time before first value. Return last known position.
-        interpolatedPos = firstAfter->data;
-    }
-
-    return interpolatedPos;
+    return _ephemeris.position(data.time.j2000Seconds());
 }
 
 void HorizonsTranslation::loadData() {
+    std::vector<HorizonsKeyframe> keyframes;
     for (const std::string& filePath : _horizonsFiles.value()) {
         std::filesystem::path file = absPath(filePath);
         if (!std::filesystem::is_regular_file(file)) {
@@ -146,7 +122,7 @@ void HorizonsTranslation::loadData() {
                 "Cached file '{}' used for Horizon file '{}'", cachedFile, file
             ));
 
-            if (loadCachedFile(cachedFile)) {
+            if (loadCachedFile(cachedFile, keyframes)) {
                 continue;
             }
             else {
@@ -161,42 +137,69 @@ void HorizonsTranslation::loadData() {
         LINFO(std::format("Loading Horizon file '{}'", file));
 
         HorizonsFile horizonsFile(file);
-        if (!readHorizonsTextFile(horizonsFile)) {
+        HorizonsResult result = readHorizonsFile(horizonsFile.file());
+        if (result.errorCode != HorizonsResultCode::Valid) {
+            horizonsFile.displayErrorMessage(result.errorCode);
             LERROR(std::format("Could not read data from Horizons file '{}'", file));
             return;
         }
 
         LINFO("Saving cache");
-        saveCachedFile(cachedFile);
-    }
-}
-
-bool HorizonsTranslation::readHorizonsTextFile(HorizonsFile& horizonsFile) {
-    HorizonsResult result = readHorizonsFile(horizonsFile.file());
-    if (result.errorCode != HorizonsResultCode::Valid) {
-        horizonsFile.displayErrorMessage(result.errorCode);
-        return false;
+        saveCachedFile(cachedFile, result.data);
+        keyframes.insert(
+            keyframes.end(),
+            std::make_move_iterator(result.data.begin()),
+            std::make_move_iterator(result.data.end())
+        );
     }
 
-    for (HorizonsKeyframe& keyframe : result.data) {
-        // Search if the keyframe already exist in the timeline
-        auto it = std::find_if(
-            _timeline.keyframes().begin(),
-            _timeline.keyframes().end(),
-            [keyframe](const Keyframe<glm::dvec3>& kf) {
-                return kf.timestamp == keyframe.time;
+    // Combine the files into a single table, sorted by time and without duplicates
+    std::stable_sort(
+        keyframes.begin(),
+        keyframes.end(),
+        [](const HorizonsKeyframe& lhs, const HorizonsKeyframe& rhs) {
+            return lhs.time < rhs.time;
+        }
+    );
+    keyframes.erase(
+        std::unique(
+            keyframes.begin(),
+            keyframes.end(),
+            [](const HorizonsKeyframe& lhs, const HorizonsKeyframe& rhs) {
+                return lhs.time == rhs.time;
             }
-        );
+        ),
+        keyframes.end()
+    );
+
+    // The velocities can only be used if every keyframe has one
+    const bool hasVelocities = !keyframes.empty() && std::all_of(
+        keyframes.begin(),
+        keyframes.end(),
+        [](const HorizonsKeyframe& kf) { return kf.velocity.has_value(); }
+    );
 
-        // If it doesn't exist in the timeline then add it, prevent duplicates
-        if (it == _timeline.keyframes().end()) {
-            _timeline.addKeyframe(keyframe.time, std::move(keyframe.position));
+    std::vector<double> times;
+    times.reserve(keyframes.size());
+    std::vector<glm::dvec3> positions;
+    positions.reserve(keyframes.size());
+    std::vector<glm::dvec3> velocities;
+    if (hasVelocities) {
+        velocities.reserve(keyframes.size());
+    }
+    for (const HorizonsKeyframe& kf : keyframes) {
+        times.push_back(kf.time);
+        positions.push_back(kf.position);
+        if (hasVelocities) {
+            velocities.push_back(*kf.velocity);
         }
     }
-    return true;
+    _ephemeris = Ephemeris(std::move(times), std::move(positions), std::move(velocities));
 }
 
-bool HorizonsTranslation::loadCachedFile(const std::filesystem::path& file) {
+bool HorizonsTranslation::loadCachedFile(const std::filesystem::path& file,
+                                         std::vector<HorizonsKeyframe>& keyframes)
+{
     std::ifstream fileStream(file, std::ifstream::binary);
 
     if (!fileStream.good()) {
@@ -214,39 +217,48 @@ bool HorizonsTranslation::loadCachedFile(const std::filesystem::path& file) {
         return false;
     }
 
-    // Read how many keyframes to read
+    // Read how many keyframes to read and whether they have velocities
     int32_t nKeyframes = 0;
-
     fileStream.read(reinterpret_cast<char*>(&nKeyframes), sizeof(int32_t));
     if (nKeyframes == 0) {
         throw ghoul::RuntimeError("Error reading cache: No values were loaded");
     }
+    uint8_t hasVelocities = 0;
+    fileStream.read(reinterpret_cast<char*>(&hasVelocities), sizeof(uint8_t));
 
     // Read all data in one go
-    std::vector<CacheKeyframe> cacheKeyframes;
-    cacheKeyframes.resize(nKeyframes);
+    std::vector<double> times(nKeyframes);
+    fileStream.read(reinterpret_cast<char*>(times.data()), nKeyframes * sizeof(double));
+    std::vector<glm::dvec3> positions(nKeyframes);
     fileStream.read(
-        reinterpret_cast<char*>(cacheKeyframes.data()),
-        sizeof(CacheKeyframe) * nKeyframes
+        reinterpret_cast<char*>(positions.data()),
+        nKeyframes * sizeof(glm::dvec3)
     );
-
-    // Extract the data from the cache Keyframe vector
-    for (int i = 0; i < nKeyframes; i++) {
-        // Add keyframe in timeline
-        _timeline.addKeyframe(
-            cacheKeyframes[i].timestamp,
-            {
-                cacheKeyframes[i].position[0],
-                cacheKeyframes[i].position[1],
-                cacheKeyframes[i].position[2]
-            }
+    std::vector<glm::dvec3> velocities;
+    if (hasVelocities) {
+        velocities.resize(nKeyframes);
+        fileStream.read(
+            reinterpret_cast<char*>(velocities.data()),
+            nKeyframes * sizeof(glm::dvec3)
         );
     }
+    if (!fileStream.good()) {
+        return false;
+    }
 
-    return fileStream.good();
+    for (int32_t i = 0; i < nKeyframes; i++) {
+        HorizonsKeyframe kf = { .time = times[i], .position = positions[i] };
+        if (hasVelocities) {
+            kf.velocity = velocities[i];
+        }
+        keyframes.push_back(std::move(kf));
+    }
+    return true;
 }
 
-void HorizonsTranslation::saveCachedFile(const std::filesystem::path& file) const {
+void HorizonsTranslation::saveCachedFile(const std::filesystem::path& file,
+                                     const std::vector<HorizonsKeyframe>& keyframes) const
+{
     std::ofstream fileStream(file, std::ofstream::binary);
     if (!fileStream.good()) {
         LERROR(std::format("Error opening file '{}' for save cache file", file));
@@ -260,36 +272,46 @@ void HorizonsTranslation::saveCachedFile(const std::filesystem::path& file) cons
     );
 
     // Write how many keyframes are to be written
-    int32_t nKeyframes = static_cast<int32_t>(_timeline.nKeyframes());
+    const int32_t nKeyframes = static_cast<int32_t>(keyframes.size());
     if (nKeyframes == 0) {
         throw ghoul::RuntimeError("Error writing cache: No values were loaded");
     }
     fileStream.write(reinterpret_cast<const char*>(&nKeyframes), sizeof(int32_t));
 
-    // Transfer all data to a cache key frame vector, write it all in one go
-    std::deque<Keyframe<glm::dvec3>> keyframes = _timeline.keyframes();
-    std::vector<CacheKeyframe> cachKeyframes;
-    cachKeyframes.reserve(nKeyframes);
-    for (int i = 0; i < nKeyframes; i++) {
-        CacheKeyframe cacheKeyframe;
-        cacheKeyframe.timestamp = keyframes[i].timestamp;
-        cacheKeyframe.position[0] = keyframes[i].data.x;
-        cacheKeyframe.position[1] = keyframes[i].data.y;
-        cacheKeyframe.position[2] = keyframes[i].data.z;
-
-        cachKeyframes.push_back(cacheKeyframe);
+    const uint8_t hasVelocities = std::all_of(
+        keyframes.begin(),
+        keyframes.end(),
+        [](const HorizonsKeyframe& kf) { return kf.velocity.has_value(); }
+    ) ? 1 : 0;
+    fileStream.write(reinterpret_cast<const char*>(&hasVelocities), sizeof(uint8_t));
+
+    // Transfer the data into one contiguous array per value and write them in one go
+    std::vector<double> times;
+    times.reserve(nKeyframes);
+    std::vector<glm::dvec3> positions;
+    positions.reserve(nKeyframes);
+    std::vector<glm::dvec3> velocities;
+    for (const HorizonsKeyframe& kf : keyframes) {
+        times.push_back(kf.time);
+        positions.push_back(kf.position);
+        if (hasVelocities) {
+            velocities.push_back(*kf.velocity);
+        }
     }
 
-    // Write of entire vector will only work if the data is plain old data type,
-    // is_pod is depricated in C++20 and replaced with both is_trivial and
-    // is_standard_layout
-    static_assert(std::is_trivial_v<CacheKeyframe>);
-    static_assert(std::is_standard_layout_v<CacheKeyframe>);
-
-    // Write data
     fileStream.write(
-        reinterpret_cast<const char*>(cachKeyframes.data()),
-        sizeof(CacheKeyframe) * nKeyframes
+        reinterpret_cast<const char*>(times.data()),
+        nKeyframes * sizeof(double)
     );
+    fileStream.write(
+        reinterpret_cast<const char*>(positions.data()),
+        nKeyframes * sizeof(glm::dvec3)
+    );
+    if (hasVelocities) {
+        fileStream.write(
+            reinterpret_cast<const char*>(velocities.data()),
+            nKeyframes * sizeof(glm::dvec3)
+        );
+    }
 }
 } // namespace openspace
@@ -28,11 +28,12 @@
 #include <openspace/scene/translation.h>
 
 #include <openspace/properties/list/stringlistproperty.h>
-#include <openspace/util/timeline.h>
 #include <ghoul/filesystem/file.h>
 #include <ghoul/lua/luastate.h>
+#include <modules/space/ephemeris.h>
 #include <modules/space/horizonsfile.h>
 #include <memory>
+#include <vector>
 
 namespace openspace {
 
@@ -53,8 +54,12 @@ namespace documentation { struct Documentation; }
  * Z - Z position in kilometers in Ecliptic J2000 reference frame
  * Changes required in the "Table Settings" for compatible data:
  *   1. Under "Select Output Quantities" choose option "Position components {x, y, z}
- *      only"
+ *      only" or "State vector {x, y, z, vx, vy, vz}"
  *   2. Uncheck the "Vector labels" options
+ * If the state vector is included, the velocities (in kilometers per second) are used
+ * for a cubic Hermite interpolation between the positions, which allows for a much
+ * larger step size in the table for the same accuracy. Otherwise the velocities are
+ * estimated from the neighboring positions.
  *
  * In case of Observer table data the implementation expects a file with format:
  * TIME(YYYY-MM-DD HH:MM:SS) Range(km) GalLon(degrees) GalLat(degrees)
@@ -77,19 +82,15 @@ public:
     static documentation::Documentation Documentation();
 
 private:
-    struct CacheKeyframe {
-        double timestamp;
-        std::array<double, 3> position;
-    };
-
     void loadData();
-    bool readHorizonsTextFile(HorizonsFile& horizonsFile);
-    bool loadCachedFile(const std::filesystem::path& file);
-    void saveCachedFile(const std::filesystem::path& file) const;
+    bool loadCachedFile(const std::filesystem::path& file,
+        std::vector<HorizonsKeyframe>& keyframes);
+    void saveCachedFile(const std::filesystem::path& file,
+        const std::vector<HorizonsKeyframe>& keyframes) const;
 
     properties::StringListProperty _horizonsFiles;
     ghoul::lua::LuaState _state;
-    Timeline<glm::dvec3> _timeline;
+    Ephemeris _ephemeris;
 };
 
 } // namespace openspace
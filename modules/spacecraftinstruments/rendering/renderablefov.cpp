@@ -25,12 +25,14 @@
 #include <modules/spacecraftinstruments/rendering/renderablefov.h>
 
 #include <modules/spacecraftinstruments/spacecraftinstrumentsmodule.h>
+#include <modules/spacecraftinstruments/util/ellipsoidintercept.h>
 #include <modules/spacecraftinstruments/util/imagesequencer.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/documentation/verifier.h>
 #include <openspace/engine/globals.h>
 #include <openspace/engine/moduleengine.h>
 #include <openspace/rendering/renderengine.h>
+#include <openspace/util/distanceconstants.h>
 #include <openspace/util/updatestructures.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/logging/logmanager.h>
@@ -457,317 +459,293 @@ bool RenderableFov::isReady() const {
     return _program != nullptr && !_instrument.bounds.empty();
 }
 
-// Orthogonal projection next to planets surface
-glm::dvec3 RenderableFov::orthogonalProjection(const glm::dvec3& vecFov, double time,
-                                               const std::string& target) const
+std::optional<glm::dvec3> RenderableFov::targetRadii(const std::string& target) {
+    // The radii are queried again whenever the target changes, which also picks up
+    // kernels that have been loaded or unloaded in the meantime
+    if (_radiiTarget != target) {
+        _radiiTarget = target;
+        _targetRadii = std::nullopt;
+        if (SpiceManager::ref().hasValue(target, "RADII")) {
+            glm::dvec3 r = glm::dvec3(0.0);
+            SpiceManager::ref().getValue(target, "RADII", r);
+            if (glm::all(glm::greaterThan(r, glm::dvec3(0.0)))) {
+                _targetRadii = r;
+            }
+        }
+    }
+    return _targetRadii;
+}
+
+std::vector<glm::dvec3> RenderableFov::orthogonalProjections(
+                                                      std::span<const glm::dvec3> probes,
+                                                                             double time,
+                                                         const std::string& target) const
 {
+    std::vector<glm::dvec3> result;
+    result.reserve(probes.size());
+
     if (target.empty()) {
         constexpr glm::dvec3 Up = glm::dvec3(1.0, 0.0, 0.0);
-        return glm::normalize(glm::cross(Up, vecFov));
+        for (const glm::dvec3& probe : probes) {
+            result.push_back(glm::normalize(glm::cross(Up, probe)));
+        }
+        return result;
     }
-    else {
-        const glm::dvec3 vecToTarget = SpiceManager::ref().targetPosition(
-            target,
-            _instrument.spacecraft,
-            _instrument.referenceFrame,
-            _instrument.aberrationCorrection,
-            time
-        );
-        const glm::dvec3 fov = SpiceManager::ref().frameTransformationMatrix(
-            _instrument.name,
-            _instrument.referenceFrame,
-            time
-        ) * vecFov;
-        const glm::dvec3 p = glm::proj(vecToTarget, fov);
-        return p * 1000.0; // km -> m
+
+    // The target position and the instrument orientation are the same for all probes,
+    // so we only need to ask SPICE for them once
+    const glm::dvec3 vecToTarget = SpiceManager::ref().targetPosition(
+        target,
+        _instrument.spacecraft,
+        _instrument.referenceFrame,
+        _instrument.aberrationCorrection,
+        time
+    );
+    const glm::dmat3 toReference = SpiceManager::ref().frameTransformationMatrix(
+        _instrument.name,
+        _instrument.referenceFrame,
+        time
+    );
+    for (const glm::dvec3& probe : probes) {
+        const glm::dvec3 p = glm::proj(vecToTarget, toReference * probe);
+        result.push_back(p * 1000.0); // km -> m
     }
+    return result;
 }
 
-void RenderableFov::computeIntercepts(double time, const std::string& target,
-                                      bool isInFov)
+std::vector<std::optional<glm::dvec3>> RenderableFov::surfaceIntercepts(
+                                                      std::span<const glm::dvec3> probes,
+                                                                             double time,
+                                                               const std::string& target)
 {
-    auto makeBodyFixedReferenceFrame =
-        [&target](const std::string& ref) -> std::pair<std::string, bool>
-    {
-        const bool convert = (ref.find("IAU_") == std::string::npos);
+    // The surface intercepts have to be computed in a body-fixed frame of the target
+    const bool convert = (_instrument.referenceFrame.find("IAU_") == std::string::npos);
+    const std::string bodyFrame = [&]() {
         if (convert) {
             SpacecraftInstrumentsModule* m =
                 global::moduleEngine->module<SpacecraftInstrumentsModule>();
-            return { m->frameFromBody(target), true };
+            return m->frameFromBody(target);
         }
         else {
-            return { ref, false };
+            return _instrument.referenceFrame;
+        }
+    }();
+
+    std::vector<std::optional<glm::dvec3>> result;
+    const std::optional<glm::dvec3> radii = targetRadii(target);
+    if (radii.has_value()) {
+        // We replicate what `sincpt` does for the ellipsoid shape model: The target's
+        // position and orientation are evaluated at the light-time corrected epoch,
+        // whereas the instrument's orientation is evaluated at the observation time. If
+        // stellar aberration is requested, the ray directions are corrected for it
+        // instead of the target position
+        using AC = SpiceManager::AberrationCorrection;
+        const AC& correction = _instrument.aberrationCorrection;
+        const bool isStellar = correction.type == AC::Type::LightTimeStellar ||
+                               correction.type == AC::Type::ConvergedNewtonianStellar;
+        AC lightTimeCorrection = correction;
+        if (correction.type == AC::Type::LightTimeStellar) {
+            lightTimeCorrection.type = AC::Type::LightTime;
+        }
+        else if (correction.type == AC::Type::ConvergedNewtonianStellar) {
+            lightTimeCorrection.type = AC::Type::ConvergedNewtonian;
         }
-    };
-
-    // First we fill the field-of-view bounds array by testing each bounds vector against
-    // the object. We need to test it against the object (rather than using a fixed
-    // distance) as the field of view rendering should stop at the surface
-    for (size_t i = 0; i < _instrument.bounds.size(); i++) {
-        const glm::dvec3& bound = _instrument.bounds[i];
-
-        RenderInformation::VBOData& first = _fieldOfViewBounds.data[2 * i];
-        RenderInformation::VBOData& second = _fieldOfViewBounds.data[2 * i + 1];
-
-        // Regardless of what happens next, the position of every second element is going
-        // to be the same. Only the color attribute might change
-        first = {
-            .position = { 0.f, 0.f, 0.f },
-            .color = RenderInformation::VertexColorTypeDefaultStart
-        };
 
-        if (!isInFov) {
-            // If the target is not in the field of view, we don't need to perform any
-            // surface intercepts
-            const glm::vec3 o = orthogonalProjection(bound, time, target);
+        double lightTime = 0.0;
+        const glm::dvec3 targetPos = SpiceManager::ref().targetPosition(
+            target,
+            _instrument.spacecraft,
+            bodyFrame,
+            lightTimeCorrection,
+            time,
+            lightTime
+        );
 
-            second = {
-                .position = { o.x, o.y, o.z },
-                .color = RenderInformation::VertexColorTypeDefaultEnd
-            };
+        const bool isReception = correction.direction == AC::Direction::Reception;
+        double targetEpoch = time;
+        if (correction.type != AC::Type::None) {
+            targetEpoch = isReception ? time - lightTime : time + lightTime;
         }
-        else {
-            // The target is in the field of view, but not the entire field of view has to
-            // be filled by the target
-            const std::pair<std::string, bool> ref = makeBodyFixedReferenceFrame(
-                _instrument.referenceFrame
-            );
 
-            SpiceManager::SurfaceInterceptResult r = SpiceManager::ref().surfaceIntercept(
-                target,
+        // The apparent direction of a ray is tilted towards the velocity of the observer
+        // for reception, and away from it for transmission. To first order in v/c, the
+        // geometric direction is recovered by removing that tilt again
+        glm::dvec3 aberration = glm::dvec3(0.0);
+        if (isStellar) {
+            const glm::dvec3 velocity = SpiceManager::ref().targetState(
                 _instrument.spacecraft,
-                _instrument.name,
-                ref.first,
-                _instrument.aberrationCorrection,
-                time,
-                bound
-            );
-
-            if (r.interceptFound) {
-                // This point intersected the target
-                first.color = RenderInformation::VertexColorTypeIntersectionStart;
-
-                // If we had to convert the reference frame into a body-fixed frame, we
-                // need to apply this change here:
-                if (ref.second) {
-                    r.surfaceVector = SpiceManager::ref().frameTransformationMatrix(
-                        ref.first,
-                        _instrument.referenceFrame,
-                        time
-                    ) * r.surfaceVector;
-                }
-
-                // Convert the KM scale that SPICE uses to meter
-                glm::vec3 srfVec = r.surfaceVector * 1000.0;
-
-                // Standoff distance, we would otherwise end up *exactly* on the surface
-                srfVec *= _standOffDistance;
-
-                second = {
-                    .position = { srfVec.x, srfVec.y, srfVec.z },
-                    .color = RenderInformation::VertexColorTypeIntersectionEnd
-                };
-            }
-            else {
-                // This point did not intersect the target though others did
-                const glm::vec3 o = orthogonalProjection(bound, time, target);
-                second = {
-                    .position = { o.x, o.y, o.z },
-                    .color = RenderInformation::VertexColorTypeInFieldOfView
-                };
-            }
+                "SSB",
+                "J2000",
+                AC(),
+                time
+            ).velocity;
+            const double c = distanceconstants::LightSecond / 1000.0; // km/s
+            aberration = isReception ? -velocity / c : velocity / c;
         }
-    }
 
-    // After finding the positions for the field of view boundaries, we can create the
-    // vertices for the orthogonal plane as well, reusing the computations we performed
-    // earlier
-
-    // Each boundary in _instrument.bounds has 'InterpolationSteps' steps between
-    auto indexForBounds = [](size_t idx) -> size_t { return idx * InterpolationSteps; };
-
-    auto copyFieldOfViewValues = [this](size_t iBound, size_t begin, size_t end) -> void {
-        std::fill(
-            _orthogonalPlane.data.begin() + begin,
-            _orthogonalPlane.data.begin() + end,
-            _fieldOfViewBounds.data[2 * iBound + 1]
+        const glm::dmat3 instrumentToJ2000 =
+            SpiceManager::ref().frameTransformationMatrix(
+                _instrument.name,
+                "J2000",
+                time
+            );
+        const glm::dmat3 j2000ToBody = SpiceManager::ref().frameTransformationMatrix(
+            "J2000",
+            bodyFrame,
+            targetEpoch
         );
-    };
 
-    // An early out for when the target is not in field of view
-    if (!isInFov) {
-        for (size_t i = 0; i < _instrument.bounds.size(); i++) {
-            // If none of the points are able to intersect with the target, we can just
-            // copy the values from the field-of-view boundary. So we take each second
-            // item (the first one is (0,0,0)) and replicate it 'InterpolationSteps' times
-            copyFieldOfViewValues(i, indexForBounds(i), indexForBounds(i + 1));
+        std::vector<glm::dvec3> directions;
+        directions.reserve(probes.size());
+        for (const glm::dvec3& probe : probes) {
+            glm::dvec3 direction = instrumentToJ2000 * probe;
+            if (isStellar) {
+                direction = glm::normalize(glm::normalize(direction) + aberration);
+            }
+            directions.push_back(j2000ToBody * direction);
         }
+        result = ellipsoidIntercepts(-targetPos, directions, *radii);
     }
     else {
-        // At least one point will intersect
-        for (size_t i = 0; i < _instrument.bounds.size(); i++) {
-            // Wrap around the array index to 0
-            const size_t j = (i == _instrument.bounds.size() - 1) ? 0 : i + 1;
-
-            const glm::dvec3& iBound = _instrument.bounds[i];
-            const glm::dvec3& jBound = _instrument.bounds[j];
-
-            auto intercepts = [&](const glm::dvec3& probe) -> bool {
-                return SpiceManager::ref().surfaceIntercept(
+        // Without a triaxial ellipsoid for the target, we have to let SPICE figure out
+        // the intercepts
+        result.reserve(probes.size());
+        for (const glm::dvec3& probe : probes) {
+            const SpiceManager::SurfaceInterceptResult r =
+                SpiceManager::ref().surfaceIntercept(
                     target,
                     _instrument.spacecraft,
                     _instrument.name,
-                    makeBodyFixedReferenceFrame(_instrument.referenceFrame).first,
+                    bodyFrame,
                     _instrument.aberrationCorrection,
                     time,
                     probe
-                ).interceptFound;
-            };
+                );
+            result.push_back(
+                r.interceptFound ?
+                    std::optional<glm::dvec3>(r.surfaceVector) :
+                    std::nullopt
+            );
+        }
+    }
 
-            // Computes the intercept vector between the 'probe' and the target
-            // the intercept vector is in meter and contains a standoff distance offset
-            auto interceptVector = [&](const glm::dvec3& probe) -> glm::dvec3 {
-                auto ref = makeBodyFixedReferenceFrame(_instrument.referenceFrame);
-                SpiceManager::SurfaceInterceptResult r =
-                    SpiceManager::ref().surfaceIntercept(
-                        target,
-                        _instrument.spacecraft,
-                        _instrument.name,
-                        ref.first,
-                        _instrument.aberrationCorrection,
-                        time,
-                        probe
-                    );
-
-                if (ref.second) {
-                    r.surfaceVector = SpiceManager::ref().frameTransformationMatrix(
-                        ref.first,
-                        _instrument.referenceFrame,
-                        time
-                    ) * r.surfaceVector;
-                }
-
-                // Convert the KM scale that SPICE uses to meter
-                // Standoff distance, we would otherwise end up *exactly* on the surface
-                return r.surfaceVector * 1000.0 * _standOffDistance.value();
-            };
+    // If we had to convert the reference frame into a body-fixed frame, we need to
+    // apply this change here
+    const glm::dmat3 bodyToReference =
+        convert ?
+        SpiceManager::ref().frameTransformationMatrix(
+            bodyFrame,
+            _instrument.referenceFrame,
+            time
+        ) :
+        glm::dmat3(1.0);
+
+    // Convert the KM scale that SPICE uses to meter and apply the standoff distance, we
+    // would otherwise end up *exactly* on the surface
+    const double scale = 1000.0 * _standOffDistance;
+    for (std::optional<glm::dvec3>& intercept : result) {
+        if (intercept.has_value()) {
+            *intercept = bodyToReference * *intercept * scale;
+        }
+    }
+    return result;
+}
 
-            for (size_t m = 0; m < InterpolationSteps; ++m) {
-                const double t = static_cast<double>(m) / (InterpolationSteps);
-                const glm::dvec3 tBound = glm::mix(iBound, jBound, t);
-
-                if (intercepts(tBound)) {
-                    const glm::vec3 icpt = interceptVector(tBound);
-                    _orthogonalPlane.data[indexForBounds(i) + m] = {
-                        .position = { icpt.x, icpt.y, icpt.z },
-                        .color = RenderInformation::VertexColorTypeSquare
-                    };
-                }
-                else {
-                    const glm::vec3 o = orthogonalProjection(tBound, time, target);
-                    _orthogonalPlane.data[indexForBounds(i) + m] = {
-                        .position = { o.x, o.y, o.z },
-                        .color = RenderInformation::VertexColorTypeSquare
-                    };
-                }
-            }
+void RenderableFov::computeIntercepts(double time, const std::string& target,
+                                      bool isInFov)
+{
+    const size_t nBounds = _instrument.bounds.size();
+
+    // Each boundary in _instrument.bounds has 'InterpolationSteps' steps between it and
+    // the next boundary, the first of which is the boundary itself. All of these probes
+    // are tested against the target in one batch
+    std::vector<glm::dvec3> probes;
+    probes.reserve(nBounds * InterpolationSteps);
+    for (size_t i = 0; i < nBounds; i++) {
+        // Wrap around the array index to 0
+        const size_t j = (i == nBounds - 1) ? 0 : i + 1;
+
+        for (size_t m = 0; m < InterpolationSteps; m++) {
+            const double t = static_cast<double>(m) / InterpolationSteps;
+            probes.push_back(glm::mix(_instrument.bounds[i], _instrument.bounds[j], t));
         }
     }
+    auto indexForBounds = [](size_t idx) -> size_t { return idx * InterpolationSteps; };
 
+    const std::vector<glm::dvec3> projections = orthogonalProjections(
+        probes,
+        time,
+        target
+    );
 
-#if 0 // DEBUG_THIS
-    // At least one point will intersect
-    for (size_t i = 0; i < _instrument.bounds.size(); i++) {
-        // Wrap around the array index to 0
-        const size_t j = (i == _instrument.bounds.size() - 1) ? 0 : i + 1;
+    // We only need to test against the object if it is in the field of view at all. We
+    // need to test it against the object (rather than using a fixed distance) as the
+    // field of view rendering should stop at the surface
+    const std::vector<std::optional<glm::dvec3>> intercepts =
+        isInFov ?
+        surfaceIntercepts(probes, time, target) :
+        std::vector<std::optional<glm::dvec3>>(probes.size());
 
-        const glm::dvec3& iBound = _instrument.bounds[i];
-        const glm::dvec3& jBound = _instrument.bounds[j];
+    // First we fill the field-of-view bounds array
+    for (size_t i = 0; i < nBounds; i++) {
+        const size_t probe = indexForBounds(i);
 
-        auto intercepts = [&](const glm::dvec3& probe) -> bool {
-            return SpiceManager::ref().surfaceIntercept(
-                target,
-                _instrument.spacecraft,
-                _instrument.name,
-                makeBodyFixedReferenceFrame(_instrument.referenceFrame).first,
-                _instrument.aberrationCorrection,
-                time,
-                probe
-            ).interceptFound;
-        };
+        RenderInformation::VBOData& first = _fieldOfViewBounds.data[2 * i];
+        RenderInformation::VBOData& second = _fieldOfViewBounds.data[2 * i + 1];
 
-        constexpr uint8_t NoIntersect   = 0b00;
-        constexpr uint8_t ThisIntersect = 0b01;
-        constexpr uint8_t NextIntersect = 0b10;
-        constexpr uint8_t BothIntersect = 0b11;
-
-        const uint8_t type = (intersects[i] ? 1 : 0) + (intersects[j] ? 2 : 0);
-        switch (type) {
-            case NoIntersect:
-            {
-                // If both points don't intercept, the target might still pass between
-                // them, so we need to check the intermediate point
-
-                const glm::dvec3 half = glm::mix(iBound, jBound, 0.5);
-                if (intercepts(half)) {
-                    // The two outer points do not intersect, but the middle point
-                    // does; so we need to find the intersection points
-                    const double t1 = bisect(half, iBound, intercepts);
-                    const double t2 = 0.5 + bisect(half, jBound, intercepts);
-
-                    //
-                    // The target is sticking out somewhere between i and j, so we
-                    // have three regions here:
-                    // The first (0,t1) and second (t2,1) are not intersecting
-                    // The third between (t1,t2) is intersecting
-                    //
-                    //   i       p1    p2       j
-                    //            *****
-                    //   x-------*     *-------x
-                    //   0       t1    t2      1
-
-                    // OBS: i and j are in bounds-space,  p1, p2 are in
-                    // _orthogonalPlane-space
-                    const size_t p1 = static_cast<size_t>(
-                        indexForBounds(i) + t1 * InterpolationSteps
-                    );
-                    const size_t p2 = static_cast<size_t>(
-                        indexForBounds(i) + t2 * InterpolationSteps
-                    );
-
-                    // We can copy the non-intersecting parts
-                    copyFieldOfViewValues(i, indexForBounds(i), p1);
-                    copyFieldOfViewValues(i, p2, indexForBounds(j));
-
-                    // Are recompute the intersecting ones
-                    for (size_t k = 0; k <= (p2 - p1); k++) {
-                        const double t = t1 + k * (t2 - t1);
-                        const glm::dvec3 interpolated = glm::mix(iBound, jBound, t);
-                        const glm::vec3 icpt = interceptVector(interpolated);
-                        _orthogonalPlane.data[p1 + k] = {
-                            icpt.x, icpt.y, icpt.z,
-                            RenderInformation::VertexColorTypeSquare
-                        };
-                    }
-                }
-                else {
-                    copyFieldOfViewValues(
-                        i,
-                        indexForBounds(i),
-                        indexForBounds(i + 1)
-                    );
-                }
-                break;
-            }
-            case ThisIntersect:
-            case NextIntersect:
-            case BothIntersect:
-                break;
-            default:
-                throw ghoul::MissingCaseException();
+        if (intercepts[probe].has_value()) {
+            // This point intersected the target
+            const glm::vec3 srfVec = *intercepts[probe];
+            first = {
+                .position = { 0.f, 0.f, 0.f },
+                .color = RenderInformation::VertexColorTypeIntersectionStart
+            };
+            second = {
+                .position = { srfVec.x, srfVec.y, srfVec.z },
+                .color = RenderInformation::VertexColorTypeIntersectionEnd
+            };
+        }
+        else {
+            // Either the target is not in the field of view at all, or it is but this
+            // point did not intersect the target though others might have
+            const glm::vec3 o = projections[probe];
+            first = {
+                .position = { 0.f, 0.f, 0.f },
+                .color = RenderInformation::VertexColorTypeDefaultStart
+            };
+            second = {
+                .position = { o.x, o.y, o.z },
+                .color = isInFov ?
+                    RenderInformation::VertexColorTypeInFieldOfView :
+                    RenderInformation::VertexColorTypeDefaultEnd
+            };
+        }
+    }
+
+    // After finding the positions for the field of view boundaries, we can create the
+    // vertices for the orthogonal plane as well, reusing the computations we performed
+    // earlier
+    if (!isInFov) {
+        // If none of the points are able to intersect with the target, we can just copy
+        // the values from the field-of-view boundary. So we take each second item (the
+        // first one is (0,0,0)) and replicate it 'InterpolationSteps' times
+        for (size_t i = 0; i < nBounds; i++) {
+            std::fill(
+                _orthogonalPlane.data.begin() + indexForBounds(i),
+                _orthogonalPlane.data.begin() + indexForBounds(i + 1),
+                _fieldOfViewBounds.data[2 * i + 1]
+            );
+        }
+    }
+    else {
+        for (size_t k = 0; k < probes.size(); k++) {
+            const glm::vec3 p = intercepts[k].value_or(projections[k]);
+            _orthogonalPlane.data[k] = {
+                .position = { p.x, p.y, p.z },
+                .color = RenderInformation::VertexColorTypeSquare
+            };
         }
     }
-#endif
 }
 
 void RenderableFov::render(const RenderData& data, RendererTasks&) {
@@ -35,6 +35,9 @@
 #include <ghoul/glm.h>
 #include <ghoul/opengl/ghoul_gl.h>
 #include <ghoul/opengl/uniformcache.h>
+#include <optional>
+#include <span>
+#include <string>
 
 namespace ghoul::opengl {
     class ProgramObject;
@@ -73,8 +76,30 @@ private:
     void computeIntercepts(double time, const std::string& target,
         bool isInFov);
 
-    glm::dvec3 orthogonalProjection(const glm::dvec3& vecFov, double time,
-        const std::string& target) const;
+    /**
+     * Projects all of the \p probes in the instrument frame onto the direction towards
+     * the \p target at the provided \p time. The returned vectors are in meters and in
+     * the instrument's reference frame.
+     */
+    std::vector<glm::dvec3> orthogonalProjections(std::span<const glm::dvec3> probes,
+        double time, const std::string& target) const;
+
+    /**
+     * Computes the surface intercepts of all \p probes in the instrument frame with the
+     * \p target at the provided \p time. The shape and orientation of the target are
+     * only requested once for all probes. The returned vectors point from the spacecraft
+     * to the intercept point in meters, including the standoff distance, and are in the
+     * instrument's reference frame. Probes that miss the target are `std::nullopt`.
+     */
+    std::vector<std::optional<glm::dvec3>> surfaceIntercepts(
+        std::span<const glm::dvec3> probes, double time, const std::string& target);
+
+    /**
+     * Returns the radii of the triaxial ellipsoid of the \p target or `std::nullopt` if
+     * the loaded kernels don't provide one. The radii are cached until the target
+     * changes.
+     */
+    std::optional<glm::dvec3> targetRadii(const std::string& target);
 
     // properties
     properties::FloatProperty _lineWidth;
@@ -90,6 +115,10 @@ private:
     std::string _previousTarget;
     bool _drawFOV = false;
 
+    /// The target for which the ellipsoid radii are cached in #_targetRadii
+    std::optional<std::string> _radiiTarget;
+    std::optional<glm::dvec3> _targetRadii;
+
     struct {
         std::string spacecraft;
         std::string name;
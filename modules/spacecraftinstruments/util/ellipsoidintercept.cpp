@@ -0,0 +1,119 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <modules/spacecraftinstruments/util/ellipsoidintercept.h>
+
+#include <ghoul/misc/assert.h>
+#include <cmath>
+#include <utility>
+
+namespace {
+    // Intersects a ray with the unit sphere after the ellipsoid has been scaled into it.
+    // 'b' and 'c' are the half linear and the constant coefficients of the quadratic
+    // equation a*t^2 + 2*b*t + c = 0; only 'a' and 'b' depend on the ray direction
+    std::optional<double> intersectUnitSphere(double a, double b, double c) {
+        const double discriminant = b * b - a * c;
+        if (discriminant < 0.0) {
+            return std::nullopt;
+        }
+
+        // Numerically stable form of the quadratic formula that avoids the cancellation
+        // for observers that are far away compared to the size of the ellipsoid
+        const double q = -(b + std::copysign(std::sqrt(discriminant), b));
+        if (q == 0.0) {
+            // The observer is located exactly on the surface and looking along it
+            return c == 0.0 ? std::optional<double>(0.0) : std::nullopt;
+        }
+        double t1 = q / a;
+        double t2 = c / q;
+        if (t1 > t2) {
+            std::swap(t1, t2);
+        }
+
+        if (c > 0.0) {
+            // The observer is outside, so the closer root is the one we are looking
+            // for, but only if the ellipsoid is in front of the observer
+            if (t1 < 0.0) {
+                return std::nullopt;
+            }
+            return t1;
+        }
+        else {
+            // The observer is inside the ellipsoid, so the ray always leaves it in front
+            return t2;
+        }
+    }
+} // namespace
+
+namespace openspace {
+
+std::optional<glm::dvec3> ellipsoidIntercept(const glm::dvec3& observer,
+                                             const glm::dvec3& direction,
+                                             const glm::dvec3& radii)
+{
+    ghoul_assert(direction != glm::dvec3(0.0), "Direction must not be the null vector");
+    ghoul_assert(glm::all(glm::greaterThan(radii, glm::dvec3(0.0))), "Invalid radii");
+
+    const glm::dvec3 o = observer / radii;
+    const glm::dvec3 d = direction / radii;
+    const std::optional<double> t = intersectUnitSphere(
+        glm::dot(d, d),
+        glm::dot(o, d),
+        glm::dot(o, o) - 1.0
+    );
+    return t.has_value() ? std::optional<glm::dvec3>(*t * direction) : std::nullopt;
+}
+
+std::vector<std::optional<glm::dvec3>> ellipsoidIntercepts(const glm::dvec3& observer,
+                                                std::span<const glm::dvec3> directions,
+                                                               const glm::dvec3& radii)
+{
+    ghoul_assert(glm::all(glm::greaterThan(radii, glm::dvec3(0.0))), "Invalid radii");
+
+    const glm::dvec3 invRadii = 1.0 / radii;
+    const glm::dvec3 o = observer * invRadii;
+    const double c = glm::dot(o, o) - 1.0;
+
+    std::vector<std::optional<glm::dvec3>> result;
+    result.reserve(directions.size());
+    for (const glm::dvec3& direction : directions) {
+        ghoul_assert(
+            direction != glm::dvec3(0.0),
+            "Direction must not be the null vector"
+        );
+
+        const glm::dvec3 d = direction * invRadii;
+        const std::optional<double> t = intersectUnitSphere(
+            glm::dot(d, d),
+            glm::dot(o, d),
+            c
+        );
+        result.push_back(
+            t.has_value() ? std::optional<glm::dvec3>(*t * direction) : std::nullopt
+        );
+    }
+    return result;
+}
+
+} // namespace openspace
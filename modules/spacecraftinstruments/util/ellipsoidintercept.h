@@ -0,0 +1,71 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_SPACECRAFTINSTRUMENTS___ELLIPSOIDINTERCEPT___H__
+#define __OPENSPACE_MODULE_SPACECRAFTINSTRUMENTS___ELLIPSOIDINTERCEPT___H__
+
+#include <ghoul/glm.h>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace openspace {
+
+/**
+ * Computes the closest point at which the ray starting at \p observer and pointing into
+ * \p direction hits the surface of a triaxial ellipsoid that is centered at the origin
+ * and whose semi-axes \p radii are aligned with the coordinate axes. This is the same
+ * computation that SPICE's `sincpt` performs for the `ELLIPSOID` shape model, but
+ * without any of the kernel lookups, so the \p observer and \p direction have to be
+ * provided in the body-fixed frame of the ellipsoid.
+ *
+ * \param observer The position of the observer relative to the center of the ellipsoid
+ * \param direction The direction of the ray. This vector does not have to be normalized
+ * \param radii The semi-axes of the ellipsoid in the same unit as \p observer
+ * \return The vector from the \p observer to the intercept point, or `std::nullopt` if
+ *         the ray misses the ellipsoid. If the observer is inside the ellipsoid, the
+ *         point at which the ray leaves the ellipsoid is returned instead
+ *
+ * \pre \p direction must not be the null vector
+ * \pre All components of \p radii must be positive
+ */
+std::optional<glm::dvec3> ellipsoidIntercept(const glm::dvec3& observer,
+    const glm::dvec3& direction, const glm::dvec3& radii);
+
+/**
+ * Computes the ellipsoidIntercept for all \p directions that share the same
+ * \p observer. The values that only depend on the observer and the ellipsoid are only
+ * computed once for the entire batch.
+ *
+ * \param observer The position of the observer relative to the center of the ellipsoid
+ * \param directions The directions of all rays that should be intersected
+ * \param radii The semi-axes of the ellipsoid in the same unit as \p observer
+ * \return The surface vectors in the same order as the \p directions
+ */
+std::vector<std::optional<glm::dvec3>> ellipsoidIntercepts(const glm::dvec3& observer,
+    std::span<const glm::dvec3> directions, const glm::dvec3& radii);
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_SPACECRAFTINSTRUMENTS___ELLIPSOIDINTERCEPT___H__
@@ -28,9 +28,68 @@
 #include <openspace/util/timemanager.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/logging/logmanager.h>
+#include <algorithm>
+#include <iterator>
+#include <limits>
 
 namespace {
     constexpr std::string_view _loggerCat = "ImageSequencer";
+
+    bool compareStartTime(const openspace::Image& a, const openspace::Image& b) {
+        return a.timeRange.start < b.timeRange.start;
+    }
+
+    // Merges the predicted captures into the time-sorted list of actual images. If there
+    // is an image that is closer than epsilon to a predicted capture, the prediction is
+    // discarded as the image was taken instead
+    void mergePredictions(std::vector<openspace::Image>& images,
+                          std::vector<openspace::Image> predictions)
+    {
+        using namespace openspace;
+
+        if (!std::is_sorted(images.begin(), images.end(), &compareStartTime)) {
+            std::stable_sort(images.begin(), images.end(), &compareStartTime);
+        }
+        std::stable_sort(predictions.begin(), predictions.end(), &compareStartTime);
+
+        // The smallest separation of the images in time, but at most 10 seconds. Epsilon
+        // is 1% smaller than that so that predictions can't match two images
+        double minSeparation = 10.0;
+        for (size_t i = 1; i < images.size(); i++) {
+            const double separation = std::abs(
+                images[i].timeRange.start - images[i - 1].timeRange.start
+            );
+            minSeparation = std::min(separation, minSeparation);
+        }
+        const double epsilon = minSeparation * 0.99;
+
+        std::vector<Image> result;
+        result.reserve(images.size() + predictions.size());
+        auto image = images.begin();
+        double previousImageTime = -std::numeric_limits<double>::max();
+        for (Image& prediction : predictions) {
+            const double t = prediction.timeRange.start;
+            while (image != images.end() && image->timeRange.start < t) {
+                previousImageTime = image->timeRange.start;
+                result.push_back(std::move(*image));
+                image++;
+            }
+
+            // The only candidates are the image just before and just after the capture
+            const bool hasPreviousImage = t - previousImageTime < epsilon;
+            const bool hasNextImage =
+                image != images.end() && image->timeRange.start - t < epsilon;
+            if (!hasPreviousImage && !hasNextImage) {
+                result.push_back(std::move(prediction));
+            }
+        }
+        result.insert(
+            result.end(),
+            std::make_move_iterator(image),
+            std::make_move_iterator(images.end())
+        );
+        images = std::move(result);
+    }
 } // namespace
 
 namespace openspace {
@@ -209,33 +268,27 @@ std::vector<Image> ImageSequencer::imagePaths(const std::string& projectee,
 
     // check if this instance is either in range or
     // a valid candidate to recieve data
+    const auto subset = _subsetMap.find(projectee);
+    if (subset == _subsetMap.end()) {
+        return std::vector<Image>();
+    }
 
     const bool instrumentActive = isInstrumentActive(time, instrument);
-    const bool hasCurrentTime = _subsetMap[projectee]._range.includes(time);
-    const bool hasSinceTime = _subsetMap[projectee]._range.includes(sinceTime);
+    const bool hasCurrentTime = subset->second._range.includes(time);
+    const bool hasSinceTime = subset->second._range.includes(sinceTime);
 
     if (!instrumentActive || (!hasCurrentTime && !hasSinceTime)) {
         return std::vector<Image>();
     }
 
-    // for readability we store the iterators
-    auto begin = _subsetMap[projectee]._subset.begin();
-    auto end = _subsetMap[projectee]._subset.end();
-
-    // create temporary storage
-    std::vector<Image> captures;
-    // what to look for
-    Image findPrevious;
-    Image findCurrent;
-    findPrevious.timeRange.start = sinceTime;
-    findCurrent.timeRange.start = time;
-
-    // find the two iterators that correspond to the latest time jump
-    auto compareTime = [](const Image& a, const Image& b) -> bool {
-        return a.timeRange.start < b.timeRange.start;
-    };
-    auto curr = std::lower_bound(begin, end, findCurrent , compareTime);
-    auto prev = std::lower_bound(begin, end, findPrevious, compareTime);
+    // The images are sorted by time, so we can find the two iterators that correspond
+    // to the latest time jump through a binary search
+    const std::vector<Image>& images = subset->second._subset;
+    auto compareTime = [](const Image& a, double t) { return a.timeRange.start < t; };
+    const auto begin = images.begin();
+    const auto end = images.end();
+    const auto curr = std::lower_bound(begin, end, time, compareTime);
+    const auto prev = std::lower_bound(begin, end, sinceTime, compareTime);
 
     if (curr == begin || curr == end || prev == begin || prev == end || prev >= curr ||
         curr->timeRange.start < prev->timeRange.start)
@@ -243,44 +296,46 @@ std::vector<Image> ImageSequencer::imagePaths(const std::string& projectee,
         return std::vector<Image>();
     }
 
+    std::vector<Image> captures;
     std::copy_if(
         prev,
         curr,
         back_inserter(captures),
-        [instrument](const Image& i) { return i.activeInstruments[0] == instrument; }
+        [&instrument](const Image& i) { return i.activeInstruments[0] == instrument; }
     );
 
-    if (!captures.empty()) {
-        _latestImages[captures.back().activeInstruments.front()] = captures.back();
+    if (captures.empty()) {
+        return captures;
     }
-
-    std::vector<int> toDelete;
-    for (auto it = captures.begin(); it != captures.end(); it++) {
-        if (!it->isPlaceholder) {
+    _latestImages[captures.back().activeInstruments.front()] = captures.back();
+
+    // Remove the placeholders that are closer than a second to another capture. The
+    // neighbors are checked against the unfiltered list of captures
+    const size_t nCaptures = captures.size();
+    std::vector<bool> keep = std::vector<bool>(nCaptures, true);
+    for (size_t i = 0; i < nCaptures; i++) {
+        if (!captures[i].isPlaceholder) {
             continue;
         }
 
-        double beforeDist = std::numeric_limits<double>::max();
-        if (it != captures.begin()) {
-            beforeDist = std::abs(std::prev(it)->timeRange.start - it->timeRange.start);
-        }
-
-        double nextDist = std::numeric_limits<double>::max();
-        if (it != captures.end() - 1) {
-            nextDist = std::abs(std::next(it)->timeRange.start - it->timeRange.start);
-        }
-
-        if (beforeDist < 1.0 || nextDist < 1.0) {
-            toDelete.push_back(static_cast<int>(std::distance(captures.begin(), it)));
-        }
+        const double t = captures[i].timeRange.start;
+        const bool hasPrevious =
+            i > 0 && std::abs(captures[i - 1].timeRange.start - t) < 1.0;
+        const bool hasNext =
+            i + 1 < nCaptures && std::abs(captures[i + 1].timeRange.start - t) < 1.0;
+        keep[i] = !hasPrevious && !hasNext;
     }
 
-    for (size_t i = 0; i < toDelete.size(); i++) {
-        // We have to subtract i here as we already have deleted i value before this and
-        // we need to adjust the location
-        const int v = toDelete[i] - static_cast<int>(i);
-        captures.erase(captures.begin() + v);
+    size_t nKept = 0;
+    for (size_t i = 0; i < nCaptures; i++) {
+        if (keep[i]) {
+            if (nKept != i) {
+                captures[nKept] = std::move(captures[i]);
+            }
+            nKept++;
+        }
     }
+    captures.resize(nKept);
 
     return captures;
 }
@@ -297,14 +352,12 @@ void ImageSequencer::sortData() {
     );
     std::stable_sort(_captureProgression.begin(), _captureProgression.end());
 
-    for (const std::pair<const std::string, ImageSubset>& sub : _subsetMap) {
-        std::sort(
-            _subsetMap[sub.first]._subset.begin(),
-            _subsetMap[sub.first]._subset.end(),
-            [](const Image& a, const Image& b) -> bool {
-                return a.timeRange.start < b.timeRange.start;
-            }
-        );
+    for (std::pair<const std::string, ImageSubset>& sub : _subsetMap) {
+        // The subsets are kept sorted while merging, so this is usually a no-op
+        std::vector<Image>& images = sub.second._subset;
+        if (!std::is_sorted(images.begin(), images.end(), &compareStartTime)) {
+            std::stable_sort(images.begin(), images.end(), &compareStartTime);
+        }
     }
 
     std::sort(
@@ -338,51 +391,16 @@ void ImageSequencer::runSequenceParser(SequenceParser& parser) {
     }
 
     for (std::pair<const std::string, ImageSubset>& it : imageData) {
-        if (_subsetMap.find(it.first) == _subsetMap.end()) {
+        const auto subset = _subsetMap.find(it.first);
+        if (subset == _subsetMap.end()) {
             // if key not exist yet - add sequence data for key (target)
-            _subsetMap.insert(it);
+            _subsetMap.insert(std::move(it));
             continue;
         }
 
-        const std::string& key = it.first;
-        std::vector<Image>& source = it.second._subset; // prediction
-        const std::vector<Image>& destination = _subsetMap[key]._subset; // imagery
-
-        // simple search function
-        double min = 10;
-        auto findMin = [&min](const std::vector<Image>& vec) -> double {
-            for (size_t i = 1; i < vec.size(); i++) {
-                const double e = std::abs(
-                    vec[i].timeRange.start - vec[i - 1].timeRange.start
-                );
-                min = std::min(e, min);
-            }
-            return min;
-        };
-
-        // find the smallest separation of images in time
-        double epsilon = findMin(destination);
-        // set epsilon as 1% smaller than min
-        epsilon -= min * 0.01;
-
-        // IFF images have same time as mission planned capture, erase that event
-        // from 'predicted event file' (mission-playbook)
-        for (const Image& i : source) {
-            for (const Image& j : destination) {
-                const double diff = std::abs(i.timeRange.start - j.timeRange.start);
-                if (diff < epsilon) {
-                    source.erase(source.begin() + 1);
-                }
-            }
-        }
         // pad image data with predictions (ie - where no actual images, add placeholder)
-        _subsetMap[key]._subset.insert(
-            _subsetMap[key]._subset.end(),
-            source.begin(),
-            source.end()
-        );
-
-        _subsetMap[key]._range.include(it.second._range);
+        mergePredictions(subset->second._subset, std::move(it.second._subset));
+        subset->second._range.include(it.second._range);
     }
 
     _instrumentTimes.insert(
@@ -32,13 +32,112 @@
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/dictionary.h>
 #include <ghoul/misc/stringhelper.h>
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <thread>
 
 namespace {
     constexpr std::string_view _loggerCat = "LabelParser";
     constexpr std::string_view keySpecs = "Read";
     constexpr std::string_view keyConvert = "Convert";
+
+    constexpr int8_t CurrentCacheVersion = 1;
+
+    void writeString(std::ofstream& file, const std::string& value) {
+        const uint32_t length = static_cast<uint32_t>(value.size());
+        file.write(reinterpret_cast<const char*>(&length), sizeof(uint32_t));
+        file.write(value.data(), length);
+    }
+
+    // Calls \p function for all indices in [0, \p count) distributed over all hardware
+    // threads
+    void parallelFor(size_t count, const std::function<void(size_t)>& function) {
+        std::atomic<size_t> next = 0;
+        auto worker = [&]() {
+            for (size_t i = next++; i < count; i = next++) {
+                function(i);
+            }
+        };
+        const size_t nThreads = std::min<size_t>(
+            std::max(std::thread::hardware_concurrency(), 1u),
+            count
+        );
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < nThreads; i++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    std::string readString(std::ifstream& file) {
+        uint32_t length = 0;
+        file.read(reinterpret_cast<char*>(&length), sizeof(uint32_t));
+        std::string value;
+        value.resize(length);
+        file.read(value.data(), length);
+        return value;
+    }
+
+    bool loadCachedFile(const std::filesystem::path& path,
+                        std::vector<openspace::Image>& images,
+                        std::string& instrumentName)
+    {
+        std::ifstream file = std::ifstream(path, std::ifstream::binary);
+        if (!file.good()) {
+            return false;
+        }
+
+        int8_t version = 0;
+        file.read(reinterpret_cast<char*>(&version), sizeof(int8_t));
+        if (version != CurrentCacheVersion) {
+            LINFO("The format of the cached file has changed");
+            return false;
+        }
+
+        instrumentName = readString(file);
+        uint64_t nImages = 0;
+        file.read(reinterpret_cast<char*>(&nImages), sizeof(uint64_t));
+        images.resize(nImages);
+        for (openspace::Image& image : images) {
+            file.read(reinterpret_cast<char*>(&image.timeRange.start), sizeof(double));
+            file.read(reinterpret_cast<char*>(&image.timeRange.end), sizeof(double));
+            image.path = readString(file);
+            image.activeInstruments = { readString(file) };
+            image.target = readString(file);
+        }
+
+        if (!file.good()) {
+            images.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void saveCachedFile(const std::filesystem::path& path,
+                        const std::vector<openspace::Image>& images,
+                        const std::string& instrumentName)
+    {
+        std::ofstream file = std::ofstream(path, std::ofstream::binary);
+        file.write(reinterpret_cast<const char*>(&CurrentCacheVersion), sizeof(int8_t));
+
+        writeString(file, instrumentName);
+        const uint64_t nImages = images.size();
+        file.write(reinterpret_cast<const char*>(&nImages), sizeof(uint64_t));
+        for (const openspace::Image& image : images) {
+            const openspace::TimeRange& range = image.timeRange;
+            file.write(reinterpret_cast<const char*>(&range.start), sizeof(double));
+            file.write(reinterpret_cast<const char*>(&range.end), sizeof(double));
+            writeString(file, image.path.string());
+            writeString(file, image.activeInstruments.front());
+            writeString(file, image.target);
+        }
+    }
 } // namespace
 
 namespace openspace {
@@ -113,14 +212,17 @@ LabelParser::LabelParser(std::filesystem::path fileName,
     }
 }
 
-std::string LabelParser::decode(const std::string& line) {
+std::string LabelParser::decode(const std::string& line) const {
     using K = std::string;
     using V = std::unique_ptr<Decoder>;
     for (const std::pair<const K, V>& key : _fileTranslation) {
         const size_t value = line.find(key.first);
         if (value != std::string::npos) {
-            const std::string toTranslate = line.substr(value);
-            return _fileTranslation[toTranslate]->translations()[0];
+            const auto it = _fileTranslation.find(line.substr(value));
+            if (it == _fileTranslation.end()) {
+                return "";
+            }
+            return it->second->translations()[0];
         }
     }
     return "";
@@ -138,6 +240,115 @@ std::string LabelParser::encode(const std::string& line) const {
     return "";
 }
 
+std::optional<LabelParser::LabelFile> LabelParser::parseLabelFile(
+                                                        const std::filesystem::path& path,
+                                             const std::filesystem::path& imagePath) const
+{
+    std::ifstream file = std::ifstream(path);
+    if (!file.good()) {
+        LERROR(std::format("Failed to open label file '{}'", path));
+        return std::nullopt;
+    }
+
+    LabelFile result;
+    std::string target;
+    std::string instrumentID;
+    std::string start;
+    std::string stop;
+    int count = 0;
+
+    auto cleanLine = [](std::string& l) {
+        l.erase(
+            std::remove_if(
+                l.begin(),
+                l.end(),
+                [](char c) { return c == '"' || c == ' ' || c == '\r'; }
+            ),
+            l.end()
+        );
+    };
+
+    constexpr std::string_view ErrorMsg =
+        "Unrecognized '{}' in line {} in file {}. The 'Convert' table must contain the "
+        "identity tranformation for all values encountered in the label files, for "
+        "example: ROSETTA = {{ \"ROSETTA\" }}";
+
+    std::string line;
+    do {
+        ghoul::getline(file, line);
+        cleanLine(line);
+
+        std::string read = line.substr(0, line.find_first_of('='));
+
+        // Add more
+        if (read == "TARGET_NAME") {
+            target = decode(line);
+            if (target.empty()) {
+                LWARNING(std::format(ErrorMsg, "TARGET_NAME", line, path));
+            }
+            count++;
+        }
+        if (read == "INSTRUMENT_HOST_NAME") {
+            if (decode(line).empty()) {
+                LWARNING(std::format(ErrorMsg, "INSTRUMENT_HOST_NAME", line, path));
+            }
+            count++;
+        }
+        if (read == "INSTRUMENT_ID") {
+            instrumentID = decode(line);
+            if (instrumentID.empty()) {
+                LWARNING(std::format(ErrorMsg, "INSTRUMENT_ID", line, path));
+            }
+            result.instrumentName = encode(line);
+            count++;
+        }
+        if (read == "DETECTOR_TYPE") {
+            if (decode(line).empty()) {
+                LWARNING(std::format(ErrorMsg, "DETECTOR_TYPE", line, path));
+            }
+            count++;
+        }
+
+        if (read == "START_TIME") {
+            start = line.substr(line.find('=') + 1);
+            count++;
+
+            ghoul::getline(file, line);
+            cleanLine(line);
+
+            read = line.substr(0, line.find_first_of('='));
+            if (read == "STOP_TIME") {
+                stop = line.substr(line.find('=') + 1);
+                count++;
+            }
+            else {
+                LERROR(std::format(
+                    "Label file '{}' deviates from generic standard", path
+                ));
+                LINFO(
+                    "Please make sure input data adheres to format from \
+                    https://pds.jpl.nasa.gov/documents/qs/labels.html"
+                );
+            }
+        }
+        if (count == static_cast<int>(_specsOfInterest.size())) {
+            count = 0;
+
+            if (!imagePath.empty()) {
+                result.captures.push_back({
+                    .imagePath = imagePath,
+                    .target = target,
+                    .instrumentID = instrumentID,
+                    .startTime = start,
+                    .stopTime = stop
+                });
+            }
+        }
+    } while (!file.eof());
+
+    return result;
+}
+
 bool LabelParser::create() {
     std::filesystem::path sequenceDir = absPath(_fileName);
     if (!std::filesystem::is_directory(sequenceDir)) {
@@ -145,187 +356,148 @@ bool LabelParser::create() {
         return false;
     }
 
-    std::string lblName;
+    //
+    // Collect all label files. Their modification times, the images attached to them,
+    // and the translations identify the cache file, so that changes to any of them
+    // invalidate it
+    std::vector<std::filesystem::path> labelFiles;
+    std::string cacheInfo;
     namespace fs = std::filesystem;
     for (const fs::directory_entry& e : fs::recursive_directory_iterator(sequenceDir)) {
         if (!e.is_regular_file()) {
             continue;
         }
 
-        const std::filesystem::path path = e.path();
-        const std::filesystem::path extension = path.extension();
+        const std::filesystem::path extension = e.path().extension();
         if (extension != ".lbl" && extension != ".LBL") {
             continue;
         }
-
-        std::ifstream file = std::ifstream(path);
-
-        if (!file.good()) {
-            LERROR(std::format("Failed to open label file '{}'", path));
-            return false;
+        labelFiles.push_back(e.path());
+    }
+    // The order of the directory iteration is unspecified, so we sort the files to get
+    // reproducible results
+    std::sort(labelFiles.begin(), labelFiles.end());
+
+    // Find the image with one of the supported extensions next to each label file. Most
+    // of the time is spent waiting on the disk, so this is done in parallel
+    const std::vector<std::string> extensions =
+        ghoul::io::TextureReader::ref().supportedExtensions();
+    std::vector<std::filesystem::path> imageFiles =
+        std::vector<std::filesystem::path>(labelFiles.size());
+    parallelFor(labelFiles.size(), [&](size_t i) {
+        for (const std::string& ext : extensions) {
+            std::filesystem::path imagePath = labelFiles[i];
+            imagePath.replace_extension(ext);
+            if (std::filesystem::is_regular_file(imagePath)) {
+                imageFiles[i] = std::move(imagePath);
+                break;
+            }
         }
+    });
 
-        int count = 0;
-
-        // open up label files
-        double startTime = 0.0;
-        double stopTime = 0.0;
-        std::string line;
-        do {
-            ghoul::getline(file, line);
-
-            line.erase(std::remove(line.begin(), line.end(), '"'), line.end());
-            line.erase(std::remove(line.begin(), line.end(), ' '), line.end());
-            line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
-
-            std::string read = line.substr(0, line.find_first_of('='));
-
-            _detectorType = "CAMERA"; // default value
+    for (size_t i = 0; i < labelFiles.size(); i++) {
+        const std::filesystem::file_time_type time =
+            std::filesystem::last_write_time(labelFiles[i]);
+        cacheInfo += std::format(
+            "{}|{}|{}|", labelFiles[i], time.time_since_epoch().count(), imageFiles[i]
+        );
+    }
+    for (const std::pair<const std::string, std::unique_ptr<Decoder>>& t :
+         _fileTranslation)
+    {
+        const std::string translations = ghoul::join(t.second->translations(), ",");
+        cacheInfo += std::format("{}={};", t.first, translations);
+    }
+    const std::filesystem::path cached = FileSys.cacheManager()->cachedFilename(
+        sequenceDir,
+        std::to_string(std::hash<std::string>{}(cacheInfo))
+    );
 
-            constexpr std::string_view ErrorMsg =
-                "Unrecognized '{}' in line {} in file {}. The 'Convert' table must "
-                "contain the identity tranformation for all values encountered in the "
-                "label files, for example: ROSETTA = {{ \"ROSETTA\" }}";
+    std::vector<Image> images;
+    std::string instrumentName;
+    if (std::filesystem::is_regular_file(cached)) {
+        LINFO(std::format("Cached file '{}' used for label directory '{}'",
+            cached, sequenceDir
+        ));
+        const bool success = loadCachedFile(cached, images, instrumentName);
+        if (!success) {
+            FileSys.cacheManager()->removeCacheFile(cached);
+        }
+    }
 
-            // Add more
-            if (read == "TARGET_NAME") {
-                _target = decode(line);
-                if (_target.empty()) {
-                    LWARNING(std::format(ErrorMsg, "TARGET_NAME", line, path));
-                }
-                count++;
-            }
-            if (read == "INSTRUMENT_HOST_NAME") {
-                _instrumentHostID = decode(line);
-                if (_instrumentHostID.empty()) {
-                    LWARNING(std::format(ErrorMsg, "INSTRUMENT_HOST_NAME", line, path));
-                }
-                count++;
-            }
-            if (read == "INSTRUMENT_ID") {
-                _instrumentID = decode(line);
-                if (_instrumentID.empty()) {
-                    LWARNING(std::format(ErrorMsg, "INSTRUMENT_ID", line, path));
-                }
-                lblName = encode(line);
-                count++;
-            }
-            if (read == "DETECTOR_TYPE") {
-                _detectorType = decode(line);
-                if (_detectorType.empty()) {
-                    LWARNING(std::format(ErrorMsg, "DETECTOR_TYPE", line, path));
-                }
-                count++;
+    if (images.empty()) {
+        //
+        // Parse the label files in parallel, as most of the time is spent waiting on the
+        // disk for reading the labels
+        std::vector<std::optional<LabelFile>> parsed =
+            std::vector<std::optional<LabelFile>>(labelFiles.size());
+        parallelFor(labelFiles.size(), [&](size_t i) {
+            parsed[i] = parseLabelFile(labelFiles[i], imageFiles[i]);
+        });
+
+        //
+        // The conversion of the times has to happen serially as SPICE is not thread-safe
+        for (const std::optional<LabelFile>& file : parsed) {
+            if (!file.has_value()) {
+                return false;
             }
 
-            if (read == "START_TIME") {
-                std::string start = line.substr(line.find('=') + 1);
-                start.erase(std::remove(start.begin(), start.end(), ' '), start.end());
-                startTime = SpiceManager::ref().ephemerisTimeFromDate(start);
-                count++;
+            if (!file->instrumentName.empty()) {
+                instrumentName = file->instrumentName;
+            }
 
-                ghoul::getline(file, line);
-                line.erase(std::remove(line.begin(), line.end(), '"'), line.end());
-                line.erase(std::remove(line.begin(), line.end(), ' '), line.end());
-                line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
-
-                read = line.substr(0, line.find_first_of('='));
-                if (read == "STOP_TIME") {
-                    std::string stop = line.substr(line.find('=') + 1);
-                    stop.erase(
-                        std::remove_if(
-                            stop.begin(),
-                            stop.end(),
-                            [](char c) { return c == ' ' || c == '\r'; }
-                        ),
-                        stop.end()
-                    );
-                    stopTime = SpiceManager::ref().ephemerisTimeFromDate(stop);
-                    count++;
-                }
-                else{
-                    LERROR(std::format(
-                        "Label file '{}' deviates from generic standard", path
-                    ));
-                    LINFO(
-                        "Please make sure input data adheres to format from \
-                        https://pds.jpl.nasa.gov/documents/qs/labels.html"
-                    );
-                }
+            for (const Capture& capture : file->captures) {
+                SpiceManager& spice = SpiceManager::ref();
+                const double startTime = capture.startTime.empty() ?
+                    0.0 :
+                    spice.ephemerisTimeFromDate(capture.startTime);
+                const double stopTime = capture.stopTime.empty() ?
+                    0.0 :
+                    spice.ephemerisTimeFromDate(capture.stopTime);
+
+                images.push_back({
+                    .timeRange = TimeRange(startTime, stopTime),
+                    .path = capture.imagePath,
+                    .activeInstruments = { capture.instrumentID },
+                    .target = capture.target,
+                    .isPlaceholder = false,
+                    .projected = false
+                });
             }
-            if (count == static_cast<int>(_specsOfInterest.size())) {
-                const std::vector<std::string> extensions =
-                    ghoul::io::TextureReader::ref().supportedExtensions();
-
-                count = 0;
-
-                for (const std::string& ext : extensions) {
-                    std::filesystem::path imagePath = path;
-                    imagePath.replace_extension(ext);
-                    if (std::filesystem::is_regular_file(imagePath)) {
-                        std::vector<std::string> spiceInstrument;
-                        spiceInstrument.push_back(_instrumentID);
-
-                        const Image image = {
-                            .timeRange = TimeRange(startTime, stopTime),
-                            .path = imagePath,
-                            .activeInstruments = spiceInstrument,
-                            .target = _target,
-                            .isPlaceholder = false,
-                            .projected = false
-                        };
-
-                        _subsetMap[image.target]._subset.push_back(image);
-                        _subsetMap[image.target]._range.include(startTime);
-
-                        _captureProgression.push_back(startTime);
-                        std::stable_sort(
-                            _captureProgression.begin(),
-                            _captureProgression.end()
-                        );
-
-                        break;
-                    }
-                }
+        }
+
+        std::stable_sort(
+            images.begin(),
+            images.end(),
+            [](const Image& a, const Image& b) {
+                return a.timeRange.start < b.timeRange.start;
             }
-        } while (!file.eof());
-    }
+        );
 
-    std::vector<Image> tmp;
-    for (const std::pair<const std::string, ImageSubset>& key : _subsetMap) {
-        for (const Image& image : key.second._subset) {
-            tmp.push_back(image);
+        if (!images.empty()) {
+            saveCachedFile(cached, images, instrumentName);
         }
     }
-    std::sort(
-        tmp.begin(),
-        tmp.end(),
-        [](const Image& a, const Image& b) -> bool {
-            return a.timeRange.start < b.timeRange.start;
-        }
-    );
 
+    //
+    // The images are sorted by time, so all derived arrays are sorted as well
+    _captureProgression.reserve(_captureProgression.size() + images.size());
     std::string previousTarget;
-    for (const Image& image : tmp) {
-        if (previousTarget == image.target) {
-            continue;
+    for (Image& image : images) {
+        if (image.target != previousTarget) {
+            previousTarget = image.target;
+            _targetTimes.emplace_back(image.timeRange.start, image.target);
         }
 
-        previousTarget = image.target;
-        _targetTimes.emplace_back(image.timeRange.start , image.target);
-        std::sort(
-            _targetTimes.begin(),
-            _targetTimes.end(),
-            [](const std::pair<double, std::string>& a,
-               const std::pair<double, std::string>& b) -> bool
-            {
-                return a.first < b.first;
-            }
-        );
+        _captureProgression.push_back(image.timeRange.start);
+
+        ImageSubset& subset = _subsetMap[image.target];
+        subset._range.include(image.timeRange.start);
+        subset._subset.push_back(std::move(image));
     }
 
     for (const std::pair<const std::string, ImageSubset>& target : _subsetMap) {
-        _instrumentTimes.emplace_back(lblName, _subsetMap[target.first]._range);
+        _instrumentTimes.emplace_back(instrumentName, target.second._range);
     }
     return true;
 }
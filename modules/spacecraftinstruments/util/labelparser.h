@@ -28,6 +28,9 @@
 #include <modules/spacecraftinstruments/util/sequenceparser.h>
 
 #include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace openspace {
 
@@ -39,16 +42,35 @@ public:
     bool create() override;
 
 private:
+    /// A capture as it is read from a label file, before its times are converted
+    struct Capture {
+        std::filesystem::path imagePath;
+        std::string target;
+        std::string instrumentID;
+        std::string startTime;
+        std::string stopTime;
+    };
+
+    struct LabelFile {
+        std::vector<Capture> captures;
+        std::string instrumentName;
+    };
+
     std::string encode(const std::string& line) const;
-    std::string decode(const std::string& line);
+    std::string decode(const std::string& line) const;
+
+    /**
+     * Parses a single label file and returns the captures that it describes for the
+     * image at \p imagePath. If \p imagePath is empty, no image is attached to the label
+     * file and no captures are returned.
+     * This function does not access any SPICE functions and can be called concurrently.
+     * Returns `std::nullopt` if the file could not be opened.
+     */
+    std::optional<LabelFile> parseLabelFile(const std::filesystem::path& path,
+        const std::filesystem::path& imagePath) const;
 
     std::filesystem::path _fileName;
     std::vector<std::string> _specsOfInterest;
-
-    std::string _target;
-    std::string _instrumentID;
-    std::string _instrumentHostID;
-    std::string _detectorType;
 };
 
 } // namespace openspace
@@ -26,7 +26,7 @@
 #define __OPENSPACE_MODULE_TOUCH___DIRECTINPUT_SOLVER___H__
 
 #include <openspace/util/touch.h>
-#include <modules/touch/ext/levmarq.h>
+#include <ghoul/glm.h>
 #include <vector>
 
 namespace openspace {
@@ -36,7 +36,10 @@ class SceneGraphNode;
 
 /**
  * The DirectInputSolver is used to minimize the L2 error of touch input to 3D camera
- * position. It uses the levmarq algorithm in order to do this.
+ * position. It uses a Levenberg-Marquardt solver in order to do this, where the Jacobian
+ * of the camera projection is computed exactly using forward-mode automatic
+ * differentiation. The number of iterations is bounded and all intermediate storage lives
+ * on the stack, so a call to #solve does not allocate any memory.
  */
 class DirectInputSolver {
 public:
@@ -50,12 +53,28 @@ public:
         glm::dvec3 coordinates = glm::dvec3(0.0);
     };
 
-    DirectInputSolver();
+    /**
+     * Statistics about the last invocation of the #solve function.
+     */
+    struct Statistics {
+        /// The number of iterations, including rejected steps, that were performed
+        int nIterations = 0;
+        /// The final sum of squared distances in normalized device coordinates
+        double error = 0.0;
+        /// The change in error during the last accepted step
+        double errorChange = 0.0;
+    };
+
+    /// The maximum number of degrees of freedom, which is reached for three fingers
+    static constexpr int MaxDof = 6;
+
+    /// The maximum number of iterations, including rejected steps, of the solver
+    static constexpr int MaxIterations = 50;
 
     /**
-     * Returns true if the error could be minimized within certain bounds. If the error is
-     * found to be outside the bounds after a certain amount of iterations, this function
-     * fails.
+     * Returns true if the error could be minimized within certain bounds, or if the
+     * error was reduced before the solver ran out of iterations. Otherwise the
+     * calculated values should not be used.
      */
     bool solve(const std::vector<TouchInputHolder>& list,
         const std::vector<SelectedBody>& selectedBodies,
@@ -63,13 +82,11 @@ public:
 
     int nDof() const;
 
-    const LMstat& levMarqStat();
-
-    void setLevMarqVerbosity(bool verbose);
+    const Statistics& statistics() const;
 
 private:
     int _nDof = 0;
-    LMstat _lmstat;
+    Statistics _statistics;
 };
 
 } // openspace namespace
@@ -0,0 +1,201 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifndef __OPENSPACE_MODULE_TOUCH___DUALNUMBER___H__
+#define __OPENSPACE_MODULE_TOUCH___DUALNUMBER___H__
+
+#include <array>
+#include <cmath>
+
+namespace openspace {
+
+/**
+ * A dual number for forward-mode automatic differentiation with respect to \p N
+ * variables. Every arithmetic operation propagates the partial derivatives along with
+ * the value, so evaluating a function on dual numbers yields its value together with its
+ * exact gradient. All storage is inline, so no heap allocations take place.
+ */
+template <int N>
+struct Dual {
+    Dual() = default;
+    Dual(double v) : value(v) {} // NOLINT(google-explicit-constructor)
+
+    /**
+     * Creates the dual number for the variable with index \p index, i.e. a number
+     * whose derivative with respect to itself is 1.
+     */
+    static Dual variable(double v, int index) {
+        Dual res = Dual(v);
+        res.derivatives[index] = 1.0;
+        return res;
+    }
+
+    double value = 0.0;
+    std::array<double, N> derivatives = {};
+};
+
+template <int N>
+Dual<N> operator-(const Dual<N>& a) {
+    Dual<N> res;
+    res.value = -a.value;
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] = -a.derivatives[i];
+    }
+    return res;
+}
+
+template <int N>
+Dual<N> operator+(const Dual<N>& a, const Dual<N>& b) {
+    Dual<N> res;
+    res.value = a.value + b.value;
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] = a.derivatives[i] + b.derivatives[i];
+    }
+    return res;
+}
+
+template <int N>
+Dual<N> operator-(const Dual<N>& a, const Dual<N>& b) {
+    Dual<N> res;
+    res.value = a.value - b.value;
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] = a.derivatives[i] - b.derivatives[i];
+    }
+    return res;
+}
+
+template <int N>
+Dual<N> operator*(const Dual<N>& a, const Dual<N>& b) {
+    Dual<N> res;
+    res.value = a.value * b.value;
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] = a.derivatives[i] * b.value + a.value * b.derivatives[i];
+    }
+    return res;
+}
+
+template <int N>
+Dual<N> operator/(const Dual<N>& a, const Dual<N>& b) {
+    Dual<N> res;
+    res.value = a.value / b.value;
+    const double invSquared = 1.0 / (b.value * b.value);
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] =
+            (a.derivatives[i] * b.value - a.value * b.derivatives[i]) * invSquared;
+    }
+    return res;
+}
+
+template <int N>
+Dual<N> operator+(const Dual<N>& a, double b) {
+    Dual<N> res = a;
+    res.value += b;
+    return res;
+}
+
+template <int N>
+Dual<N> operator+(double a, const Dual<N>& b) {
+    return b + a;
+}
+
+template <int N>
+Dual<N> operator-(const Dual<N>& a, double b) {
+    Dual<N> res = a;
+    res.value -= b;
+    return res;
+}
+
+template <int N>
+Dual<N> operator-(double a, const Dual<N>& b) {
+    return -b + a;
+}
+
+template <int N>
+Dual<N> operator*(const Dual<N>& a, double b) {
+    Dual<N> res;
+    res.value = a.value * b;
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] = a.derivatives[i] * b;
+    }
+    return res;
+}
+
+template <int N>
+Dual<N> operator*(double a, const Dual<N>& b) {
+    return b * a;
+}
+
+template <int N>
+Dual<N> operator/(const Dual<N>& a, double b) {
+    return a * (1.0 / b);
+}
+
+template <int N>
+Dual<N> operator/(double a, const Dual<N>& b) {
+    Dual<N> res;
+    res.value = a / b.value;
+    const double factor = -a / (b.value * b.value);
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] = b.derivatives[i] * factor;
+    }
+    return res;
+}
+
+template <int N>
+Dual<N> sqrt(const Dual<N>& a) {
+    const double s = std::sqrt(a.value);
+    Dual<N> res;
+    res.value = s;
+    const double factor = 0.5 / s;
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] = a.derivatives[i] * factor;
+    }
+    return res;
+}
+
+template <int N>
+Dual<N> sin(const Dual<N>& a) {
+    Dual<N> res;
+    res.value = std::sin(a.value);
+    const double c = std::cos(a.value);
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] = a.derivatives[i] * c;
+    }
+    return res;
+}
+
+template <int N>
+Dual<N> cos(const Dual<N>& a) {
+    Dual<N> res;
+    res.value = std::cos(a.value);
+    const double s = -std::sin(a.value);
+    for (int i = 0; i < N; i++) {
+        res.derivatives[i] = a.derivatives[i] * s;
+    }
+    return res;
+}
+
+} // namespace openspace
+
+#endif // __OPENSPACE_MODULE_TOUCH___DUALNUMBER___H__
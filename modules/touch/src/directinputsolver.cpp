@@ -24,189 +24,308 @@
 
 #include <modules/touch/include/touchinteraction.h>
 
+#include <modules/touch/include/dualnumber.h>
 #include <openspace/camera/camera.h>
 #include <openspace/scene/scenegraphnode.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
 
 namespace {
-    // Used in the LM algorithm
-    struct FunctionData {
-        std::vector<glm::dvec3> selectedPoints;
-        std::vector<glm::dvec2> screenPoints;
-        int nDOF;
-        const openspace::Camera* camera;
-        openspace::SceneGraphNode* node;
-        LMstat stats;
+    using openspace::Dual;
+    using openspace::DirectInputSolver;
+
+    constexpr int MaxDof = DirectInputSolver::MaxDof;
+    constexpr int MaxFingers = MaxDof / 2;
+    using D = Dual<MaxDof>;
+
+    // Smallest diagonal value that is accepted in the Cholesky decomposition
+    constexpr double CholeskyTolerance = 1e-30;
+    // The solver stops once an accepted step decreases the error less than this
+    constexpr double TargetErrorChange = 1e-12;
+    constexpr double InitialLambda = 1e-6;
+    constexpr double LambdaUpFactor = 10.0;
+    constexpr double LambdaDownFactor = 0.1;
+
+    struct Vec3 {
+        D x;
+        D y;
+        D z;
     };
-} // namespace
 
-namespace openspace {
+    struct Quat {
+        D w;
+        D x;
+        D y;
+        D z;
+    };
 
-DirectInputSolver::DirectInputSolver() {
-    levmarq_init(&_lmstat);
-}
+    Vec3 toVec3(const glm::dvec3& v) {
+        return { v.x, v.y, v.z };
+    }
 
-// project back a 3D point in model view to clip space [-1,1] coordinates on the view
-// plane
-glm::dvec2 castToNDC(const glm::dvec3& vec, Camera& camera, SceneGraphNode* node) {
-    glm::dvec3 posInCamSpace = glm::inverse(camera.rotationQuaternion()) *
-        (node->worldRotationMatrix() * vec +
-        (node->worldPosition() - camera.positionVec3()));
+    Quat toQuat(const glm::dquat& q) {
+        return { q.w, q.x, q.y, q.z };
+    }
 
-    glm::dvec4 clipspace = camera.projectionMatrix() * glm::dvec4(posInCamSpace, 1.0);
-    return (glm::dvec2(clipspace) / clipspace.w);
-}
+    Vec3 operator+(const Vec3& a, const Vec3& b) {
+        return { a.x + b.x, a.y + b.y, a.z + b.z };
+    }
 
-// Returns the screen point s(xi,par) dependent the transform M(par) and object point xi
-double distToMinimize(double* par, int x, void* fdata, LMstat* lmstat) {
-    FunctionData* ptr = reinterpret_cast<FunctionData*>(fdata);
+    Vec3 operator-(const Vec3& a, const Vec3& b) {
+        return { a.x - b.x, a.y - b.y, a.z - b.z };
+    }
 
-    // Apply transform to camera and find the new screen point of the updated camera state
+    Vec3 operator-(const Vec3& a) {
+        return { -a.x, -a.y, -a.z };
+    }
 
-    // { vec2 globalRot, zoom, roll, vec2 localRot }
-    double q[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
-    for (int i = 0; i < ptr->nDOF; i++) {
-        q[i] = par[i];
+    Vec3 operator*(const Vec3& a, const D& s) {
+        return { a.x * s, a.y * s, a.z * s };
     }
 
-    using namespace glm;
-    // Create variables from current state
-    dvec3 camPos = ptr->camera->positionVec3();
-    dvec3 centerPos = ptr->node->worldPosition();
-
-    dvec3 directionToCenter = normalize(centerPos - camPos);
-    dvec3 lookUp = ptr->camera->lookUpVectorWorldSpace();
-    dvec3 camDirection = ptr->camera->viewDirectionWorldSpace();
-
-    // Make a representation of the rotation quaternion with local and global
-    // rotations
-    dmat4 lookAtMat = lookAt(
-        dvec3(0, 0, 0),
-        directionToCenter,
-        // To avoid problem with lookup in up direction
-        normalize(camDirection + lookUp)
-    );
-    dquat globalCamRot = normalize(quat_cast(inverse(lookAtMat)));
-    dquat localCamRot = inverse(globalCamRot) * ptr->camera->rotationQuaternion();
+    D dot(const Vec3& a, const Vec3& b) {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
 
-    {
-        // Roll
-        dquat rollRot = angleAxis(q[3], dvec3(0.0, 0.0, 1.0));
-        localCamRot = localCamRot * rollRot;
+    Vec3 cross(const Vec3& a, const Vec3& b) {
+        return {
+            a.y * b.z - a.z * b.y,
+            a.z * b.x - a.x * b.z,
+            a.x * b.y - a.y * b.x
+        };
     }
-    {
-        // Panning (local rotation)
-        dvec3 eulerAngles(q[5], q[4], 0);
-        dquat panRot = dquat(eulerAngles);
-        localCamRot = localCamRot * panRot;
+
+    Vec3 normalize(const Vec3& v) {
+        const D invLength = 1.0 / sqrt(dot(v, v));
+        return v * invLength;
+    }
+
+    // Rotates the vector v by the unit quaternion q, equivalent to glm's q * v
+    Vec3 rotate(const Quat& q, const Vec3& v) {
+        const Vec3 u = { q.x, q.y, q.z };
+        const Vec3 t = cross(u, v) * 2.0;
+        return v + t * q.w + cross(u, t);
+    }
+
+    // Rotates the vector v by the inverse of the unit quaternion q
+    Vec3 rotateInverse(const Quat& q, const Vec3& v) {
+        return rotate({ q.w, -q.x, -q.y, -q.z }, v);
+    }
+
+    // Equivalent to glm::dquat(glm::dvec3(pitch, yaw, 0.0))
+    Quat fromEuler(const D& pitch, const D& yaw) {
+        const D cx = cos(pitch * 0.5);
+        const D sx = sin(pitch * 0.5);
+        const D cy = cos(yaw * 0.5);
+        const D sy = sin(yaw * 0.5);
+        return { cx * cy, sx * cy, cx * sy, -(sx * sy) };
+    }
+
+    // Equivalent to glm::angleAxis(angle, glm::dvec3(0.0, 0.0, 1.0))
+    Quat rotationZ(const D& angle) {
+        return { cos(angle * 0.5), 0.0, 0.0, sin(angle * 0.5) };
     }
+
+    // The parts of the camera and scene state that do not depend on the parameters and
+    // are therefore computed only once per call to solve
+    struct FrameData {
+        int nFingers = 0;
+        int nDof = 0;
+        // Rotation of the camera when looking at the center of the node
+        glm::dquat globalCamRot;
+        // Camera rotation relative to globalCamRot
+        glm::dquat localCamRot;
+        // Vector from the node to the camera, expressed in the globalCamRot frame
+        glm::dvec3 centerToCameraLocal = glm::dvec3(0.0);
+        // Up vector used when the camera is facing the center of the node
+        glm::dvec3 lookUp = glm::dvec3(0.0);
+        glm::dmat4 projection = glm::dmat4(1.0);
+        // The selected surface points relative to the center of the node
+        std::array<glm::dvec3, MaxFingers> points;
+        // The touch positions in normalized device coordinates
+        std::array<glm::dvec2, MaxFingers> screenPoints;
+    };
+
+    FrameData createFrameData(const std::vector<openspace::TouchInputHolder>& list,
+                              const std::vector<DirectInputSolver::SelectedBody>& bodies,
+                              const openspace::Camera& camera, int nFingers, int nDof)
     {
-        // Orbit (global rotation)
-        dvec3 eulerAngles(q[1], q[0], 0);
-        dquat rotationDiffCamSpace = dquat(eulerAngles);
-
-        dvec3 centerToCamera = camPos - centerPos;
-
-        dquat rotationDiffWorldSpace =
-            globalCamRot * rotationDiffCamSpace * inverse(globalCamRot);
-        dvec3 rotationDiffVec3 = centerToCamera * rotationDiffWorldSpace - centerToCamera;
-        camPos += rotationDiffVec3;
-
-        centerToCamera = camPos - centerPos;
-        directionToCenter = normalize(-centerToCamera);
-        dvec3 lookUpWhenFacingCenter =
-            globalCamRot * dvec3(ptr->camera->lookUpVectorCameraSpace());
-        lookAtMat = lookAt(
-            dvec3(0, 0, 0),
-            directionToCenter,
-            lookUpWhenFacingCenter
+        using namespace glm;
+
+        const openspace::SceneGraphNode* node = bodies[0].node;
+
+        FrameData data;
+        data.nFingers = nFingers;
+        data.nDof = nDof;
+
+        const dvec3 camPos = camera.positionVec3();
+        const dvec3 centerPos = node->worldPosition();
+
+        // Make a representation of the rotation quaternion with local and global
+        // rotations
+        const dmat4 lookAtMat = lookAt(
+            dvec3(0.0),
+            normalize(centerPos - camPos),
+            // To avoid problem with lookup in up direction
+            normalize(camera.viewDirectionWorldSpace() + camera.lookUpVectorWorldSpace())
         );
-        globalCamRot = normalize(quat_cast(inverse(lookAtMat)));
+        data.globalCamRot = normalize(quat_cast(inverse(lookAtMat)));
+        data.localCamRot = inverse(data.globalCamRot) * camera.rotationQuaternion();
+        data.centerToCameraLocal = inverse(data.globalCamRot) * (camPos - centerPos);
+        data.lookUp = data.globalCamRot * dvec3(camera.lookUpVectorCameraSpace());
+        data.projection = camera.projectionMatrix();
+
+        const dmat3 nodeRotation = node->worldRotationMatrix();
+        for (int i = 0; i < nFingers; i++) {
+            data.points[i] = nodeRotation * bodies[i].coordinates;
+            data.screenPoints[i] = dvec2(
+                2.0 * (list[i].latestInput().x - 0.5),
+                -2.0 * (list[i].latestInput().y - 0.5)
+            );
+        }
+        return data;
     }
-    { // Zooming
-        camPos += directionToCenter * q[2];
+
+    // Applies the transform M(q) to the camera and projects the selected surface points
+    // into normalized device coordinates. The parameters q are
+    // { vec2 globalRot, zoom, roll, vec2 localRot }
+    void project(const FrameData& data, const std::array<D, MaxDof>& q,
+                 std::array<D, 2 * MaxFingers>& result)
+    {
+        // Orbit (global rotation) around the center of the node
+        const Quat orbit = fromEuler(q[1], q[0]);
+        const Vec3 centerToCamera = rotate(
+            toQuat(data.globalCamRot),
+            rotateInverse(orbit, toVec3(data.centerToCameraLocal))
+        );
+
+        // Look-at basis of the new global rotation
+        const Vec3 forward = normalize(-centerToCamera);
+        const Vec3 side = normalize(cross(forward, toVec3(data.lookUp)));
+        const Vec3 up = cross(side, forward);
+
+        // Zooming along the direction towards the center
+        const Vec3 cameraOffset = centerToCamera + forward * q[2];
+
+        // Roll and panning (local rotation)
+        const Quat roll = rotationZ(q[3]);
+        const Quat pan = fromEuler(q[5], q[4]);
+        const Quat local = toQuat(data.localCamRot);
+
+        for (int i = 0; i < data.nFingers; i++) {
+            const Vec3 rel = toVec3(data.points[i]) - cameraOffset;
+            const Vec3 globalSpace = { dot(side, rel), dot(up, rel), -dot(forward, rel) };
+            const Vec3 camSpace = rotateInverse(
+                pan,
+                rotateInverse(roll, rotateInverse(local, globalSpace))
+            );
+
+            const glm::dmat4& p = data.projection;
+            const D clipX = camSpace.x * p[0][0] + camSpace.y * p[1][0] +
+                            camSpace.z * p[2][0] + p[3][0];
+            const D clipY = camSpace.x * p[0][1] + camSpace.y * p[1][1] +
+                            camSpace.z * p[2][1] + p[3][1];
+            const D clipW = camSpace.x * p[0][3] + camSpace.y * p[1][3] +
+                            camSpace.z * p[2][3] + p[3][3];
+            result[2 * i] = clipX / clipW;
+            result[2 * i + 1] = clipY / clipW;
+        }
     }
-    // Update the camera state
-    Camera cam = *(ptr->camera);
-    cam.setPositionVec3(camPos);
-    cam.setRotation(globalCamRot * localCamRot);
-
-    // we now have a new position and orientation of camera, project surfacePoint to
-    // the new screen to get distance to minimize
-    glm::dvec2 newScreenPoint = castToNDC(
-        ptr->selectedPoints.at(x),
-        cam,
-        ptr->node
-    );
-    lmstat->pos.push_back(newScreenPoint);
-    return glm::length(ptr->screenPoints.at(x) - newScreenPoint);
-}
 
-// Gradient of distToMinimize w.r.t par (using forward difference)
-void gradient(double* g, double* par, int x, void* fdata, LMstat* lmstat) {
-    FunctionData* ptr = reinterpret_cast<FunctionData*>(fdata);
-    double f0 = distToMinimize(par, x, fdata, lmstat);
-    // scale value to find minimum step size h, dependant on planet size
-    double scale = log10(ptr->node->interactionSphere());
-    std::vector<double> dPar(ptr->nDOF, 0.0);
-    dPar.assign(par, par + ptr->nDOF);
-
-    for (int i = 0; i < ptr->nDOF; i++) {
-        // Initial values
-        double h = 1e-8;
-        double lastG = 1;
-        dPar.at(i) += h;
-        double f1 = distToMinimize(dPar.data(), x, fdata, lmstat);
-        dPar.at(i) = par[i];
-        // Iterative process to find the minimum step h that gives a good gradient
-        for (int j = 0; j < 100; j++) {
-            if ((f1 - f0) != 0 && lastG == 0) { // found minimum step size h
-                // scale up to get a good initial guess value
-                h *= scale * scale * scale;
-
-                // clamp min step size to a fraction of the incoming parameter
-                if (i == 2) {
-                    double epsilon = 1e-3;
-                    // make sure incoming parameter is larger than 0
-                    h = std::max(std::max(std::abs(dPar.at(i)), epsilon) * 0.001, h);
-                }
-                else if (ptr->nDOF == 2) {
-                    h = std::max(std::abs(dPar.at(i)) * 0.001, h);
-                }
+    // Evaluates the residuals, i.e. the distance between the projected points and the
+    // touch positions, as well as their Jacobian with respect to the active parameters.
+    // Returns the sum of squared residuals
+    double evaluate(const FrameData& data, const std::array<double, MaxDof>& par,
+                    std::array<double, 2 * MaxFingers>& residuals,
+                    std::array<std::array<double, MaxDof>, 2 * MaxFingers>& jacobian)
+    {
+        std::array<D, MaxDof> q;
+        for (int i = 0; i < MaxDof; i++) {
+            q[i] = i < data.nDof ? D::variable(par[i], i) : D(par[i]);
+        }
 
-                // calculate f1 with good h for finite difference
-                dPar[i] += h;
-                f1 = distToMinimize(dPar.data(), x, fdata, lmstat);
-                dPar[i] = par[i];
-                break;
-            }
-            else if ((f1 - f0) != 0 && lastG != 0) {
-                // h too big
-                h /= scale;
-            }
-            else if ((f1 - f0) == 0) {
-                // h too small
-                h *= scale;
+        std::array<D, 2 * MaxFingers> projected;
+        project(data, q, projected);
+
+        double error = 0.0;
+        for (int i = 0; i < data.nFingers; i++) {
+            for (int j = 0; j < 2; j++) {
+                const int r = 2 * i + j;
+                residuals[r] = projected[r].value - data.screenPoints[i][j];
+                jacobian[r] = projected[r].derivatives;
+                error += residuals[r] * residuals[r];
             }
-            lastG = f1 - f0;
-            dPar.at(i) += h;
-            f1 = distToMinimize(dPar.data(), x, fdata, lmstat);
-            dPar.at(i) = par[i];
         }
-        g[i] = (f1 - f0) / h;
+        return error;
     }
-    if (ptr->nDOF == 2) {
-        // normalize on 1 finger case to allow for horizontal/vertical movement
-        for (int i = 0; i < 2; i++) {
-            g[i] = g[i] / std::abs(g[i]);
+
+    // Only computes the sum of squared residuals without any derivatives
+    double evaluateError(const FrameData& data, const std::array<double, MaxDof>& par) {
+        std::array<D, MaxDof> q;
+        for (int i = 0; i < MaxDof; i++) {
+            q[i] = D(par[i]);
+        }
+
+        std::array<D, 2 * MaxFingers> projected;
+        project(data, q, projected);
+
+        double error = 0.0;
+        for (int i = 0; i < data.nFingers; i++) {
+            const double dx = projected[2 * i].value - data.screenPoints[i].x;
+            const double dy = projected[2 * i + 1].value - data.screenPoints[i].y;
+            error += dx * dx + dy * dy;
         }
+        return error;
     }
-    else if (ptr->nDOF == 6) {
-        for (int i = 0; i < ptr->nDOF; i++) {
-            // lock to only pan and zoom on 3 finger case, no roll/orbit
-            g[i] = (i == 2) ? g[i] : g[i] / std::abs(g[i]);
+
+    // Solves a * x = b for the symmetric positive definite n x n matrix a, where only the
+    // lower triangle of a is used. Returns false if the matrix is not positive definite
+    bool solveCholesky(int n, std::array<std::array<double, MaxDof>, MaxDof> a,
+                       const std::array<double, MaxDof>& b,
+                       std::array<double, MaxDof>& x)
+    {
+        // Decomposition a = l * l^T, stored in place in the lower triangle of a
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j <= i; j++) {
+                double sum = a[i][j];
+                for (int k = 0; k < j; k++) {
+                    sum -= a[i][k] * a[j][k];
+                }
+                if (i == j) {
+                    if (sum < CholeskyTolerance) {
+                        return false;
+                    }
+                    a[i][i] = std::sqrt(sum);
+                }
+                else {
+                    a[i][j] = sum / a[j][j];
+                }
+            }
         }
+
+        // Forward substitution l * y = b
+        for (int i = 0; i < n; i++) {
+            double sum = b[i];
+            for (int k = 0; k < i; k++) {
+                sum -= a[i][k] * x[k];
+            }
+            x[i] = sum / a[i][i];
+        }
+
+        // Back substitution l^T * x = y
+        for (int i = n - 1; i >= 0; i--) {
+            double sum = x[i];
+            for (int k = i + 1; k < n; k++) {
+                sum -= a[k][i] * x[k];
+            }
+            x[i] = sum / a[i][i];
+        }
+        return true;
     }
-}
+} // namespace
+
+namespace openspace {
 
 bool DirectInputSolver::solve(const std::vector<TouchInputHolder>& list,
                               const std::vector<SelectedBody>& selectedBodies,
@@ -218,58 +337,105 @@ bool DirectInputSolver::solve(const std::vector<TouchInputHolder>& list,
         selectedBodies.size() >= list.size(),
         "Number of touch inputs must match the number of 'selected bodies'"
     );
+    ghoul_assert(
+        parameters->size() >= MaxDof,
+        "Parameter vector must contain values for all degrees of freedom"
+    );
 
-    int nFingers = std::min(static_cast<int>(list.size()), 3);
-    _nDof = std::min(nFingers * 2, 6);
+    const int nFingers = std::min(static_cast<int>(list.size()), MaxFingers);
+    _nDof = std::min(nFingers * 2, MaxDof);
+    _statistics = Statistics();
 
-    // Parse input data to be used in the LM algorithm
-    std::vector<glm::dvec3> selectedPoints;
-    std::vector<glm::dvec2> screenPoints;
+    const FrameData data = createFrameData(
+        list,
+        selectedBodies,
+        camera,
+        nFingers,
+        _nDof
+    );
+    const int nResiduals = 2 * nFingers;
 
-    for (int i = 0; i < nFingers; i++) {
-        const SelectedBody& sb = selectedBodies.at(i);
-        selectedPoints.push_back(sb.coordinates);
-        screenPoints.emplace_back(
-            2.0 * (list[i].latestInput().x - 0.5),
-            -2.0 * (list[i].latestInput().y - 0.5)
-        );
+    std::array<double, MaxDof> par;
+    for (int i = 0; i < MaxDof; i++) {
+        par[i] = (*parameters)[i];
     }
 
-    FunctionData fData = {
-        .selectedPoints = selectedPoints,
-        .screenPoints = screenPoints,
-        .nDOF = _nDof,
-        .camera = &camera,
-        .node = selectedBodies.at(0).node,
-        .stats = _lmstat
-    };
-    void* dataPtr = reinterpret_cast<void*>(&fData);
-
-    bool result = levmarq(
-        _nDof,
-        parameters->data(),
-        static_cast<int>(screenPoints.size()),
-        nullptr,
-        distToMinimize,
-        gradient,
-        dataPtr,
-        &_lmstat
-    );
+    std::array<double, 2 * MaxFingers> residuals = {};
+    std::array<std::array<double, MaxDof>, 2 * MaxFingers> jacobian = {};
+    std::array<std::array<double, MaxDof>, MaxDof> hessian = {};
+    std::array<double, MaxDof> gradient = {};
+    std::array<double, MaxDof> delta = {};
+    std::array<double, MaxDof> newPar = par;
+
+    double lambda = InitialLambda;
+    double error = evaluate(data, par, residuals, jacobian);
+    const double initialError = error;
+    bool hasConverged = false;
+    int it = 0;
+    while (it < MaxIterations && !hasConverged) {
+        // Gauss-Newton approximation of the Hessian J^T * J and the gradient -J^T * r
+        for (int i = 0; i < _nDof; i++) {
+            gradient[i] = 0.0;
+            for (int j = 0; j <= i; j++) {
+                hessian[i][j] = 0.0;
+            }
+        }
+        for (int r = 0; r < nResiduals; r++) {
+            for (int i = 0; i < _nDof; i++) {
+                gradient[i] -= jacobian[r][i] * residuals[r];
+                for (int j = 0; j <= i; j++) {
+                    hessian[i][j] += jacobian[r][i] * jacobian[r][j];
+                }
+            }
+        }
+
+        // Make a step with Marquardt's diagonal damping. If the step is rejected,
+        // increase the damping and try again
+        bool isAccepted = false;
+        while (!isAccepted && it < MaxIterations) {
+            it++;
+            std::array<std::array<double, MaxDof>, MaxDof> damped = hessian;
+            for (int i = 0; i < _nDof; i++) {
+                damped[i][i] *= 1.0 + lambda;
+            }
 
-    return result;
+            if (solveCholesky(_nDof, damped, gradient, delta)) {
+                for (int i = 0; i < _nDof; i++) {
+                    newPar[i] = par[i] + delta[i];
+                }
+                const double newError = evaluateError(data, newPar);
+                const double errorChange = newError - error;
+                if (errorChange <= 0.0) {
+                    isAccepted = true;
+                    par = newPar;
+                    error = evaluate(data, par, residuals, jacobian);
+                    lambda *= LambdaDownFactor;
+                    hasConverged = -errorChange < TargetErrorChange;
+                    _statistics.errorChange = errorChange;
+                    continue;
+                }
+            }
+            lambda *= LambdaUpFactor;
+        }
+    }
+
+    _statistics.nIterations = it;
+    _statistics.error = error;
+
+    for (int i = 0; i < _nDof; i++) {
+        (*parameters)[i] = par[i];
+    }
+    // The solver stops early only if it converged. If it ran out of iterations, the
+    // solution is still used if it moves the selected bodies closer to the fingers
+    return hasConverged || error < initialError;
 }
 
 int DirectInputSolver::nDof() const {
     return _nDof;
 }
 
-const LMstat& DirectInputSolver::levMarqStat() {
-    return _lmstat;
-}
-
-void DirectInputSolver::setLevMarqVerbosity(bool verbose) {
-    _lmstat.verbose = verbose;
+const DirectInputSolver::Statistics& DirectInputSolver::statistics() const {
+    return _statistics;
 }
 
 } // openspace namespace
-
@@ -49,6 +49,16 @@ public:
     virtual glm::ivec3 dimensions() const;
     void setPaths(std::vector<std::string> paths);
 
+    /**
+     * Loads all slices in the range [\p firstSlice, \p lastSlice] that are not cached
+     * yet. The image files are read on \p nThreads threads, while the textures are
+     * created on the calling thread. The slices that are already cached are marked as
+     * recently used. Once this function returns, calls to #get for the prefetched slices
+     * do not modify the cache and can thus be made from multiple threads concurrently,
+     * as long as the range fits into the cache.
+     */
+    void prefetchSlices(int firstSlice, int lastSlice, size_t nThreads);
+
 private:
     ghoul::opengl::Texture& getSlice(int sliceIndex) const;
     std::vector<std::string> _paths;
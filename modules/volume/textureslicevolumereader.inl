@@ -22,8 +22,17 @@
  * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
  ****************************************************************************************/
 
+#include <ghoul/format.h>
 #include <ghoul/io/texture/texturereader.h>
+#include <ghoul/misc/exception.h>
 #include <ghoul/opengl/texture.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <thread>
 
 namespace openspace::volume {
 
@@ -68,6 +77,95 @@ void TextureSliceVolumeReader<VoxelType>::setPaths(std::vector<std::string> path
     _paths = std::move(paths);
 }
 
+template <typename VoxelType>
+void TextureSliceVolumeReader<VoxelType>::prefetchSlices(int firstSlice, int lastSlice,
+                                                         size_t nThreads)
+{
+    ghoul_assert(_isInitialized, "Volume is not initialized");
+    ghoul_assert(
+        firstSlice >= 0 && lastSlice < static_cast<int>(_paths.size()),
+        "Slice range is outside the volume"
+    );
+    ghoul_assert(
+        lastSlice - firstSlice < static_cast<int>(_cache.capacity()),
+        "Slice range does not fit into the cache"
+    );
+
+    std::vector<int> missing;
+    for (int i = firstSlice; i <= lastSlice; i++) {
+        if (_cache.has(i)) {
+            _cache.use(i);
+        }
+        else {
+            missing.push_back(i);
+        }
+    }
+    if (missing.empty()) {
+        return;
+    }
+
+    // Only the file contents are read on the worker threads, as creating the textures
+    // requires the thread that owns the OpenGL context
+    std::vector<std::vector<std::byte>> files(missing.size());
+    std::vector<std::exception_ptr> errors(missing.size());
+    std::atomic<size_t> next = 0;
+    auto read = [this, &missing, &files, &errors, &next]() {
+        for (size_t i = next++; i < missing.size(); i = next++) {
+            try {
+                const std::filesystem::path path = _paths[missing[i]];
+                std::ifstream file = std::ifstream(path, std::ios::binary);
+                if (!file.good()) {
+                    throw ghoul::RuntimeError(
+                        std::format("Could not open slice '{}'", path)
+                    );
+                }
+                files[i].resize(std::filesystem::file_size(path));
+                file.read(reinterpret_cast<char*>(files[i].data()), files[i].size());
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const size_t nWorkers = std::clamp<size_t>(nThreads, 1, missing.size());
+    for (size_t i = 1; i < nWorkers; i++) {
+        threads.emplace_back(read);
+    }
+    read();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < missing.size(); i++) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+
+        const std::filesystem::path path = _paths[missing[i]];
+        std::string format = path.extension().string();
+        if (!format.empty()) {
+            // Remove the leading '.' from the extension
+            format = format.substr(1);
+        }
+        std::shared_ptr<ghoul::opengl::Texture> texture =
+            ghoul::io::TextureReader::ref().loadTexture(
+                files[i].data(),
+                files[i].size(),
+                2,
+                format
+            );
+        files[i] = std::vector<std::byte>();
+
+        ghoul_assert(
+            glm::ivec2(texture->dimensions()) == _sliceDimensions,
+            "Slice dimensions do not agree"
+        );
+        _cache.set(missing[i], std::move(texture));
+    }
+}
+
 template <typename VoxelType>
 ghoul::opengl::Texture&
 TextureSliceVolumeReader<VoxelType>::getSlice(int sliceIndex) const
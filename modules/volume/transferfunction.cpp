@@ -27,7 +27,10 @@
 #include <ghoul/lua/ghoul_lua.h>
 #include <ghoul/misc/dictionaryluaformatter.h>
 #include <ghoul/opengl/texture.h>
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <vector>
 
 using json = nlohmann::json;
 
@@ -194,37 +197,50 @@ bool TransferFunction::createTexture(ghoul::opengl::Texture& ptr) {
     if (_envelopes.empty()) {
         return false;
     }
-    else {
-        float* transferFunction = new float[_width * 4];
-        std::memset(transferFunction, 0, _width * 4 * sizeof(float));
-
-        for (int i = 0; i < _width ; i++) {
-            const float position = static_cast<float>(i) / static_cast<float>(_width);
-            int count = 0;
-            glm::vec4 rgbFromEnvelopes(0.f);
-            float alpha = 0.f;
-            for (const Envelope& env : _envelopes) {
-                if (env.isValueInEnvelope(position) && env.isEnvelopeValid()) {
-                    count++;
-                    const glm::vec4 tmp = env.valueAtPosition(position);
-                    rgbFromEnvelopes.r += tmp.r * tmp.a;
-                    rgbFromEnvelopes.g += tmp.g * tmp.a;
-                    rgbFromEnvelopes.b += tmp.b * tmp.a;
-                    alpha = std::min(alpha, tmp.a);
-                }
-            }
-            rgbFromEnvelopes /= (count == 0) ? 1.f : static_cast<float>(count);
-            rgbFromEnvelopes.w = alpha;
 
-            for (int channel = 0; channel < 4; ++channel) {
-                const int p = 4 * i + channel;
-                const float value = rgbFromEnvelopes[channel];
-                transferFunction[p] = value;
+    // Each envelope is only evaluated for the texels that it covers, rather than
+    // checking every envelope for every texel
+    std::vector<glm::vec3> rgb = std::vector<glm::vec3>(_width, glm::vec3(0.f));
+    std::vector<int> counts = std::vector<int>(_width, 0);
+    std::vector<float> alphas = std::vector<float>(_width, 0.f);
+    const float width = static_cast<float>(_width);
+    for (const Envelope& env : _envelopes) {
+        if (env.points().empty() || !env.isEnvelopeValid()) {
+            continue;
+        }
+
+        // The range is extended by one texel in each direction to account for rounding
+        // and the exact test is done per texel
+        const int first = std::max(
+            static_cast<int>(std::floor(env.points().front().position.first * width)) - 1,
+            0
+        );
+        const int last = std::min(
+            static_cast<int>(std::ceil(env.points().back().position.first * width)) + 1,
+            _width - 1
+        );
+        for (int i = first; i <= last; i++) {
+            const float position = static_cast<float>(i) / width;
+            if (!env.isValueInEnvelope(position)) {
+                continue;
             }
+            counts[i]++;
+            const glm::vec4 tmp = env.valueAtPosition(position);
+            rgb[i] += glm::vec3(tmp) * tmp.a;
+            alphas[i] = std::min(alphas[i], tmp.a);
         }
-        ptr.setPixelData(transferFunction);
-        return true;
     }
+
+    float* transferFunction = new float[_width * 4];
+    for (int i = 0; i < _width; i++) {
+        const float count = counts[i] == 0 ? 1.f : static_cast<float>(counts[i]);
+        transferFunction[4 * i] = rgb[i].r / count;
+        transferFunction[4 * i + 1] = rgb[i].g / count;
+        transferFunction[4 * i + 2] = rgb[i].b / count;
+        transferFunction[4 * i + 3] = alphas[i];
+    }
+    ptr.setPixelData(transferFunction);
+    return true;
 }
 
 } // namespace openspace::volume
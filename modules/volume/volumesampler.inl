@@ -50,39 +50,36 @@ typename VolumeType::VoxelType VolumeSampler<VolumeType>::sample(
     const glm::ivec3 maxCoords = minCoords + _filterSize;
     const glm::ivec3 clampCeiling = _volume->dimensions() - glm::ivec3(1);
 
-    typename VolumeType::VoxelType value;
+    // The filter is separable, so the weight of a sample is the product of one weight
+    // per axis. Only the first and last sample along each axis are partially weighted
+    auto weight = [](int i, int min, int max, float frac) {
+        if (i == min) {
+            return 1.f - frac;
+        }
+        else if (i == max) {
+            return frac;
+        }
+        return 1.f;
+    };
+
+    using Voxel = typename VolumeType::VoxelType;
+    Voxel value = Voxel(0);
     for (int z = minCoords.z; z <= maxCoords.z; z++) {
+        const float wz = weight(z, minCoords.z, maxCoords.z, t.z);
+        const int cz = glm::clamp(z, 0, clampCeiling.z);
         for (int y = minCoords.y; y <= maxCoords.y; y++) {
-            for (int x = minCoords.x; x <= maxCoords.x; x++) {
-                const glm::ivec3 sampleCoords = glm::ivec3(x, y, z);
-                float filterCoefficient = 1.f;
-
-                if (x == minCoords.x) {
-                    filterCoefficient *= (1.f - t.x);
-                }
-                else if (x == maxCoords.x) {
-                    filterCoefficient *= t.x;
-                }
-                if (y == minCoords.y) {
-                    filterCoefficient *= (1.f - t.y);
-                }
-                else if (y == maxCoords.y) {
-                    filterCoefficient *= t.y;
-                }
-                if (z == minCoords.z) {
-                    filterCoefficient *= (1.f - t.z);
-                }
-                else if (z == maxCoords.z) {
-                    filterCoefficient *= t.z;
-                }
+            const float wzy = wz * weight(y, minCoords.y, maxCoords.y, t.y);
+            const int cy = glm::clamp(y, 0, clampCeiling.y);
 
-                glm::ivec3 clampedCoords = glm::clamp(
-                    sampleCoords,
-                    glm::ivec3(0),
-                    clampCeiling
-                );
-                value += filterCoefficient * _volume->get(clampedCoords);
+            // Accumulate the row with the x weights first so that the combined y and z
+            // weight only has to be applied once per row
+            Voxel row = Voxel(0);
+            for (int x = minCoords.x; x <= maxCoords.x; x++) {
+                const float wx = weight(x, minCoords.x, maxCoords.x, t.x);
+                const int cx = glm::clamp(x, 0, clampCeiling.x);
+                row += wx * _volume->get(glm::ivec3(cx, cy, cz));
             }
+            value += wzy * row;
         }
     }
 
@@ -40,7 +40,7 @@
 #include <string_view>
 
 namespace {
-    constexpr int8_t DataCacheFileVersion = 13;
+    constexpr int8_t DataCacheFileVersion = 14;
     constexpr int8_t LabelCacheFileVersion = 11;
     constexpr int8_t ColorCacheFileVersion = 11;
 
@@ -144,6 +144,11 @@ Dataset loadFile(std::filesystem::path path, std::optional<DataMapping> specs) {
         ));
     }
 
+    res.bounds = computeBoundingVolume(
+        res.entries.size(),
+        [&res](size_t i) { return glm::dvec3(res.entries[i].position); }
+    );
+
     return res;
 }
 
@@ -297,6 +302,14 @@ std::optional<Dataset> loadCachedFile(const std::filesystem::path& path) {
     file.read(reinterpret_cast<char*>(&max), sizeof(float));
     result.maxPositionComponent = max;
 
+    //
+    // Read bounding volume
+    file.read(reinterpret_cast<char*>(&result.bounds.minimum.x), 3 * sizeof(double));
+    file.read(reinterpret_cast<char*>(&result.bounds.maximum.x), 3 * sizeof(double));
+    file.read(reinterpret_cast<char*>(&result.bounds.center.x), 3 * sizeof(double));
+    file.read(reinterpret_cast<char*>(&result.bounds.radius), sizeof(double));
+    file.read(reinterpret_cast<char*>(&result.bounds.originRadius), sizeof(double));
+
     return result;
 }
 
@@ -404,6 +417,15 @@ void saveCachedFile(const Dataset& dataset, const std::filesystem::path& path) {
         reinterpret_cast<const char*>(&dataset.maxPositionComponent),
         sizeof(float)
     );
+
+    //
+    // Store bounding volume
+    const BoundingVolume& bounds = dataset.bounds;
+    file.write(reinterpret_cast<const char*>(&bounds.minimum.x), 3 * sizeof(double));
+    file.write(reinterpret_cast<const char*>(&bounds.maximum.x), 3 * sizeof(double));
+    file.write(reinterpret_cast<const char*>(&bounds.center.x), 3 * sizeof(double));
+    file.write(reinterpret_cast<const char*>(&bounds.radius), sizeof(double));
+    file.write(reinterpret_cast<const char*>(&bounds.originRadius), sizeof(double));
 }
 
 Dataset loadFileWithCache(std::filesystem::path path, std::optional<DataMapping> specs) {
@@ -0,0 +1,310 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/documentation/compiledspecification.h>
+
+#include <openspace/documentation/documentation.h>
+#include <openspace/documentation/verifier.h>
+#include <ghoul/format.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/dictionary.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <typeinfo>
+
+namespace {
+    constexpr std::string_view _loggerCat = "CompiledSpecification";
+
+    std::mutex CacheMutex;
+    std::map<
+        std::string,
+        std::unique_ptr<openspace::documentation::CompiledSpecification>,
+        std::less<>
+    > Cache;
+
+    void combineHash(size_t& hash, size_t value) {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+
+    // Hashes everything in the entries that influences the result of a test, including
+    // the entries of nested tables, so that two Documentations with the same identifier
+    // but a different specification are not mistaken for each other
+    void hashEntries(const std::vector<openspace::documentation::DocumentationEntry>& es,
+                     size_t& hash)
+    {
+        using namespace openspace::documentation;
+
+        combineHash(hash, es.size());
+        for (const DocumentationEntry& entry : es) {
+            const Verifier& verifier = *entry.verifier;
+            combineHash(hash, std::hash<std::string>{}(entry.key));
+            combineHash(hash, static_cast<size_t>(static_cast<bool>(entry.optional)));
+            combineHash(hash, typeid(verifier).hash_code());
+            // The documentation of a Verifier describes its parameters, for example the
+            // range of an InRangeVerifier
+            combineHash(hash, std::hash<std::string>{}(verifier.documentation()));
+
+            if (const TableVerifier* t = dynamic_cast<const TableVerifier*>(&verifier)) {
+                combineHash(hash, static_cast<size_t>(t->count.value_or(-1)));
+                hashEntries(t->documentations, hash);
+            }
+            else if (const StringVerifier* s =
+                         dynamic_cast<const StringVerifier*>(&verifier))
+            {
+                combineHash(hash, static_cast<size_t>(s->mustBeNotEmpty()));
+            }
+        }
+    }
+
+    size_t hashDocumentation(const openspace::documentation::Documentation& doc) {
+        size_t hash = std::hash<std::string>{}(doc.id);
+        hashEntries(doc.entries, hash);
+        return hash;
+    }
+} // namespace
+
+namespace openspace::documentation {
+
+CompiledSpecification::CompiledSpecification(const Documentation& documentation)
+    : _identifier(documentation.id)
+    , _hash(hashDocumentation(documentation))
+{
+    compile(documentation.entries);
+}
+
+void CompiledSpecification::compile(const std::vector<DocumentationEntry>& entries) {
+    for (const DocumentationEntry& entry : entries) {
+        const size_t index = _checks.size();
+
+        Check check = {
+            .key = entry.key,
+            .isOptional = static_cast<bool>(entry.optional),
+            .isWildcard = entry.key == DocumentationEntry::Wildcard
+        };
+
+        // Only the exact types are handled directly as subclasses are free to add more
+        // requirements in their call operator
+        const Verifier& verifier = *entry.verifier;
+        const std::type_info& type = typeid(verifier);
+        if (type == typeid(BoolVerifier)) {
+            check.kind = Check::Kind::Bool;
+        }
+        else if (type == typeid(IntVerifier)) {
+            check.kind = Check::Kind::Int;
+        }
+        else if (type == typeid(DoubleVerifier)) {
+            check.kind = Check::Kind::Double;
+        }
+        else if (type == typeid(StringVerifier)) {
+            check.kind = Check::Kind::String;
+            check.mustBeNotEmpty =
+                static_cast<const StringVerifier&>(verifier).mustBeNotEmpty();
+        }
+        else if (type == typeid(TableVerifier) || type == typeid(StringListVerifier) ||
+                 type == typeid(IntListVerifier))
+        {
+            const TableVerifier& table = static_cast<const TableVerifier&>(verifier);
+            check.kind = Check::Kind::Table;
+            check.count = table.count;
+            _checks.push_back(std::move(check));
+
+            // The checks for the nested table directly follow the table's check
+            compile(table.documentations);
+            _checks[index].nNested = static_cast<uint32_t>(_checks.size() - index - 1);
+            continue;
+        }
+        else {
+            check.kind = Check::Kind::Verifier;
+            check.verifier = entry.verifier;
+        }
+        _checks.push_back(std::move(check));
+    }
+}
+
+bool CompiledSpecification::test(const ghoul::Dictionary& dictionary) const {
+    return test(dictionary, 0, _checks.size());
+}
+
+bool CompiledSpecification::test(const ghoul::Dictionary& dictionary, size_t begin,
+                                 size_t end) const
+{
+    for (size_t i = begin; i < end; i += 1 + _checks[i].nNested) {
+        const Check& check = _checks[i];
+        if (check.isWildcard) {
+            for (const std::string_view key : dictionary.keys()) {
+                if (!test(dictionary, i, key)) {
+                    return false;
+                }
+            }
+        }
+        else {
+            if (!dictionary.hasKey(check.key)) {
+                // If the key is optional and it doesn't exist, we don't need to check it
+                // if the key exists, it has to be correct, however
+                if (check.isOptional) {
+                    continue;
+                }
+                return false;
+            }
+            if (!test(dictionary, i, check.key)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool CompiledSpecification::test(const ghoul::Dictionary& dictionary, size_t index,
+                                 std::string_view key) const
+{
+    const Check& check = _checks[index];
+    switch (check.kind) {
+        case Check::Kind::Bool:
+            return dictionary.hasValue<bool>(key);
+        case Check::Kind::Int:
+            if (dictionary.hasValue<int>(key)) {
+                return true;
+            }
+            else if (dictionary.hasValue<double>(key)) {
+                // A double value is accepted as long as it is an integer
+                double intPart = 0.0;
+                return std::modf(dictionary.value<double>(key), &intPart) == 0.0;
+            }
+            else {
+                return false;
+            }
+        case Check::Kind::Double:
+            return dictionary.hasValue<double>(key);
+        case Check::Kind::String:
+            if (!dictionary.hasValue<std::string>(key)) {
+                return false;
+            }
+            return !check.mustBeNotEmpty || !dictionary.value<std::string>(key).empty();
+        case Check::Kind::Table:
+        {
+            if (!dictionary.hasValue<ghoul::Dictionary>(key)) {
+                return false;
+            }
+            const ghoul::Dictionary table = dictionary.value<ghoul::Dictionary>(key);
+            if (check.count.has_value() &&
+                table.size() != static_cast<size_t>(*check.count))
+            {
+                return false;
+            }
+            return test(table, index + 1, index + 1 + check.nNested);
+        }
+        case Check::Kind::Verifier:
+            return (*check.verifier)(dictionary, std::string(key)).success;
+        default:
+            throw ghoul::MissingCaseException();
+    }
+}
+
+bool CompiledSpecification::matches(const Documentation& documentation) const {
+    return documentation.id == _identifier && hashDocumentation(documentation) == _hash;
+}
+
+void CompiledSpecification::recordTest(std::chrono::nanoseconds duration,
+                                       bool success) const
+{
+    _nTests++;
+    if (!success) {
+        _nFailures++;
+    }
+    _totalTime += duration.count();
+}
+
+const std::string& CompiledSpecification::identifier() const {
+    return _identifier;
+}
+
+uint64_t CompiledSpecification::nTests() const {
+    return _nTests;
+}
+
+uint64_t CompiledSpecification::nFailures() const {
+    return _nFailures;
+}
+
+std::chrono::nanoseconds CompiledSpecification::totalTime() const {
+    return std::chrono::nanoseconds(_totalTime);
+}
+
+const CompiledSpecification* compiledSpecification(const Documentation& documentation) {
+    if (documentation.id.empty()) {
+        return nullptr;
+    }
+
+    const CompiledSpecification* spec = nullptr;
+    {
+        const std::lock_guard lock(CacheMutex);
+        auto it = Cache.find(documentation.id);
+        if (it == Cache.end()) {
+            it = Cache.emplace(
+                documentation.id,
+                std::make_unique<CompiledSpecification>(documentation)
+            ).first;
+        }
+        spec = it->second.get();
+    }
+
+    // The compiled specifications are never removed from the cache, so it is safe to
+    // use the pointer without holding the lock
+    return spec->matches(documentation) ? spec : nullptr;
+}
+
+void logSpecificationTimings() {
+    std::vector<const CompiledSpecification*> specs;
+    {
+        const std::lock_guard lock(CacheMutex);
+        specs.reserve(Cache.size());
+        for (const auto& [id, spec] : Cache) {
+            if (spec->nTests() > 0) {
+                specs.push_back(spec.get());
+            }
+        }
+    }
+
+    std::sort(
+        specs.begin(),
+        specs.end(),
+        [](const CompiledSpecification* lhs, const CompiledSpecification* rhs) {
+            return lhs->totalTime() > rhs->totalTime();
+        }
+    );
+
+    for (const CompiledSpecification* spec : specs) {
+        using namespace std::chrono;
+        LDEBUG(std::format(
+            "{}: {} tests, {} failed, {:.3f} ms",
+            spec->identifier(), spec->nTests(), spec->nFailures(),
+            duration_cast<duration<double, std::milli>>(spec->totalTime()).count()
+        ));
+    }
+}
+
+} // namespace openspace::documentation
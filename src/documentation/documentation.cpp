@@ -24,9 +24,11 @@
 
 #include <openspace/documentation/documentation.h>
 
+#include <openspace/documentation/compiledspecification.h>
 #include <openspace/documentation/verifier.h>
 #include <ghoul/misc/dictionary.h>
 #include <algorithm>
+#include <chrono>
 #include <set>
 
 namespace {
@@ -201,8 +203,8 @@ TestResult testSpecification(const Documentation& documentation,
     TestResult result;
     result.success = true;
 
-    auto applyVerifier = [dictionary, &result](const Verifier& verifier,
-                                               const std::string& key)
+    auto applyVerifier = [&dictionary, &result](const Verifier& verifier,
+                                                const std::string& key)
     {
         TestResult res = verifier(dictionary, key);
         if (!res.success) {
@@ -266,6 +268,23 @@ TestResult testSpecification(const Documentation& documentation,
 void testSpecificationAndThrow(const Documentation& documentation,
                                const ghoul::Dictionary& dictionary, std::string component)
 {
+    // Most dictionaries adhere to their specification, so we first run the compiled
+    // version that does not collect any offenses and only run the full test to create
+    // the error message if that one fails
+    const CompiledSpecification* spec = compiledSpecification(documentation);
+    if (spec) {
+        const auto begin = std::chrono::steady_clock::now();
+        const bool success = spec->test(dictionary);
+        const auto end = std::chrono::steady_clock::now();
+        spec->recordTest(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin),
+            success
+        );
+        if (success) {
+            return;
+        }
+    }
+
     // Perform testing against the documentation/specification
     const TestResult testResult = testSpecification(documentation, dictionary);
     if (!testResult.success) {
@@ -720,4 +720,14 @@ void DocumentationEngine::addDocumentation(Documentation documentation) {
 std::vector<Documentation> DocumentationEngine::documentations() const {
     return _documentations;
 }
+
+const Documentation* DocumentationEngine::documentation(std::string_view identifier) const
+{
+    auto it = std::find_if(
+        _documentations.cbegin(),
+        _documentations.cend(),
+        [identifier](const Documentation& d) { return d.id == identifier; }
+    );
+    return it != _documentations.cend() ? &*it : nullptr;
+}
 } // namespace openspace::documentation
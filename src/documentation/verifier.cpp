@@ -730,15 +730,8 @@ TestResult ReferencingVerifier::operator()(const ghoul::Dictionary& dictionary,
 {
     TestResult res = TableVerifier::operator()(dictionary, key);
     if (res.success) {
-        std::vector<Documentation> docs = DocEng.documentations();
-
-        auto it = std::find_if(
-            docs.begin(),
-            docs.end(),
-            [this](const Documentation& doc) { return doc.id == identifier; }
-        );
-
-        if (it == docs.end()) {
+        const Documentation* doc = DocEng.documentation(identifier);
+        if (!doc) {
             res.success = false;
             TestResult::Offense o = {
                 .offender = key,
@@ -749,7 +742,7 @@ TestResult ReferencingVerifier::operator()(const ghoul::Dictionary& dictionary,
         }
 
         const ghoul::Dictionary d = dictionary.value<ghoul::Dictionary>(key);
-        TestResult r = testSpecification(*it, d);
+        TestResult r = testSpecification(*doc, d);
 
         // Add the 'key' as a prefix to make the offender a fully qualified identifer
         for (TestResult::Offense& s : r.offenses) {
@@ -789,21 +782,18 @@ OrVerifier::OrVerifier(
 TestResult OrVerifier::operator()(const ghoul::Dictionary& dictionary,
                                   const std::string& key) const
 {
-    std::vector<TestResult> res(values.size());
-    std::transform(
-        values.cbegin(),
-        values.cend(),
-        res.begin(),
-        [dictionary, key](const std::shared_ptr<Verifier>& v) {
-            return v->operator()(dictionary, key);
+    // We can stop at the first verifier that succeeds and only need to keep the
+    // results around if all of them fail to report the reason
+    std::vector<TestResult> res;
+    bool success = false;
+    for (const std::shared_ptr<Verifier>& v : values) {
+        TestResult r = v->operator()(dictionary, key);
+        if (r.success) {
+            success = true;
+            break;
         }
-    );
-
-    const bool success = std::any_of(
-        res.cbegin(),
-        res.cend(),
-        std::mem_fn(&TestResult::success)
-    );
+        res.push_back(std::move(r));
+    }
 
     if (success) {
         TestResult r = {
@@ -32,22 +32,87 @@
 #include <ghoul/misc/stringhelper.h>
 #include <ghoul/misc/thread.h>
 #include <curl/curl.h>
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <filesystem>
+#include <map>
 #include <sstream>
 #include <thread>
+#include <utility>
 
 namespace {
     constexpr std::string_view _loggerCat = "DownloadManager";
 
+    // The longest time the transfer thread waits for activity on its connections before
+    // checking for new, finished, or cancelled transfers
+    constexpr int PollTimeout = 10;
+
+    // The longest time the transfer thread sleeps when there are no active transfers. New
+    // transfers wake it up immediately, but cancellations of queued transfers do not
+    constexpr std::chrono::milliseconds IdleTimeout = std::chrono::milliseconds(100);
+
+    // The maximum number of handles that are kept around for reuse
+    constexpr size_t MaxIdleHandles = 16;
+
+    struct FileTarget {
+        FILE* file = nullptr;
+        std::filesystem::path path;
+        CURL* handle = nullptr;
+        // The size of the partial file if the download is resumed
+        curl_off_t resumeFrom = 0;
+        bool hasCheckedResponse = false;
+        // Set if the response to a resumed download is not part of the file
+        bool shouldDiscard = false;
+    };
+
     struct ProgressInformation {
         std::shared_ptr<openspace::DownloadManager::FileFuture> future;
         std::chrono::system_clock::time_point startTime;
         const openspace::DownloadManager::DownloadProgressCallback* callback;
+        // The file that is written, which is used to account for a resumed download
+        const FileTarget* target = nullptr;
     };
 
-    size_t writeData(void* ptr, size_t size, size_t nmemb, FILE* stream) {
-        const size_t written = fwrite(ptr, size, nmemb, stream);
+    std::string hostFromUrl(std::string_view url) {
+        const size_t schemeEnd = url.find("://");
+        if (schemeEnd != std::string_view::npos) {
+            url.remove_prefix(schemeEnd + 3);
+        }
+        const size_t hostEnd = url.find_first_of("/?#");
+        return std::string(url.substr(0, hostEnd));
+    }
+
+    size_t writeData(void* ptr, size_t size, size_t nmemb, FileTarget* target) {
+        if (!target->hasCheckedResponse) {
+            target->hasCheckedResponse = true;
+
+            long code = 0;
+            curl_easy_getinfo(target->handle, CURLINFO_RESPONSE_CODE, &code);
+            if (target->resumeFrom > 0 && code == 200) {
+                // The server ignored the range request and sends the whole file, so we
+                // have to start over
+                const std::string f = target->path.string();
+                fclose(target->file);
+                target->file = fopen(f.c_str(), "wb");
+                target->resumeFrom = 0;
+                if (!target->file) {
+                    return 0;
+                }
+            }
+            else if (target->resumeFrom > 0 && code != 206) {
+                // The body of any other response, for example the error page that comes
+                // with a 416 if the file is already complete, must not end up in the
+                // partial file
+                target->shouldDiscard = true;
+            }
+        }
+
+        if (target->shouldDiscard) {
+            return size * nmemb;
+        }
+
+        const size_t written = fwrite(ptr, size, nmemb, target->file);
         return written;
     }
 
@@ -83,16 +148,20 @@ namespace {
             return 1;
         }
 
-        i->future->currentSize = dlnow;
-        i->future->totalSize = dltotal;
-        i->future->progress = static_cast<float>(dlnow) / static_cast<float>(dltotal);
+        const curl_off_t offset = i->target ? i->target->resumeFrom : 0;
+        i->future->currentSize = offset + dlnow;
+        i->future->totalSize = offset + dltotal;
+        i->future->progress =
+            static_cast<float>(i->future->currentSize) /
+            static_cast<float>(i->future->totalSize);
 
         auto now = std::chrono::system_clock::now();
 
         // Compute time spent transferring.
         auto transferTime = now - i->startTime;
-        // Compute estimated transfer time.
-        auto estimatedTime = transferTime / i->future->progress;
+        // Compute estimated transfer time, only counting the bytes of this transfer
+        auto estimatedTime =
+            transferTime / (static_cast<float>(dlnow) / static_cast<float>(dltotal));
         // Compute estimated time remaining.
         auto timeRemaining = estimatedTime - transferTime;
 
@@ -112,14 +181,227 @@ namespace {
 
 namespace openspace {
 
+// A single request that is waiting for or in the process of being transferred. The
+// request-specific behavior is provided by the callbacks, so that the transfer thread
+// only has to deal with the scheduling
+struct DownloadManager::Transfer {
+    std::string url;
+    std::string host;
+    Priority priority = Priority::Normal;
+    // Used to start transfers with the same priority in the order they were requested
+    uint64_t sequence = 0;
+
+    // Sets all request-specific options on the handle, except for the URL
+    std::function<void(CURL*)> configure;
+    // Called on the transfer thread after the transfer finished, failed, or was
+    // cancelled. The handle is still valid during the call
+    std::function<void(CURL*, CURLcode)> finish;
+    // Optional check that is polled while the transfer is waiting or active
+    std::function<bool()> isCancelled;
+};
+
 DownloadManager::FileFuture::FileFuture(std::filesystem::path file)
     : filePath(std::move(file))
 {}
 
 DownloadManager::DownloadManager(UseMultipleThreads useMultipleThreads)
+    : DownloadManager(useMultipleThreads, Limits())
+{}
+
+DownloadManager::DownloadManager(UseMultipleThreads useMultipleThreads, Limits limits)
     : _useMultithreadedDownload(useMultipleThreads)
+    , _limits(limits)
 {
     curl_global_init(CURL_GLOBAL_ALL);
+
+    if (_useMultithreadedDownload) {
+        _transferThread = std::thread([this]() { transferLoop(); });
+        ghoul::thread::setPriority(
+            _transferThread,
+            ghoul::thread::ThreadPriorityClass::Idle,
+            ghoul::thread::ThreadPriorityLevel::Lowest
+        );
+    }
+}
+
+DownloadManager::~DownloadManager() {
+    if (_transferThread.joinable()) {
+        {
+            const std::lock_guard lock(_queueMutex);
+            _isRunning = false;
+        }
+        _queueCondition.notify_one();
+        _transferThread.join();
+    }
+}
+
+void DownloadManager::enqueue(std::unique_ptr<Transfer> transfer) {
+    transfer->host = hostFromUrl(transfer->url);
+
+    if (!_useMultithreadedDownload) {
+        CURL* handle = curl_easy_init();
+        if (!handle) {
+            throw ghoul::RuntimeError("Error initializing cURL");
+        }
+        curl_easy_setopt(handle, CURLOPT_URL, transfer->url.c_str());
+        transfer->configure(handle);
+        const CURLcode res = curl_easy_perform(handle);
+        transfer->finish(handle, res);
+        curl_easy_cleanup(handle);
+        return;
+    }
+
+    {
+        const std::lock_guard lock(_queueMutex);
+        transfer->sequence = _nextSequence++;
+        _queue.push_back(std::move(transfer));
+    }
+    _queueCondition.notify_one();
+}
+
+void DownloadManager::transferLoop() {
+    CURLM* multi = curl_multi_init();
+
+    // The connections are cached in the multi handle and are reused by every transfer to
+    // the same host. We still apply the limits ourselves as transfers that are queued
+    // inside cURL would be started in the order they were added rather than by priority
+    curl_multi_setopt(
+        multi,
+        CURLMOPT_MAX_HOST_CONNECTIONS,
+        static_cast<long>(_limits.maxTransfersPerHost)
+    );
+    curl_multi_setopt(
+        multi,
+        CURLMOPT_MAX_TOTAL_CONNECTIONS,
+        static_cast<long>(_limits.maxTransfers)
+    );
+    curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+
+    std::map<CURL*, std::unique_ptr<Transfer>> active;
+    std::map<std::string, int> nActivePerHost;
+    std::vector<CURL*> idleHandles;
+
+    auto finishTransfer = [&](CURL* handle, CURLcode result) {
+        curl_multi_remove_handle(multi, handle);
+        auto it = active.find(handle);
+        it->second->finish(handle, result);
+        nActivePerHost[it->second->host]--;
+        active.erase(it);
+
+        if (idleHandles.size() < MaxIdleHandles) {
+            // Resetting the handle keeps its DNS cache and TLS session alive
+            curl_easy_reset(handle);
+            idleHandles.push_back(handle);
+        }
+        else {
+            curl_easy_cleanup(handle);
+        }
+    };
+
+    while (true) {
+        const bool isRunning = _isRunning;
+
+        // Remove the cancelled transfers and start as many of the waiting transfers as
+        // the limits allow, beginning with the highest priority
+        std::vector<std::unique_ptr<Transfer>> cancelled;
+        {
+            const std::lock_guard lock(_queueMutex);
+            for (std::unique_ptr<Transfer>& t : _queue) {
+                if (!isRunning || (t->isCancelled && t->isCancelled())) {
+                    cancelled.push_back(std::move(t));
+                }
+            }
+            std::erase(_queue, nullptr);
+
+            std::sort(
+                _queue.begin(),
+                _queue.end(),
+                [](const std::unique_ptr<Transfer>& lhs,
+                   const std::unique_ptr<Transfer>& rhs)
+                {
+                    if (lhs->priority != rhs->priority) {
+                        return lhs->priority > rhs->priority;
+                    }
+                    return lhs->sequence < rhs->sequence;
+                }
+            );
+
+            for (std::unique_ptr<Transfer>& t : _queue) {
+                if (std::cmp_greater_equal(active.size(), _limits.maxTransfers)) {
+                    break;
+                }
+                if (nActivePerHost[t->host] >= _limits.maxTransfersPerHost) {
+                    continue;
+                }
+
+                CURL* handle = nullptr;
+                if (idleHandles.empty()) {
+                    handle = curl_easy_init();
+                    if (!handle) {
+                        LERROR("Error initializing cURL");
+                        break;
+                    }
+                }
+                else {
+                    handle = idleHandles.back();
+                    idleHandles.pop_back();
+                }
+
+                curl_easy_setopt(handle, CURLOPT_URL, t->url.c_str());
+                t->configure(handle);
+                curl_multi_add_handle(multi, handle);
+                nActivePerHost[t->host]++;
+                active[handle] = std::move(t);
+            }
+            std::erase(_queue, nullptr);
+        }
+
+        for (std::unique_ptr<Transfer>& t : cancelled) {
+            t->finish(nullptr, CURLE_ABORTED_BY_CALLBACK);
+        }
+
+        std::vector<CURL*> cancelledHandles;
+        for (const auto& [handle, t] : active) {
+            if (!isRunning || (t->isCancelled && t->isCancelled())) {
+                cancelledHandles.push_back(handle);
+            }
+        }
+        for (CURL* handle : cancelledHandles) {
+            finishTransfer(handle, CURLE_ABORTED_BY_CALLBACK);
+        }
+
+        if (!isRunning) {
+            break;
+        }
+
+        int nRunning = 0;
+        curl_multi_perform(multi, &nRunning);
+
+        int nMessages = 0;
+        while (CURLMsg* msg = curl_multi_info_read(multi, &nMessages)) {
+            if (msg->msg != CURLMSG_DONE) {
+                continue;
+            }
+            finishTransfer(msg->easy_handle, msg->data.result);
+        }
+
+        if (active.empty()) {
+            std::unique_lock lock(_queueMutex);
+            _queueCondition.wait_for(
+                lock,
+                IdleTimeout,
+                [this]() { return !_queue.empty() || !_isRunning; }
+            );
+        }
+        else {
+            curl_multi_wait(multi, nullptr, 0, PollTimeout, nullptr);
+        }
+    }
+
+    for (CURL* handle : idleHandles) {
+        curl_easy_cleanup(handle);
+    }
+    curl_multi_cleanup(multi);
 }
 
 std::shared_ptr<DownloadManager::FileFuture> DownloadManager::downloadFile(
@@ -129,151 +411,179 @@ std::shared_ptr<DownloadManager::FileFuture> DownloadManager::downloadFile(
                                                                   FailOnError failOnError,
                                                                 unsigned int timeout_secs,
                                                 DownloadFinishedCallback finishedCallback,
-                                          DownloadProgressCallback progressCallback) const
+                                                DownloadProgressCallback progressCallback,
+                                                                        Priority priority,
+                                                                            Resume resume)
 {
-    if (!overrideFile && std::filesystem::is_regular_file(file)) {
+    const bool exists = std::filesystem::is_regular_file(file);
+    if (!overrideFile && !resume && exists) {
         return nullptr;
     }
 
+    auto target = std::make_shared<FileTarget>();
+    target->path = file;
+    if (resume && exists) {
+        target->resumeFrom = static_cast<curl_off_t>(std::filesystem::file_size(file));
+    }
+
     auto future = std::make_shared<FileFuture>(file.filename());
     errno = 0;
-#ifdef WIN32
-    FILE* fp;
     const std::string f = file.string();
-    errno_t error = fopen_s(&fp, f.c_str(), "wb");
+    // Append to the partial file if we resume, otherwise write binary
+    const char* mode = target->resumeFrom > 0 ? "ab" : "wb";
+#ifdef WIN32
+    errno_t error = fopen_s(&target->file, f.c_str(), mode);
     if (error != 0) {
         LERROR(std::format(
             "Could not open/create file: {}. Errno: {}", file, errno
         ));
     }
 #else
-    const std::string f = file.string();
-    FILE* fp = fopen(f.c_str(), "wb"); // write binary
+    target->file = fopen(f.c_str(), mode);
 #endif // WIN32
-    if (!fp) {
+    if (!target->file) {
         LERROR(std::format(
             "Could not open/create file: {}. Errno: {}", file, errno
         ));
+        future->errorMessage = std::format("Could not open/create file: {}", file);
+        if (finishedCallback) {
+            finishedCallback(*future);
+        }
+        return future;
     }
 
-    auto downloadFunction = [url, failOnError, timeout_secs,
-                             finishedCb = std::move(finishedCallback),
-                             progressCb = std::move(progressCallback), future, fp]()
+    auto progress = std::make_shared<ProgressInformation>();
+    progress->future = future;
+    progress->target = target.get();
+    auto progressCb = std::make_shared<DownloadProgressCallback>(
+        std::move(progressCallback)
+    );
+    progress->callback = progressCb.get();
+
+    auto transfer = std::make_unique<Transfer>();
+    transfer->url = url;
+    transfer->priority = priority;
+    transfer->configure = [failOnError, timeout_secs, target, progress, progressCb](
+                                                                             CURL* curl)
     {
-        CURL* curl = curl_easy_init();
+        target->handle = curl;
+        progress->startTime = std::chrono::system_clock::now();
+
+        curl_easy_setopt(curl, CURLOPT_USERAGENT, "OpenSpace");
+        curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, target.get());
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, &writeData);
+        if (target->resumeFrom > 0) {
+            // Using a plain range instead of CURLOPT_RESUME_FROM_LARGE as cURL would fail
+            // the transfer if the server responds with the whole file instead
+            const std::string range = std::format("{}-", target->resumeFrom);
+            curl_easy_setopt(curl, CURLOPT_RANGE, range.c_str());
+        }
+        if (timeout_secs) {
+            curl_easy_setopt(curl, CURLOPT_TIMEOUT, timeout_secs);
+        }
+        if (failOnError) {
+            curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
+        }
+
+        #if LIBCURL_VERSION_NUM >= 0x072000
+        // xferinfo was introduced in 7.32.0, if a lower curl version is used the
+        // progress will not be shown for downloads on the splash screen
+        curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, xferinfo);
+        curl_easy_setopt(curl, CURLOPT_XFERINFODATA, progress.get());
+        #endif
+        curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    };
+    transfer->finish = [target, future, finishedCb = std::move(finishedCallback)](
+                                                                CURL* curl, CURLcode res)
+    {
+        if (target->file) {
+            fclose(target->file);
+            target->file = nullptr;
+        }
+
+        long rescode = 0;
         if (curl) {
-            curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-            curl_easy_setopt(curl, CURLOPT_USERAGENT, "OpenSpace");
-            curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-            curl_easy_setopt(curl, CURLOPT_WRITEDATA, fp);
-            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, &writeData);
-            if (timeout_secs) {
-                curl_easy_setopt(curl, CURLOPT_TIMEOUT, timeout_secs);
-            }
-            if (failOnError) {
-                curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
-            }
+            curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &rescode);
+        }
 
-            ProgressInformation p = {
-                .future = future,
-                .startTime = std::chrono::system_clock::now(),
-                .callback = &progressCb
-            };
-            #if LIBCURL_VERSION_NUM >= 0x072000
-            // xferinfo was introduced in 7.32.0, if a lower curl version is used the
-            // progress will not be shown for downloads on the splash screen
-            curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, xferinfo);
-            curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &p);
-            #endif
-            curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
-
-            const CURLcode res = curl_easy_perform(curl);
-            curl_easy_cleanup(curl);
-            fclose(fp);
-
-            if (res == CURLE_OK) {
-                future->isFinished = true;
-            }
-            else {
-                long rescode = 0;
-                curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &rescode);
-                future->errorMessage = std::format(
-                    "{}. HTTP code: {}", curl_easy_strerror(res), rescode
-                );
+        if (res == CURLE_OK) {
+            future->isFinished = true;
+        }
+        else if (target->resumeFrom > 0 && rescode == 416) {
+            // The requested range starts at the end of the file, so the partial file
+            // was already complete
+            future->isFinished = true;
+        }
+        else {
+            if (res == CURLE_ABORTED_BY_CALLBACK) {
+                future->isAborted = true;
             }
+            future->errorMessage = std::format(
+                "{}. HTTP code: {}", curl_easy_strerror(res), rescode
+            );
+        }
 
-            if (finishedCb) {
-                finishedCb(*future);
-            }
+        if (finishedCb) {
+            finishedCb(*future);
         }
     };
+    transfer->isCancelled = [future]() { return future->abortDownload; };
 
-    if (_useMultithreadedDownload) {
-        std::thread t = std::thread(downloadFunction);
-        ghoul::thread::setPriority(
-            t,
-            ghoul::thread::ThreadPriorityClass::Idle,
-            ghoul::thread::ThreadPriorityLevel::Lowest
-        );
-
-        t.detach();
-    }
-    else {
-        downloadFunction();
-    }
-
+    enqueue(std::move(transfer));
     return future;
 }
 
 std::future<DownloadManager::MemoryFile> DownloadManager::fetchFile(
                                                                    const std::string& url,
                                                           SuccessCallback successCallback,
-                                                              ErrorCallback errorCallback)
+                                                              ErrorCallback errorCallback,
+                                                                        Priority priority)
 {
     LDEBUG(std::format("Start downloading file '{}' into memory", url));
 
-    auto downloadFunction = [url, successCb = std::move(successCallback),
-                             errorCb = std::move(errorCallback)]()
-    {
-        DownloadManager::MemoryFile file;
-        file.buffer = reinterpret_cast<char*>(malloc(1));
-        file.size = 0;
-        file.corrupted = false;
+    auto file = std::make_shared<MemoryFile>();
+    file->buffer = reinterpret_cast<char*>(malloc(1));
+    file->size = 0;
+    file->corrupted = false;
 
-        CURL* curl = curl_easy_init();
-        if (!curl) {
-            throw ghoul::RuntimeError("Error initializing cURL");
-        }
+    auto promise = std::make_shared<std::promise<MemoryFile>>();
+    std::future<MemoryFile> result = promise->get_future();
 
-        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    auto transfer = std::make_unique<Transfer>();
+    transfer->url = url;
+    transfer->priority = priority;
+    transfer->configure = [file](CURL* curl) {
         curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
         curl_easy_setopt(curl, CURLOPT_USERAGENT, "OpenSpace");
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, reinterpret_cast<void*>(&file));
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, reinterpret_cast<void*>(file.get()));
         curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeMemoryCallback);
         curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);
         curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, false);
 
         // Will fail when response status is 400 or above
         curl_easy_setopt(curl, CURLOPT_FAILONERROR, 1L);
-
-        CURLcode res = curl_easy_perform(curl);
+    };
+    transfer->finish = [url, file, promise, successCb = std::move(successCallback),
+                        errorCb = std::move(errorCallback)](CURL* curl, CURLcode res)
+    {
         if (res == CURLE_OK) {
             // ask for the content-type
             char* ct = nullptr;
             res = curl_easy_getinfo(curl, CURLINFO_CONTENT_TYPE, &ct);
-            if (res == CURLE_OK) {
+            if (res == CURLE_OK && ct) {
                 std::string extension = std::string(ct);
                 std::stringstream ss(extension);
                 ghoul::getline(ss, extension ,'/');
                 ghoul::getline(ss, extension);
-                file.format = extension;
+                file->format = extension;
             }
             else {
                 LWARNING("Could not get extension from file downloaded from: " + url);
             }
-            successCb(file);
-            curl_easy_cleanup(curl);
-            return file;
+            if (successCb) {
+                successCb(*file);
+            }
         }
         else {
             std::string err = curl_easy_strerror(res);
@@ -283,53 +593,42 @@ std::future<DownloadManager::MemoryFile> DownloadManager::fetchFile(
             else {
                 LWARNING(std::format("Error downloading '{}': {}", url, err));
             }
-            curl_easy_cleanup(curl);
             // Set a boolean variable in MemoryFile to determine if it is
             // valid/corrupted or not.
             // Return MemoryFile even if it is not valid, and check if it is after
             // future.get() call.
-            file.corrupted = true;
-            return file;
+            file->corrupted = true;
         }
+        promise->set_value(*file);
     };
 
-    return std::async(std::launch::async, downloadFunction);
+    enqueue(std::move(transfer));
+    return result;
 }
 
 void DownloadManager::fileExtension(const std::string& url,
-                                    RequestFinishedCallback finishedCallback) const
+                                    RequestFinishedCallback finishedCallback)
 {
-    auto requestFunction = [url, finishedCb = std::move(finishedCallback)]() {
-        CURL* curl = curl_easy_init();
-        if (curl) {
-            curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-            //USING CURLOPT NOBODY
-            curl_easy_setopt(curl, CURLOPT_NOBODY, 1);
-            CURLcode res = curl_easy_perform(curl);
-            if (CURLE_OK == res) {
-                char* ct = nullptr;
-                // ask for the content-type
-                res = curl_easy_getinfo(curl, CURLINFO_CONTENT_TYPE, &ct);
-                if ((res == CURLE_OK) && ct && finishedCb) {
-                    finishedCb(std::string(ct));
-                }
+    auto transfer = std::make_unique<Transfer>();
+    transfer->url = url;
+    transfer->configure = [](CURL* curl) {
+        //USING CURLOPT NOBODY
+        curl_easy_setopt(curl, CURLOPT_NOBODY, 1);
+    };
+    transfer->finish = [finishedCb = std::move(finishedCallback)](CURL* curl,
+                                                                  CURLcode res)
+    {
+        if (CURLE_OK == res) {
+            char* ct = nullptr;
+            // ask for the content-type
+            res = curl_easy_getinfo(curl, CURLINFO_CONTENT_TYPE, &ct);
+            if ((res == CURLE_OK) && ct && finishedCb) {
+                finishedCb(std::string(ct));
             }
-
-            curl_easy_cleanup(curl);
         }
     };
-    if (_useMultithreadedDownload) {
-        std::thread t = std::thread(requestFunction);
-        ghoul::thread::setPriority(
-            t,
-            ghoul::thread::ThreadPriorityClass::Idle,
-            ghoul::thread::ThreadPriorityLevel::Lowest
-        );
-        t.detach();
-    }
-    else {
-        requestFunction();
-    }
+
+    enqueue(std::move(transfer));
 }
 
 } // namespace openspace
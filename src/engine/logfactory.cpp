@@ -26,6 +26,7 @@
 
 #include <openspace/documentation/documentation.h>
 #include <openspace/documentation/verifier.h>
+#include <openspace/util/asynclog.h>
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/logging/loglevel.h>
 #include <ghoul/logging/htmllog.h>
@@ -85,6 +86,13 @@ namespace {
         };
         // The log level for this specific text-based log
         std::optional<LogLevel> logLevel;
+
+        // Determines whether the messages are formatted and written on a separate
+        // thread. If this is `true`, logging threads do not wait for the file to be
+        // written and consecutive identical messages are combined. The time stamps in
+        // the log are then the times when the messages were written, which can be
+        // slightly later than when they were logged
+        std::optional<bool> asynchronous;
     };
 #include "logfactory_codegen.cpp"
 } // namespace
@@ -108,7 +116,9 @@ std::unique_ptr<ghoul::logging::Log> createLog(const ghoul::Dictionary& dictiona
     const ghoul::logging::LogLevel level = codegen::map<ghoul::logging::LogLevel>(
         p.logLevel.value_or(Parameters::LogLevel::AllLogging)
     );
+    const bool isAsynchronous = p.asynchronous.value_or(true);
 
+    std::unique_ptr<ghoul::logging::Log> log;
     switch (p.type) {
         case Parameters::Type::Html:
         {
@@ -118,7 +128,7 @@ std::unique_ptr<ghoul::logging::Log> createLog(const ghoul::Dictionary& dictiona
             };
             const std::vector<std::filesystem::path> jsFiles = { absPath(JsPath) };
 
-            return std::make_unique<ghoul::logging::HTMLLog>(
+            log = std::make_unique<ghoul::logging::HTMLLog>(
                 filename,
                 nLogRotation,
                 ghoul::logging::Log::TimeStamping(timeStamp),
@@ -129,9 +139,10 @@ std::unique_ptr<ghoul::logging::Log> createLog(const ghoul::Dictionary& dictiona
                 jsFiles,
                 level
             );
+            break;
         }
         case Parameters::Type::Text:
-            return std::make_unique<ghoul::logging::TextLog>(
+            log = std::make_unique<ghoul::logging::TextLog>(
                 filename,
                 nLogRotation,
                 ghoul::logging::TextLog::Append(append),
@@ -141,9 +152,15 @@ std::unique_ptr<ghoul::logging::Log> createLog(const ghoul::Dictionary& dictiona
                 ghoul::logging::Log::LogLevelStamping(logLevelStamp),
                 level
             );
+            break;
         default:
             throw ghoul::MissingCaseException();
     }
+
+    if (isAsynchronous) {
+        return std::make_unique<AsyncLog>(std::move(log), level);
+    }
+    return log;
 }
 
 } // namespace openspace
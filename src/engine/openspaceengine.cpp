@@ -26,6 +26,7 @@
 
 #include <openspace/openspace.h>
 #include <openspace/camera/camera.h>
+#include <openspace/documentation/compiledspecification.h>
 #include <openspace/documentation/core_registration.h>
 #include <openspace/documentation/documentationengine.h>
 #include <openspace/engine/configuration.h>
@@ -835,6 +836,7 @@ void OpenSpaceEngine::loadAssets() {
 
     _loadingScreen->exec(*_assetManager, *_scene);
     _loadingScreen = nullptr;
+    documentation::logSpecificationTimings();
 
 
     global::renderEngine->updateScene();
@@ -33,13 +33,201 @@
 #include <ghoul/format.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/assert.h>
+#include <array>
 #include <functional>
+#include <span>
 
 namespace {
     constexpr std::string_view _loggerCat = "EventInfo";
-} // namespace
 
-using namespace std::string_literals;
+    using namespace openspace::events;
+    using namespace std::string_view_literals;
+
+    struct Parameter {
+        std::string_view key;
+        ParameterAccessor accessor;
+    };
+
+    template <typename T, auto Member>
+    ParameterValue field(const Event& e) {
+        return static_cast<const T&>(e).*Member;
+    }
+
+    // The parameters of each event type. These are passed to the actions that are
+    // triggered by the events and can be used to filter the events
+    std::span<const Parameter> parameters(Event::Type type) {
+        switch (type) {
+            case Event::Type::ParallelConnection: {
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "State", [](const Event& e) -> ParameterValue {
+                        using State = EventParallelConnection::State;
+                        switch (static_cast<const EventParallelConnection&>(e).state) {
+                            case State::Established:    return "Established"sv;
+                            case State::Lost:           return "Lost"sv;
+                            case State::HostshipGained: return "HostshipGained"sv;
+                            case State::HostshipLost:   return "HostshipLost"sv;
+                            default:        throw ghoul::MissingCaseException();
+                        }
+                    }}
+                }};
+                return Parameters;
+            }
+            case Event::Type::ApplicationShutdown: {
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "State", [](const Event& e) -> ParameterValue {
+                        using State = EventApplicationShutdown::State;
+                        switch (static_cast<const EventApplicationShutdown&>(e).state) {
+                            case State::Started:  return "Started"sv;
+                            case State::Aborted:  return "Aborted"sv;
+                            case State::Finished: return "Finished"sv;
+                            default:  throw ghoul::MissingCaseException();
+                        }
+                    }}
+                }};
+                return Parameters;
+            }
+            case Event::Type::CameraFocusTransition: {
+                using T = EventCameraFocusTransition;
+                static constexpr std::array<Parameter, 2> Parameters = {{
+                    { "Node", &field<T, &T::node> },
+                    { "Transition", [](const Event& e) -> ParameterValue {
+                        using Transition = T::Transition;
+                        switch (static_cast<const T&>(e).transition) {
+                            case Transition::Approaching: return "Approaching"sv;
+                            case Transition::Reaching:    return "Reaching"sv;
+                            case Transition::Receding:    return "Receding"sv;
+                            case Transition::Exiting:     return "Exiting"sv;
+                            default:          throw ghoul::MissingCaseException();
+                        }
+                    }}
+                }};
+                return Parameters;
+            }
+            case Event::Type::PlanetEclipsed: {
+                using T = EventPlanetEclipsed;
+                static constexpr std::array<Parameter, 2> Parameters = {{
+                    { "Eclipsee", &field<T, &T::eclipsee> },
+                    { "Eclipser", &field<T, &T::eclipser> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::InterpolationFinished: {
+                using T = EventInterpolationFinished;
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "Property", &field<T, &T::property> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::FocusNodeChanged: {
+                using T = EventFocusNodeChanged;
+                static constexpr std::array<Parameter, 2> Parameters = {{
+                    { "OldNode", &field<T, &T::oldNode> },
+                    { "NewNode", &field<T, &T::newNode> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::PropertyTreeUpdated: {
+                using T = EventPropertyTreeUpdated;
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "Uri", &field<T, &T::uri> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::PropertyTreePruned: {
+                using T = EventPropertyTreePruned;
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "Uri", &field<T, &T::uri> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::ActionAdded: {
+                using T = EventActionAdded;
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "Uri", &field<T, &T::uri> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::ActionRemoved: {
+                using T = EventActionRemoved;
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "Uri", &field<T, &T::uri> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::SessionRecordingPlayback: {
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "State", [](const Event& e) -> ParameterValue {
+                        using T = EventSessionRecordingPlayback;
+                        switch (static_cast<const T&>(e).state) {
+                            case T::State::Started:  return "Started"sv;
+                            case T::State::Paused:   return "Paused"sv;
+                            case T::State::Resumed:  return "Resumed"sv;
+                            case T::State::Finished: return "Finished"sv;
+                            default:     throw ghoul::MissingCaseException();
+                        }
+                    }}
+                }};
+                return Parameters;
+            }
+            case Event::Type::PointSpacecraft: {
+                using T = EventPointSpacecraft;
+                static constexpr std::array<Parameter, 3> Parameters = {{
+                    { "Ra", &field<T, &T::ra> },
+                    { "Dec", &field<T, &T::dec> },
+                    { "Duration", &field<T, &T::duration> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::RenderableEnabled: {
+                using T = EventRenderableEnabled;
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "Node", &field<T, &T::node> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::RenderableDisabled: {
+                using T = EventRenderableDisabled;
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "Node", &field<T, &T::node> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::CameraPathStarted: {
+                using T = EventCameraPathStarted;
+                static constexpr std::array<Parameter, 2> Parameters = {{
+                    { "Origin", &field<T, &T::origin> },
+                    { "Destination", &field<T, &T::destination> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::CameraPathFinished: {
+                using T = EventCameraPathFinished;
+                static constexpr std::array<Parameter, 2> Parameters = {{
+                    { "Origin", &field<T, &T::origin> },
+                    { "Destination", &field<T, &T::destination> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::ScheduledScriptExecuted: {
+                using T = EventScheduledScriptExecuted;
+                static constexpr std::array<Parameter, 1> Parameters = {{
+                    { "Script", &field<T, &T::script> }
+                }};
+                return Parameters;
+            }
+            case Event::Type::Custom: {
+                using T = CustomEvent;
+                static constexpr std::array<Parameter, 2> Parameters = {{
+                    { "Subtype", &field<T, &T::subtype> },
+                    { "Payload", &field<T, &T::payload> }
+                }};
+                return Parameters;
+            }
+            default:
+                return {};
+        }
+    }
+} // namespace
 
 namespace openspace::events {
 
@@ -331,179 +519,30 @@ Event::Type fromString(std::string_view str) {
 
 ghoul::Dictionary toParameter(const Event& e) {
     ghoul::Dictionary d;
-    switch (e.type) {
-        case Event::Type::ParallelConnection:
-            switch (static_cast<const EventParallelConnection&>(e).state) {
-                case EventParallelConnection::State::Established:
-                    d.setValue("State", "Established"s);
-                    break;
-                case EventParallelConnection::State::Lost:
-                    d.setValue("State", "Lost"s);
-                    break;
-                case EventParallelConnection::State::HostshipGained:
-                    d.setValue("State", "HostshipGained"s);
-                    break;
-                case EventParallelConnection::State::HostshipLost:
-                    d.setValue("State", "HostshipLost"s);
-                    break;
-            }
-            break;
-        case Event::Type::ApplicationShutdown:
-            switch (static_cast<const EventApplicationShutdown&>(e).state) {
-                case EventApplicationShutdown::State::Started:
-                    d.setValue("State", "Started"s);
-                    break;
-                case EventApplicationShutdown::State::Aborted:
-                    d.setValue("State", "Aborted"s);
-                    break;
-                case EventApplicationShutdown::State::Finished:
-                    d.setValue("State", "Finished"s);
-                    break;
-            }
-            break;
-        case Event::Type::CameraFocusTransition:
-            d.setValue(
-                "Node",
-                std::string(static_cast<const EventCameraFocusTransition&>(e).node)
-            );
-            switch (static_cast<const EventCameraFocusTransition&>(e).transition) {
-                case EventCameraFocusTransition::Transition::Approaching:
-                    d.setValue("Transition", "Approaching"s);
-                    break;
-                case EventCameraFocusTransition::Transition::Reaching:
-                    d.setValue("Transition", "Reaching"s);
-                    break;
-                case EventCameraFocusTransition::Transition::Receding:
-                    d.setValue("Transition", "Receding"s);
-                    break;
-                case EventCameraFocusTransition::Transition::Exiting:
-                    d.setValue("Transition", "Exiting"s);
-                    break;
-            }
-            break;
-        case Event::Type::PlanetEclipsed:
-            d.setValue(
-                "Eclipsee",
-                std::string(static_cast<const EventPlanetEclipsed&>(e).eclipsee)
-            );
-            d.setValue(
-                "Eclipser",
-                std::string(static_cast<const EventPlanetEclipsed&>(e).eclipser)
-            );
-            break;
-        case Event::Type::InterpolationFinished:
-            d.setValue(
-                "Property",
-                std::string(static_cast<const EventInterpolationFinished&>(e).property)
-            );
-            break;
-        case Event::Type::FocusNodeChanged:
-            d.setValue(
-                "OldNode",
-                std::string(static_cast<const EventFocusNodeChanged&>(e).oldNode)
-            );
-            d.setValue(
-                "NewNode",
-                std::string(static_cast<const EventFocusNodeChanged&>(e).newNode)
-            );
-            break;
-        case Event::Type::PropertyTreeUpdated:
-            d.setValue(
-                "Uri",
-                std::string(static_cast<const EventPropertyTreeUpdated&>(e).uri)
-            );
-            break;
-        case Event::Type::PropertyTreePruned:
-            d.setValue(
-                "Uri",
-                std::string(static_cast<const EventPropertyTreePruned&>(e).uri)
-            );
-            break;
-        case Event::Type::ActionAdded:
-            d.setValue(
-                "Uri",
-                std::string(static_cast<const EventActionAdded&>(e).uri)
-            );
-            break;
-        case Event::Type::ActionRemoved:
-            d.setValue(
-                "Uri",
-                std::string(static_cast<const EventActionRemoved&>(e).uri)
-            );
-            break;
-        case Event::Type::SessionRecordingPlayback:
-            switch (static_cast<const EventSessionRecordingPlayback&>(e).state) {
-                case EventSessionRecordingPlayback::State::Started:
-                    d.setValue("State", "Started"s);
-                    break;
-                case EventSessionRecordingPlayback::State::Paused:
-                    d.setValue("State", "Paused"s);
-                    break;
-                case EventSessionRecordingPlayback::State::Resumed:
-                    d.setValue("State", "Resumed"s);
-                    break;
-                case EventSessionRecordingPlayback::State::Finished:
-                    d.setValue("State", "Finished"s);
-                    break;
-            }
-            break;
-        case Event::Type::PointSpacecraft:
-            d.setValue("Ra", static_cast<const EventPointSpacecraft&>(e).ra);
-            d.setValue("Dec", static_cast<const EventPointSpacecraft&>(e).dec);
-            d.setValue("Duration", static_cast<const EventPointSpacecraft&>(e).duration);
-            break;
-        case Event::Type::RenderableEnabled:
-            d.setValue(
-                "Node",
-                std::string(static_cast<const EventRenderableEnabled&>(e).node)
-            );
-            break;
-        case Event::Type::RenderableDisabled:
-            d.setValue(
-                "Node",
-                std::string(static_cast<const EventRenderableDisabled&>(e).node)
-            );
-            break;
-        case Event::Type::CameraPathStarted:
-            d.setValue(
-                "Origin",
-                std::string(static_cast<const EventCameraPathStarted&>(e).origin)
-            );
-            d.setValue(
-                "Destination",
-                std::string(static_cast<const EventCameraPathStarted&>(e).destination)
-            );
-            break;
-        case Event::Type::CameraPathFinished:
-            d.setValue(
-                "Origin",
-                std::string(static_cast<const EventCameraPathFinished&>(e).origin)
-            );
-            d.setValue(
-                "Destination",
-                std::string(static_cast<const EventCameraPathFinished&>(e).destination)
-            );
-            break;
-        case Event::Type::ScheduledScriptExecuted:
-            d.setValue(
-                "Script",
-                std::string(static_cast<const EventScheduledScriptExecuted&>(e).script)
-            );
-            break;
-        case Event::Type::Custom:
-            d.setValue(
-                "Subtype", std::string(static_cast<const CustomEvent&>(e).subtype)
-            );
+    for (const Parameter& parameter : parameters(e.type)) {
+        const ParameterValue value = parameter.accessor(e);
+        if (std::holds_alternative<double>(value)) {
+            d.setValue(std::string(parameter.key), std::get<double>(value));
+        }
+        else {
             d.setValue(
-                "Payload", std::string(static_cast<const CustomEvent&>(e).payload)
+                std::string(parameter.key),
+                std::string(std::get<std::string_view>(value))
             );
-            break;
-        default:
-            break;
+        }
     }
     return d;
 }
 
+ParameterAccessor parameterAccessor(Event::Type type, std::string_view key) {
+    for (const Parameter& parameter : parameters(type)) {
+        if (parameter.key == key) {
+            return parameter.accessor;
+        }
+    }
+    return nullptr;
+}
+
 void logAllEvents(const Event* e) {
     int i = 0;
     while (e) {
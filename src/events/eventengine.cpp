@@ -26,11 +26,48 @@
 
 #include <openspace/engine/globals.h>
 #include <openspace/interaction/actionmanager.h>
+#include <type_traits>
+#include <variant>
 
 #include "eventengine_lua.inl"
 
 namespace {
     constexpr std::string_view _loggerCat = "EventEngine";
+
+    openspace::EventEngine::CompiledFilter compileFilter(
+                                                      openspace::events::Event::Type type,
+                                                          const ghoul::Dictionary& filter)
+    {
+        using namespace openspace;
+
+        EventEngine::CompiledFilter res;
+        for (std::string_view key : filter.keys()) {
+            EventEngine::CompiledFilter::Condition condition;
+            condition.accessor = events::parameterAccessor(type, key);
+            if (filter.hasValue<std::string>(key)) {
+                condition.value = filter.value<std::string>(key);
+            }
+            else if (filter.hasValue<double>(key)) {
+                condition.value = filter.value<double>(key);
+            }
+            else if (filter.hasValue<int>(key)) {
+                condition.value = static_cast<double>(filter.value<int>(key));
+            }
+            else {
+                condition.accessor = nullptr;
+            }
+
+            if (!condition.accessor) {
+                // A Dictionary of event parameters would not contain this key (or not
+                // with a comparable value) so the filter can never be passed
+                res.isSatisfiable = false;
+                res.conditions.clear();
+                break;
+            }
+            res.conditions.push_back(std::move(condition));
+        }
+        return res;
+    }
 } // namespace
 
 namespace openspace {
@@ -41,6 +78,34 @@ uint32_t EventEngine::nextRegisteredEventId = 0;
 uint64_t EventEngine::nEvents = 0;
 #endif // _DEBUG
 
+bool EventEngine::CompiledFilter::matches(const events::Event& e) const {
+    if (!isSatisfiable) {
+        return false;
+    }
+
+    for (const Condition& condition : conditions) {
+        const events::ParameterValue v = condition.accessor(e);
+        const bool isEqual = std::visit(
+            [&v](const auto& expected) {
+                using T = std::decay_t<decltype(expected)>;
+                if constexpr (std::is_same_v<T, double>) {
+                    return std::holds_alternative<double>(v) &&
+                           std::get<double>(v) == expected;
+                }
+                else {
+                    return std::holds_alternative<std::string_view>(v) &&
+                           std::get<std::string_view>(v) == expected;
+                }
+            },
+            condition.value
+        );
+        if (!isEqual) {
+            return false;
+        }
+    }
+    return true;
+}
+
 events::Event* EventEngine::firstEvent() const {
     return _firstEvent;
 }
@@ -62,6 +127,9 @@ void EventEngine::registerEventAction(events::Event::Type type, std::string iden
     ai.isEnabled = true;
     ai.type = type;
     ai.action = std::move(identifier);
+    if (filter.has_value()) {
+        ai.compiledFilter = compileFilter(type, *filter);
+    }
     ai.filter = std::move(filter);
     const auto it = _eventActions.find(type);
     if (it != _eventActions.end()) {
@@ -75,7 +143,7 @@ void EventEngine::registerEventAction(events::Event::Type type, std::string iden
 }
 
 void EventEngine::registerEventTopic(size_t topicId, events::Event::Type type,
-                                     ScriptCallback callback)
+                                     TopicCallback callback)
 {
     TopicInfo ti;
     ti.id = static_cast<uint32_t>(topicId);
@@ -209,19 +277,24 @@ void EventEngine::triggerActions() const {
     while (e) {
         const auto it = _eventActions.find(e->type);
         if (it != _eventActions.end()) {
-            const ghoul::Dictionary params = toParameter(*e);
+            // The parameters are only converted into a Dictionary if an action fires
+            std::optional<ghoul::Dictionary> params;
             for (const ActionInfo& ai : it->second) {
-                if (ai.isEnabled &&
-                    (!ai.filter.has_value() || params.isSubset(*ai.filter)))
-                {
-                    // No sync because events are always synced and sent to the connected
-                    // nodes and peers
-                    global::actionManager->triggerAction(
-                        ai.action,
-                        params,
-                        interaction::ActionManager::ShouldBeSynchronized::No
-                    );
+                if (!ai.isEnabled || !ai.compiledFilter.matches(*e)) {
+                    continue;
+                }
+
+                if (!params.has_value()) {
+                    params = toParameter(*e);
                 }
+
+                // No sync because events are always synced and sent to the connected
+                // nodes and peers
+                global::actionManager->triggerAction(
+                    ai.action,
+                    *params,
+                    interaction::ActionManager::ShouldBeSynchronized::No
+                );
             }
         }
 
@@ -235,19 +308,36 @@ void EventEngine::triggerTopics() const {
         return;
     }
 
+    // Collect the events for each topic first so that every topic is only called once
+    struct Batch {
+        const TopicCallback* callback = nullptr;
+        std::vector<ghoul::Dictionary> events;
+    };
+    std::vector<Batch> batches;
+    std::unordered_map<uint32_t, size_t> batchIndices;
+
     const events::Event* e = _firstEvent;
     while (e) {
         const auto it = _eventTopics.find(e->type);
 
         if (it != _eventTopics.end()) {
-            const ghoul::Dictionary params = toParameter(*e);
+            ghoul::Dictionary params = toParameter(*e);
+            params.setValue("Event", std::string(events::toString(e->type)));
             for (const TopicInfo& ti : it->second) {
-                ti.callback(params);
+                const auto [jt, isNew] = batchIndices.try_emplace(ti.id, batches.size());
+                if (isNew) {
+                    batches.push_back({ .callback = &ti.callback });
+                }
+                batches[jt->second].events.push_back(params);
             }
         }
 
         e = e->next;
     }
+
+    for (const Batch& batch : batches) {
+        (*batch.callback)(batch.events);
+    }
 }
 
 scripting::LuaLibrary EventEngine::luaLibrary() {
@@ -31,7 +31,6 @@
 #include <openspace/scripting/scriptengine.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/misc/crc32.h>
-#include <ghoul/misc/dictionaryluaformatter.h>
 #include <algorithm>
 
 #include "actionmanager_lua.inl"
@@ -102,15 +101,12 @@ void ActionManager::triggerAction(const std::string& identifier,
         return;
     }
 
+    // The arguments are passed separately so that the compiled command can be reused
     const Action& a = action(identifier);
-    std::string script =
-        arguments.isEmpty() ?
-        a.command :
-        std::format("args = {}\n{}", ghoul::formatLua(arguments), a.command);
-
     if (!shouldBeSynchronized || a.isLocal) {
         global::scriptEngine->queueScript({
-            .code = std::move(script),
+            .code = a.command,
+            .arguments = arguments,
             .synchronized = scripting::ScriptEngine::Script::ShouldBeSynchronized::No,
             .sendToRemote = scripting::ScriptEngine::Script::ShouldSendToRemote::No,
             .addToLog = scripting::ScriptEngine::Script::ShouldBeLogged(shouldBeLogged)
@@ -118,7 +114,8 @@ void ActionManager::triggerAction(const std::string& identifier,
     }
     else {
         global::scriptEngine->queueScript({
-            .code = std::move(script),
+            .code = a.command,
+            .arguments = arguments,
             .addToLog = scripting::ScriptEngine::Script::ShouldBeLogged(shouldBeLogged)
         });
     }
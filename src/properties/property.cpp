@@ -24,6 +24,9 @@
 
 #include <openspace/properties/property.h>
 
+#include <openspace/engine/globals.h>
+#include <openspace/events/event.h>
+#include <openspace/events/eventengine.h>
 #include <openspace/properties/propertyowner.h>
 #include <openspace/util/json_helper.h>
 #include <ghoul/logging/logmanager.h>
@@ -121,10 +124,21 @@ std::string Property::groupIdentifier() const {
 }
 
 void Property::setVisibility(Visibility visibility) {
+    const bool isChanged =
+        !_metaData.hasKey(MetaDataKeyVisibility) || this->visibility() != visibility;
     _metaData.setValue(
         std::string(MetaDataKeyVisibility),
         static_cast<std::underlying_type_t<Visibility>>(visibility)
     );
+
+    // Notify the change so that the UI can update which properties are shown. Properties
+    // that are not part of the property tree yet do not have a URI
+    if (isChanged && _owner) {
+        const std::string uri = this->uri();
+        if (!uri.empty()) {
+            global::eventEngine->publishEvent<events::EventPropertyTreeUpdated>(uri);
+        }
+    }
 }
 
 Property::Visibility Property::visibility() const {
@@ -268,6 +282,18 @@ std::string Property::generateJsonDescription() const {
     );
 }
 
+const std::string& Property::staticJsonDescription() const {
+    if (_staticJsonDescription.empty()) {
+        _staticJsonDescription = std::format(
+            R"("{}":"{}","{}":"{}","description":{})",
+            TypeKey, escapedJson(std::string(className())),
+            NameKey, escapedJson(guiName()),
+            nlohmann::json(_description).dump()
+        );
+    }
+    return _staticJsonDescription;
+}
+
 std::string Property::generateMetaDataJsonDescription() const {
     static const std::map<Visibility, std::string> VisibilityConverter = {
         { Visibility::Always, "Always" },
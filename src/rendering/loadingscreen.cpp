@@ -586,6 +586,9 @@ void LoadingScreen::renderLogMessages() const {
     using FR = ghoul::fontrendering::FontRenderer;
     const FR& renderer = FR::defaultRenderer();
 
+    // The messages are only moved into the entries when requested, but they should not
+    // expire while the loading screen is shown
+    _log->addIncomingEntries();
     const std::vector<ScreenLog::LogEntry>& entries = _log->entries();
 
     size_t nRows = 0;
@@ -635,7 +638,7 @@ void LoadingScreen::renderLogMessages() const {
     // Render # of warnings and error messages
     std::map<ghoul::logging::LogLevel, size_t> numberOfErrorsPerLevel;
     for (const auto& entry : _log->entries()) {
-        numberOfErrorsPerLevel[entry.level]++;
+        numberOfErrorsPerLevel[entry.level] += entry.nRepetitions + 1;
     }
     size_t row = 0;
     for (auto& [level, amount] : numberOfErrorsPerLevel) {
@@ -652,6 +655,20 @@ void LoadingScreen::renderLogMessages() const {
         );
         ++row;
     }
+
+    const size_t nDropped = _log->nDroppedEntries();
+    if (nDropped > 0) {
+        const std::string text = std::format("Dropped: {}", nDropped);
+        const glm::vec2 bbox = _logFont->boundingBox(text);
+        renderer.render(
+            *_logFont,
+            glm::vec2(
+                res.x - bbox.x - 10,
+                10 + _logFont->pointSize() * row * 2
+            ),
+            text
+        );
+    }
 }
 
 void LoadingScreen::postMessage(std::string message) {
@@ -26,7 +26,10 @@
 
 #include <openspace/engine/globals.h>
 #include <openspace/engine/windowdelegate.h>
+#include <openspace/events/event.h>
+#include <openspace/events/eventengine.h>
 #include <openspace/network/parallelpeer.h>
+#include <openspace/properties/property.h>
 #include <openspace/rendering/helper.h>
 #include <openspace/scripting/scriptengine.h>
 #include <ghoul/filesystem/cachemanager.h>
@@ -42,6 +45,7 @@
 #include <ghoul/opengl/programobject.h>
 #include <filesystem>
 #include <fstream>
+#include <optional>
 
 namespace {
     constexpr std::string_view HistoryFile = "ConsoleHistory";
@@ -138,6 +142,23 @@ namespace {
         return str;
     }
 
+    // Returns the position directly after the opening quote if the end of the \p text
+    // is inside a string literal, or std::nullopt otherwise
+    std::optional<size_t> openStringStart(std::string_view text) {
+        char quote = '\0';
+        size_t start = 0;
+        for (size_t i = 0; i < text.size(); i++) {
+            if (quote == '\0' && (text[i] == '"' || text[i] == '\'')) {
+                quote = text[i];
+                start = i + 1;
+            }
+            else if (text[i] == quote && text[i - 1] != '\\') {
+                quote = '\0';
+            }
+        }
+        return quote != '\0' ? std::optional<size_t>(start) : std::nullopt;
+    }
+
 } // namespace
 
 namespace openspace {
@@ -478,19 +499,18 @@ bool LuaConsole::keyboardCallback(Key key, KeyModifier modifier, KeyAction actio
     }
 
     if (key == Key::Tab) {
-        // We get a list of all the available commands and initially find the first
-        // command that starts with how much we typed sofar. We store the index so
-        // that in subsequent "tab" presses, we will discard previous commands. This
+        // We look up all commands that start with how much we typed sofar in a sorted
+        // index and pick the first one. We store the position in the list of matches
+        // so that in subsequent "tab" presses, we will discard previous commands. This
         // implements the 'hop-over' behavior. As soon as another key is pressed,
-        // everything is set back to normal
+        // everything is set back to normal. If the cursor is inside a string, we
+        // complete property URIs instead of commands
 
         // If the shift key is pressed, we decrement the current index so that we will
         // find the value before the one that was previously found
         if (_autoCompleteInfo.lastIndex != NoAutoComplete && modifierShift) {
             _autoCompleteInfo.lastIndex -= 2;
         }
-        std::vector<std::string> allCommands = global::scriptEngine->allLuaFunctions();
-        std::sort(allCommands.begin(), allCommands.end());
 
         const std::string currentCommand = _commands.at(_activeCommand);
 
@@ -499,68 +519,97 @@ bool LuaConsole::keyboardCallback(Key key, KeyModifier modifier, KeyAction actio
         // from there. We will overwrite the 'currentCommand' thus making the storage
         // necessary
         if (!_autoCompleteInfo.hasInitialValue) {
-            _autoCompleteInfo.initialValue = currentCommand;
-            _autoCompleteInfo.hasInitialValue = true;
-        }
-
-        for (int i = 0; i < static_cast<int>(allCommands.size()); i++) {
-            const std::string& command = allCommands[i];
-
-            // Check if the command has enough length (we don't want crashes here)
-            // Then check if the iterator-command's start is equal to what we want
-            // then check if we need to skip the first found values as the user has
-            // pressed TAB repeatedly
-            const size_t fullLength = _autoCompleteInfo.initialValue.length();
-            const bool correctLength = command.length() >= fullLength;
-
-            const std::string commandLowerCase = ghoul::toLowerCase(command);
-
-            const std::string initialValueLowerCase = ghoul::toLowerCase(
-                _autoCompleteInfo.initialValue
+            const std::optional<size_t> stringStart = openStringStart(
+                std::string_view(currentCommand).substr(0, _inputPosition)
             );
+            if (stringStart.has_value()) {
+                _autoCompleteInfo.isPropertyUri = true;
+                _autoCompleteInfo.prefix = currentCommand.substr(0, *stringStart);
+                _autoCompleteInfo.initialValue = currentCommand.substr(
+                    *stringStart,
+                    _inputPosition - *stringStart
+                );
+                _autoCompleteInfo.suffix = currentCommand.substr(_inputPosition);
+            }
+            else {
+                _autoCompleteInfo.initialValue = currentCommand;
+            }
+            _autoCompleteInfo.hasInitialValue = true;
 
-            const bool correctCommand =
-                commandLowerCase.substr(0, fullLength) == initialValueLowerCase;
+            // Only if nothing starts with the value do we fall back to a fuzzy search
+            const CompletionIndex& index = _autoCompleteInfo.isPropertyUri ?
+                propertyIndex() :
+                global::scriptEngine->luaFunctionIndex();
+            const auto [first, last] = index.prefixRange(_autoCompleteInfo.initialValue);
+            _autoCompleteInfo.isFuzzy = first == last;
+            if (_autoCompleteInfo.isFuzzy) {
+                _autoCompleteInfo.fuzzyMatches = index.fuzzyMatches(
+                    _autoCompleteInfo.initialValue
+                );
+            }
+        }
 
-            if (correctLength && correctCommand && (i > _autoCompleteInfo.lastIndex)) {
-                // We found our index, so store it
-                _autoCompleteInfo.lastIndex = i;
+        const CompletionIndex& index = _autoCompleteInfo.isPropertyUri ?
+            propertyIndex() :
+            global::scriptEngine->luaFunctionIndex();
+        const size_t fullLength = _autoCompleteInfo.initialValue.length();
+        const auto [first, last] = index.prefixRange(_autoCompleteInfo.initialValue);
+        const std::vector<size_t>& fuzzy = _autoCompleteInfo.fuzzyMatches;
+        const int nMatches = static_cast<int>(
+            _autoCompleteInfo.isFuzzy ? fuzzy.size() : last - first
+        );
 
-                // We only want to auto-complete until the next separator "."
-                const size_t pos = command.find('.', fullLength);
-                if (pos == std::string::npos) {
-                    // If we don't find a separator, we autocomplete until the end
+        for (int i = std::max(_autoCompleteInfo.lastIndex + 1, 0); i < nMatches; i++) {
+            const size_t entry = _autoCompleteInfo.isFuzzy ? fuzzy[i] : first + i;
+            const std::string& command = index[entry];
+
+            // We found our index, so store it
+            _autoCompleteInfo.lastIndex = i;
+
+            // We only want to auto-complete until the next separator "." unless the
+            // match was fuzzy, in which case the typed value is not a prefix
+            const size_t pos = _autoCompleteInfo.isFuzzy ?
+                std::string::npos :
+                command.find('.', fullLength);
+            const std::string& prefix = _autoCompleteInfo.prefix;
+            const std::string& suffix = _autoCompleteInfo.suffix;
+            if (pos == std::string::npos) {
+                // If we don't find a separator, we autocomplete until the end
+                if (_autoCompleteInfo.isPropertyUri) {
+                    _commands.at(_activeCommand) = prefix + command + suffix;
+                    _inputPosition = prefix.size() + command.size();
+                }
+                else {
                     // Set the found command as active command
                     _commands.at(_activeCommand) = command + "();";
                     // Set the cursor position to be between the brackets
                     _inputPosition = _commands.at(_activeCommand).size() - 2;
                 }
-                else {
-                    // If we find a separator, we autocomplete until and including the
-                    // separator unless the autocompletion would be the same that we
-                    // already have (the case if there are multiple commands in the
-                    // same group
-                    const std::string subCommand = command.substr(0, pos + 1);
-                    if (subCommand == _commands.at(_activeCommand)) {
-                        continue;
-                    }
-                    else {
-                        _commands.at(_activeCommand) = command.substr(0, pos + 1);
-                        _inputPosition = _commands.at(_activeCommand).length();
-                        // We only want to remove the autocomplete info if we just
-                        // entered the 'default' openspace namespace
-                        if (command.substr(0, pos + 1) == "openspace.") {
-                            _autoCompleteInfo = {
-                                .lastIndex = NoAutoComplete,
-                                .hasInitialValue = false,
-                                .initialValue = ""
-                            };
-                        }
-                    }
+            }
+            else {
+                // If we find a separator, we autocomplete until and including the
+                // separator unless the autocompletion would be the same that we
+                // already have (the case if there are multiple commands in the
+                // same group
+                const std::string subCommand = command.substr(0, pos + 1);
+                if (prefix + subCommand + suffix == _commands.at(_activeCommand)) {
+                    continue;
                 }
 
-                break;
+                _commands.at(_activeCommand) = prefix + subCommand + suffix;
+                _inputPosition = prefix.size() + subCommand.size();
+                // We only want to remove the autocomplete info if we just
+                // entered the 'default' openspace namespace
+                if (!_autoCompleteInfo.isPropertyUri && subCommand == "openspace.") {
+                    _autoCompleteInfo = {
+                        .lastIndex = NoAutoComplete,
+                        .hasInitialValue = false,
+                        .initialValue = ""
+                    };
+                }
             }
+
+            break;
         }
         return true;
     }
@@ -627,6 +676,13 @@ void LuaConsole::charCallback(unsigned int codepoint,
 void LuaConsole::update() {
     ZoneScoped;
 
+    const events::Event* e = global::eventEngine->firstEvent();
+    while (e && !_isPropertyIndexDirty) {
+        _isPropertyIndexDirty = e->type == events::Event::Type::PropertyTreeUpdated ||
+                                e->type == events::Event::Type::PropertyTreePruned;
+        e = e->next;
+    }
+
     // Compute the height by simulating _historyFont number of lines and checking
     // what the bounding box for that text would be.
     using namespace ghoul::fontrendering;
@@ -660,6 +716,21 @@ void LuaConsole::update() {
     _currentHeight = std::min(static_cast<float>(res.y), _currentHeight);
 }
 
+const CompletionIndex& LuaConsole::propertyIndex() {
+    if (_isPropertyIndexDirty) {
+        const std::vector<properties::Property*> ps =
+            global::rootPropertyOwner->propertiesRecursive();
+        std::vector<std::string> uris;
+        uris.reserve(ps.size());
+        for (const properties::Property* p : ps) {
+            uris.push_back(p->uri());
+        }
+        _propertyIndex.assign(std::move(uris));
+        _isPropertyIndexDirty = false;
+    }
+    return _propertyIndex;
+}
+
 void LuaConsole::render() {
     ZoneScoped;
 
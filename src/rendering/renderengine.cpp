@@ -42,6 +42,7 @@
 #include <openspace/rendering/luaconsole.h>
 #include <openspace/rendering/raycastermanager.h>
 #include <openspace/rendering/screenspacerenderable.h>
+#include <openspace/rendering/texturecache.h>
 #include <openspace/scene/scene.h>
 #include <openspace/scripting/scriptengine.h>
 #include <openspace/util/memorymanager.h>
@@ -458,6 +459,8 @@ void RenderEngine::initialize() {
         std::make_unique<ghoul::io::TextureWriterSTB>()
     );
 
+    _textureCache = std::make_unique<TextureCache>();
+
     ghoul::io::ModelReader::ref().addReader(
         std::make_unique<ghoul::io::ModelReaderAssimp>()
     );
@@ -886,6 +889,11 @@ ghoul::opengl::OpenGLStateCache& RenderEngine::openglStateCache() {
     return *_openglStateCache;
 }
 
+TextureCache& RenderEngine::textureCache() {
+    ghoul_assert(_textureCache, "RenderEngine must be initialized");
+    return *_textureCache;
+}
+
 float RenderEngine::hdrExposure() const {
     return _hdrExposure;
 }
@@ -1369,7 +1377,9 @@ void RenderEngine::renderScreenLog() {
                 10 + 44 * _fontLog->pointSize(),
                 _fontLog->pointSize() * nRows * 2 + fontRes.y * _verticalLogOffset
             ),
-            message,
+            it.nRepetitions > 0 ?
+                std::format("{} (x{})", message, it.nRepetitions + 1) :
+                std::string(message),
             white
         );
         ++nRows;
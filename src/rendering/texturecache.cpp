@@ -0,0 +1,352 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/rendering/texturecache.h>
+
+#include <ghoul/filesystem/cachemanager.h>
+#include <ghoul/filesystem/filesystem.h>
+#include <ghoul/io/texture/texturereader.h>
+#include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/crc32.h>
+#include <ghoul/misc/profiling.h>
+#include <stb_image.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace {
+    constexpr std::string_view _loggerCat = "TextureCache";
+
+    constexpr uint8_t CurrentCacheVersion = 1;
+
+    using Image = openspace::TextureCache::Image;
+
+    ghoul::opengl::Texture::Format textureFormat(int nChannels) {
+        switch (nChannels) {
+            case 1:  return ghoul::opengl::Texture::Format::Red;
+            case 2:  return ghoul::opengl::Texture::Format::RG;
+            case 3:  return ghoul::opengl::Texture::Format::RGB;
+            default: return ghoul::opengl::Texture::Format::RGBA;
+        }
+    }
+
+    size_t imageSize(const Image& image) {
+        return static_cast<size_t>(image.resolution.x) * image.resolution.y *
+               image.nChannels;
+    }
+
+    std::shared_ptr<Image> readCachedImage(const std::filesystem::path& path) {
+        std::ifstream file = std::ifstream(path, std::ifstream::binary);
+        if (!file.good()) {
+            return nullptr;
+        }
+
+        uint8_t version = 0;
+        file.read(reinterpret_cast<char*>(&version), sizeof(uint8_t));
+        if (version != CurrentCacheVersion) {
+            return nullptr;
+        }
+
+        auto image = std::make_shared<Image>();
+        uint8_t nChannels = 0;
+        file.read(reinterpret_cast<char*>(&image->resolution.x), sizeof(uint32_t));
+        file.read(reinterpret_cast<char*>(&image->resolution.y), sizeof(uint32_t));
+        file.read(reinterpret_cast<char*>(&nChannels), sizeof(uint8_t));
+        image->nChannels = nChannels;
+        if (!file.good() || nChannels < 1 || nChannels > 4) {
+            return nullptr;
+        }
+
+        const size_t size = imageSize(*image);
+        image->pixels = std::unique_ptr<std::byte[]>(new std::byte[size]);
+        file.read(reinterpret_cast<char*>(image->pixels.get()), size);
+        if (!file.good()) {
+            return nullptr;
+        }
+        return image;
+    }
+
+    void writeCachedImage(const Image& image, const std::filesystem::path& path) {
+        // The same image might be decoded by multiple threads if it is loaded with
+        // different settings, so every thread writes to its own file before moving it
+        static std::atomic_int Counter = 0;
+        std::filesystem::path tmp = path;
+        tmp += std::format(".{}.tmp", Counter++);
+
+        {
+            std::ofstream file = std::ofstream(tmp, std::ofstream::binary);
+            if (!file.good()) {
+                LWARNING(std::format("Could not write texture cache file '{}'", path));
+                return;
+            }
+
+            const uint8_t nChannels = static_cast<uint8_t>(image.nChannels);
+            const uint8_t version = CurrentCacheVersion;
+            file.write(reinterpret_cast<const char*>(&version), sizeof(uint8_t));
+            file.write(
+                reinterpret_cast<const char*>(&image.resolution.x),
+                sizeof(uint32_t)
+            );
+            file.write(
+                reinterpret_cast<const char*>(&image.resolution.y),
+                sizeof(uint32_t)
+            );
+            file.write(reinterpret_cast<const char*>(&nChannels), sizeof(uint8_t));
+            file.write(
+                reinterpret_cast<const char*>(image.pixels.get()),
+                imageSize(image)
+            );
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tmp, path, ec);
+        if (ec) {
+            std::filesystem::remove(tmp, ec);
+        }
+    }
+
+    // Runs on a worker thread. Returns `nullptr` if the image can not be decoded here, in
+    // which case the texture reader has to load it on the rendering thread
+    std::shared_ptr<Image> decodeImage(const std::filesystem::path& path,
+                                       const std::filesystem::path& cachePath)
+    {
+        ZoneScoped;
+
+        if (!cachePath.empty()) {
+            std::shared_ptr<Image> image = readCachedImage(cachePath);
+            if (image) {
+                return image;
+            }
+        }
+
+        // The flag only applies to this thread. OpenGL expects the bottom row first
+        stbi_set_flip_vertically_on_load_thread(1);
+        int width = 0;
+        int height = 0;
+        int nChannels = 0;
+        stbi_uc* data = stbi_load(path.string().c_str(), &width, &height, &nChannels, 0);
+        if (!data) {
+            return nullptr;
+        }
+
+        auto image = std::make_shared<Image>();
+        image->resolution = glm::uvec2(width, height);
+        image->nChannels = nChannels;
+        const size_t size = imageSize(*image);
+        image->pixels = std::unique_ptr<std::byte[]>(new std::byte[size]);
+        std::memcpy(image->pixels.get(), data, size);
+        stbi_image_free(data);
+
+        if (!cachePath.empty()) {
+            writeCachedImage(*image, cachePath);
+        }
+        return image;
+    }
+
+    bool hasSameContent(const std::filesystem::path& a, const std::filesystem::path& b) {
+        std::ifstream fileA = std::ifstream(a, std::ifstream::binary);
+        std::ifstream fileB = std::ifstream(b, std::ifstream::binary);
+        if (!fileA.good() || !fileB.good()) {
+            return false;
+        }
+
+        constexpr std::streamsize BufferSize = 64 * 1024;
+        std::vector<char> bufferA = std::vector<char>(BufferSize);
+        std::vector<char> bufferB = std::vector<char>(BufferSize);
+        while (fileA && fileB) {
+            fileA.read(bufferA.data(), BufferSize);
+            fileB.read(bufferB.data(), BufferSize);
+            const std::streamsize n = fileA.gcount();
+            if (n != fileB.gcount() ||
+                !std::equal(bufferA.begin(), bufferA.begin() + n, bufferB.begin()))
+            {
+                return false;
+            }
+        }
+        return fileA.eof() && fileB.eof();
+    }
+} // namespace
+
+namespace openspace {
+
+TextureCache::TextureCache(size_t nThreads)
+    : _threadPool(nThreads)
+{}
+
+std::shared_ptr<TextureCache::SharedTexture> TextureCache::load(
+                                                        const std::filesystem::path& path,
+                                                                 const Settings& settings)
+{
+    ZoneScoped;
+
+    const std::lock_guard lock(_mutex);
+
+    // Remove the textures that are no longer used by any component
+    std::erase_if(_textures, [](const auto& p) { return p.second.texture.expired(); });
+
+    // The settings are part of the key as they are applied to the shared texture
+    const unsigned int hash = contentHash(path);
+    const std::string key = std::format(
+        "{}|{}|{}|{}|{}",
+        hash, settings.nDimensions, static_cast<int>(settings.filterMode),
+        static_cast<int>(settings.wrappingMode), settings.shouldPurgeFromRAM
+    );
+
+    const auto it = _textures.find(key);
+    if (it != _textures.end() && isSameContent(it->second, path)) {
+        std::shared_ptr<SharedTexture> texture = it->second.texture.lock();
+        if (texture) {
+            LDEBUG(std::format("Reusing texture loaded from '{}'", path));
+            return texture;
+        }
+    }
+
+    auto texture = std::make_shared<SharedTexture>();
+    texture->path = path;
+    texture->nDimensions = settings.nDimensions;
+    const std::uintmax_t size = std::filesystem::file_size(path);
+    if (settings.nDimensions == 2) {
+        std::filesystem::path cachePath;
+        if (FileSys.cacheManager()) {
+            cachePath = FileSys.cacheManager()->cachedFilename(
+                std::format("texture_{:08x}", hash),
+                std::to_string(size)
+            );
+        }
+
+        auto task = std::make_shared<std::packaged_task<std::shared_ptr<Image>()>>(
+            [path, cachePath]() { return decodeImage(path, cachePath); }
+        );
+        texture->image = task->get_future().share();
+        _threadPool.enqueue([task]() { (*task)(); });
+    }
+    else {
+        // Only two-dimensional images are decoded on the worker threads. The others are
+        // loaded by the texture reader when the texture is created
+        std::promise<std::shared_ptr<Image>> noImage;
+        noImage.set_value(nullptr);
+        texture->image = noImage.get_future().share();
+    }
+
+    // Replaces the cached texture if the hash collided or the file it was loaded from
+    // has changed. Components using that texture keep it alive
+    _textures[key] = {
+        .texture = texture,
+        .path = path,
+        .lastWriteTime = std::filesystem::last_write_time(path),
+        .size = size
+    };
+    return texture;
+}
+
+bool TextureCache::isDecoded(const SharedTexture& texture) {
+    using namespace std::chrono_literals;
+    return texture.isCreated ||
+           texture.image.wait_for(0s) == std::future_status::ready;
+}
+
+void TextureCache::createTexture(SharedTexture& texture) {
+    ZoneScoped;
+
+    if (texture.isCreated) {
+        return;
+    }
+    texture.isCreated = true;
+
+    std::shared_ptr<Image> image;
+    try {
+        image = texture.image.get();
+    }
+    catch (const std::future_error&) {
+        // The cache was destroyed before the image was decoded
+    }
+    texture.image = {};
+
+    using namespace ghoul::opengl;
+    if (image) {
+        const Texture::Format format = textureFormat(image->nChannels);
+        texture.texture = std::make_unique<Texture>(
+            image->pixels.release(),
+            glm::uvec3(image->resolution, 1),
+            GL_TEXTURE_2D,
+            format,
+            static_cast<GLenum>(format),
+            GL_UNSIGNED_BYTE
+        );
+    }
+    else {
+        texture.texture = ghoul::io::TextureReader::ref().loadTexture(
+            texture.path,
+            texture.nDimensions
+        );
+    }
+
+    if (texture.texture) {
+        LDEBUG(std::format("Loaded texture from '{}'", texture.path));
+    }
+}
+
+unsigned int TextureCache::contentHash(const std::filesystem::path& path) {
+    const std::filesystem::file_time_type time = std::filesystem::last_write_time(path);
+    const std::uintmax_t size = std::filesystem::file_size(path);
+
+    const auto it = _fileHashes.find(path.string());
+    if (it != _fileHashes.end() &&
+        it->second.lastWriteTime == time && it->second.size == size)
+    {
+        return it->second.hash;
+    }
+
+    const unsigned int hash = ghoul::hashCRC32File(path);
+    _fileHashes[path.string()] = { time, size, hash };
+    return hash;
+}
+
+bool TextureCache::isSameContent(const CachedTexture& cached,
+                                 const std::filesystem::path& path)
+{
+    std::error_code ec;
+    const std::filesystem::file_time_type time =
+        std::filesystem::last_write_time(cached.path, ec);
+    if (ec || time != cached.lastWriteTime ||
+        std::filesystem::file_size(cached.path, ec) != cached.size || ec)
+    {
+        // The file of the cached texture has changed since it was loaded, so its content
+        // is unknown
+        return false;
+    }
+
+    if (cached.path == path) {
+        // The hash of the file was computed for this version of the file
+        return true;
+    }
+
+    return cached.size == std::filesystem::file_size(path) &&
+           hasSameContent(cached.path, path);
+}
+
+} // namespace openspace
@@ -24,9 +24,10 @@
 
 #include <openspace/rendering/texturecomponent.h>
 
+#include <openspace/engine/globals.h>
+#include <openspace/rendering/renderengine.h>
 #include <ghoul/filesystem/file.h>
 #include <ghoul/filesystem/filesystem.h>
-#include <ghoul/io/texture/texturereader.h>
 #include <ghoul/logging/logmanager.h>
 
 namespace {
@@ -45,11 +46,11 @@ TextureComponent::TextureComponent(int nDimensions)
 }
 
 const ghoul::opengl::Texture* TextureComponent::texture() const {
-    return _texture.get();
+    return _texture ? _texture->texture.get() : nullptr;
 }
 
 ghoul::opengl::Texture* TextureComponent::texture() {
-    return _texture.get();
+    return _texture ? _texture->texture.get() : nullptr;
 }
 
 void TextureComponent::setFilterMode(ghoul::opengl::Texture::FilterMode filterMode) {
@@ -70,7 +71,7 @@ void TextureComponent::setShouldPurgeFromRAM(bool value) {
 
 void TextureComponent::bind() {
     ghoul_assert(_texture, "Texture must be loaded before binding");
-    _texture->bind();
+    _texture->texture->bind();
 }
 
 void TextureComponent::uploadToGpu() {
@@ -78,51 +79,75 @@ void TextureComponent::uploadToGpu() {
         LERROR("Could not upload texture to GPU. Texture not loaded");
         return;
     }
-    _texture->uploadTexture();
-    _texture->setFilter(_filterMode);
-    _texture->setWrapping(_wrappingMode);
+    if (_texture->isUploaded) {
+        // The texture is shared with another component that has already uploaded it
+        return;
+    }
+    ghoul::opengl::Texture& texture = *_texture->texture;
+    texture.uploadTexture();
+    texture.setFilter(_filterMode);
+    texture.setWrapping(_wrappingMode);
     if (_shouldPurgeFromRAM) {
-        _texture->purgeFromRAM();
+        texture.purgeFromRAM();
     }
+    _texture->isUploaded = true;
 }
 
-void TextureComponent::loadFromFile(const std::filesystem::path& path) {
+void TextureComponent::loadFromFile(const std::filesystem::path& path,
+                                    WaitForTexture waitForTexture)
+{
     if (path.empty()) {
         return;
     }
 
-    using namespace ghoul::io;
-    using namespace ghoul::opengl;
-
     std::filesystem::path absolutePath = absPath(path);
+    if (!std::filesystem::is_regular_file(absolutePath)) {
+        LERROR(std::format("Could not find texture '{}'", absolutePath));
+        return;
+    }
 
-    std::unique_ptr<Texture> texture = TextureReader::ref().loadTexture(
-        absolutePath,
-        _nDimensions
-    );
-
-    if (texture) {
-        LDEBUG(std::format("Loaded texture from '{}'", absolutePath));
-        _texture = std::move(texture);
-
-        _textureFile = std::make_unique<ghoul::filesystem::File>(absolutePath);
-        if (_shouldWatchFile) {
-            _textureFile->setCallback([this]() { _fileIsDirty = true; });
-        }
-
-        _fileIsDirty = false;
-        _textureIsDirty = true;
+    const TextureCache::Settings settings = {
+        .nDimensions = _nDimensions,
+        .filterMode = _filterMode,
+        .wrappingMode = _wrappingMode,
+        .shouldPurgeFromRAM = _shouldPurgeFromRAM
+    };
+    _pendingTexture = global::renderEngine->textureCache().load(absolutePath, settings);
+
+    _textureFile = std::make_unique<ghoul::filesystem::File>(absolutePath);
+    if (_shouldWatchFile) {
+        _textureFile->setCallback([this]() { _fileIsDirty = true; });
     }
+    _fileIsDirty = false;
+
+    finishLoading(waitForTexture);
 }
 
 void TextureComponent::update() {
     if (_fileIsDirty) {
-        loadFromFile(_textureFile->path());
+        loadFromFile(_textureFile->path(), WaitForTexture::No);
     }
+    finishLoading(WaitForTexture::No);
 
     if (_textureIsDirty) {
         uploadToGpu();
         _textureIsDirty = false;
     }
 }
+
+void TextureComponent::finishLoading(WaitForTexture waitForTexture) {
+    if (!_pendingTexture ||
+        (!waitForTexture && !TextureCache::isDecoded(*_pendingTexture)))
+    {
+        return;
+    }
+
+    TextureCache::createTexture(*_pendingTexture);
+    if (_pendingTexture->texture) {
+        _texture = std::move(_pendingTexture);
+        _textureIsDirty = true;
+    }
+    _pendingTexture = nullptr;
+}
+
 } // namespace openspace
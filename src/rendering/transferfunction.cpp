@@ -28,16 +28,145 @@
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/io/texture/texturereader.h>
 #include <ghoul/logging/logmanager.h>
+#include <ghoul/misc/crc32.h>
 #include <ghoul/misc/stringhelper.h>
 #include <ghoul/opengl/texture.h>
+#include <algorithm>
+#include <deque>
 #include <iterator>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 namespace {
     constexpr std::string_view _loggerCat = "TransferFunction";
+
+    // The largest difference between the baked and the exact transfer function if no
+    // width was specified, which corresponds to half of an 8-bit color step
+    constexpr float MaxInterpolationError = 1.f / 512.f;
+
+    // The number of baked transfer functions that are kept in the cache
+    constexpr size_t MaxCachedTransferFunctions = 32;
+
+    struct BakedTransferFunction {
+        std::string source;
+        std::vector<float> texels;
+        int width = 0;
+    };
+
+    // The baked transfer functions keyed by the hash of their source. Identical files,
+    // or files that are changed back to a previous state, are thus only baked once
+    std::mutex CacheMutex;
+    std::unordered_map<unsigned int, std::shared_ptr<const BakedTransferFunction>> Cache;
+    std::deque<unsigned int> CacheOrder;
+
+    glm::vec4 premultiplied(const glm::vec4& color) {
+        return glm::vec4(glm::vec3(color) * color.a, color.a);
+    }
+
+    // Returns the exact premultiplied value of the transfer function at the position
+    glm::vec4 evaluate(const openspace::PiecewiseTransferFunction& tf, float position) {
+        using namespace openspace;
+
+        const auto it = std::upper_bound(
+            tf.keys.begin(),
+            tf.keys.end(),
+            position,
+            [](float p, const MappingKey& key) { return p < key.position; }
+        );
+        if (it == tf.keys.begin()) {
+            return premultiplied(tf.keys.front().color / 255.f);
+        }
+        if (it == tf.keys.end()) {
+            return premultiplied(tf.keys.back().color / 255.f);
+        }
+
+        const MappingKey& prev = *(it - 1);
+        const float t = (position - prev.position) / (it->position - prev.position);
+        return premultiplied(glm::mix(prev.color, it->color, t) / 255.f);
+    }
+
+    // Returns the largest difference between the linear interpolation of a transfer
+    // function that is baked with the provided width and the exact transfer function
+    float interpolationError(const openspace::PiecewiseTransferFunction& tf, int width) {
+        using namespace openspace;
+
+        const float h = 1.f / static_cast<float>(width - 1);
+        float error = 0.f;
+        for (size_t i = 1; i < tf.keys.size(); i++) {
+            const MappingKey& k0 = tf.keys[i - 1];
+            const MappingKey& k1 = tf.keys[i];
+            const float length = k1.position - k0.position;
+            if (length <= 0.f) {
+                continue;
+            }
+
+            // Between two keys, the premultiplied colors are the product of two linear
+            // functions. The error of interpolating such a quadratic function linearly is
+            // bounded by h^2 / 8 times its second derivative
+            const glm::vec4 slope = (k1.color - k0.color) / (255.f * length);
+            const glm::vec3 secondDerivative = 2.f * glm::vec3(slope) * slope.a;
+            const glm::vec3 e = glm::abs(secondDerivative) * (h * h / 8.f);
+            error = std::max({ error, e.r, e.g, e.b });
+        }
+
+        // At the keys themselves, the slope of the function changes abruptly, which the
+        // interpolation between the two surrounding texels cannot represent
+        for (const MappingKey& key : tf.keys) {
+            if (key.position <= tf.lower || key.position >= tf.upper) {
+                continue;
+            }
+            const float x = key.position * static_cast<float>(width - 1);
+            const float i0 = std::floor(x);
+            const float i1 = std::min(i0 + 1.f, static_cast<float>(width - 1));
+            const glm::vec4 interpolated = glm::mix(
+                evaluate(tf, i0 * h),
+                evaluate(tf, i1 * h),
+                x - i0
+            );
+            const glm::vec4 e = glm::abs(interpolated - evaluate(tf, key.position));
+            error = std::max({ error, e.r, e.g, e.b, e.a });
+        }
+        return error;
+    }
+
+    std::shared_ptr<const BakedTransferFunction> bake(std::string source) {
+        using namespace openspace;
+
+        const unsigned int hash = ghoul::hashCRC32(source);
+
+        const std::lock_guard lock(CacheMutex);
+        const auto it = Cache.find(hash);
+        if (it != Cache.end() && it->second->source == source) {
+            return it->second;
+        }
+
+        std::istringstream stream = std::istringstream(source);
+        const PiecewiseTransferFunction tf = parseTransferFunction(stream);
+        if (tf.keys.empty()) {
+            return nullptr;
+        }
+
+        auto baked = std::make_shared<BakedTransferFunction>();
+        baked->width = tf.width > 0 ?
+            tf.width :
+            adaptiveTransferFunctionWidth(tf, MaxInterpolationError);
+        baked->texels = bakeTransferFunction(tf, baked->width);
+        baked->source = std::move(source);
+
+        if (it == Cache.end()) {
+            CacheOrder.push_back(hash);
+        }
+        Cache[hash] = baked;
+        if (CacheOrder.size() > MaxCachedTransferFunctions) {
+            Cache.erase(CacheOrder.front());
+            CacheOrder.pop_front();
+        }
+        return baked;
+    }
 } // namespace
 
 namespace openspace {
@@ -101,103 +230,24 @@ void TransferFunction::setTextureFromTxt() {
         throw ghoul::FileNotFoundError(_filepath);
     }
 
-    int width = 512;
-    float lower = 0.f;
-    float upper = 1.f;
-
-    std::vector<MappingKey> mappingKeys;
-
-    std::string line;
-
-    while (ghoul::getline(in, line)) {
-        std::istringstream iss(line);
-        std::string key;
-        iss >> key;
-
-        if (key == "width") {
-            iss >> width;
-        }
-        else if (key == "lower") {
-            iss >> lower;
-            lower = glm::clamp(lower, 0.f, 1.f);
-        }
-        else if (key == "upper") {
-            iss >> upper;
-            upper = glm::clamp(upper, lower, 1.f);
-        }
-        else if (key == "mappingkey") {
-            float intensity = 0.f;
-            glm::vec4 rgba;
-            iss >> intensity;
-            for (int i = 0; i < 4; i++) {
-                iss >> rgba[i];
-            }
-            mappingKeys.emplace_back(intensity, rgba);
-        }
-    }
+    std::string source = std::string(
+        std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>()
+    );
     in.close();
 
-    if (mappingKeys.empty()) {
+    const std::shared_ptr<const BakedTransferFunction> baked = bake(std::move(source));
+    if (!baked) {
         return;
     }
 
-    if (mappingKeys.front().position > lower) {
-        mappingKeys.insert(mappingKeys.begin(), {lower, mappingKeys.front().color});
-    }
-
-    if (mappingKeys.back().position < upper) {
-        mappingKeys.emplace_back(upper, mappingKeys.back().color);
-    }
-
-    // allocate new float array with zeros
-    float* transferFunction = new float[width * 4];
-    for (int i = 0; i < 4 * width; i++) {
-        transferFunction[i] = 0.f;
-    }
-
-    const size_t lowerIndex = static_cast<size_t>(
-        std::floor(lower * static_cast<float>(width - 1))
-    );
-    const size_t upperIndex = static_cast<size_t>(
-        std::floor(upper * static_cast<float>(width - 1))
-    );
-
-    auto prevKey = mappingKeys.begin();
-    auto currentKey = prevKey + 1;
-    auto lastKey = mappingKeys.end() -1;
-
-    for (size_t i = lowerIndex; i <= upperIndex; i++) {
-        const float fpos = static_cast<float>(i) / static_cast<float>(width-1);
-        if (fpos > currentKey->position) {
-            prevKey = currentKey;
-            currentKey++;
-            if (currentKey == mappingKeys.end()) {
-                currentKey = lastKey;
-            }
-        }
-
-        const float dist = fpos - prevKey->position;
-        const float weight = dist / (currentKey->position - prevKey->position);
-
-        for (int channel = 0; channel < 4; ++channel) {
-            const size_t position = 4 * i + channel;
-            // Interpolate linearly between prev and next mapping key
-            float value = (prevKey->color[channel] * (1.f - weight) +
-                          currentKey->color[channel] * weight) / 255.f;
-            if (channel < 3) {
-                // Premultiply with alpha
-                value *= (prevKey->color[3] * (1.f - weight) +
-                         currentKey->color[3] * weight) / 255.f;
-            }
-            transferFunction[position] = value;
-        }
-    }
-
-    // no need to deallocate transferFunction. Ownership is transferred to the Texture.
+    // The cached texels are shared, so the texture gets a copy to take ownership of
+    float* transferFunction = new float[baked->texels.size()];
+    std::copy(baked->texels.begin(), baked->texels.end(), transferFunction);
 
     _texture = std::make_unique<ghoul::opengl::Texture>(
         transferFunction,
-        glm::size3_t(width, 1, 1),
+        glm::size3_t(baked->width, 1, 1),
         GL_TEXTURE_1D,
         ghoul::opengl::Texture::Format::RGBA,
         GL_RGBA,
@@ -237,4 +287,128 @@ void TransferFunction::bind() {
     _texture->bind();
 }
 
+PiecewiseTransferFunction parseTransferFunction(std::istream& stream) {
+    PiecewiseTransferFunction tf;
+
+    std::string line;
+    while (ghoul::getline(stream, line)) {
+        std::istringstream iss(line);
+        std::string key;
+        iss >> key;
+
+        if (key == "width") {
+            iss >> tf.width;
+        }
+        else if (key == "lower") {
+            iss >> tf.lower;
+            tf.lower = glm::clamp(tf.lower, 0.f, 1.f);
+        }
+        else if (key == "upper") {
+            iss >> tf.upper;
+            tf.upper = glm::clamp(tf.upper, tf.lower, 1.f);
+        }
+        else if (key == "mappingkey") {
+            float intensity = 0.f;
+            glm::vec4 rgba = glm::vec4(0.f);
+            iss >> intensity;
+            for (int i = 0; i < 4; i++) {
+                iss >> rgba[i];
+            }
+            tf.keys.emplace_back(intensity, rgba);
+        }
+    }
+
+    if (tf.keys.empty()) {
+        return tf;
+    }
+
+    std::stable_sort(
+        tf.keys.begin(),
+        tf.keys.end(),
+        [](const MappingKey& lhs, const MappingKey& rhs) {
+            return lhs.position < rhs.position;
+        }
+    );
+
+    if (tf.keys.front().position > tf.lower) {
+        tf.keys.insert(tf.keys.begin(), { tf.lower, tf.keys.front().color });
+    }
+    if (tf.keys.back().position < tf.upper) {
+        tf.keys.emplace_back(tf.upper, tf.keys.back().color);
+    }
+    return tf;
+}
+
+int adaptiveTransferFunctionWidth(const PiecewiseTransferFunction& tf, float maxError,
+                                  int minWidth, int maxWidth)
+{
+    ghoul_assert(minWidth > 1, "Minimum width must be larger than 1");
+    ghoul_assert(maxWidth >= minWidth, "Maximum width must not be smaller than minimum");
+
+    if (tf.keys.size() < 2) {
+        return minWidth;
+    }
+
+    int width = minWidth;
+    while (width < maxWidth && interpolationError(tf, width) > maxError) {
+        width *= 2;
+    }
+    return std::min(width, maxWidth);
+}
+
+std::vector<float> bakeTransferFunction(const PiecewiseTransferFunction& tf, int width) {
+    std::vector<float> result = std::vector<float>(4 * width, 0.f);
+    if (tf.keys.empty() || width < 2) {
+        return result;
+    }
+
+    const float w = static_cast<float>(width - 1);
+    const size_t lowerIndex = static_cast<size_t>(std::floor(tf.lower * w));
+    const size_t upperIndex = static_cast<size_t>(std::floor(tf.upper * w));
+
+    auto store = [&result](size_t i, const glm::vec4& color) {
+        result[4 * i] = color.r * color.a;
+        result[4 * i + 1] = color.g * color.a;
+        result[4 * i + 2] = color.b * color.a;
+        result[4 * i + 3] = color.a;
+    };
+
+    // Texels in front of the first key take its color
+    size_t i = lowerIndex;
+    const glm::vec4 first = tf.keys.front().color / 255.f;
+    for (; i <= upperIndex && static_cast<float>(i) / w < tf.keys.front().position; i++) {
+        store(i, first);
+    }
+
+    // The texels are filled one segment between two keys at a time, so that the inner
+    // loop does not need to search for the keys surrounding each texel
+    for (size_t k = 1; k < tf.keys.size(); k++) {
+        const MappingKey& k0 = tf.keys[k - 1];
+        const MappingKey& k1 = tf.keys[k];
+        const float length = k1.position - k0.position;
+        if (length <= 0.f) {
+            continue;
+        }
+
+        const size_t last = std::min(
+            upperIndex,
+            static_cast<size_t>(std::max(std::floor(k1.position * w), 0.f))
+        );
+        const glm::vec4 c0 = k0.color / 255.f;
+        const glm::vec4 dc = (k1.color - k0.color) / 255.f;
+        for (; i <= last; i++) {
+            const float t = (static_cast<float>(i) / w - k0.position) / length;
+            store(i, c0 + t * dc);
+        }
+    }
+
+    // Texels behind the last key take its color
+    const glm::vec4 back = tf.keys.back().color / 255.f;
+    for (; i <= upperIndex; i++) {
+        store(i, back);
+    }
+
+    return result;
+}
+
 } // namespace openspace
@@ -37,8 +37,11 @@
 #include <ghoul/filesystem/filesystem.h>
 #include <ghoul/logging/logmanager.h>
 #include <ghoul/lua/lua_helper.h>
+#include <ghoul/misc/defer.h>
+#include <ghoul/misc/dictionaryluaformatter.h>
 #include <ghoul/misc/profiling.h>
 #include <ghoul/ext/assimp/contrib/zip/src/zip.h>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 
@@ -83,6 +86,18 @@ namespace {
 
         return result;
     }
+
+    // Returns the code of the script as it has to be sent to other nodes in the cluster,
+    // remote peers, or the session recording. These only receive the source code, so the
+    // arguments have to be spliced into it
+    std::string transportCode(const openspace::scripting::ScriptEngine::Script& script) {
+        if (script.arguments.isEmpty()) {
+            return script.code;
+        }
+        return std::format(
+            "args = {}\n{}", ghoul::formatLua(script.arguments), script.code
+        );
+    }
 #include "scriptengine_codegen.cpp"
 } // namespace
 
@@ -112,6 +127,7 @@ void ScriptEngine::deinitialize() {
         }
     }
     _repeatedScripts.clear();
+    clearCompiledScripts();
 }
 
 void ScriptEngine::initializeLuaState(lua_State* state) {
@@ -161,6 +177,7 @@ void ScriptEngine::addLibrary(LuaLibrary library) {
     std::sort(library.functions.begin(), library.functions.end(), sortFunc);
     _registeredLibraries.push_back(std::move(library));
     std::sort(_registeredLibraries.begin(), _registeredLibraries.end());
+    _isLuaFunctionIndexDirty = true;
 }
 
 bool ScriptEngine::hasLibrary(const std::string& name) {
@@ -185,7 +202,7 @@ bool ScriptEngine::runScript(const Script& script) {
     // Binary scripts should never be logged
     if (_logScripts && !ghoul::lua::isScriptBinary(script.code)) {
         if (script.addToLog && !global::configuration->verboseScriptLog) {
-            writeLog(script.code);
+            writeLog(transportCode(script));
         }
         else if (global::configuration->verboseScriptLog) {
             // Even if the script doesn't want to get logged, it will get anyway if
@@ -195,34 +212,53 @@ bool ScriptEngine::runScript(const Script& script) {
                 script.addToLog ? "" : "--[[generated]]",
                 script.synchronized ? "--[[sync]]" : "--[[!sync]]",
                 script.sendToRemote ? "--[[sendRemote]]" : "--[[!sendRemote]]",
-                script.code
+                transportCode(script)
             ));
         }
     }
 
+    ghoul::Dictionary returnValue;
     try {
-        if (script.callback) {
-            ghoul::Dictionary returnValue =
-                ghoul::lua::loadArrayDictionaryFromString(script.code, _state);
-            script.callback(std::move(returnValue));
+        const int top = lua_gettop(_state);
+        defer {
+            lua_settop(_state, top);
+        };
+
+        if (!pushCompiledScript(script.code)) {
+            LERROR(std::format("Error loading script: {}", lua_tostring(_state, -1)));
+            if (script.callback) {
+                script.callback(ghoul::Dictionary());
+            }
+            return false;
         }
-        else {
-            ghoul::lua::runScript(_state, script.code);
+
+        if (!script.arguments.isEmpty()) {
+            ghoul::lua::push(_state, script.arguments);
+            lua_setglobal(_state, "args");
         }
-    }
-    catch (const ghoul::lua::LuaLoadingException& e) {
-        LERRORC(e.component, e.message);
-        if (script.callback) {
-            script.callback(ghoul::Dictionary());
+
+        const auto start = std::chrono::steady_clock::now();
+        const int result = lua_pcall(_state, 0, script.callback ? LUA_MULTRET : 0, 0);
+        _statistics.executionTime += std::chrono::steady_clock::now() - start;
+
+        if (result != LUA_OK) {
+            LERROR(std::format("Error executing script: {}", lua_tostring(_state, -1)));
+            if (script.callback) {
+                script.callback(ghoul::Dictionary());
+            }
+            return false;
         }
-        return false;
-    }
-    catch (const ghoul::lua::LuaExecutionException& e) {
-        LERRORC(e.component, e.message);
+
         if (script.callback) {
-            script.callback(ghoul::Dictionary());
+            // Collect all return values into an array-like table
+            const int nResults = lua_gettop(_state) - top;
+            lua_createtable(_state, nResults, 0);
+            lua_insert(_state, top + 1);
+            for (int i = nResults; i > 0; i--) {
+                lua_rawseti(_state, top + 1, i);
+            }
+            returnValue = ghoul::lua::luaDictionaryFromState(_state);
         }
-        return false;
     }
     catch (const documentation::SpecificationError& e) {
         LERRORC(e.component, e.message);
@@ -240,9 +276,66 @@ bool ScriptEngine::runScript(const Script& script) {
         return false;
     }
 
+    if (script.callback) {
+        script.callback(std::move(returnValue));
+    }
+    return true;
+}
+
+bool ScriptEngine::pushCompiledScript(const std::string& code) {
+    ZoneScoped;
+
+    const auto it = _compiledScripts.find(code);
+    if (it != _compiledScripts.end()) {
+        it->second.lastUse = ++_compiledScriptsClock;
+        _statistics.nCacheHits++;
+        lua_rawgeti(_state, LUA_REGISTRYINDEX, it->second.reference);
+        return true;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const int result = luaL_loadbuffer(_state, code.data(), code.size(), code.c_str());
+    _statistics.compileTime += std::chrono::steady_clock::now() - start;
+    _statistics.nCompilations++;
+    if (result != LUA_OK) {
+        return false;
+    }
+
+    if (_compiledScripts.size() >= MaxCompiledScripts) {
+        const auto lru = std::min_element(
+            _compiledScripts.begin(),
+            _compiledScripts.end(),
+            [](const std::pair<const std::string, CompiledScript>& lhs,
+               const std::pair<const std::string, CompiledScript>& rhs)
+            {
+                return lhs.second.lastUse < rhs.second.lastUse;
+            }
+        );
+        luaL_unref(_state, LUA_REGISTRYINDEX, lru->second.reference);
+        _compiledScripts.erase(lru);
+    }
+
+    // Keep one copy of the function on the stack for the caller
+    lua_pushvalue(_state, -1);
+    const int reference = luaL_ref(_state, LUA_REGISTRYINDEX);
+    _compiledScripts[code] = {
+        .reference = reference,
+        .lastUse = ++_compiledScriptsClock
+    };
     return true;
 }
 
+void ScriptEngine::clearCompiledScripts() {
+    for (const std::pair<const std::string, CompiledScript>& p : _compiledScripts) {
+        luaL_unref(_state, LUA_REGISTRYINDEX, p.second.reference);
+    }
+    _compiledScripts.clear();
+}
+
+const ScriptEngine::Statistics& ScriptEngine::statistics() const {
+    return _statistics;
+}
+
 bool ScriptEngine::isLibraryNameAllowed(lua_State* state, const std::string& name) {
     bool result = false;
     lua_getglobal(state, OpenSpaceLibraryName.data());
@@ -434,6 +527,14 @@ const std::vector<LuaLibrary>& ScriptEngine::allLuaLibraries() const {
     return _registeredLibraries;
 }
 
+const CompletionIndex& ScriptEngine::luaFunctionIndex() {
+    if (_isLuaFunctionIndexDirty) {
+        _luaFunctionIndex.assign(allLuaFunctions());
+        _isLuaFunctionIndexDirty = false;
+    }
+    return _luaFunctionIndex;
+}
+
 void ScriptEngine::writeLog(const std::string& script) {
     ZoneScoped;
 
@@ -484,27 +585,33 @@ void ScriptEngine::preSync(bool isMaster) {
             // Not really a received script but the master also needs to run the script...
             _masterScriptQueue.push(item);
 
-            if (global::sessionRecordingHandler->isRecording()) {
-                global::sessionRecordingHandler->saveScriptKeyframeToTimeline(item.code);
+            const bool isRecording = global::sessionRecordingHandler->isRecording();
+            if (!isRecording && !item.synchronized) {
+                continue;
+            }
+
+            std::string code = transportCode(item);
+            if (isRecording) {
+                global::sessionRecordingHandler->saveScriptKeyframeToTimeline(code);
             }
 
             // Sync out to other nodes (cluster)
             if (!item.synchronized) {
                 continue;
             }
-            _scriptsToSync.push_back(item.code);
 
             // Send to other peers (parallel connection)
             if (global::parallelPeer->isHost() && item.sendToRemote) {
-                global::parallelPeer->sendScript(item.code);
+                global::parallelPeer->sendScript(code);
             }
+            _scriptsToSync.push_back(std::move(code));
         }
     }
     else {
         while (!_incomingScripts.empty()) {
             Script item = std::move(_incomingScripts.front());
             _incomingScripts.pop();
-            _clientScriptQueue.push(item.code);
+            _clientScriptQueue.push(transportCode(item));
         }
     }
 }
@@ -734,7 +841,8 @@ void ScriptEngine::addBaseLibrary() {
             codegen::lua::UnzipFile,
             codegen::lua::RegisterRepeatedScript,
             codegen::lua::RemoveRepeatedScript,
-            codegen::lua::ScheduleScript
+            codegen::lua::ScheduleScript,
+            codegen::lua::ScriptStatistics
         }
     };
     addLibrary(lib);
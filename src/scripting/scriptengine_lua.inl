@@ -305,6 +305,34 @@ namespace {
     openspace::global::scriptEngine->scheduleScript(std::move(script), delay);
 }
 
+/**
+ * Returns statistics about the scripts that have been run by the script engine. The
+ * returned table contains the number of scripts that had to be compiled
+ * (`Compilations`), the number of scripts that were reused from the cache of compiled
+ * scripts (`CacheHits`), as well as the total time in seconds spent compiling
+ * (`CompileTime`) and executing (`ExecutionTime`) them.
+ */
+[[codegen::luawrap]] ghoul::Dictionary scriptStatistics() {
+    using namespace openspace;
+    using namespace std::chrono;
+
+    const scripting::ScriptEngine::Statistics& stats =
+        global::scriptEngine->statistics();
+
+    ghoul::Dictionary res;
+    res.setValue("Compilations", static_cast<double>(stats.nCompilations));
+    res.setValue("CacheHits", static_cast<double>(stats.nCacheHits));
+    res.setValue(
+        "CompileTime",
+        duration_cast<duration<double>>(stats.compileTime).count()
+    );
+    res.setValue(
+        "ExecutionTime",
+        duration_cast<duration<double>>(stats.executionTime).count()
+    );
+    return res;
+}
+
 #include "scriptengine_lua_codegen.cpp"
 
 } // namespace
@@ -0,0 +1,188 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/util/asynclog.h>
+
+#include <ghoul/format.h>
+#include <ghoul/misc/profiling.h>
+#include <chrono>
+
+namespace {
+    // The time the writer thread sleeps if there are no messages to write
+    constexpr std::chrono::milliseconds IdleTime = std::chrono::milliseconds(5);
+} // namespace
+
+namespace openspace {
+
+AsyncLog::AsyncLog(std::unique_ptr<ghoul::logging::Log> log, LogLevel logLevel,
+                   size_t capacity)
+    : _log(std::move(log))
+    , _logLevel(logLevel)
+    , _buffer(capacity)
+{
+    _writerThread = std::thread([this]() { writeMessages(); });
+}
+
+AsyncLog::~AsyncLog() {
+    _isRunning = false;
+    _wakeCondition.notify_one();
+    _writerThread.join();
+}
+
+void AsyncLog::log(LogLevel level, std::string_view category, std::string_view message)
+{
+    if (level < _logLevel) {
+        return;
+    }
+
+    if (level == LogLevel::Fatal) {
+        // Fatal messages are written directly, even if the buffer is full, as the
+        // application might terminate right after. The messages that are still in the
+        // buffer are written first to keep the order of the messages
+        const std::lock_guard lock(_writeMutex);
+        writeBufferedMessages();
+        writeRepetitions();
+        _log->log(level, category, message);
+        _previous = { level, std::string(category), std::string(message) };
+        return;
+    }
+
+    Message m = { level, std::string(category), std::string(message) };
+    if (_buffer.push(std::move(m))) {
+        _nPushed++;
+    }
+    else {
+        _nDropped++;
+    }
+}
+
+void AsyncLog::waitForPendingMessages() {
+    const uint64_t target = _nPushed;
+    _wakeCondition.notify_one();
+
+    std::unique_lock lock(_wakeMutex);
+    _writtenCondition.wait(lock, [&]() { return _nWritten >= target || !_isRunning; });
+}
+
+uint64_t AsyncLog::nDroppedMessages() const {
+    return _nDropped;
+}
+
+void AsyncLog::writeMessages() {
+    while (true) {
+        // Read the flag before draining the buffer so that no message that was logged
+        // before the destructor was called is lost
+        const bool isRunning = _isRunning;
+
+        bool hasWritten = false;
+        {
+            const std::lock_guard lock(_writeMutex);
+            hasWritten = writeBufferedMessages();
+
+            const uint64_t nDropped = _nDropped;
+            if (nDropped > _nReportedDropped) {
+                writeRepetitions();
+                _log->log(
+                    LogLevel::Warning,
+                    "AsyncLog",
+                    std::format(
+                        "{} messages were dropped as the log buffer was full",
+                        nDropped - _nReportedDropped
+                    )
+                );
+                _nReportedDropped = nDropped;
+            }
+
+            // Report repetitions as soon as the messages stop coming in, rather than
+            // waiting for the next different message
+            if (!isRunning || !hasWritten) {
+                writeRepetitions();
+            }
+        }
+
+        if (!isRunning) {
+            // Wake up threads that are still waiting for messages to be written
+            {
+                const std::lock_guard lock(_wakeMutex);
+            }
+            _writtenCondition.notify_all();
+            return;
+        }
+
+        if (!hasWritten) {
+            std::unique_lock lock(_wakeMutex);
+            _wakeCondition.wait_for(lock, IdleTime);
+        }
+    }
+}
+
+bool AsyncLog::writeBufferedMessages() {
+    Message message;
+    bool hasWritten = false;
+    while (_buffer.pop(message)) {
+        write(std::move(message));
+        _nWritten++;
+        hasWritten = true;
+    }
+
+    if (hasWritten) {
+        // Locking the mutex ensures that the notification can not get lost between the
+        // check and the wait in waitForPendingMessages
+        {
+            const std::lock_guard lock(_wakeMutex);
+        }
+        _writtenCondition.notify_all();
+    }
+    return hasWritten;
+}
+
+void AsyncLog::write(Message message) {
+    ZoneScoped;
+
+    if (message.level == _previous.level && message.category == _previous.category &&
+        message.message == _previous.message)
+    {
+        _nRepetitions++;
+        return;
+    }
+
+    writeRepetitions();
+    _log->log(message.level, message.category, message.message);
+    _previous = std::move(message);
+}
+
+void AsyncLog::writeRepetitions() {
+    if (_nRepetitions == 0) {
+        return;
+    }
+
+    _log->log(
+        _previous.level,
+        _previous.category,
+        std::format("Previous message repeated {} times", _nRepetitions)
+    );
+    _nRepetitions = 0;
+}
+
+} // namespace openspace
@@ -0,0 +1,272 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/util/boundingvolume.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace {
+    // Computes the eigenvalues and eigenvectors of the symmetric matrix `a` using the
+    // cyclic Jacobi method. The eigenvectors are returned as the columns of the matrix
+    std::pair<glm::dvec3, glm::dmat3> symmetricEigen(glm::dmat3 a) {
+        constexpr int MaxSweeps = 50;
+
+        glm::dmat3 v = glm::dmat3(1.0);
+        for (int sweep = 0; sweep < MaxSweeps; sweep++) {
+            const double off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+            const double diag = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+            if (off <= 1e-24 * diag || off == 0.0) {
+                break;
+            }
+
+            for (int p = 0; p < 2; p++) {
+                for (int q = p + 1; q < 3; q++) {
+                    const double apq = a[q][p];
+                    if (apq == 0.0) {
+                        continue;
+                    }
+
+                    // Rotation in the pq-plane that eliminates the element apq
+                    const double theta = (a[q][q] - a[p][p]) / (2.0 * apq);
+                    const double t = (theta >= 0.0 ? 1.0 : -1.0) /
+                        (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                    const double c = 1.0 / std::sqrt(t * t + 1.0);
+                    const double s = t * c;
+
+                    glm::dmat3 rotation = glm::dmat3(1.0);
+                    rotation[p][p] = c;
+                    rotation[q][q] = c;
+                    rotation[q][p] = s;
+                    rotation[p][q] = -s;
+
+                    a = glm::transpose(rotation) * a * rotation;
+                    v = v * rotation;
+                }
+            }
+        }
+
+        return { glm::dvec3(a[0][0], a[1][1], a[2][2]), v };
+    }
+
+    template <typename T>
+    openspace::OrientedBox orientedBox(std::span<const T> positions,
+                                       unsigned int nThreads)
+    {
+        using namespace openspace;
+
+        OrientedBox box;
+        const size_t nPoints = positions.size();
+        if (nPoints == 0) {
+            return box;
+        }
+
+        const unsigned int nChunks = detail::numberOfChunks(nPoints, nThreads);
+
+        //
+        // Mean of all positions
+        std::vector<glm::dvec3> sums = std::vector<glm::dvec3>(nChunks);
+        detail::forEachChunk(
+            nPoints,
+            nChunks,
+            [&sums, positions](unsigned int chunk, size_t begin, size_t end) {
+                glm::dvec3 sum = glm::dvec3(0.0);
+                for (size_t i = begin; i < end; i++) {
+                    sum += glm::dvec3(positions[i]);
+                }
+                sums[chunk] = sum;
+            }
+        );
+        glm::dvec3 mean = glm::dvec3(0.0);
+        for (const glm::dvec3& sum : sums) {
+            mean += sum;
+        }
+        mean /= static_cast<double>(nPoints);
+
+        //
+        // Covariance matrix. Only the upper triangle is accumulated as it is symmetric
+        using Covariance = std::array<double, 6>;
+        std::vector<Covariance> partials = std::vector<Covariance>(nChunks);
+        detail::forEachChunk(
+            nPoints,
+            nChunks,
+            [&partials, positions, mean](unsigned int chunk, size_t begin, size_t end) {
+                Covariance c = {};
+                for (size_t i = begin; i < end; i++) {
+                    const glm::dvec3 d = glm::dvec3(positions[i]) - mean;
+                    c[0] += d.x * d.x;
+                    c[1] += d.x * d.y;
+                    c[2] += d.x * d.z;
+                    c[3] += d.y * d.y;
+                    c[4] += d.y * d.z;
+                    c[5] += d.z * d.z;
+                }
+                partials[chunk] = c;
+            }
+        );
+        Covariance c = {};
+        for (const Covariance& partial : partials) {
+            for (size_t i = 0; i < c.size(); i++) {
+                c[i] += partial[i];
+            }
+        }
+        const glm::dmat3 covariance = glm::dmat3(
+            c[0], c[1], c[2],
+            c[1], c[3], c[4],
+            c[2], c[4], c[5]
+        );
+
+        //
+        // The eigenvectors are the axes of the box, sorted by decreasing variance
+        auto [eigenvalues, eigenvectors] = symmetricEigen(covariance);
+        std::array<int, 3> order = { 0, 1, 2 };
+        std::sort(
+            order.begin(),
+            order.end(),
+            [&eigenvalues](int lhs, int rhs) {
+                return eigenvalues[lhs] > eigenvalues[rhs];
+            }
+        );
+        glm::dmat3 axes;
+        for (int i = 0; i < 3; i++) {
+            axes[i] = glm::normalize(eigenvectors[order[i]]);
+        }
+        // Make sure that the axes form a right-handed coordinate system
+        if (glm::dot(glm::cross(axes[0], axes[1]), axes[2]) < 0.0) {
+            axes[2] = -axes[2];
+        }
+
+        //
+        // Extent of the positions along each of the axes
+        struct Extent {
+            glm::dvec3 minimum = glm::dvec3(std::numeric_limits<double>::max());
+            glm::dvec3 maximum = glm::dvec3(-std::numeric_limits<double>::max());
+        };
+        std::vector<Extent> extents = std::vector<Extent>(nChunks);
+        const glm::dmat3 toLocal = glm::transpose(axes);
+        detail::forEachChunk(
+            nPoints,
+            nChunks,
+            [&extents, positions, mean, toLocal](unsigned int chunk, size_t begin,
+                                                 size_t end)
+            {
+                Extent& extent = extents[chunk];
+                for (size_t i = begin; i < end; i++) {
+                    const glm::dvec3 p = toLocal * (glm::dvec3(positions[i]) - mean);
+                    extent.minimum = glm::min(extent.minimum, p);
+                    extent.maximum = glm::max(extent.maximum, p);
+                }
+            }
+        );
+        Extent extent;
+        for (const Extent& e : extents) {
+            extent.minimum = glm::min(extent.minimum, e.minimum);
+            extent.maximum = glm::max(extent.maximum, e.maximum);
+        }
+
+        box.axes = axes;
+        box.center = mean + axes * ((extent.minimum + extent.maximum) * 0.5);
+        box.halfExtents = (extent.maximum - extent.minimum) * 0.5;
+        return box;
+    }
+} // namespace
+
+namespace openspace {
+
+bool BoundingVolume::isEmpty() const {
+    return minimum.x > maximum.x;
+}
+
+BoundingVolume computeBoundingVolume(std::span<const glm::vec3> positions,
+                                     unsigned int nThreads)
+{
+    return computeBoundingVolume(
+        positions.size(),
+        [positions](size_t i) { return glm::dvec3(positions[i]); },
+        nThreads
+    );
+}
+
+BoundingVolume computeBoundingVolume(std::span<const glm::dvec3> positions,
+                                     unsigned int nThreads)
+{
+    return computeBoundingVolume(
+        positions.size(),
+        [positions](size_t i) { return positions[i]; },
+        nThreads
+    );
+}
+
+OrientedBox computeOrientedBox(std::span<const glm::vec3> positions,
+                               unsigned int nThreads)
+{
+    return orientedBox(positions, nThreads);
+}
+
+OrientedBox computeOrientedBox(std::span<const glm::dvec3> positions,
+                               unsigned int nThreads)
+{
+    return orientedBox(positions, nThreads);
+}
+
+double transformedOriginRadius(const BoundingVolume& volume,
+                               const glm::dmat4& transform)
+{
+    if (volume.isEmpty()) {
+        return 0.0;
+    }
+
+    // The transformed box is always contained in the sphere through its farthest corner
+    double radius = 0.0;
+    for (int i = 0; i < 8; i++) {
+        const glm::dvec3 corner = glm::dvec3(
+            (i & 1) ? volume.maximum.x : volume.minimum.x,
+            (i & 2) ? volume.maximum.y : volume.minimum.y,
+            (i & 4) ? volume.maximum.z : volume.minimum.z
+        );
+        const glm::dvec3 p = glm::dvec3(transform * glm::dvec4(corner, 1.0));
+        radius = std::max(radius, glm::length(p));
+    }
+
+    // If the transform is a rotation with a uniform scaling, the sphere around the origin
+    // stays a sphere, which is a tighter fit than the box for most distributions
+    const glm::dmat3 m = glm::dmat3(transform);
+    const double scale = glm::length(m[0]);
+    constexpr double Epsilon = 1e-9;
+    const bool isSimilarity =
+        std::abs(glm::length(m[1]) - scale) <= Epsilon * scale &&
+        std::abs(glm::length(m[2]) - scale) <= Epsilon * scale &&
+        std::abs(glm::dot(m[0], m[1])) <= Epsilon * scale * scale &&
+        std::abs(glm::dot(m[0], m[2])) <= Epsilon * scale * scale &&
+        std::abs(glm::dot(m[1], m[2])) <= Epsilon * scale * scale;
+    if (isSimilarity) {
+        const glm::dvec3 translation = glm::dvec3(transform[3]);
+        radius = std::min(radius, glm::length(translation) + scale * volume.originRadius);
+    }
+
+    return radius;
+}
+
+} // namespace openspace
@@ -0,0 +1,123 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <openspace/util/completionindex.h>
+
+#include <ghoul/misc/assert.h>
+#include <ghoul/misc/stringhelper.h>
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+namespace openspace {
+
+CompletionIndex::CompletionIndex(std::vector<std::string> entries) {
+    assign(std::move(entries));
+}
+
+void CompletionIndex::assign(std::vector<std::string> entries) {
+    std::vector<std::string> keys;
+    keys.reserve(entries.size());
+    for (const std::string& entry : entries) {
+        keys.push_back(ghoul::toLowerCase(entry));
+    }
+
+    // Sort by the lowercase key first and use the original entry to make the order of
+    // entries that only differ in their case deterministic
+    std::vector<size_t> order(entries.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(
+        order.begin(),
+        order.end(),
+        [&keys, &entries](size_t lhs, size_t rhs) {
+            return std::tie(keys[lhs], entries[lhs]) < std::tie(keys[rhs], entries[rhs]);
+        }
+    );
+
+    _entries.clear();
+    _keys.clear();
+    _entries.reserve(entries.size());
+    _keys.reserve(entries.size());
+    for (size_t i : order) {
+        if (!_entries.empty() && _entries.back() == entries[i]) {
+            continue;
+        }
+        _entries.push_back(std::move(entries[i]));
+        _keys.push_back(std::move(keys[i]));
+    }
+}
+
+size_t CompletionIndex::size() const {
+    return _entries.size();
+}
+
+bool CompletionIndex::empty() const {
+    return _entries.empty();
+}
+
+const std::string& CompletionIndex::operator[](size_t index) const {
+    ghoul_assert(index < _entries.size(), "Index out of bounds");
+    return _entries[index];
+}
+
+std::pair<size_t, size_t> CompletionIndex::prefixRange(std::string_view prefix) const {
+    const std::string p = ghoul::toLowerCase(std::string(prefix));
+
+    // All keys that start with the prefix are sorted directly after the prefix itself
+    const auto first = std::lower_bound(_keys.begin(), _keys.end(), p);
+    const auto last = std::partition_point(
+        first,
+        _keys.end(),
+        [&p](const std::string& key) { return key.starts_with(p); }
+    );
+    return {
+        static_cast<size_t>(std::distance(_keys.begin(), first)),
+        static_cast<size_t>(std::distance(_keys.begin(), last))
+    };
+}
+
+std::vector<size_t> CompletionIndex::fuzzyMatches(std::string_view pattern) const {
+    const std::string p = ghoul::toLowerCase(std::string(pattern));
+
+    std::vector<size_t> result;
+    for (size_t i = 0; i < _keys.size(); i++) {
+        const std::string& key = _keys[i];
+        if (key.size() < p.size()) {
+            continue;
+        }
+
+        size_t iPattern = 0;
+        for (size_t iKey = 0; iKey < key.size() && iPattern < p.size(); iKey++) {
+            if (key[iKey] == p[iPattern]) {
+                iPattern++;
+            }
+        }
+        if (iPattern == p.size()) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+} // namespace openspace
@@ -26,17 +26,58 @@
 
 #include <algorithm>
 
+namespace {
+    // The maximum number of messages that can arrive between two calls to
+    // addIncomingEntries or removeExpiredEntries
+    constexpr size_t IncomingCapacity = 1024;
+
+    // The maximum number of entries that are stored
+    constexpr size_t MaxEntries = 256;
+} // namespace
+
 namespace openspace {
 
 ScreenLog::ScreenLog(std::chrono::seconds timeToLive, LogLevel logLevel)
     : _timeToLive(timeToLive)
     , _logLevel(logLevel)
+    , _incoming(IncomingCapacity)
 {
     _entries.reserve(64);
 }
 
+void ScreenLog::addIncomingEntries() {
+    ZoneScoped;
+
+    LogEntry entry;
+    while (_incoming.pop(entry)) {
+        if (!_entries.empty()) {
+            LogEntry& last = _entries.back();
+            if (last.level == entry.level && last.category == entry.category &&
+                last.message == entry.message)
+            {
+                last.timeStamp = entry.timeStamp;
+                last.timeString = std::move(entry.timeString);
+                last.nRepetitions++;
+                continue;
+            }
+        }
+        _entries.push_back(std::move(entry));
+    }
+
+    if (_entries.size() > MaxEntries) {
+        const auto end = _entries.end() - MaxEntries;
+        for (auto it = _entries.begin(); it != end; it++) {
+            _nDroppedEntries += it->nRepetitions + 1;
+        }
+        _entries.erase(_entries.begin(), end);
+    }
+}
+
 void ScreenLog::removeExpiredEntries() {
-    const std::lock_guard guard(_mutex);
+    ZoneScoped;
+
+    addIncomingEntries();
+
     const auto t = std::chrono::steady_clock::now();
 
     const auto rit = std::remove_if(
@@ -51,15 +92,17 @@ void ScreenLog::removeExpiredEntries() {
 void ScreenLog::log(LogLevel level, std::string_view category, std::string_view message) {
     ZoneScoped;
 
-    const std::lock_guard guard(_mutex);
     if (level >= _logLevel) {
-        _entries.push_back({
+        const bool success = _incoming.push({
             level,
             std::chrono::steady_clock::now(),
             Log::timeString(),
             std::string(category),
             std::string(message)
         });
+        if (!success) {
+            _nDroppedEntries++;
+        }
     }
 }
 
@@ -67,4 +110,8 @@ const std::vector<ScreenLog::LogEntry>& ScreenLog::entries() const {
     return _entries;
 }
 
+size_t ScreenLog::nDroppedEntries() const {
+    return _nDroppedEntries;
+}
+
 } // namespace openspace
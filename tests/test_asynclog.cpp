@@ -0,0 +1,255 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/util/asynclog.h>
+#include <openspace/util/concurrentringbuffer.h>
+#include <ghoul/format.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    class CapturingLog : public ghoul::logging::Log {
+    public:
+        void log(ghoul::logging::LogLevel, std::string_view,
+                 std::string_view message) override
+        {
+            const std::lock_guard lock(mutex);
+            messages.emplace_back(message);
+        }
+
+        std::mutex mutex;
+        std::vector<std::string> messages;
+    };
+
+    // A log that blocks the writer thread in the first call until it is released
+    class BlockingLog : public CapturingLog {
+    public:
+        void log(ghoul::logging::LogLevel level, std::string_view category,
+                 std::string_view message) override
+        {
+            {
+                std::unique_lock lock(gateMutex);
+                if (!hasEntered) {
+                    hasEntered = true;
+                    gateCondition.notify_all();
+                    gateCondition.wait(lock, [this]() { return isReleased; });
+                }
+            }
+            CapturingLog::log(level, category, message);
+        }
+
+        void waitUntilEntered() {
+            std::unique_lock lock(gateMutex);
+            gateCondition.wait(lock, [this]() { return hasEntered; });
+        }
+
+        void release() {
+            const std::lock_guard lock(gateMutex);
+            isReleased = true;
+            gateCondition.notify_all();
+        }
+
+        std::mutex gateMutex;
+        std::condition_variable gateCondition;
+        bool hasEntered = false;
+        bool isReleased = false;
+    };
+} // namespace
+
+TEST_CASE("ConcurrentRingBuffer: Basic", "[concurrentringbuffer]") {
+    ConcurrentRingBuffer<int> buffer(3);
+    CHECK(buffer.capacity() == 4);
+
+    int value = 0;
+    CHECK_FALSE(buffer.pop(value));
+
+    for (int i = 0; i < 4; i++) {
+        CHECK(buffer.push(int(i)));
+    }
+    CHECK_FALSE(buffer.push(4));
+
+    for (int i = 0; i < 4; i++) {
+        REQUIRE(buffer.pop(value));
+        CHECK(value == i);
+    }
+    CHECK_FALSE(buffer.pop(value));
+
+    // Wrapping around the end of the buffer
+    CHECK(buffer.push(5));
+    REQUIRE(buffer.pop(value));
+    CHECK(value == 5);
+}
+
+TEST_CASE("ConcurrentRingBuffer: Multiple Producers", "[concurrentringbuffer]") {
+    constexpr int NThreads = 4;
+    constexpr int NItems = 10000;
+
+    ConcurrentRingBuffer<int> buffer(64);
+    std::vector<std::thread> producers;
+    for (int t = 0; t < NThreads; t++) {
+        producers.emplace_back([&buffer]() {
+            for (int i = 0; i < NItems; i++) {
+                while (!buffer.push(int(i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    long long sum = 0;
+    int nReceived = 0;
+    while (nReceived < NThreads * NItems) {
+        int value = 0;
+        if (buffer.pop(value)) {
+            sum += value;
+            nReceived++;
+        }
+    }
+    for (std::thread& t : producers) {
+        t.join();
+    }
+
+    CHECK(sum == static_cast<long long>(NThreads) * NItems * (NItems - 1) / 2);
+}
+
+TEST_CASE("AsyncLog: Repetitions", "[asynclog]") {
+    auto capture = std::make_unique<CapturingLog>();
+    CapturingLog* c = capture.get();
+
+    AsyncLog log = AsyncLog(std::move(capture));
+    log.log(ghoul::logging::LogLevel::Warning, "Test", "a");
+    for (int i = 0; i < 100; i++) {
+        log.log(ghoul::logging::LogLevel::Warning, "Test", "b");
+    }
+    log.log(ghoul::logging::LogLevel::Warning, "Test", "c");
+    log.waitForPendingMessages();
+
+    // Depending on when the writer thread catches up, the repetitions might be reported
+    // in multiple parts, but together they have to account for every message
+    const std::lock_guard lock(c->mutex);
+    REQUIRE(c->messages.size() >= 3);
+    CHECK(c->messages.front() == "a");
+    CHECK(c->messages[1] == "b");
+    CHECK(c->messages.back() == "c");
+
+    int nB = 0;
+    for (const std::string& m : c->messages) {
+        if (m == "b") {
+            nB++;
+        }
+        else if (m.starts_with("Previous message repeated ")) {
+            nB += std::stoi(m.substr(m.find_first_of("0123456789")));
+        }
+    }
+    CHECK(nB == 100);
+    CHECK(log.nDroppedMessages() == 0);
+}
+
+TEST_CASE("AsyncLog: Fatal messages are written immediately", "[asynclog]") {
+    auto capture = std::make_unique<CapturingLog>();
+    CapturingLog* c = capture.get();
+
+    AsyncLog log = AsyncLog(std::move(capture));
+    log.log(ghoul::logging::LogLevel::Fatal, "Test", "fatal");
+
+    const std::lock_guard lock(c->mutex);
+    REQUIRE(c->messages.size() == 1);
+    CHECK(c->messages[0] == "fatal");
+}
+
+TEST_CASE("AsyncLog: Fatal messages are not dropped", "[asynclog]") {
+    auto capture = std::make_unique<BlockingLog>();
+    BlockingLog* c = capture.get();
+
+    AsyncLog log = AsyncLog(std::move(capture), ghoul::logging::LogLevel::AllLogging, 2);
+    log.log(ghoul::logging::LogLevel::Warning, "Test", "first");
+    c->waitUntilEntered();
+
+    // The writer thread is blocked, so the buffer fills up and the last message is
+    // dropped
+    log.log(ghoul::logging::LogLevel::Warning, "Test", "a");
+    log.log(ghoul::logging::LogLevel::Warning, "Test", "b");
+    log.log(ghoul::logging::LogLevel::Warning, "Test", "c");
+    CHECK(log.nDroppedMessages() == 1);
+
+    std::atomic_bool hasReturned = false;
+    std::thread fatal = std::thread([&log, &hasReturned]() {
+        log.log(ghoul::logging::LogLevel::Fatal, "Test", "fatal");
+        hasReturned = true;
+    });
+    // Give the fatal message time to arrive while the buffer is still full
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK_FALSE(hasReturned);
+    c->release();
+    fatal.join();
+    CHECK(hasReturned);
+
+    // The report of the dropped message might be written before the fatal message
+    const std::lock_guard lock(c->mutex);
+    REQUIRE(c->messages.size() >= 4);
+    CHECK(c->messages[0] == "first");
+    CHECK(c->messages[1] == "a");
+    CHECK(c->messages[2] == "b");
+    CHECK(c->messages.back() == "fatal");
+}
+
+TEST_CASE("AsyncLog: Throughput", "[asynclog][.benchmark]") {
+    constexpr int NThreads = 8;
+    constexpr int NMessages = 100000;
+
+    AsyncLog log = AsyncLog(std::make_unique<CapturingLog>());
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NThreads; t++) {
+        threads.emplace_back([&log, t]() {
+            for (int i = 0; i < NMessages; i++) {
+                log.log(
+                    ghoul::logging::LogLevel::Warning,
+                    "Benchmark",
+                    "Thread " + std::to_string(t) + " message " + std::to_string(i % 8)
+                );
+            }
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    const std::chrono::duration<double> duration =
+        std::chrono::steady_clock::now() - start;
+
+    WARN(std::format(
+        "{} log calls per second on {} threads, {} dropped",
+        static_cast<double>(NThreads) * NMessages / duration.count(),
+        NThreads, log.nDroppedMessages()
+    ));
+}
@@ -0,0 +1,141 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/util/boundingvolume.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    std::vector<glm::dvec3> randomPoints(size_t n, glm::dvec3 offset) {
+        std::mt19937 rng = std::mt19937(1337);
+        std::uniform_real_distribution<double> dist = std::uniform_real_distribution(
+            -1.0,
+            1.0
+        );
+        std::vector<glm::dvec3> points;
+        points.reserve(n);
+        for (size_t i = 0; i < n; i++) {
+            points.push_back(offset + glm::dvec3(dist(rng), dist(rng), dist(rng)));
+        }
+        return points;
+    }
+} // namespace
+
+TEST_CASE("BoundingVolume: Empty", "[boundingvolume]") {
+    const BoundingVolume bounds = computeBoundingVolume(std::span<const glm::dvec3>());
+    CHECK(bounds.isEmpty());
+    CHECK(bounds.radius == 0.0);
+    CHECK(bounds.originRadius == 0.0);
+    CHECK(transformedOriginRadius(bounds, glm::dmat4(1.0)) == 0.0);
+}
+
+TEST_CASE("BoundingVolume: Box", "[boundingvolume]") {
+    std::vector<glm::vec3> points;
+    for (int i = 0; i < 8; i++) {
+        points.emplace_back(
+            (i & 1) ? 11.f : 9.f,
+            (i & 2) ? 1.f : -1.f,
+            (i & 4) ? 1.f : -1.f
+        );
+    }
+
+    const BoundingVolume bounds = computeBoundingVolume(points);
+    CHECK_FALSE(bounds.isEmpty());
+    CHECK(bounds.minimum.x == 9.0);
+    CHECK(bounds.maximum.x == 11.0);
+    CHECK(bounds.minimum.y == -1.0);
+    CHECK(bounds.maximum.z == 1.0);
+    CHECK(bounds.center.x == Catch::Approx(10.0));
+    CHECK(bounds.center.y == Catch::Approx(0.0));
+    CHECK(bounds.radius == Catch::Approx(std::sqrt(3.0)));
+    CHECK(bounds.originRadius == Catch::Approx(std::sqrt(123.0)));
+}
+
+TEST_CASE("BoundingVolume: Parallel Matches Serial", "[boundingvolume]") {
+    const glm::dvec3 offset = glm::dvec3(5.0, -2.0, 1.0);
+    const std::vector<glm::dvec3> points = randomPoints(500000, offset);
+
+    const BoundingVolume serial = computeBoundingVolume(points, 1);
+    const BoundingVolume parallel = computeBoundingVolume(points, 8);
+    CHECK(serial.minimum == parallel.minimum);
+    CHECK(serial.maximum == parallel.maximum);
+    CHECK(serial.radius == parallel.radius);
+    CHECK(serial.originRadius == parallel.originRadius);
+
+    for (const glm::dvec3& p : points) {
+        REQUIRE(glm::distance(p, parallel.center) <= parallel.radius);
+        REQUIRE(glm::length(p) <= parallel.originRadius);
+    }
+}
+
+TEST_CASE("BoundingVolume: Transformed Origin Radius", "[boundingvolume]") {
+    const std::vector<glm::dvec3> points = randomPoints(1000, glm::dvec3(3.0, 0.0, 0.0));
+    const BoundingVolume bounds = computeBoundingVolume(points);
+
+    // A uniform scaling results in the exact radius
+    const glm::dmat4 scale = glm::scale(glm::dmat4(1.0), glm::dvec3(2.0));
+    CHECK(
+        transformedOriginRadius(bounds, scale) == Catch::Approx(2.0 * bounds.originRadius)
+    );
+
+    // Any other transform has to result in a sphere containing all points
+    glm::dmat4 shear = glm::dmat4(1.0);
+    shear[1][0] = 0.5;
+    shear[2] = glm::dvec4(0.0, 0.0, 4.0, 0.0);
+    shear[3] = glm::dvec4(-1.0, 2.0, 0.0, 1.0);
+    const double radius = transformedOriginRadius(bounds, shear);
+    for (const glm::dvec3& p : points) {
+        const glm::dvec3 q = glm::dvec3(shear * glm::dvec4(p, 1.0));
+        REQUIRE(glm::length(q) <= radius);
+    }
+}
+
+TEST_CASE("BoundingVolume: Oriented Box", "[boundingvolume]") {
+    // Points along an inclined segment with a small spread perpendicular to it
+    const glm::dvec3 direction = glm::normalize(glm::dvec3(1.0, 1.0, 0.0));
+    const glm::dvec3 normal = glm::normalize(glm::dvec3(-1.0, 1.0, 0.0));
+    std::vector<glm::dvec3> points;
+    for (int i = -100; i <= 100; i++) {
+        const double spread = (i % 2 == 0) ? 0.01 : -0.01;
+        points.push_back(direction * (i * 0.1) + normal * spread);
+    }
+
+    const OrientedBox box = computeOrientedBox(points);
+    CHECK(std::abs(glm::dot(box.axes[0], direction)) == Catch::Approx(1.0));
+    CHECK(std::abs(glm::dot(box.axes[1], normal)) == Catch::Approx(1.0));
+    CHECK(box.halfExtents.x == Catch::Approx(10.0));
+    CHECK(box.halfExtents.y == Catch::Approx(0.01));
+    CHECK(box.halfExtents.z == Catch::Approx(0.0).margin(1e-9));
+    CHECK(glm::length(box.center) == Catch::Approx(0.0).margin(1e-9));
+
+    // The axes have to form a right-handed orthonormal basis
+    const glm::dvec3 normalOfPlane = glm::cross(box.axes[0], box.axes[1]);
+    CHECK(glm::dot(normalOfPlane, box.axes[2]) == Catch::Approx(1.0));
+}
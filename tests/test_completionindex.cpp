@@ -0,0 +1,84 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/util/completionindex.h>
+#include <string>
+#include <vector>
+
+using namespace openspace;
+
+TEST_CASE("CompletionIndex: Sorted and Unique", "[completionindex]") {
+    const CompletionIndex index = CompletionIndex({
+        "openspace.time.setTime", "openspace.asset.add", "openspace.Asset.remove",
+        "openspace.asset.add"
+    });
+
+    REQUIRE(index.size() == 3);
+    CHECK(index[0] == "openspace.asset.add");
+    CHECK(index[1] == "openspace.Asset.remove");
+    CHECK(index[2] == "openspace.time.setTime");
+}
+
+TEST_CASE("CompletionIndex: Prefix Range", "[completionindex]") {
+    const CompletionIndex index = CompletionIndex({
+        "openspace.time.setTime", "openspace.time.currentTime", "openspace.asset.add",
+        "openspace.printInfo", "openspace.timeQuantum"
+    });
+
+    {
+        const auto [first, last] = index.prefixRange("openspace.TIME.");
+        REQUIRE(last - first == 2);
+        CHECK(index[first] == "openspace.time.currentTime");
+        CHECK(index[first + 1] == "openspace.time.setTime");
+    }
+    {
+        const auto [first, last] = index.prefixRange("openspace.time");
+        CHECK(last - first == 3);
+    }
+    {
+        const auto [first, last] = index.prefixRange("");
+        CHECK(first == 0);
+        CHECK(last == index.size());
+    }
+    {
+        const auto [first, last] = index.prefixRange("openspace.zzz");
+        CHECK(first == last);
+    }
+}
+
+TEST_CASE("CompletionIndex: Fuzzy Matches", "[completionindex]") {
+    const CompletionIndex index = CompletionIndex({
+        "openspace.time.setTime", "openspace.asset.add", "openspace.setPropertyValue"
+    });
+
+    const std::vector<size_t> matches = index.fuzzyMatches("SETpv");
+    REQUIRE(matches.size() == 1);
+    CHECK(index[matches[0]] == "openspace.setPropertyValue");
+
+    CHECK(index.fuzzyMatches("tst").size() == 1);
+    CHECK(index.fuzzyMatches("").size() == 3);
+    CHECK(index.fuzzyMatches("xyz").empty());
+}
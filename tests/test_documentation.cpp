@@ -24,6 +24,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <openspace/documentation/compiledspecification.h>
 #include <openspace/documentation/documentation.h>
 #include <openspace/documentation/documentationengine.h>
 #include <openspace/documentation/verifier.h>
@@ -2815,3 +2816,144 @@ TEST_CASE("Documentation: Verifier Documentation Post Conditions", "[documentati
 
     CHECK(!ReferencingVerifier("identifier"s).documentation().empty());
 }
+
+TEST_CASE("Documentation: CompiledSpecification", "[documentation]") {
+    using namespace openspace::documentation;
+    using namespace std::string_literals;
+
+    const Documentation doc = {
+        .entries = {
+            { "Bool", new BoolVerifier },
+            { "Int", new IntVerifier },
+            { "String", new StringVerifier(true), Optional::Yes },
+            { "Range", new IntInRangeVerifier(0, 5), Optional::Yes },
+            {
+                "Table",
+                new TableVerifier({
+                    { "a", new DoubleVerifier },
+                    { "b", new TableVerifier({{ "*", new StringVerifier }}) }
+                })
+            },
+            {
+                "Count",
+                new TableVerifier({{ "*", new IntVerifier }}, 2),
+                Optional::Yes
+            }
+        }
+    };
+    const CompiledSpecification spec = CompiledSpecification(doc);
+
+    ghoul::Dictionary list;
+    list.setValue("1", "a"s);
+    list.setValue("2", "b"s);
+    ghoul::Dictionary table;
+    table.setValue("a", 1.5);
+    table.setValue("b", list);
+
+    ghoul::Dictionary positive;
+    positive.setValue("Bool", true);
+    positive.setValue("Int", 2.0);
+    positive.setValue("Table", table);
+    CHECK(spec.test(positive));
+    CHECK(testSpecification(doc, positive).success);
+
+    auto checkAgreement = [&](const ghoul::Dictionary& d, bool expected) {
+        CHECK(spec.test(d) == expected);
+        CHECK(testSpecification(doc, d).success == expected);
+    };
+
+    ghoul::Dictionary d = positive;
+    d.setValue("Int", 2.5);
+    checkAgreement(d, false);
+
+    d = positive;
+    d.setValue("String", ""s);
+    checkAgreement(d, false);
+
+    d = positive;
+    d.setValue("Range", 7);
+    checkAgreement(d, false);
+    d.setValue("Range", 3);
+    checkAgreement(d, true);
+
+    ghoul::Dictionary badList = list;
+    badList.setValue("3", 1.0);
+    ghoul::Dictionary badTable = table;
+    badTable.setValue("b", badList);
+    d = positive;
+    d.setValue("Table", badTable);
+    checkAgreement(d, false);
+
+    ghoul::Dictionary count;
+    count.setValue("1", 1);
+    d = positive;
+    d.setValue("Count", count);
+    checkAgreement(d, false);
+    count.setValue("2", 2);
+    d.setValue("Count", count);
+    checkAgreement(d, true);
+
+    ghoul::Dictionary missing;
+    missing.setValue("Bool", true);
+    checkAgreement(missing, false);
+}
+
+TEST_CASE("Documentation: CompiledSpecification Cache", "[documentation]") {
+    using namespace openspace::documentation;
+
+    const Documentation anonymous = {
+        .entries = {{ "Int", new IntVerifier }}
+    };
+    CHECK(compiledSpecification(anonymous) == nullptr);
+
+    const Documentation doc = {
+        .id = "test_compiledspecification_cache",
+        .entries = {{ "Int", new IntVerifier }}
+    };
+    const CompiledSpecification* spec = compiledSpecification(doc);
+    REQUIRE(spec != nullptr);
+    CHECK(compiledSpecification(doc) == spec);
+
+    // A different Documentation with the same identifier must not use the cached one
+    const Documentation other = {
+        .id = "test_compiledspecification_cache",
+        .entries = {{ "Double", new DoubleVerifier }}
+    };
+    CHECK(compiledSpecification(other) == nullptr);
+
+    // The same applies if only a nested table or the parameters of a verifier differ
+    const Documentation nested = {
+        .id = "test_compiledspecification_cache_nested",
+        .entries = {{ "Table", new TableVerifier({{ "a", new IntVerifier }}) }}
+    };
+    REQUIRE(compiledSpecification(nested) != nullptr);
+    const Documentation otherNested = {
+        .id = "test_compiledspecification_cache_nested",
+        .entries = {{ "Table", new TableVerifier({{ "a", new DoubleVerifier }}) }}
+    };
+    CHECK(compiledSpecification(otherNested) == nullptr);
+
+    const Documentation range = {
+        .id = "test_compiledspecification_cache_range",
+        .entries = {{ "Int", new IntInRangeVerifier(0, 5) }}
+    };
+    REQUIRE(compiledSpecification(range) != nullptr);
+    const Documentation otherRange = {
+        .id = "test_compiledspecification_cache_range",
+        .entries = {{ "Int", new IntInRangeVerifier(0, 10) }}
+    };
+    CHECK(compiledSpecification(otherRange) == nullptr);
+
+    ghoul::Dictionary positive;
+    positive.setValue("Int", 1);
+    CHECK_NOTHROW(testSpecificationAndThrow(doc, positive, "Test"));
+
+    ghoul::Dictionary negative;
+    negative.setValue("Int", std::string("a"));
+    CHECK_THROWS_AS(
+        testSpecificationAndThrow(doc, negative, "Test"),
+        SpecificationError
+    );
+    CHECK(spec->nTests() == 2);
+    CHECK(spec->nFailures() == 1);
+}
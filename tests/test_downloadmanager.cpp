@@ -0,0 +1,404 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/engine/downloadmanager.h>
+#include <ghoul/format.h>
+#include <ghoul/io/socket/tcpsocket.h>
+#include <ghoul/io/socket/tcpsocketserver.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    // A minimal HTTP/1.1 server that answers every GET request with the same content. It
+    // keeps connections alive, supports range requests if requested, and records the
+    // requests so that the tests can check how the DownloadManager scheduled them
+    class StandInServer {
+    public:
+        StandInServer(std::string content, std::chrono::milliseconds delay,
+                      bool supportsRanges = true)
+            : _content(std::move(content))
+            , _delay(delay)
+            , _supportsRanges(supportsRanges)
+        {
+            // Listen on a random port of the dynamic range so that test runs in parallel
+            // do not collide, and try another one if the port is already taken
+            std::mt19937 random = std::mt19937(std::random_device()());
+            std::uniform_int_distribution<int> ports =
+                std::uniform_int_distribution<int>(49152, 65535);
+            for (int attempt = 0; true; attempt++) {
+                _port = ports(random);
+                try {
+                    _server.listen(_port);
+                    break;
+                }
+                catch (const ghoul::io::TcpSocket::TcpSocketError&) {
+                    if (attempt == 10) {
+                        throw;
+                    }
+                }
+            }
+            _acceptThread = std::thread([this]() {
+                while (_isRunning) {
+                    std::unique_ptr<ghoul::io::TcpSocket> socket =
+                        _server.nextPendingTcpSocket();
+                    if (!socket) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        continue;
+                    }
+                    _nConnections++;
+                    socket->startStreams();
+                    _connectionThreads.emplace_back(
+                        [this, s = std::move(socket)]() mutable {
+                            handleConnection(std::move(s));
+                        }
+                    );
+                }
+            });
+        }
+
+        ~StandInServer() {
+            _isRunning = false;
+            _acceptThread.join();
+            _server.close();
+            for (std::thread& t : _connectionThreads) {
+                t.join();
+            }
+        }
+
+        std::string url(std::string_view path) const {
+            return std::format("http://localhost:{}/{}", _port, path);
+        }
+
+        int nConnections() const {
+            return _nConnections;
+        }
+
+        int maxConcurrentRequests() const {
+            return _maxConcurrentRequests;
+        }
+
+        std::vector<std::string> requestedPaths() {
+            const std::lock_guard lock(_mutex);
+            return _requestedPaths;
+        }
+
+        std::vector<std::string> requestedRanges() {
+            const std::lock_guard lock(_mutex);
+            return _requestedRanges;
+        }
+
+    private:
+        void handleConnection(std::unique_ptr<ghoul::io::TcpSocket> socket) {
+            while (true) {
+                // Read the request header byte by byte until the empty line
+                std::string header;
+                char c = 0;
+                while (!header.ends_with("\r\n\r\n")) {
+                    if (!socket->get(&c, 1)) {
+                        // The client closed the connection
+                        return;
+                    }
+                    header += c;
+                }
+
+                const size_t pathBegin = header.find(' ') + 2;
+                const size_t pathEnd = header.find(' ', pathBegin);
+                std::string path = header.substr(pathBegin, pathEnd - pathBegin);
+                size_t rangeBegin = 0;
+                bool hasRange = false;
+                const size_t rangePos = header.find("Range: bytes=");
+                if (rangePos != std::string::npos && _supportsRanges) {
+                    hasRange = true;
+                    rangeBegin = std::stoull(header.substr(rangePos + 13));
+                }
+
+                {
+                    const std::lock_guard lock(_mutex);
+                    _requestedPaths.push_back(path);
+                    if (hasRange) {
+                        _requestedRanges.push_back(std::to_string(rangeBegin));
+                    }
+                }
+
+                const int nActive = ++_nActiveRequests;
+                int max = _maxConcurrentRequests;
+                while (nActive > max && !_maxConcurrentRequests.compare_exchange_weak(
+                    max, nActive
+                ));
+                std::this_thread::sleep_for(_delay);
+                _nActiveRequests--;
+
+                std::string response;
+                if (hasRange && rangeBegin >= _content.size()) {
+                    // Servers usually send an error page along with the status
+                    const std::string page = "Range Not Satisfiable";
+                    response = std::format(
+                        "HTTP/1.1 416 Range Not Satisfiable\r\n"
+                        "Content-Type: text/plain\r\nContent-Length: {}\r\n\r\n{}",
+                        page.size(), page
+                    );
+                }
+                else if (hasRange) {
+                    const std::string part = _content.substr(rangeBegin);
+                    response = std::format(
+                        "HTTP/1.1 206 Partial Content\r\nContent-Type: text/plain\r\n"
+                        "Content-Range: bytes {}-{}/{}\r\nContent-Length: {}\r\n\r\n{}",
+                        rangeBegin, _content.size() - 1, _content.size(), part.size(),
+                        part
+                    );
+                }
+                else {
+                    response = std::format(
+                        "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\n"
+                        "Content-Length: {}\r\n\r\n{}",
+                        _content.size(), _content
+                    );
+                }
+                socket->put<char>(response.data(), response.size());
+            }
+        }
+
+        const std::string _content;
+        const std::chrono::milliseconds _delay;
+        const bool _supportsRanges;
+
+        ghoul::io::TcpSocketServer _server;
+        int _port = 0;
+        std::atomic_bool _isRunning = true;
+        std::thread _acceptThread;
+        std::vector<std::thread> _connectionThreads;
+
+        std::atomic_int _nConnections = 0;
+        std::atomic_int _nActiveRequests = 0;
+        std::atomic_int _maxConcurrentRequests = 0;
+
+        std::mutex _mutex;
+        std::vector<std::string> _requestedPaths;
+        std::vector<std::string> _requestedRanges;
+    };
+
+    // Downloads the url into the file, resuming from the file's current size, and waits
+    // for the download to finish
+    std::shared_ptr<DownloadManager::FileFuture> download(DownloadManager& manager,
+                                                          const std::string& url,
+                                                      const std::filesystem::path& file,
+           DownloadManager::FailOnError failOnError = DownloadManager::FailOnError::Yes)
+    {
+        std::promise<void> finished;
+        std::shared_ptr<DownloadManager::FileFuture> future = manager.downloadFile(
+            url,
+            file,
+            DownloadManager::OverrideFile::Yes,
+            failOnError,
+            5,
+            [&finished](const DownloadManager::FileFuture&) { finished.set_value(); },
+            DownloadManager::DownloadProgressCallback(),
+            DownloadManager::Priority::Normal,
+            DownloadManager::Resume::Yes
+        );
+        finished.get_future().wait();
+        return future;
+    }
+
+    // Returns a path in the temporary directory that is unique to this test run, so that
+    // test runs in parallel do not write to the same files
+    std::filesystem::path temporaryFile(std::string_view name) {
+        static const unsigned int Run = std::random_device()();
+        return std::filesystem::temp_directory_path() /
+               std::format("test_downloadmanager_{}_{}", Run, name);
+    }
+
+    std::string readFile(const std::filesystem::path& file) {
+        std::ifstream f = std::ifstream(file, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(f), {});
+    }
+} // namespace
+
+TEST_CASE("DownloadManager: Fetch File", "[downloadmanager]") {
+    StandInServer server = StandInServer("OpenSpace", std::chrono::milliseconds(0));
+    DownloadManager manager;
+
+    DownloadManager::MemoryFile file = manager.fetchFile(server.url("file")).get();
+    REQUIRE_FALSE(file.corrupted);
+    CHECK(std::string(file.buffer, file.size) == "OpenSpace");
+    CHECK(file.format == "plain");
+    free(file.buffer);
+}
+
+TEST_CASE("DownloadManager: Connection Reuse", "[downloadmanager]") {
+    StandInServer server = StandInServer("OpenSpace", std::chrono::milliseconds(0));
+    DownloadManager manager;
+
+    for (int i = 0; i < 4; i++) {
+        DownloadManager::MemoryFile file = manager.fetchFile(server.url("file")).get();
+        CHECK_FALSE(file.corrupted);
+        free(file.buffer);
+    }
+    CHECK(server.nConnections() == 1);
+}
+
+TEST_CASE("DownloadManager: Concurrency Limit", "[downloadmanager]") {
+    StandInServer server = StandInServer("OpenSpace", std::chrono::milliseconds(50));
+    DownloadManager manager = DownloadManager(
+        DownloadManager::UseMultipleThreads::Yes,
+        { .maxTransfers = 2, .maxTransfersPerHost = 2 }
+    );
+
+    std::vector<std::future<DownloadManager::MemoryFile>> futures;
+    for (int i = 0; i < 8; i++) {
+        futures.push_back(manager.fetchFile(server.url(std::to_string(i))));
+    }
+    for (std::future<DownloadManager::MemoryFile>& f : futures) {
+        DownloadManager::MemoryFile file = f.get();
+        CHECK_FALSE(file.corrupted);
+        free(file.buffer);
+    }
+    CHECK(server.requestedPaths().size() == 8);
+    CHECK(server.maxConcurrentRequests() <= 2);
+}
+
+TEST_CASE("DownloadManager: Priority", "[downloadmanager]") {
+    StandInServer server = StandInServer("OpenSpace", std::chrono::milliseconds(50));
+    DownloadManager manager = DownloadManager(
+        DownloadManager::UseMultipleThreads::Yes,
+        { .maxTransfers = 1, .maxTransfersPerHost = 1 }
+    );
+
+    std::vector<std::future<DownloadManager::MemoryFile>> futures;
+    for (int i = 0; i < 4; i++) {
+        futures.push_back(manager.fetchFile(
+            server.url(std::format("low{}", i)),
+            DownloadManager::SuccessCallback(),
+            DownloadManager::ErrorCallback(),
+            DownloadManager::Priority::Low
+        ));
+    }
+    futures.push_back(manager.fetchFile(
+        server.url("high"),
+        DownloadManager::SuccessCallback(),
+        DownloadManager::ErrorCallback(),
+        DownloadManager::Priority::High
+    ));
+    for (std::future<DownloadManager::MemoryFile>& f : futures) {
+        free(f.get().buffer);
+    }
+
+    // The first low priority request might have been started before the high priority
+    // request was queued, but none of the others
+    const std::vector<std::string> paths = server.requestedPaths();
+    REQUIRE(paths.size() == 5);
+    const auto it = std::find(paths.begin(), paths.end(), "high");
+    CHECK(std::distance(paths.begin(), it) <= 1);
+}
+
+TEST_CASE("DownloadManager: Cancel Queued", "[downloadmanager]") {
+    StandInServer server = StandInServer("OpenSpace", std::chrono::milliseconds(200));
+    DownloadManager manager = DownloadManager(
+        DownloadManager::UseMultipleThreads::Yes,
+        { .maxTransfers = 1, .maxTransfersPerHost = 1 }
+    );
+
+    std::promise<void> finished;
+    std::shared_ptr<DownloadManager::FileFuture> first = manager.downloadFile(
+        server.url("first"),
+        temporaryFile("first.txt")
+    );
+    std::shared_ptr<DownloadManager::FileFuture> second = manager.downloadFile(
+        server.url("second"),
+        temporaryFile("second.txt"),
+        DownloadManager::OverrideFile::Yes,
+        DownloadManager::FailOnError::No,
+        0,
+        [&finished](const DownloadManager::FileFuture&) { finished.set_value(); }
+    );
+    second->abortDownload = true;
+    finished.get_future().wait();
+
+    CHECK(second->isAborted);
+    CHECK_FALSE(second->isFinished);
+    const std::vector<std::string> paths = server.requestedPaths();
+    CHECK(std::find(paths.begin(), paths.end(), "second") == paths.end());
+}
+
+TEST_CASE("DownloadManager: Resume", "[downloadmanager]") {
+    std::string content;
+    for (int i = 0; i < 1000; i++) {
+        content += static_cast<char>('a' + i % 26);
+    }
+    const std::filesystem::path file = temporaryFile("resume.txt");
+
+    {
+        StandInServer server = StandInServer(content, std::chrono::milliseconds(0));
+        DownloadManager manager;
+
+        std::ofstream(file, std::ios::binary) << content.substr(0, 400);
+        std::shared_ptr<DownloadManager::FileFuture> future =
+            download(manager, server.url("file"), file);
+        CHECK(future->isFinished);
+        CHECK(readFile(file) == content);
+        CHECK(server.requestedRanges() == std::vector<std::string>{ "400" });
+
+        // Resuming a complete file does not change it
+        future = download(manager, server.url("file"), file);
+        CHECK(future->isFinished);
+        CHECK(readFile(file) == content);
+
+        // Even if the body of the error response is not treated as an error
+        future = download(
+            manager,
+            server.url("file"),
+            file,
+            DownloadManager::FailOnError::No
+        );
+        CHECK(future->isFinished);
+        CHECK(readFile(file) == content);
+    }
+
+    {
+        // If the server does not support ranges, the file is downloaded from the start
+        StandInServer server =
+            StandInServer(content, std::chrono::milliseconds(0), false);
+        DownloadManager manager;
+
+        std::ofstream(file, std::ios::binary) << content.substr(0, 400);
+        std::shared_ptr<DownloadManager::FileFuture> future =
+            download(manager, server.url("file"), file);
+        CHECK(future->isFinished);
+        CHECK(readFile(file) == content);
+    }
+
+    std::filesystem::remove(file);
+}
@@ -0,0 +1,83 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_TOUCH_ENABLED
+#include <modules/touch/include/dualnumber.h>
+#include <cmath>
+
+using namespace openspace;
+
+TEST_CASE("DualNumber: Arithmetic", "[dualnumber]") {
+    const Dual<2> x = Dual<2>::variable(3.0, 0);
+    const Dual<2> y = Dual<2>::variable(2.0, 1);
+
+    const Dual<2> sum = x + y * 2.0 - 1.0;
+    CHECK(sum.value == Catch::Approx(6.0));
+    CHECK(sum.derivatives[0] == Catch::Approx(1.0));
+    CHECK(sum.derivatives[1] == Catch::Approx(2.0));
+
+    const Dual<2> product = x * y;
+    CHECK(product.value == Catch::Approx(6.0));
+    CHECK(product.derivatives[0] == Catch::Approx(2.0));
+    CHECK(product.derivatives[1] == Catch::Approx(3.0));
+
+    const Dual<2> quotient = x / y;
+    CHECK(quotient.value == Catch::Approx(1.5));
+    CHECK(quotient.derivatives[0] == Catch::Approx(0.5));
+    CHECK(quotient.derivatives[1] == Catch::Approx(-0.75));
+
+    const Dual<2> inverse = 1.0 / x;
+    CHECK(inverse.value == Catch::Approx(1.0 / 3.0));
+    CHECK(inverse.derivatives[0] == Catch::Approx(-1.0 / 9.0));
+    CHECK(inverse.derivatives[1] == Catch::Approx(0.0));
+}
+
+TEST_CASE("DualNumber: Functions", "[dualnumber]") {
+    const Dual<1> x = Dual<1>::variable(0.5, 0);
+
+    const Dual<1> s = sin(x);
+    CHECK(s.value == Catch::Approx(std::sin(0.5)));
+    CHECK(s.derivatives[0] == Catch::Approx(std::cos(0.5)));
+
+    const Dual<1> c = cos(x);
+    CHECK(c.value == Catch::Approx(std::cos(0.5)));
+    CHECK(c.derivatives[0] == Catch::Approx(-std::sin(0.5)));
+
+    const Dual<1> r = sqrt(x);
+    CHECK(r.value == Catch::Approx(std::sqrt(0.5)));
+    CHECK(r.derivatives[0] == Catch::Approx(0.5 / std::sqrt(0.5)));
+}
+
+TEST_CASE("DualNumber: Chain Rule", "[dualnumber]") {
+    // f(x) = sin(x^2) has the derivative 2x * cos(x^2)
+    const Dual<1> x = Dual<1>::variable(1.2, 0);
+    const Dual<1> f = sin(x * x);
+    CHECK(f.value == Catch::Approx(std::sin(1.44)));
+    CHECK(f.derivatives[0] == Catch::Approx(2.4 * std::cos(1.44)));
+}
+
+#endif // OPENSPACE_MODULE_TOUCH_ENABLED
@@ -0,0 +1,128 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_SPACECRAFTINSTRUMENTS_ENABLED
+#include <modules/spacecraftinstruments/util/ellipsoidintercept.h>
+#include <optional>
+#include <vector>
+
+using namespace openspace;
+
+TEST_CASE("EllipsoidIntercept: Sphere", "[ellipsoidintercept]") {
+    const glm::dvec3 observer = glm::dvec3(10.0, 0.0, 0.0);
+    const glm::dvec3 radii = glm::dvec3(2.0);
+
+    const std::optional<glm::dvec3> hit = ellipsoidIntercept(
+        observer,
+        glm::dvec3(-3.0, 0.0, 0.0),
+        radii
+    );
+    REQUIRE(hit.has_value());
+    CHECK(hit->x == Catch::Approx(-8.0));
+    CHECK(hit->y == Catch::Approx(0.0).margin(1e-12));
+    CHECK(hit->z == Catch::Approx(0.0).margin(1e-12));
+
+    // Looking away from the sphere or past it
+    CHECK_FALSE(ellipsoidIntercept(observer, glm::dvec3(1.0, 0.0, 0.0), radii));
+    CHECK_FALSE(ellipsoidIntercept(observer, glm::dvec3(-1.0, 1.0, 0.0), radii));
+}
+
+TEST_CASE("EllipsoidIntercept: Triaxial", "[ellipsoidintercept]") {
+    const glm::dvec3 radii = glm::dvec3(3.0, 2.0, 1.0);
+
+    for (const glm::dvec3& observer : { glm::dvec3(0.0, 10.0, 0.0),
+                                        glm::dvec3(0.0, 0.0, -7.0),
+                                        glm::dvec3(5.0, 5.0, 5.0) })
+    {
+        const std::optional<glm::dvec3> hit = ellipsoidIntercept(
+            observer,
+            -observer,
+            radii
+        );
+        REQUIRE(hit.has_value());
+
+        // The intercept has to be on the surface of the ellipsoid
+        const glm::dvec3 p = (observer + *hit) / radii;
+        CHECK(glm::dot(p, p) == Catch::Approx(1.0));
+    }
+
+    const std::optional<glm::dvec3> hit = ellipsoidIntercept(
+        glm::dvec3(0.0, 0.0, 5.0),
+        glm::dvec3(0.0, 0.0, -1.0),
+        radii
+    );
+    REQUIRE(hit.has_value());
+    CHECK(hit->z == Catch::Approx(-4.0));
+}
+
+TEST_CASE("EllipsoidIntercept: Inside", "[ellipsoidintercept]") {
+    const std::optional<glm::dvec3> hit = ellipsoidIntercept(
+        glm::dvec3(0.0),
+        glm::dvec3(0.0, 2.0, 0.0),
+        glm::dvec3(3.0, 2.0, 1.0)
+    );
+    REQUIRE(hit.has_value());
+    CHECK(hit->y == Catch::Approx(2.0));
+}
+
+TEST_CASE("EllipsoidIntercept: Batch", "[ellipsoidintercept]") {
+    const glm::dvec3 observer = glm::dvec3(1000.0, -200.0, 50.0);
+    const glm::dvec3 radii = glm::dvec3(60.0, 50.0, 40.0);
+
+    std::vector<glm::dvec3> directions;
+    for (int i = -10; i <= 10; i++) {
+        for (int j = -10; j <= 10; j++) {
+            directions.push_back(-observer + glm::dvec3(0.0, i * 10.0, j * 10.0));
+        }
+    }
+
+    const std::vector<std::optional<glm::dvec3>> hits = ellipsoidIntercepts(
+        observer,
+        directions,
+        radii
+    );
+    REQUIRE(hits.size() == directions.size());
+
+    size_t nHits = 0;
+    for (size_t i = 0; i < directions.size(); i++) {
+        const std::optional<glm::dvec3> single = ellipsoidIntercept(
+            observer,
+            directions[i],
+            radii
+        );
+        REQUIRE(hits[i].has_value() == single.has_value());
+        if (single.has_value()) {
+            nHits++;
+            CHECK(hits[i]->x == Catch::Approx(single->x));
+            CHECK(hits[i]->y == Catch::Approx(single->y));
+            CHECK(hits[i]->z == Catch::Approx(single->z));
+        }
+    }
+    CHECK(nHits > 0);
+    CHECK(nHits < directions.size());
+}
+#endif // OPENSPACE_MODULE_SPACECRAFTINSTRUMENTS_ENABLED
@@ -0,0 +1,129 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_SPACE_ENABLED
+#include <modules/space/ephemeris.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    // A circular orbit with a radius of 1 and a period of 2 pi
+    Ephemeris createOrbit(int nSamples, double step, bool withVelocities) {
+        std::vector<double> times;
+        std::vector<glm::dvec3> positions;
+        std::vector<glm::dvec3> velocities;
+        for (int i = 0; i < nSamples; i++) {
+            const double t = i * step;
+            times.push_back(t);
+            positions.emplace_back(std::cos(t), std::sin(t), 0.0);
+            if (withVelocities) {
+                velocities.emplace_back(-std::sin(t), std::cos(t), 0.0);
+            }
+        }
+        return Ephemeris(std::move(times), std::move(positions), std::move(velocities));
+    }
+
+    double maxError(const Ephemeris& ephemeris, double end) {
+        double error = 0.0;
+        for (double t = 0.0; t < end; t += 0.001) {
+            const glm::dvec3 p = ephemeris.position(t);
+            const glm::dvec3 expected = glm::dvec3(std::cos(t), std::sin(t), 0.0);
+            error = std::max(error, glm::length(p - expected));
+        }
+        return error;
+    }
+} // namespace
+
+TEST_CASE("Ephemeris: Empty", "[ephemeris]") {
+    const Ephemeris ephemeris;
+    CHECK(ephemeris.isEmpty());
+    CHECK(ephemeris.position(10.0) == glm::dvec3(0.0));
+}
+
+TEST_CASE("Ephemeris: Clamped", "[ephemeris]") {
+    const Ephemeris ephemeris = Ephemeris(
+        { 0.0, 1.0, 3.0 },
+        { glm::dvec3(1.0, 2.0, 3.0), glm::dvec3(2.0), glm::dvec3(4.0, 5.0, 6.0) }
+    );
+    CHECK(!ephemeris.isUniform());
+    CHECK(ephemeris.position(-5.0) == glm::dvec3(1.0, 2.0, 3.0));
+    CHECK(ephemeris.position(5.0) == glm::dvec3(4.0, 5.0, 6.0));
+    CHECK(ephemeris.position(1.0) == glm::dvec3(2.0));
+}
+
+TEST_CASE("Ephemeris: Linear Motion", "[ephemeris]") {
+    // The estimated tangents are exact for a linear motion, regardless of the spacing
+    std::vector<double> times = { 0.0, 0.5, 2.0, 2.25, 4.0, 7.0 };
+    std::vector<glm::dvec3> positions;
+    for (double t : times) {
+        positions.push_back(glm::dvec3(1.0, -2.0, 0.5) * t + glm::dvec3(3.0));
+    }
+    const Ephemeris ephemeris = Ephemeris(times, positions);
+    CHECK(!ephemeris.hasVelocities());
+
+    for (double t = 0.0; t < 7.0; t += 0.1) {
+        const glm::dvec3 p = ephemeris.position(t);
+        CHECK(p.x == Catch::Approx(t + 3.0));
+        CHECK(p.y == Catch::Approx(-2.0 * t + 3.0));
+        CHECK(p.z == Catch::Approx(0.5 * t + 3.0));
+    }
+}
+
+TEST_CASE("Ephemeris: Uniform Orbit", "[ephemeris]") {
+    const Ephemeris withVelocities = createOrbit(65, 0.1, true);
+    CHECK(withVelocities.isUniform());
+    CHECK(withVelocities.hasVelocities());
+    const double hermiteError = maxError(withVelocities, 6.4);
+
+    const Ephemeris withoutVelocities = createOrbit(65, 0.1, false);
+    const double estimatedError = maxError(withoutVelocities, 6.4);
+
+    // A linear interpolation of the same data has an error of about 1 - cos(0.05)
+    const double linearError = 1.0 - std::cos(0.05);
+    CHECK(hermiteError < 1e-5);
+    CHECK(hermiteError < estimatedError);
+    CHECK(estimatedError < linearError);
+}
+
+TEST_CASE("Ephemeris: Nonuniform Orbit", "[ephemeris]") {
+    std::vector<double> times;
+    std::vector<glm::dvec3> positions;
+    std::vector<glm::dvec3> velocities;
+    for (double t = 0.0; t < 6.0; t += (times.size() % 2 == 0) ? 0.05 : 0.15) {
+        times.push_back(t);
+        positions.emplace_back(std::cos(t), std::sin(t), 0.0);
+        velocities.emplace_back(-std::sin(t), std::cos(t), 0.0);
+    }
+    const double end = times.back();
+    const Ephemeris ephemeris = Ephemeris(times, positions, velocities);
+    CHECK(!ephemeris.isUniform());
+    CHECK(maxError(ephemeris, end) < 1e-5);
+}
+#endif // OPENSPACE_MODULE_SPACE_ENABLED
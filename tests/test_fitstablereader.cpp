@@ -0,0 +1,176 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_FITSFILEREADER_ENABLED
+#include <modules/fitsfilereader/include/fitstablereader.h>
+#include <ghoul/format.h>
+#include <ghoul/misc/exception.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    void writeCard(std::string& header, const std::string& card) {
+        header += card;
+        header.append(80 - card.size(), ' ');
+    }
+
+    void padBlock(std::string& data, char fill) {
+        data.append((2880 - data.size() % 2880) % 2880, fill);
+    }
+
+    template <typename T>
+    void writeBigEndian(std::string& data, T value) {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        if constexpr (std::endian::native == std::endian::little) {
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        data.append(bytes, sizeof(T));
+    }
+
+    // Creates a FITS file with an empty primary HDU and a binary table with the columns
+    // ID (J), FLUX (E), DIST (D), FLAG (I, scaled with a null value), and NAME (8A)
+    std::filesystem::path createTable(int nRows) {
+        std::string file;
+        writeCard(file, "SIMPLE  =                    T");
+        writeCard(file, "BITPIX  =                    8");
+        writeCard(file, "NAXIS   =                    0");
+        writeCard(file, "EXTEND  =                    T");
+        writeCard(file, "END");
+        padBlock(file, ' ');
+
+        writeCard(file, "XTENSION= 'BINTABLE'           / binary table extension");
+        writeCard(file, "BITPIX  =                    8");
+        writeCard(file, "NAXIS   =                    2");
+        writeCard(file, "NAXIS1  =                   26");
+        writeCard(file, std::format("NAXIS2  = {:>20}", nRows));
+        writeCard(file, "PCOUNT  =                    0");
+        writeCard(file, "GCOUNT  =                    1");
+        writeCard(file, "TFIELDS =                    5");
+        writeCard(file, "TTYPE1  = 'ID      '");
+        writeCard(file, "TFORM1  = 'J       '");
+        writeCard(file, "TTYPE2  = 'FLUX    '");
+        writeCard(file, "TFORM2  = '1E      '");
+        writeCard(file, "TTYPE3  = 'DIST    '");
+        writeCard(file, "TFORM3  = 'D       '");
+        writeCard(file, "TTYPE4  = 'FLAG    '");
+        writeCard(file, "TFORM4  = 'I       '");
+        writeCard(file, "TSCAL4  =                  0.5");
+        writeCard(file, "TZERO4  =                 10.0");
+        writeCard(file, "TNULL4  =                   -1");
+        writeCard(file, "TTYPE5  = 'NAME    '");
+        writeCard(file, "TFORM5  = '8A      '");
+        writeCard(file, "END");
+        padBlock(file, ' ');
+
+        for (int i = 0; i < nRows; i++) {
+            writeBigEndian(file, static_cast<int32_t>(i));
+            writeBigEndian(file, static_cast<float>(i) * 0.25f);
+            writeBigEndian(file, static_cast<double>(i) * 1000.0);
+            writeBigEndian(file, static_cast<int16_t>(i % 7 == 0 ? -1 : i % 100));
+            file += "star    ";
+        }
+        padBlock(file, '\0');
+
+        const std::filesystem::path path =
+            std::filesystem::temp_directory_path() / "test_fitstablereader.fits";
+        std::ofstream stream = std::ofstream(path, std::ios::binary);
+        stream.write(file.data(), file.size());
+        return path;
+    }
+} // namespace
+
+TEST_CASE("FitsTableReader: Header", "[fitstablereader]") {
+    const std::filesystem::path path = createTable(10);
+    const FitsTableReader reader = FitsTableReader(path);
+
+    CHECK(reader.nRows() == 10);
+    CHECK(reader.rowSize() == 26);
+    REQUIRE(reader.columns().size() == 5);
+    CHECK(reader.columns()[2].name == "DIST");
+    CHECK(reader.columns()[2].type == 'D');
+    CHECK(reader.columns()[2].offset == 8);
+    CHECK(reader.columns()[4].repeat == 8);
+    CHECK(reader.columnIndex("flux") == 1);
+    CHECK(!reader.columnIndex("missing").has_value());
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("FitsTableReader: Read Columns", "[fitstablereader]") {
+    // Enough rows to be split into multiple chunks
+    constexpr int NRows = 1000000;
+    const std::filesystem::path path = createTable(NRows);
+    const FitsTableReader reader = FitsTableReader(path);
+
+    const std::vector<std::string> names = { "DIST", "FLAG", "ID" };
+    const std::vector<std::vector<float>> columns = reader.readColumns(
+        names,
+        100,
+        NRows - 200,
+        4
+    );
+    REQUIRE(columns.size() == 3);
+    REQUIRE(columns[0].size() == NRows - 200);
+
+    bool isCorrect = true;
+    for (int i = 0; i < NRows - 200; i++) {
+        const int row = i + 100;
+        isCorrect &= columns[0][i] == static_cast<float>(row * 1000.0);
+        isCorrect &= columns[2][i] == static_cast<float>(row);
+        if (row % 7 == 0) {
+            isCorrect &= std::isnan(columns[1][i]);
+        }
+        else {
+            isCorrect &= columns[1][i] == (row % 100) * 0.5f + 10.f;
+        }
+    }
+    CHECK(isCorrect);
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("FitsTableReader: Invalid Columns", "[fitstablereader]") {
+    const std::filesystem::path path = createTable(10);
+    const FitsTableReader reader = FitsTableReader(path);
+
+    const std::vector<std::string> missing = { "ID", "MISSING" };
+    CHECK_THROWS_AS(reader.readColumns(missing), ghoul::RuntimeError);
+
+    const std::vector<std::string> strings = { "NAME" };
+    CHECK_THROWS_AS(reader.readColumns(strings), ghoul::RuntimeError);
+
+    std::filesystem::remove(path);
+}
+#endif // OPENSPACE_MODULE_FITSFILEREADER_ENABLED
@@ -0,0 +1,181 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_SPACE_ENABLED
+#include <modules/space/fluxnodesstatecache.h>
+#include <ghoul/glm.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using namespace openspace;
+
+namespace {
+    constexpr uint32_t NNodes = 100;
+    constexpr uint32_t NStates = 50;
+
+    // The value of every node encodes the energy bin, the state, and the node, so that
+    // we can verify that the right part of the files was read
+    float value(int bin, uint32_t state, uint32_t node) {
+        return static_cast<float>(bin * 1000000 + state * 1000 + node);
+    }
+
+    std::filesystem::path createFiles() {
+        const std::filesystem::path folder =
+            std::filesystem::temp_directory_path() / "test_fluxnodesstatecache";
+        std::filesystem::create_directories(folder);
+
+        for (int bin = 1; bin <= 3; bin += 2) {
+            const std::string suffix = bin == 1 ? "_emin01" : "_emin03";
+            std::ofstream positions(folder / ("positions" + suffix), std::ios::binary);
+            std::ofstream fluxes(folder / ("fluxes" + suffix), std::ios::binary);
+            std::ofstream radiuses(folder / ("radiuses" + suffix), std::ios::binary);
+            positions.write(reinterpret_cast<const char*>(&NNodes), sizeof(uint32_t));
+            positions.write(reinterpret_cast<const char*>(&NStates), sizeof(uint32_t));
+            for (uint32_t s = 0; s < NStates; s++) {
+                for (uint32_t n = 0; n < NNodes; n++) {
+                    const float v = value(bin, s, n);
+                    const glm::vec3 p = glm::vec3(v, -v, 2.f * v);
+                    positions.write(reinterpret_cast<const char*>(&p), sizeof(glm::vec3));
+                    fluxes.write(reinterpret_cast<const char*>(&v), sizeof(float));
+                    const float r = v + 0.5f;
+                    radiuses.write(reinterpret_cast<const char*>(&r), sizeof(float));
+                }
+            }
+        }
+
+        // An energy bin whose files are shorter than the header claims
+        std::ofstream positions(folder / "positions_broken", std::ios::binary);
+        positions.write(reinterpret_cast<const char*>(&NNodes), sizeof(uint32_t));
+        positions.write(reinterpret_cast<const char*>(&NStates), sizeof(uint32_t));
+        std::ofstream(folder / "fluxes_broken", std::ios::binary);
+        std::ofstream(folder / "radiuses_broken", std::ios::binary);
+
+        return folder;
+    }
+
+    bool isState(const FluxNodesStateCache::State& state, int bin, uint32_t index) {
+        if (state.positions.size() != NNodes || state.fluxes.size() != NNodes ||
+            state.radiuses.size() != NNodes)
+        {
+            return false;
+        }
+        for (uint32_t n = 0; n < NNodes; n++) {
+            const float v = value(bin, index, n);
+            if (state.positions[n] != glm::vec3(v, -v, 2.f * v) ||
+                state.fluxes[n] != v || state.radiuses[n] != v + 0.5f)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+TEST_CASE("FluxNodesStateCache: Read States", "[fluxnodesstatecache]") {
+    const std::filesystem::path folder = createFiles();
+    FluxNodesStateCache cache = FluxNodesStateCache(folder, 4, 1);
+
+    REQUIRE(cache.setEnergyBin("_emin01"));
+    CHECK(cache.nStates() == NStates);
+    CHECK(cache.nNodesPerState() == NNodes);
+
+    // Jumping around must always return the requested state
+    for (uint32_t i : { 0, 7, 49, 48, 20, 3, 3, 21 }) {
+        const std::shared_ptr<const FluxNodesStateCache::State> s = cache.state(i, true);
+        REQUIRE(s);
+        CHECK(isState(*s, 1, i));
+    }
+}
+
+TEST_CASE("FluxNodesStateCache: Window", "[fluxnodesstatecache]") {
+    const std::filesystem::path folder = createFiles();
+    FluxNodesStateCache cache = FluxNodesStateCache(folder, 4, 1);
+    REQUIRE(cache.setEnergyBin("_emin01"));
+
+    // Moving forward keeps 1 state behind and 4 states ahead
+    cache.state(10, true);
+    cache.waitForPrefetch();
+    CHECK(cache.nResidentStates() == 6);
+    const std::shared_ptr<const FluxNodesStateCache::State> ahead = cache.state(14, true);
+    CHECK(isState(*ahead, 1, 14));
+
+    // Moving backward flips the window
+    cache.state(30, false);
+    cache.waitForPrefetch();
+    CHECK(cache.nResidentStates() == 6);
+    const std::shared_ptr<const FluxNodesStateCache::State> back = cache.state(26, false);
+    CHECK(isState(*back, 1, 26));
+
+    // The window is clamped at the ends of the sequence
+    cache.state(49, true);
+    cache.waitForPrefetch();
+    CHECK(cache.nResidentStates() == 2);
+    cache.state(0, false);
+    cache.waitForPrefetch();
+    CHECK(cache.nResidentStates() == 2);
+}
+
+TEST_CASE("FluxNodesStateCache: Prefetched States Are Shared", "[fluxnodesstatecache]") {
+    const std::filesystem::path folder = createFiles();
+    FluxNodesStateCache cache = FluxNodesStateCache(folder, 4, 1);
+    REQUIRE(cache.setEnergyBin("_emin01"));
+
+    cache.state(5, true);
+    cache.waitForPrefetch();
+    // Within the window, the states are not read again
+    const std::shared_ptr<const FluxNodesStateCache::State> a = cache.state(6, true);
+    cache.state(7, true);
+    const std::shared_ptr<const FluxNodesStateCache::State> b = cache.state(6, true);
+    CHECK(a == b);
+    CHECK(isState(*a, 1, 6));
+}
+
+TEST_CASE("FluxNodesStateCache: Switch Energy Bin", "[fluxnodesstatecache]") {
+    const std::filesystem::path folder = createFiles();
+    FluxNodesStateCache cache = FluxNodesStateCache(folder, 4, 1);
+    REQUIRE(cache.setEnergyBin("_emin01"));
+    CHECK(isState(*cache.state(12, true), 1, 12));
+
+    REQUIRE(cache.setEnergyBin("_emin03"));
+    CHECK(cache.nResidentStates() == 0);
+    CHECK(isState(*cache.state(12, true), 3, 12));
+    cache.waitForPrefetch();
+    CHECK(isState(*cache.state(13, true), 3, 13));
+
+    REQUIRE(cache.setEnergyBin("_emin01"));
+    CHECK(isState(*cache.state(13, true), 1, 13));
+
+    // Broken or missing energy bins keep the previous energy bin active
+    CHECK_FALSE(cache.setEnergyBin("_broken"));
+    CHECK_FALSE(cache.setEnergyBin("_missing"));
+    CHECK(cache.nStates() == NStates);
+    CHECK(isState(*cache.state(14, true), 1, 14));
+}
+
+#endif // OPENSPACE_MODULE_SPACE_ENABLED
@@ -28,7 +28,9 @@
 #include <openspace/json.h>
 #include <openspace/util/spicemanager.h>
 #include <ghoul/filesystem/filesystem.h>
+#include <ghoul/glm.h>
 #include <ghoul/logging/logmanager.h>
+#include <array>
 
 #ifdef OPENSPACE_MODULE_SPACE_ENABLED
 #include <modules/space/horizonsfile.h>
@@ -828,6 +830,44 @@ TEST_CASE("HorizonsFile: Reading Vector data from file", "[horizonsfile]") {
 #endif // OPENSPACE_MODULE_SPACE_ENABLED
 }
 
+TEST_CASE("HorizonsFile: Reading Vector data with velocity from file", "[horizonsfile]") {
+#ifdef OPENSPACE_MODULE_SPACE_ENABLED
+    const std::filesystem::path kernel = absPath("${TESTDIR}/horizonsTest/naif0012.tls");
+    const std::filesystem::path filePathVector =
+        absPath("${TESTDIR}/horizonsTest/vectorStateFileTest.hrz");
+    REQUIRE(std::filesystem::is_regular_file(filePathVector));
+
+    SpiceManager::initialize();
+    openspace::SpiceManager::ref().loadKernel(kernel);
+
+    const HorizonsResult result = readHorizonsFile(filePathVector);
+    CHECK(result.type == HorizonsType::Vector);
+    CHECK(result.errorCode == HorizonsResultCode::Valid);
+    REQUIRE(result.data.size() == 3);
+
+    // The positions have to be the same as without the velocity lines
+    CHECK(result.data[0].position.x == Catch::Approx(-126379670172.70331));
+    CHECK(result.data[2].position.z == Catch::Approx(-125093260079.10854));
+
+    // The velocities are given in km/s and only rotated into the galactic frame
+    const std::array<glm::dvec3, 3> velocities = {
+        glm::dvec3(-2.152512786543208E+01, 1.613674385614527E+01, -5.376049417289436E-03),
+        glm::dvec3(-2.158565416733262E+01, 1.605874913257712E+01, -5.664352013775461E-03),
+        glm::dvec3(-2.164571293384012E+01, 1.598039877462571E+01, -5.962684436908217E-03)
+    };
+    for (size_t i = 0; i < velocities.size(); i++) {
+        REQUIRE(result.data[i].velocity.has_value());
+        CHECK(
+            glm::length(*result.data[i].velocity) ==
+            Catch::Approx(1000.0 * glm::length(velocities[i]))
+        );
+    }
+
+    openspace::SpiceManager::ref().unloadKernel(kernel);
+    openspace::SpiceManager::deinitialize();
+#endif // OPENSPACE_MODULE_SPACE_ENABLED
+}
+
 TEST_CASE("HorizonsFile: Reading Observer data from file", "[horizonsfile]") {
 #ifdef OPENSPACE_MODULE_SPACE_ENABLED
     const HorizonsType type = HorizonsType::Observer;
@@ -0,0 +1,275 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#ifdef OPENSPACE_MODULE_SERVER_ENABLED
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <modules/server/include/jsonconverters.h>
+#include <openspace/engine/globals.h>
+#include <openspace/json.h>
+#include <openspace/properties/propertyowner.h>
+#include <openspace/properties/scalar/intproperty.h>
+#include <openspace/properties/stringproperty.h>
+#include <string>
+#include <vector>
+
+using namespace openspace;
+using nlohmann::json;
+
+namespace {
+    // Attaches the owner to the root property owner for the duration of a test so that
+    // the owner and its properties have valid URIs
+    struct AttachedOwner {
+        explicit AttachedOwner(properties::PropertyOwner& owner_) : owner(owner_) {
+            global::rootPropertyOwner->addPropertySubOwner(owner);
+        }
+        ~AttachedOwner() {
+            global::rootPropertyOwner->removePropertySubOwner(owner);
+        }
+        properties::PropertyOwner& owner;
+    };
+
+    // A tree of owners with two children, of which the first has two children itself
+    struct OwnerTree {
+        OwnerTree() {
+            root.addProperty(value);
+            root.addPropertySubOwner(a);
+            root.addPropertySubOwner(b);
+            a.addPropertySubOwner(a1);
+            a.addPropertySubOwner(a2);
+        }
+
+        properties::PropertyOwner root = properties::PropertyOwner({ "JsonRoot" });
+        properties::PropertyOwner a = properties::PropertyOwner({ "A" });
+        properties::PropertyOwner a1 = properties::PropertyOwner({ "A1" });
+        properties::PropertyOwner a2 = properties::PropertyOwner({ "A2" });
+        properties::PropertyOwner b = properties::PropertyOwner({ "B" });
+        properties::IntProperty value = properties::IntProperty(
+            { "Value", "Value", "A value" },
+            5
+        );
+    };
+
+    struct Chunk {
+        std::string content;
+        bool isLastChunk = false;
+    };
+
+    std::vector<Chunk> writeChunks(const std::vector<properties::PropertyOwner*>& owners,
+                                   size_t chunkSize)
+    {
+        std::vector<Chunk> chunks;
+        std::string out;
+        properties::writeJsonChunked(
+            out,
+            owners,
+            chunkSize,
+            [&out, &chunks](bool isLastChunk) {
+                chunks.push_back({ out, isLastChunk });
+                out.clear();
+            }
+        );
+        return chunks;
+    }
+
+    std::vector<std::string> chunkIdentifiers(const Chunk& chunk) {
+        std::vector<std::string> identifiers;
+        for (const json& owner : json::parse('[' + chunk.content + ']')) {
+            identifiers.push_back(owner["identifier"].get<std::string>());
+        }
+        return identifiers;
+    }
+
+    std::string ownerJson(const properties::PropertyOwner& owner) {
+        std::string out;
+        properties::writeJson(out, owner, false);
+        return out;
+    }
+} // namespace
+
+TEST_CASE("JsonConverters: Property", "[jsonconverters]") {
+    OwnerTree tree;
+    const AttachedOwner attached = AttachedOwner(tree.root);
+
+    std::string out;
+    properties::writeJson(out, tree.value);
+    const json j = json::parse(out);
+
+    CHECK(j["Description"]["Identifier"] == "JsonRoot.Value");
+    CHECK(j["Description"]["Name"] == "Value");
+    CHECK(j["Value"] == 5);
+}
+
+TEST_CASE("JsonConverters: Property Owner Escaping", "[jsonconverters]") {
+    properties::PropertyOwner owner = properties::PropertyOwner({
+        "Escaped",
+        "Name with \"quotes\"",
+        "Line\nbreak, tab\t, backslash \\ and \x01 control character"
+    });
+    properties::StringProperty text = properties::StringProperty(
+        { "Text", "Text", "A text" },
+        "\"quoted\"\n"
+    );
+    owner.addProperty(text);
+    const AttachedOwner attached = AttachedOwner(owner);
+
+    std::string out;
+    properties::writeJson(out, owner);
+    const json j = json::parse(out);
+
+    CHECK(j["identifier"] == "Escaped");
+    CHECK(j["guiName"] == "Name with \"quotes\"");
+    CHECK(
+        j["description"] ==
+        "Line\nbreak, tab\t, backslash \\ and \x01 control character"
+    );
+    REQUIRE(j["properties"].size() == 1);
+    CHECK(j["properties"][0]["Value"] == "\"quoted\"\n");
+}
+
+TEST_CASE("JsonConverters: Property Owner Recursive", "[jsonconverters]") {
+    OwnerTree tree;
+    const AttachedOwner attached = AttachedOwner(tree.root);
+
+    std::string out;
+    properties::writeJson(out, tree.root);
+    const json j = json::parse(out);
+
+    CHECK(j["identifier"] == "JsonRoot");
+    CHECK(j["uri"] == "JsonRoot");
+    REQUIRE(j["properties"].size() == 1);
+    CHECK(j["properties"][0]["Value"] == 5);
+    REQUIRE(j["subowners"].size() == 2);
+    CHECK(j["subowners"][0]["identifier"] == "A");
+    REQUIRE(j["subowners"][0]["subowners"].size() == 2);
+    CHECK(j["subowners"][0]["subowners"][1]["uri"] == "JsonRoot.A.A2");
+    CHECK(j["subowners"][1]["subowners"].empty());
+}
+
+TEST_CASE("JsonConverters: Property Owner Not Recursive", "[jsonconverters]") {
+    OwnerTree tree;
+    const AttachedOwner attached = AttachedOwner(tree.root);
+
+    const json j = json::parse(ownerJson(tree.root));
+
+    CHECK(j["identifier"] == "JsonRoot");
+    CHECK(j["subowners"] == json::array({ "JsonRoot.A", "JsonRoot.B" }));
+}
+
+TEST_CASE("JsonConverters: Chunked Single Chunk", "[jsonconverters]") {
+    OwnerTree tree;
+    const AttachedOwner attached = AttachedOwner(tree.root);
+
+    const std::vector<Chunk> chunks = writeChunks({ &tree.root }, 1024 * 1024);
+
+    REQUIRE(chunks.size() == 1);
+    CHECK(chunks[0].isLastChunk);
+    CHECK(
+        chunkIdentifiers(chunks[0]) ==
+        std::vector<std::string>{ "JsonRoot", "A", "A1", "A2", "B" }
+    );
+}
+
+TEST_CASE("JsonConverters: Chunked One Owner Per Chunk", "[jsonconverters]") {
+    OwnerTree tree;
+    const AttachedOwner attached = AttachedOwner(tree.root);
+
+    // Every owner exceeds the chunk size, so every owner is sent in its own chunk
+    const std::vector<Chunk> chunks = writeChunks({ &tree.root }, 1);
+
+    REQUIRE(chunks.size() == 5);
+    const std::vector<std::string> expected = { "JsonRoot", "A", "A1", "A2", "B" };
+    for (size_t i = 0; i < chunks.size(); i++) {
+        CHECK(chunkIdentifiers(chunks[i]) == std::vector<std::string>{ expected[i] });
+        CHECK(chunks[i].isLastChunk == (i == chunks.size() - 1));
+    }
+}
+
+TEST_CASE("JsonConverters: Chunked Boundary", "[jsonconverters]") {
+    OwnerTree tree;
+    const AttachedOwner attached = AttachedOwner(tree.root);
+
+    // The first chunk ends exactly at the chunk size after the second owner
+    const size_t chunkSize = ownerJson(tree.root).size() + 1 + ownerJson(tree.a).size();
+
+    SECTION("Exactly at the boundary") {
+        const std::vector<Chunk> chunks = writeChunks({ &tree.root }, chunkSize);
+
+        REQUIRE(chunks.size() == 2);
+        CHECK(chunks[0].content.size() == chunkSize);
+        CHECK(chunkIdentifiers(chunks[0]) == std::vector<std::string>{ "JsonRoot", "A" });
+        CHECK_FALSE(chunks[0].isLastChunk);
+        CHECK(
+            chunkIdentifiers(chunks[1]) == std::vector<std::string>{ "A1", "A2", "B" }
+        );
+        CHECK(chunks[1].isLastChunk);
+    }
+
+    SECTION("One byte after the boundary") {
+        const std::vector<Chunk> chunks = writeChunks({ &tree.root }, chunkSize + 1);
+
+        REQUIRE(chunks.size() == 2);
+        CHECK(
+            chunkIdentifiers(chunks[0]) ==
+            std::vector<std::string>{ "JsonRoot", "A", "A1" }
+        );
+        CHECK(chunkIdentifiers(chunks[1]) == std::vector<std::string>{ "A2", "B" });
+        CHECK(chunks[1].isLastChunk);
+    }
+}
+
+TEST_CASE("JsonConverters: Chunked Last Owner Fills Chunk", "[jsonconverters]") {
+    OwnerTree tree;
+    const AttachedOwner attached = AttachedOwner(tree.root);
+
+    // The last owner reaching the chunk size must not produce an empty final chunk
+    const std::vector<Chunk> chunks = writeChunks({ &tree.b }, 1);
+
+    REQUIRE(chunks.size() == 1);
+    CHECK(chunkIdentifiers(chunks[0]) == std::vector<std::string>{ "B" });
+    CHECK(chunks[0].isLastChunk);
+}
+
+TEST_CASE("JsonConverters: Chunked Multiple Owners", "[jsonconverters]") {
+    OwnerTree tree;
+    const AttachedOwner attached = AttachedOwner(tree.root);
+
+    const std::vector<Chunk> chunks = writeChunks({ &tree.b, &tree.a }, 1024 * 1024);
+
+    REQUIRE(chunks.size() == 1);
+    CHECK(
+        chunkIdentifiers(chunks[0]) == std::vector<std::string>{ "B", "A", "A1", "A2" }
+    );
+}
+
+TEST_CASE("JsonConverters: Chunked No Owners", "[jsonconverters]") {
+    const std::vector<Chunk> chunks = writeChunks({}, 1024 * 1024);
+
+    REQUIRE(chunks.size() == 1);
+    CHECK(chunks[0].content.empty());
+    CHECK(chunks[0].isLastChunk);
+}
+
+#endif // OPENSPACE_MODULE_SERVER_ENABLED
@@ -0,0 +1,155 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_GAIA_ENABLED
+#include <modules/gaia/rendering/octreeculler.h>
+#include <modules/gaia/rendering/octreemanager.h>
+#include <algorithm>
+#include <array>
+#include <random>
+#include <span>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    constexpr int MaxDist = 10;
+    constexpr int MaxStarsPerNode = 50;
+    constexpr size_t ValuesPerStar = 8;
+    constexpr size_t PartitionDepth = 3;
+
+    std::vector<float> createStars(size_t n) {
+        std::mt19937 gen(1337);
+        std::uniform_real_distribution<float> pos(-0.99f * MaxDist, 0.99f * MaxDist);
+        std::uniform_real_distribution<float> value(-5.f, 15.f);
+
+        std::vector<float> stars;
+        stars.reserve(n * ValuesPerStar);
+        for (size_t i = 0; i < n; i++) {
+            // Cluster half of the stars around a point to get a deeper tree
+            const float scale = (i % 2 == 0) ? 1.f : 0.01f;
+            stars.push_back(pos(gen) * scale);
+            stars.push_back(pos(gen) * scale);
+            stars.push_back(pos(gen) * scale);
+            for (size_t j = 3; j < ValuesPerStar; j++) {
+                stars.push_back(value(gen));
+            }
+        }
+        return stars;
+    }
+
+    // Inserts the stars with the bulk construction, in batches of \p batchSize stars
+    void bulkInsert(OctreeManager& octree, const std::vector<float>& stars,
+                    size_t batchSize)
+    {
+        const size_t nStars = stars.size() / ValuesPerStar;
+        std::vector<std::pair<uint64_t, size_t>> order;
+        order.reserve(nStars);
+        for (size_t i = 0; i < nStars; i++) {
+            const float* s = &stars[i * ValuesPerStar];
+            order.emplace_back(octree.mortonCode(s[0], s[1], s[2]), i);
+        }
+        std::sort(order.begin(), order.end());
+
+        std::vector<uint64_t> codes;
+        std::vector<float> values;
+        std::vector<uint32_t> cellCounts(size_t(1) << (3 * PartitionDepth), 0);
+        for (const auto& [code, i] : order) {
+            codes.push_back(code);
+            const auto first = stars.begin() + i * ValuesPerStar;
+            values.insert(values.end(), first, first + ValuesPerStar);
+            cellCounts[OctreeManager::mortonPrefix(code, PartitionDepth)]++;
+        }
+
+        octree.prepareBulkInsert(cellCounts, PartitionDepth);
+        for (size_t i = 0; i < nStars; i += batchSize) {
+            const size_t n = std::min(batchSize, nStars - i);
+            octree.insertSorted(
+                std::span(codes).subspan(i, n),
+                std::span(values).subspan(i * ValuesPerStar, n * ValuesPerStar)
+            );
+        }
+        octree.finishBulkInsert();
+    }
+
+    std::vector<std::array<float, 3>> leafPositions(OctreeManager& octree) {
+        const std::vector<float> data = octree.getAllData(gaia::RenderMode::Static);
+        std::vector<std::array<float, 3>> positions;
+        for (size_t i = 0; i < data.size(); i += 3) {
+            positions.push_back({ data[i], data[i + 1], data[i + 2] });
+        }
+        std::sort(positions.begin(), positions.end());
+        return positions;
+    }
+} // namespace
+
+TEST_CASE("OctreeManager: Bulk Insert Matches Insert", "[octreemanager]") {
+    const std::vector<float> stars = createStars(20000);
+
+    OctreeManager reference;
+    reference.initOctree(0, MaxDist, MaxStarsPerNode);
+    for (size_t i = 0; i < stars.size(); i += ValuesPerStar) {
+        reference.insert(
+            std::vector<float>(stars.begin() + i, stars.begin() + i + ValuesPerStar)
+        );
+    }
+    reference.sliceLodData();
+
+    // Small batches split nodes between calls, a single batch builds them in one go
+    for (const size_t batchSize : { size_t(20000), size_t(777) }) {
+        OctreeManager octree;
+        octree.initOctree(0, MaxDist, MaxStarsPerNode);
+        bulkInsert(octree, stars, batchSize);
+
+        CHECK(octree.numLeafNodes() == reference.numLeafNodes());
+        CHECK(octree.numInnerNodes() == reference.numInnerNodes());
+        CHECK(leafPositions(octree) == leafPositions(reference));
+    }
+}
+
+TEST_CASE("OctreeManager: Bulk Insert Skips Non-Empty Branch", "[octreemanager]") {
+    const std::vector<float> stars = createStars(5000);
+
+    // Branch 3 contains the stars with a negative x and y and a positive z coordinate
+    const std::vector<float> existing = { -1.f, -1.f, 1.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+    OctreeManager octree;
+    octree.initOctree(0, MaxDist, MaxStarsPerNode);
+    octree.insert(existing);
+    bulkInsert(octree, stars, 1000);
+
+    // None of the stars of branch 3 may end up in another branch
+    std::vector<std::array<float, 3>> expected = { { -1.f, -1.f, 1.f } };
+    for (size_t i = 0; i < stars.size(); i += ValuesPerStar) {
+        const bool isBranch3 =
+            stars[i] < 0.f && stars[i + 1] < 0.f && stars[i + 2] >= 0.f;
+        if (!isBranch3) {
+            expected.push_back({ stars[i], stars[i + 1], stars[i + 2] });
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+    CHECK(leafPositions(octree) == expected);
+}
+#endif // OPENSPACE_MODULE_GAIA_ENABLED
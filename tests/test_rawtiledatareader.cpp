@@ -0,0 +1,146 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_GLOBEBROWSING_ENABLED
+#include <modules/globebrowsing/src/layergroupid.h>
+#include <modules/globebrowsing/src/rawtiledatareader.h>
+#include <modules/globebrowsing/src/tilecacheproperties.h>
+#include <modules/globebrowsing/src/tileindex.h>
+#include <modules/globebrowsing/src/tiletextureinitdata.h>
+#include <ghoul/format.h>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <thread>
+#include <vector>
+#include <gdal_priv.h>
+
+using namespace openspace::globebrowsing;
+
+namespace {
+    constexpr int Width = 8192;
+    constexpr int Height = 4096;
+
+    // Creates a tiled and compressed RGB GeoTIFF that covers the whole globe, which is
+    // the typical layout of a large local color layer
+    void createGeoTiff(const std::filesystem::path& path) {
+        GDALAllRegister();
+        GDALDriver* driver = GetGDALDriverManager()->GetDriverByName("GTiff");
+        REQUIRE(driver);
+
+        char** options = nullptr;
+        options = CSLSetNameValue(options, "TILED", "YES");
+        options = CSLSetNameValue(options, "COMPRESS", "DEFLATE");
+        GDALDataset* dataset = driver->Create(
+            path.string().c_str(),
+            Width,
+            Height,
+            3,
+            GDT_Byte,
+            options
+        );
+        CSLDestroy(options);
+        REQUIRE(dataset);
+
+        double transform[6] = { -180.0, 360.0 / Width, 0.0, 90.0, 0.0, -180.0 / Height };
+        dataset->SetGeoTransform(transform);
+
+        std::vector<uint8_t> row(Width);
+        for (int band = 1; band <= 3; band++) {
+            GDALRasterBand* raster = dataset->GetRasterBand(band);
+            for (int y = 0; y < Height; y++) {
+                for (int x = 0; x < Width; x++) {
+                    row[x] = static_cast<uint8_t>((x * band) ^ (y + band));
+                }
+                const CPLErr err = raster->RasterIO(
+                    GF_Write,
+                    0, y, Width, 1,
+                    row.data(), Width, 1,
+                    GDT_Byte,
+                    0, 0
+                );
+                REQUIRE(err == CE_None);
+            }
+        }
+        GDALClose(dataset);
+    }
+
+    // Reads all tiles of the provided level on as many threads as there are concurrent
+    // reads, which is how the tile provider uses the reader
+    int readLevel(const RawTileDataReader& reader, uint8_t level) {
+        const uint32_t nX = 2u << level;
+        const uint32_t nY = 1u << level;
+        std::atomic<uint32_t> next = 0;
+        std::atomic<int> nRead = 0;
+        auto read = [&]() {
+            for (uint32_t i = next++; i < nX * nY; i = next++) {
+                const TileIndex index = TileIndex(i % nX, i / nX, level);
+                const RawTile tile = reader.readTileData(index);
+                if (tile.error == RawTile::ReadError::None) {
+                    nRead++;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (int i = 1; i < reader.maxConcurrentReads(); i++) {
+            threads.emplace_back(read);
+        }
+        read();
+        for (std::thread& t : threads) {
+            t.join();
+        }
+        return nRead;
+    }
+} // namespace
+
+TEST_CASE("RawTileDataReader: Concurrent Reads", "[rawtiledatareader][.benchmark]") {
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "test_rawtiledatareader.tif";
+    createGeoTiff(path);
+
+    // Level 4 consists of 32 x 16 tiles
+    constexpr uint8_t Level = 4;
+    constexpr int NTiles = (2 << Level) * (1 << Level);
+    for (const int concurrentReads : { 1, 2, 4, 8 }) {
+        const RawTileDataReader reader = RawTileDataReader(
+            path.string(),
+            tileTextureInitData(layers::Group::ID::ColorLayers),
+            TileCacheProperties(),
+            RawTileDataReader::PerformPreprocessing::No,
+            concurrentReads
+        );
+        REQUIRE(readLevel(reader, Level) == NTiles);
+
+        BENCHMARK(std::format("{} tiles, {} concurrent reads", NTiles, concurrentReads)) {
+            return readLevel(reader, Level);
+        };
+    }
+
+    std::filesystem::remove(path);
+}
+#endif // OPENSPACE_MODULE_GLOBEBROWSING_ENABLED
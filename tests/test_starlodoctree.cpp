@@ -0,0 +1,161 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_SPACE_ENABLED
+#include <modules/space/starlodoctree.h>
+#include <ghoul/glm.h>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    struct Stars {
+        std::vector<glm::vec3> positions;
+        std::vector<float> magnitudes;
+    };
+
+    Stars createStars(size_t n) {
+        std::mt19937 gen(1337);
+        std::uniform_real_distribution<float> pos(-100.f, 100.f);
+        std::uniform_real_distribution<float> mag(-5.f, 15.f);
+
+        Stars stars;
+        for (size_t i = 0; i < n; i++) {
+            stars.positions.emplace_back(pos(gen), pos(gen), pos(gen));
+            stars.magnitudes.push_back(mag(gen));
+        }
+        return stars;
+    }
+
+    glm::dmat4 viewProjection(const glm::dvec3& eye, const glm::dvec3& center) {
+        return glm::perspective(glm::radians(60.0), 1.0, 0.01, 1000.0) *
+            glm::lookAt(eye, center, glm::dvec3(0.0, 0.0, 1.0));
+    }
+} // namespace
+
+TEST_CASE("StarLodOctree: Order Is Permutation", "[starlodoctree]") {
+    const Stars stars = createStars(10000);
+    const StarLodOctree octree = StarLodOctree(stars.positions, stars.magnitudes, 64);
+
+    std::vector<uint32_t> order = octree.order();
+    REQUIRE(order.size() == stars.positions.size());
+    std::sort(order.begin(), order.end());
+    std::vector<uint32_t> expected(order.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    CHECK(order == expected);
+
+    // The own stars of every node have to be sorted by brightness and contained in its
+    // bounding box, and an inner node has to keep the brightest stars of its subtree
+    for (const StarLodOctree::Node& node : octree.nodes()) {
+        CHECK(node.ownCount <= 64);
+        if (node.firstChild == -1) {
+            CHECK(node.ownCount == node.count);
+        }
+        else {
+            REQUIRE(node.ownCount > 0);
+            const uint32_t childFirst = node.first + node.ownCount;
+            const uint32_t dimmest = octree.order()[childFirst - 1];
+            for (uint32_t i = childFirst; i < node.first + node.count; i++) {
+                const uint32_t star = octree.order()[i];
+                CHECK(stars.magnitudes[dimmest] <= stars.magnitudes[star]);
+            }
+        }
+        for (uint32_t i = node.first; i < node.first + node.ownCount; i++) {
+            const uint32_t star = octree.order()[i];
+            const glm::vec3 d = glm::abs(stars.positions[star] - node.center);
+            CHECK(d.x <= node.halfSize * 1.0001f);
+            CHECK(d.y <= node.halfSize * 1.0001f);
+            CHECK(d.z <= node.halfSize * 1.0001f);
+            if (i > node.first) {
+                const uint32_t prev = octree.order()[i - 1];
+                CHECK(stars.magnitudes[prev] <= stars.magnitudes[star]);
+            }
+        }
+    }
+}
+
+TEST_CASE("StarLodOctree: Select", "[starlodoctree]") {
+    const Stars stars = createStars(10000);
+    const StarLodOctree octree = StarLodOctree(stars.positions, stars.magnitudes, 64);
+
+    const glm::dvec3 eye = glm::dvec3(0.0, -300.0, 0.0);
+    const glm::dmat4 mvp = viewProjection(eye, glm::dvec3(0.0));
+
+    StarLodOctree::Selection all;
+    octree.select(eye, mvp, 1000.f, all);
+    CHECK(all.nStars == stars.positions.size());
+
+    // With a lower limiting magnitude, every star that would be visible must still be
+    // part of the selection
+    constexpr float Limit = 12.f;
+    StarLodOctree::Selection selection;
+    octree.select(eye, mvp, Limit, selection);
+    CHECK(selection.nStars < all.nStars);
+
+    std::vector<bool> selected(stars.positions.size(), false);
+    for (size_t i = 0; i < selection.first.size(); i++) {
+        for (int32_t j = 0; j < selection.count[i]; j++) {
+            selected[octree.order()[selection.first[i] + j]] = true;
+        }
+    }
+    for (size_t i = 0; i < stars.positions.size(); i++) {
+        const double d = glm::distance(glm::dvec3(stars.positions[i]), eye);
+        const double apparent = stars.magnitudes[i] + 5.0 * std::log10(d) - 5.0;
+        if (apparent <= Limit) {
+            CHECK(selected[i]);
+        }
+    }
+
+    // Looking away from the stars should not select anything
+    StarLodOctree::Selection away;
+    octree.select(eye, viewProjection(eye, eye * 2.0), 1000.f, away);
+    CHECK(away.nStars == 0);
+}
+
+TEST_CASE("StarLodOctree: Cache", "[starlodoctree]") {
+    const Stars stars = createStars(5000);
+    const StarLodOctree octree = StarLodOctree(stars.positions, stars.magnitudes, 64);
+
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "test_starlodoctree.cache";
+    octree.saveCache(path);
+
+    const std::optional<StarLodOctree> loaded = StarLodOctree::loadCache(path, 5000);
+    REQUIRE(loaded.has_value());
+    CHECK(loaded->order() == octree.order());
+    CHECK(loaded->nodes().size() == octree.nodes().size());
+
+    // A cache for a different number of stars has to be rejected
+    CHECK(!StarLodOctree::loadCache(path, 4999).has_value());
+
+    std::filesystem::remove(path);
+}
+#endif // OPENSPACE_MODULE_SPACE_ENABLED
@@ -0,0 +1,188 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_MULTIRESVOLUME_ENABLED
+#include <modules/multiresvolume/rendering/tferrorweights.h>
+#include <openspace/util/histogram.h>
+#include <ghoul/format.h>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    constexpr int NBins = 50;
+
+    std::vector<float> randomGradients(size_t n, std::mt19937& rng) {
+        std::uniform_real_distribution<float> dist(0.f, 1.f);
+        std::vector<float> gradients(n);
+        for (float& g : gradients) {
+            g = dist(rng);
+        }
+        return gradients;
+    }
+
+    // Histograms are not safe to move, so they are created in place
+    std::vector<Histogram> randomHistograms(size_t n, std::mt19937& rng) {
+        std::uniform_real_distribution<float> dist(0.f, 1.f);
+        std::vector<Histogram> histograms;
+        histograms.reserve(n);
+        for (size_t i = 0; i < n; i++) {
+            Histogram& h = histograms.emplace_back(0.f, 1.f, NBins);
+            for (int j = 0; j < 20; j++) {
+                h.add(dist(rng), dist(rng));
+            }
+        }
+        return histograms;
+    }
+
+    // The error as the brick selectors computed it by sampling the histogram per texel
+    float sampledError(const Histogram& histogram, const std::vector<float>& gradients) {
+        const size_t tfWidth = gradients.size() + 1;
+        float error = 0.f;
+        for (size_t i = 0; i < gradients.size(); i++) {
+            const float x = (i + 0.5f) / tfWidth;
+            error += histogram.interpolate(x) * gradients[i];
+        }
+        return error;
+    }
+} // namespace
+
+TEST_CASE("TfErrorWeights: Matches Sampled Error", "[tferrorweights]") {
+    std::mt19937 rng = std::mt19937(1337);
+    const std::vector<Histogram> histograms = randomHistograms(20, rng);
+
+    for (size_t width : { 2, 16, 50, 51, 512 }) {
+        const std::vector<float> gradients = randomGradients(width - 1, rng);
+        TfErrorWeights weights;
+        const TfErrorWeights::Change change = weights.update(gradients, NBins, 0.f, 1.f);
+        CHECK(change.isComplete);
+        CHECK(change.firstBin == 0);
+        CHECK(change.endBin == NBins);
+
+        for (const Histogram& h : histograms) {
+            const float expected = sampledError(h, gradients);
+            CHECK(weights.error(h) == Catch::Approx(expected).epsilon(1e-4));
+        }
+    }
+}
+
+TEST_CASE("TfErrorWeights: Incremental Update", "[tferrorweights]") {
+    std::mt19937 rng = std::mt19937(1337);
+    const std::vector<Histogram> histograms = randomHistograms(20, rng);
+
+    std::vector<float> gradients = randomGradients(511, rng);
+    TfErrorWeights weights;
+    weights.update(gradients, NBins, 0.f, 1.f);
+    std::vector<float> errors;
+    for (const Histogram& h : histograms) {
+        errors.push_back(weights.error(h));
+    }
+
+    // Nothing changed
+    CHECK(weights.update(gradients, NBins, 0.f, 1.f).isEmpty());
+
+    // Changing a part of the transfer function only affects the bins around it
+    for (int edit = 0; edit < 10; edit++) {
+        std::uniform_int_distribution<size_t> start(0, 450);
+        const size_t first = start(rng);
+        for (size_t i = first; i < first + 40; i++) {
+            gradients[i] = std::uniform_real_distribution<float>(0.f, 1.f)(rng);
+        }
+
+        const TfErrorWeights::Change change = weights.update(gradients, NBins, 0.f, 1.f);
+        CHECK_FALSE(change.isComplete);
+        CHECK_FALSE(change.isEmpty());
+        CHECK(change.endBin - change.firstBin <= 6);
+        for (size_t i = 0; i < histograms.size(); i++) {
+            errors[i] += weights.errorChange(histograms[i], change);
+            const float expected = sampledError(histograms[i], gradients);
+            CHECK(errors[i] == Catch::Approx(expected).epsilon(1e-4));
+            CHECK(weights.error(histograms[i]) == Catch::Approx(expected).epsilon(1e-4));
+        }
+    }
+
+    // A transfer function with a different width requires all errors to be recomputed
+    CHECK(weights.update(randomGradients(255, rng), NBins, 0.f, 1.f).isComplete);
+}
+
+TEST_CASE("TfErrorWeights: Update Cost", "[tferrorweights][.benchmark]") {
+    // The histograms of the inner nodes of a TSP with 8x8x8 bricks and 64 timesteps
+    constexpr size_t NOctreeNodes = 1 + 8 + 64;
+    constexpr size_t NBstNodes = 2 * 64 - 1;
+    constexpr size_t TfWidth = 1024;
+
+    std::mt19937 rng = std::mt19937(1337);
+    const std::vector<Histogram> histograms = randomHistograms(
+        NOctreeNodes * NBstNodes,
+        rng
+    );
+    std::vector<float> gradients = randomGradients(TfWidth - 1, rng);
+    std::vector<float> errors(histograms.size());
+
+    auto measure = [](auto&& function) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const std::chrono::duration<double, std::milli> duration =
+            std::chrono::steady_clock::now() - start;
+        return duration.count();
+    };
+
+    const double sampled = measure([&]() {
+        for (size_t i = 0; i < histograms.size(); i++) {
+            errors[i] = sampledError(histograms[i], gradients);
+        }
+    });
+
+    TfErrorWeights weights;
+    const double complete = measure([&]() {
+        weights.update(gradients, NBins, 0.f, 1.f);
+        for (size_t i = 0; i < histograms.size(); i++) {
+            errors[i] = weights.error(histograms[i]);
+        }
+    });
+
+    // Editing a single mapping key changes about a twentieth of the transfer function
+    for (size_t i = 500; i < 550; i++) {
+        gradients[i] *= 0.5f;
+    }
+    const double incremental = measure([&]() {
+        const TfErrorWeights::Change change = weights.update(gradients, NBins, 0.f, 1.f);
+        for (size_t i = 0; i < histograms.size(); i++) {
+            errors[i] += weights.errorChange(histograms[i], change);
+        }
+    });
+
+    WARN(std::format(
+        "Errors of {} bricks: {:.2f} ms sampled, {:.2f} ms from bins, {:.2f} ms for an "
+        "edit",
+        histograms.size(), sampled, complete, incremental
+    ));
+}
+
+#endif // OPENSPACE_MODULE_MULTIRESVOLUME_ENABLED
@@ -0,0 +1,109 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <openspace/rendering/transferfunction.h>
+#include <sstream>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    PiecewiseTransferFunction parse(const std::string& source) {
+        std::istringstream stream = std::istringstream(source);
+        return parseTransferFunction(stream);
+    }
+} // namespace
+
+TEST_CASE("TransferFunction: Parse", "[transferfunction]") {
+    const PiecewiseTransferFunction tf = parse(
+        "width 128\n"
+        "lower 0.2\n"
+        "upper 0.8\n"
+        "mappingkey 0.6 0 0 255 255\n"
+        "mappingkey 0.4 255 0 0 128\n"
+    );
+
+    CHECK(tf.width == 128);
+    CHECK(tf.lower == Catch::Approx(0.2f));
+    CHECK(tf.upper == Catch::Approx(0.8f));
+
+    // The keys are sorted and extended to cover the lower and upper bounds
+    REQUIRE(tf.keys.size() == 4);
+    CHECK(tf.keys[0].position == Catch::Approx(0.2f));
+    CHECK(tf.keys[0].color.r == 255.f);
+    CHECK(tf.keys[1].position == Catch::Approx(0.4f));
+    CHECK(tf.keys[2].position == Catch::Approx(0.6f));
+    CHECK(tf.keys[3].position == Catch::Approx(0.8f));
+    CHECK(tf.keys[3].color.b == 255.f);
+
+    CHECK(parse("width 64\n").keys.empty());
+}
+
+TEST_CASE("TransferFunction: Bake", "[transferfunction]") {
+    const PiecewiseTransferFunction tf = parse(
+        "lower 0.25\n"
+        "mappingkey 0.5 255 0 0 255\n"
+        "mappingkey 1.0 0 255 0 0\n"
+    );
+
+    const std::vector<float> texels = bakeTransferFunction(tf, 5);
+    REQUIRE(texels.size() == 20);
+
+    // Below the lower bound
+    CHECK(texels[0] == 0.f);
+    CHECK(texels[3] == 0.f);
+
+    // Between the lower bound and the first key
+    CHECK(texels[4] == Catch::Approx(1.f));
+    CHECK(texels[7] == Catch::Approx(1.f));
+
+    // Halfway between the keys the colors are premultiplied with the alpha value
+    CHECK(texels[12] == Catch::Approx(0.25f));
+    CHECK(texels[13] == Catch::Approx(0.25f));
+    CHECK(texels[14] == Catch::Approx(0.f));
+    CHECK(texels[15] == Catch::Approx(0.5f));
+
+    CHECK(texels[19] == Catch::Approx(0.f));
+}
+
+TEST_CASE("TransferFunction: Adaptive Width", "[transferfunction]") {
+    const PiecewiseTransferFunction smooth = parse(
+        "mappingkey 0.0 0 0 0 255\n"
+        "mappingkey 1.0 255 255 255 255\n"
+    );
+    CHECK(adaptiveTransferFunctionWidth(smooth, 1.f / 512.f) == 16);
+
+    const PiecewiseTransferFunction sharp = parse(
+        "mappingkey 0.0 0 0 0 0\n"
+        "mappingkey 0.501 0 0 0 0\n"
+        "mappingkey 0.502 255 255 255 255\n"
+        "mappingkey 1.0 255 255 255 255\n"
+    );
+    const int width = adaptiveTransferFunctionWidth(sharp, 1.f / 512.f, 16, 1 << 16);
+    CHECK(width > 512);
+    CHECK(adaptiveTransferFunctionWidth(sharp, 1.f / 512.f, 16, 1024) == 1024);
+}
@@ -0,0 +1,218 @@
+/*****************************************************************************************
+ *                                                                                       *
+ * OpenSpace                                                                             *
+ *                                                                                       *
+ * Copyright (c) 2014-2025                                                               *
+ *                                                                                       *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this  *
+ * software and associated documentation files (the "Software"), to deal in the Software *
+ * without restriction, including without limitation the rights to use, copy, modify,    *
+ * merge, publish, distribute, sublicense, and/or sell copies of the Software, and to    *
+ * permit persons to whom the Software is furnished to do so, subject to the following   *
+ * conditions:                                                                           *
+ *                                                                                       *
+ * The above copyright notice and this permission notice shall be included in all copies *
+ * or substantial portions of the Software.                                              *
+ *                                                                                       *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,   *
+ * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A         *
+ * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT    *
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF  *
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE  *
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                                         *
+ ****************************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef OPENSPACE_MODULE_KAMELEON_ENABLED
+#include <modules/kameleon/include/uniformgridsampler.h>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace openspace;
+
+namespace {
+    // Large enough to be split into several slabs
+    constexpr glm::size3_t Dimensions = glm::size3_t(300, 64, 40);
+
+    size_t linearIndex(const glm::size3_t& index) {
+        return index.x + Dimensions.x * (index.y + Dimensions.y * index.z);
+    }
+
+    // Every sampler writes the linear index of the voxel and the index of the sampler,
+    // and records which threads it was called from
+    struct SamplerRecord {
+        std::mutex mutex;
+        std::set<std::thread::id> threads;
+    };
+
+    std::vector<VoxelSampler> createSamplers(size_t n,
+                                             std::vector<SamplerRecord>& records)
+    {
+        std::vector<VoxelSampler> samplers;
+        for (size_t i = 0; i < n; i++) {
+            SamplerRecord* record = &records[i];
+            samplers.emplace_back([i, record](const glm::size3_t& index, float* out) {
+                out[0] = static_cast<float>(linearIndex(index));
+                out[1] = static_cast<float>(i);
+                const std::lock_guard lock(record->mutex);
+                record->threads.insert(std::this_thread::get_id());
+            });
+        }
+        return samplers;
+    }
+} // namespace
+
+TEST_CASE("UniformGridSampler: Order", "[uniformgridsampler]") {
+    SamplingOptions options;
+    std::vector<float> progress;
+    options.progress = [&progress](float p) { progress.push_back(p); };
+    options.nThreads = 4;
+
+    const size_t nThreads = nSamplingThreads(Dimensions, options);
+    REQUIRE(nThreads == 4);
+    std::vector<SamplerRecord> records(nThreads);
+    const std::vector<VoxelSampler> samplers = createSamplers(nThreads, records);
+
+    const std::thread::id callingThread = std::this_thread::get_id();
+    size_t next = 0;
+    bool isInOrder = true;
+    bool isOnCallingThread = true;
+    std::set<size_t> usedSamplers;
+    const bool isComplete = sampleUniformGrid(
+        Dimensions,
+        2,
+        samplers,
+        [&](size_t first, std::span<const float> values) {
+            // The slabs have to arrive in order and without gaps
+            isInOrder &= first == next;
+            isInOrder &= values.size() % 2 == 0;
+            for (size_t i = 0; i < values.size() / 2; i++) {
+                isInOrder &= values[2 * i] == static_cast<float>(first + i);
+                usedSamplers.insert(static_cast<size_t>(values[2 * i + 1]));
+            }
+            next = first + values.size() / 2;
+            isOnCallingThread &= std::this_thread::get_id() == callingThread;
+        },
+        options
+    );
+
+    CHECK(isComplete);
+    CHECK(isInOrder);
+    CHECK(isOnCallingThread);
+    CHECK(next == Dimensions.x * Dimensions.y * Dimensions.z);
+
+    // Every sampler is used by a single worker thread only
+    CHECK(usedSamplers.size() <= nThreads);
+    for (const SamplerRecord& record : records) {
+        CHECK(record.threads.size() <= 1);
+        CHECK_FALSE(record.threads.contains(callingThread));
+    }
+
+    REQUIRE(progress.size() > 1);
+    for (size_t i = 1; i < progress.size(); i++) {
+        CHECK(progress[i] > progress[i - 1]);
+    }
+    CHECK(progress.back() == 1.f);
+}
+
+TEST_CASE("UniformGridSampler: Empty Grid", "[uniformgridsampler]") {
+    const glm::size3_t dimensions = glm::size3_t(0, 10, 10);
+    const SamplingOptions options;
+    REQUIRE(nSamplingThreads(dimensions, options) == 0);
+
+    bool hasConsumed = false;
+    const bool isComplete = sampleUniformGrid(
+        dimensions,
+        1,
+        std::vector<VoxelSampler>(),
+        [&hasConsumed](size_t, std::span<const float>) { hasConsumed = true; },
+        options
+    );
+    CHECK(isComplete);
+    CHECK_FALSE(hasConsumed);
+}
+
+TEST_CASE("UniformGridSampler: Cancel", "[uniformgridsampler]") {
+    std::atomic_bool cancel = false;
+    SamplingOptions options;
+    options.cancel = &cancel;
+    options.nThreads = 2;
+
+    const size_t nThreads = nSamplingThreads(Dimensions, options);
+    std::vector<SamplerRecord> records(nThreads);
+    const std::vector<VoxelSampler> samplers = createSamplers(nThreads, records);
+
+    size_t nSlabs = 0;
+    const bool isComplete = sampleUniformGrid(
+        Dimensions,
+        2,
+        samplers,
+        [&](size_t, std::span<const float>) {
+            nSlabs++;
+            cancel = true;
+        },
+        options
+    );
+    CHECK_FALSE(isComplete);
+    CHECK(nSlabs == 1);
+}
+
+TEST_CASE("UniformGridSampler: Sampler Exception", "[uniformgridsampler]") {
+    SamplingOptions options;
+    options.nThreads = 3;
+
+    const size_t nThreads = nSamplingThreads(Dimensions, options);
+    std::vector<VoxelSampler> samplers;
+    for (size_t i = 0; i < nThreads; i++) {
+        samplers.emplace_back([](const glm::size3_t& index, float* out) {
+            if (index == glm::size3_t(10, 20, 30)) {
+                throw std::runtime_error("Sampling failed");
+            }
+            *out = 0.f;
+        });
+    }
+
+    size_t next = 0;
+    CHECK_THROWS_AS(
+        sampleUniformGrid(
+            Dimensions,
+            1,
+            samplers,
+            [&next](size_t, std::span<const float> values) { next += values.size(); },
+            options
+        ),
+        std::runtime_error
+    );
+    // No slab at or after the one containing the failing voxel may have been consumed
+    CHECK(next <= linearIndex(glm::size3_t(10, 20, 30)));
+}
+
+TEST_CASE("UniformGridSampler: Consumer Exception", "[uniformgridsampler]") {
+    SamplingOptions options;
+    options.nThreads = 2;
+
+    const size_t nThreads = nSamplingThreads(Dimensions, options);
+    std::vector<SamplerRecord> records(nThreads);
+    const std::vector<VoxelSampler> samplers = createSamplers(nThreads, records);
+
+    // The worker threads have to be stopped before the exception is passed on
+    CHECK_THROWS_AS(
+        sampleUniformGrid(
+            Dimensions,
+            2,
+            samplers,
+            [](size_t, std::span<const float>) {
+                throw std::runtime_error("Consuming failed");
+            },
+            options
+        ),
+        std::runtime_error
+    );
+}
+
+#endif // OPENSPACE_MODULE_KAMELEON_ENABLED